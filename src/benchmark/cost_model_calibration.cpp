@@ -0,0 +1,172 @@
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+
+#include "cxxopts.hpp"
+
+#include "constant_mappings.hpp"
+#include "cost_model/cost_model_calibration.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/product.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_positions.hpp"
+#include "storage/encoding_type.hpp"
+#include "table_generator.hpp"
+#include "utils/assert.hpp"
+
+/**
+ * Calibrates the weights of the CostModelRuntime for the machine it is running on.
+ *
+ * The calibration executes the Operators costed by the CostModelRuntime on tables of different sizes generated by the
+ * TableGenerator, on data as well as on reference tables, and with different selectivities. Their measured walltimes
+ * are then fitted to the CostFeatures by the CostModelCalibration. The resulting config is written as JSON and can be
+ * loaded with import_cost_model_runtime_config().
+ *
+ * Since the CostFeatures don't contain the encoding of the scanned columns, the tables are encoded with the encoding
+ * that should be calibrated for (--encoding).
+ */
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// JoinNestedLoop and Product have quadratic runtime, only measure them for small inputs
+constexpr auto MAX_QUADRATIC_INPUT_ROW_COUNT = size_t{2'000};
+
+std::shared_ptr<TableWrapper> make_table_wrapper(const size_t row_count, const size_t distinct_value_count,
+                                                 const size_t chunk_size, const EncodingType encoding_type) {
+  const auto distribution =
+      ColumnDataDistribution::make_uniform_config(0.0, static_cast<double>(std::max(distinct_value_count, size_t{1})));
+  auto table = TableGenerator{}.generate_table({distribution, distribution}, row_count, chunk_size, encoding_type);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+std::shared_ptr<TableScan> make_scan(const std::shared_ptr<const AbstractOperator>& input, const size_t row_count,
+                                     const float selectivity) {
+  // Values are uniformly distributed in [0, row_count), so a LessThan-scan emits roughly selectivity * row_count rows
+  const auto threshold = static_cast<int32_t>(selectivity * static_cast<float>(row_count));
+  auto table_scan = std::make_shared<TableScan>(input, ColumnID{0}, PredicateCondition::LessThan, threshold);
+  table_scan->execute();
+  return table_scan;
+}
+
+template <typename JoinOperator>
+void measure_join(CostModelCalibration& calibration, const std::shared_ptr<const AbstractOperator>& left,
+                  const std::shared_ptr<const AbstractOperator>& right, const PredicateCondition predicate_condition) {
+  const auto join = std::make_shared<JoinOperator>(left, right, JoinMode::Inner, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+                                                   predicate_condition);
+  join->execute();
+  calibration.add_sample(join);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  cxxopts::Options cli_options{"Hyrise CostModelRuntime Calibration"};
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "print this help message")
+    ("o,output", "File to write the calibrated config to", cxxopts::value<std::string>()->default_value("cost_model_runtime_config.json")) // NOLINT
+    ("r,repetitions", "Number of times each measurement is repeated", cxxopts::value<size_t>()->default_value("5")) // NOLINT
+    ("max_row_count", "Row count of the largest generated table", cxxopts::value<size_t>()->default_value("1000000")) // NOLINT
+    ("c,chunk_size", "Chunk size of the generated tables", cxxopts::value<size_t>()->default_value("100000")) // NOLINT
+    ("e,encoding", "Encoding of the generated tables (default: dictionary)", cxxopts::value<std::string>()->default_value("dictionary")); // NOLINT
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+
+  if (cli_parse_result.count("help")) {
+    std::cout << cli_options.help({}) << std::endl;
+    return 0;
+  }
+
+  const auto output_path = cli_parse_result["output"].as<std::string>();
+  const auto repetitions = cli_parse_result["repetitions"].as<size_t>();
+  const auto max_row_count = cli_parse_result["max_row_count"].as<size_t>();
+  const auto chunk_size = cli_parse_result["chunk_size"].as<size_t>();
+
+  const auto encoding_string = cli_parse_result["encoding"].as<std::string>();
+  auto encoding_type = std::optional<EncodingType>{};
+  for (const auto& [candidate_encoding_type, candidate_encoding_string] : encoding_type_to_string) {
+    if (boost::algorithm::iequals(candidate_encoding_string, encoding_string)) encoding_type = candidate_encoding_type;
+  }
+  Assert(encoding_type, "Unknown encoding: " + encoding_string);
+
+  std::cout << "- Calibrating CostModelRuntime for " << encoding_type_to_string.at(*encoding_type)
+            << " encoding, tables with up to " << max_row_count << " rows, " << repetitions << " repetitions"
+            << std::endl;
+
+  auto calibration = CostModelCalibration{};
+
+  const auto selectivities = std::vector<float>{0.01f, 0.1f, 0.5f, 0.9f};
+
+  for (auto row_count = size_t{1'000}; row_count <= max_row_count; row_count *= 10) {
+    std::cout << "- Measuring tables with " << row_count << " rows" << std::endl;
+
+    // The right table is ten times smaller than the left one, so that equi joins emit roughly its row count
+    const auto left = make_table_wrapper(row_count, row_count, chunk_size, *encoding_type);
+    const auto right = make_table_wrapper(std::max(row_count / 10, size_t{1}), row_count, chunk_size, *encoding_type);
+
+    for (auto repetition = size_t{0}; repetition < repetitions; ++repetition) {
+      for (const auto selectivity : selectivities) {
+        // Scans on data tables and on reference tables
+        const auto data_scan = make_scan(left, row_count, selectivity);
+        calibration.add_sample(data_scan);
+
+        const auto reference_scan = make_scan(make_scan(left, row_count, 0.5f), row_count, selectivity);
+        calibration.add_sample(reference_scan);
+
+        const auto other_scan = make_scan(left, row_count, 1.0f - selectivity);
+        const auto union_positions = std::make_shared<UnionPositions>(data_scan, other_scan);
+        union_positions->execute();
+        calibration.add_sample(union_positions);
+      }
+
+      // Joins on data tables
+      measure_join<JoinHash>(calibration, left, right, PredicateCondition::Equals);
+      measure_join<JoinSortMerge>(calibration, left, right, PredicateCondition::Equals);
+
+      // Joins on reference tables
+      const auto left_references = make_scan(left, row_count, 0.5f);
+      const auto right_references = make_scan(right, row_count, 0.5f);
+      measure_join<JoinHash>(calibration, left_references, right_references, PredicateCondition::Equals);
+      measure_join<JoinSortMerge>(calibration, left_references, right_references, PredicateCondition::Equals);
+
+      if (row_count <= MAX_QUADRATIC_INPUT_ROW_COUNT) {
+        measure_join<JoinNestedLoop>(calibration, left, right, PredicateCondition::Equals);
+        measure_join<JoinNestedLoop>(calibration, left_references, right_references, PredicateCondition::LessThan);
+
+        const auto product = std::make_shared<Product>(left, right);
+        product->execute();
+        calibration.add_sample(product);
+      }
+    }
+  }
+
+  const auto config = calibration.fit();
+
+  for (const auto& [operator_type, feature_weights] : config.operator_feature_weights) {
+    std::cout << "- " << operator_type_to_string.left.at(operator_type) << " ("
+              << calibration.sample_count(operator_type) << " samples)" << std::endl;
+    for (const auto& [cost_feature, weight] : feature_weights) {
+      std::cout << "    " << cost_feature_to_string.left.at(cost_feature) << ": " << weight << std::endl;
+    }
+  }
+
+  export_cost_model_runtime_config(config, output_path);
+  std::cout << "- Wrote config to '" << output_path << "'" << std::endl;
+
+  return 0;
+}
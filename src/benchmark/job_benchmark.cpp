@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark_runner.hpp"
+#include "cxxopts.hpp"
+#include "job/job_loader.hpp"
+#include "json.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+
+/**
+ * This benchmark measures Hyrise's performance executing the queries of the Join Order Benchmark (JOB), which join up
+ * to 17 tables of the IMDB dataset. The dataset and the queries are read from the local CSV and .sql files of the JOB
+ * repository (see job_loader.hpp). As many JOB queries use features that Hyrise does not support yet (e.g., IN and OR),
+ * the queries to run can be selected by name.
+ */
+
+int main(int argc, char* argv[]) {
+  auto cli_options = opossum::BenchmarkRunner::get_default_cli_options("JOB Benchmark");
+
+  // clang-format off
+  cli_options.add_options()
+      ("tables", "Directory with the CSV files of the IMDB tables (e.g., title.csv)", cxxopts::value<std::string>()) // NOLINT
+      ("queries", "Directory with the JOB queries (e.g., 1a.sql)", cxxopts::value<std::string>()) // NOLINT
+      ("query_names", "Specify queries to run (e.g., 1a,17b), default is all queries in the directory", cxxopts::value<std::vector<std::string>>()); // NOLINT
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+
+  // Display usage and quit
+  if (cli_parse_result.count("help")) {
+    std::cout << cli_options.help({}) << std::endl;
+    return 0;
+  }
+
+  if (cli_parse_result.count("queries") == 0 || cli_parse_result.count("tables") == 0) {
+    std::cerr << "Need to specify --queries=path/to/queries and --tables=path/to/tables" << std::endl;
+    std::cerr << cli_options.help({}) << std::endl;
+    return 1;
+  }
+
+  const bool verbose = cli_parse_result["verbose"].as<bool>();
+  auto& out = opossum::get_out_stream(verbose);
+
+  const auto config = opossum::BenchmarkRunner::parse_default_cli_options(cli_parse_result, cli_options);
+
+  auto queries = opossum::load_job_queries(cli_parse_result["queries"].as<std::string>());
+
+  if (cli_parse_result.count("query_names")) {
+    const auto query_names = cli_parse_result["query_names"].as<std::vector<std::string>>();
+    const auto is_not_selected = [&](const auto& named_query) {
+      return std::none_of(query_names.begin(), query_names.end(),
+                          [&](const auto& query_name) { return named_query.first == "JOB " + query_name; });
+    };
+    queries.erase(std::remove_if(queries.begin(), queries.end(), is_not_selected), queries.end());
+  }
+
+  out << "- Benchmarking Queries ";
+  for (const auto& named_query : queries) {
+    out << named_query.first << " ";
+  }
+  out << std::endl;
+
+  const auto table_path = cli_parse_result["tables"].as<std::string>();
+  config.out << "- Loading JOB Tables from " << table_path << "..." << std::endl;
+
+  for (const auto& [table_name, table] : opossum::load_job_tables(table_path, config.chunk_size)) {
+    if (config.encoding_type != opossum::EncodingType::Unencoded) {
+      opossum::ChunkEncoder::encode_all_chunks(table, opossum::ColumnEncodingSpec{config.encoding_type});
+    }
+
+    opossum::StorageManager::get().add_table(table_name, table);
+    config.out << "- Adding table '" << table_name << "'" << std::endl;
+  }
+  config.out << "- Done." << std::endl;
+
+  auto context = opossum::BenchmarkRunner::create_context(config);
+
+  // Run the benchmark
+  opossum::BenchmarkRunner(config, queries, context).run();
+}
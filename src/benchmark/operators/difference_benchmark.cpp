@@ -4,6 +4,7 @@
 
 #include "../benchmark_basic_fixture.hpp"
 #include "operators/difference.hpp"
+#include "operators/set_operation_hash.hpp"
 #include "operators/table_wrapper.hpp"
 #include "table_generator.hpp"
 
@@ -19,4 +20,28 @@ BENCHMARK_F(BenchmarkBasicFixture, BM_Difference)(benchmark::State& state) {
   }
 }
 
+BENCHMARK_F(BenchmarkBasicFixture, BM_SetOperationHashExceptAll)(benchmark::State& state) {
+  clear_cache();
+  auto warm_up = std::make_shared<SetOperationHash>(_table_wrapper_a, _table_wrapper_b, SetOperationType::Except,
+                                                    SetOperationMode::All);
+  warm_up->execute();
+  while (state.KeepRunning()) {
+    auto set_operation = std::make_shared<SetOperationHash>(_table_wrapper_a, _table_wrapper_b,
+                                                            SetOperationType::Except, SetOperationMode::All);
+    set_operation->execute();
+  }
+}
+
+BENCHMARK_F(BenchmarkBasicFixture, BM_SetOperationHashIntersectDistinct)(benchmark::State& state) {
+  clear_cache();
+  auto warm_up = std::make_shared<SetOperationHash>(_table_wrapper_a, _table_wrapper_b, SetOperationType::Intersect,
+                                                    SetOperationMode::Distinct);
+  warm_up->execute();
+  while (state.KeepRunning()) {
+    auto set_operation = std::make_shared<SetOperationHash>(_table_wrapper_a, _table_wrapper_b,
+                                                            SetOperationType::Intersect, SetOperationMode::Distinct);
+    set_operation->execute();
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "operators/aggregate.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/topology.hpp"
+#include "scheduler/worker.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "table_generator.hpp"
+#include "utils/numa_memory_resource.hpp"
+
+namespace {
+// 40,000 rows per table (see TableGenerator), i.e., 40 chunks that are distributed across the nodes
+const auto CHUNK_SIZE = opossum::ChunkID{1000};
+const auto FAKE_NODE_COUNT = 4u;
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Runs operators on a fake NUMA topology (see Topology::create_fake_numa_topology()) to validate that the per-chunk
+ * jobs are dispatched to the node a chunk is placed on. With an argument of 1, the chunks of the input tables are
+ * placed round robin on the nodes, with 0 they are not bound to a node and the jobs are scheduled on the node of the
+ * scheduling thread. Without NUMA support, the memory is not actually moved, so the benchmark measures the overhead
+ * of the dispatch and reports the share of jobs that were executed on the node of their chunk. With NUMA support, the
+ * machine needs at least FAKE_NODE_COUNT nodes.
+ */
+class NUMAPlacementBenchmarkFixture : public benchmark::Fixture {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    const auto worker_count = std::max(1u, std::thread::hardware_concurrency() - 1);
+    const auto workers_per_node = (worker_count + FAKE_NODE_COUNT - 1) / FAKE_NODE_COUNT;
+    CurrentScheduler::set(
+        std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(worker_count, workers_per_node)));
+    _node_count = CurrentScheduler::get()->topology()->nodes().size();
+
+    auto table_generator = std::make_shared<TableGenerator>();
+    _table_wrapper_a = _make_table_wrapper(table_generator->generate_table(CHUNK_SIZE, EncodingType::Dictionary),
+                                           state.range(0) == 1);
+    _table_wrapper_b = _make_table_wrapper(table_generator->generate_table(CHUNK_SIZE, EncodingType::Dictionary),
+                                           state.range(0) == 1);
+  }
+
+  void TearDown(::benchmark::State&) override {
+    CurrentScheduler::set(nullptr);
+    StorageManager::get().reset();
+  }
+
+ protected:
+  std::shared_ptr<TableWrapper> _make_table_wrapper(const std::shared_ptr<Table>& table, const bool place_chunks) {
+    if (place_chunks) {
+      for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        table->get_chunk(chunk_id)->migrate(_memory_resource(chunk_id % _node_count));
+      }
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // The memory resources must outlive all tables, so they are never destroyed
+  static NUMAMemoryResource* _memory_resource(const size_t node_id) {
+    static auto memory_resources = [] {
+      auto resources = std::vector<std::unique_ptr<NUMAMemoryResource>>{};
+      for (auto resource_node_id = 0u; resource_node_id < FAKE_NODE_COUNT; ++resource_node_id) {
+        resources.emplace_back(std::make_unique<NUMAMemoryResource>(
+            resource_node_id, "numa_placement_benchmark_" + std::to_string(resource_node_id)));
+      }
+      return resources;
+    }();
+    return memory_resources.at(node_id).get();
+  }
+
+  size_t _node_count = 1;
+  std::shared_ptr<TableWrapper> _table_wrapper_a;
+  std::shared_ptr<TableWrapper> _table_wrapper_b;
+};
+
+BENCHMARK_DEFINE_F(NUMAPlacementBenchmarkFixture, BM_NUMAPlacement_Dispatch)(benchmark::State& state) {
+  const auto table = _table_wrapper_a->get_output();
+
+  auto local_job_count = std::atomic_size_t{0};
+  auto job_count = size_t{0};
+
+  while (state.KeepRunning()) {
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto node_id = table->get_chunk(chunk_id)->node_id();
+      jobs.emplace_back(std::make_shared<JobTask>([&, node_id]() {
+        const auto worker = Worker::get_this_thread_worker();
+        if (worker && worker->queue()->node_id() == node_id) ++local_job_count;
+      }, node_id));
+    }
+
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+    job_count += jobs.size();
+  }
+
+  // Jobs may still be stolen by idle workers of other nodes
+  state.counters["local_job_share"] = static_cast<double>(local_job_count) / std::max(job_count, size_t{1});
+}
+
+BENCHMARK_DEFINE_F(NUMAPlacementBenchmarkFixture, BM_NUMAPlacement_TableScan)(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    auto table_scan =
+        std::make_shared<TableScan>(_table_wrapper_a, ColumnID{0}, PredicateCondition::GreaterThanEquals, 7);
+    table_scan->execute();
+  }
+}
+
+BENCHMARK_DEFINE_F(NUMAPlacementBenchmarkFixture, BM_NUMAPlacement_Aggregate)(benchmark::State& state) {
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Min}};
+  const auto groupby = std::vector<ColumnID>{ColumnID{0}};
+
+  while (state.KeepRunning()) {
+    auto aggregate = std::make_shared<Aggregate>(_table_wrapper_a, aggregates, groupby);
+    aggregate->execute();
+  }
+}
+
+BENCHMARK_DEFINE_F(NUMAPlacementBenchmarkFixture, BM_NUMAPlacement_JoinHash)(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    auto join = std::make_shared<JoinHash>(_table_wrapper_a, _table_wrapper_b, JoinMode::Inner,
+                                           std::pair<ColumnID, ColumnID>{ColumnID{0}, ColumnID{0}},
+                                           PredicateCondition::Equals);
+    join->execute();
+  }
+}
+
+BENCHMARK_REGISTER_F(NUMAPlacementBenchmarkFixture, BM_NUMAPlacement_Dispatch)->Arg(0)->Arg(1);
+BENCHMARK_REGISTER_F(NUMAPlacementBenchmarkFixture, BM_NUMAPlacement_TableScan)->Arg(0)->Arg(1);
+BENCHMARK_REGISTER_F(NUMAPlacementBenchmarkFixture, BM_NUMAPlacement_Aggregate)->Arg(0)->Arg(1);
+BENCHMARK_REGISTER_F(NUMAPlacementBenchmarkFixture, BM_NUMAPlacement_JoinHash)->Arg(0)->Arg(1);
+
+}  // namespace opossum
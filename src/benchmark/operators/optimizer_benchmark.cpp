@@ -0,0 +1,120 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "SQLParser.h"
+#include "benchmark/benchmark.h"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/optimizer.hpp"
+#include "sql/sql_translator.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+#include "tpch/tpch_db_generator.hpp"
+#include "tpch/tpch_queries.hpp"
+
+namespace opossum {
+
+using hsql::SQLParser;
+using hsql::SQLParserResult;
+
+/**
+ * Measures the time the default Optimizer needs for an LQP, without translating or executing it. Each iteration
+ * optimizes a fresh deep_copy() of the LQP, since the Optimizer modifies the LQP it is given.
+ */
+class OptimizerBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(benchmark::State& st) override {
+    // The SQLTranslator and the statistics need the tables to exist, their size doesn't matter for the Optimizer
+    TpchDbGenerator{0.001f}.generate_and_store();
+    _optimizer = Optimizer::create_default_optimizer();
+  }
+
+  void TearDown(benchmark::State&) override { StorageManager::get().reset(); }
+
+  void BM_Optimize(benchmark::State& st, const std::shared_ptr<AbstractLQPNode>& lqp) {
+    while (st.KeepRunning()) {
+      st.PauseTiming();
+      const auto lqp_copy = lqp->deep_copy();
+      st.ResumeTiming();
+
+      _optimizer->optimize(lqp_copy);
+    }
+  }
+
+  /**
+   * Creates a chain of num_joins + 1 MockNodes, cross joined in a left-deep tree, with the join predicates and a scan
+   * predicate per node placed on top of the cross joins. This is the shape the SQLTranslator produces for
+   * "SELECT * FROM t0, t1, ... WHERE t0.a = t1.b AND t1.a = t2.b AND ... AND t0.b > 10 AND ...", so the Optimizer has
+   * to push down all predicates and turn every cross join into an inner join.
+   */
+  static std::shared_ptr<AbstractLQPNode> make_join_chain(const size_t num_joins) {
+    std::vector<std::shared_ptr<MockNode>> mock_nodes;
+    for (auto node_idx = size_t{0}; node_idx <= num_joins; ++node_idx) {
+      // Vary the row counts, so that the predicates are not all equally selective
+      const auto row_count = static_cast<float>(100 + (node_idx * 37) % 1000);
+
+      std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
+      column_statistics.emplace_back(
+          std::make_shared<ColumnStatistics<int32_t>>(0.0f, row_count, 0, static_cast<int32_t>(row_count) - 1));
+      column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, row_count / 10, 0, 100));
+
+      mock_nodes.emplace_back(
+          MockNode::make(std::make_shared<TableStatistics>(TableType::Data, row_count, column_statistics)));
+    }
+
+    std::shared_ptr<AbstractLQPNode> lqp = mock_nodes.front();
+    for (auto node_idx = size_t{1}; node_idx <= num_joins; ++node_idx) {
+      const auto join_node = JoinNode::make(JoinMode::Cross);
+      join_node->set_left_input(lqp);
+      join_node->set_right_input(mock_nodes[node_idx]);
+      lqp = join_node;
+    }
+
+    for (auto node_idx = size_t{0}; node_idx <= num_joins; ++node_idx) {
+      const auto a = LQPColumnReference{mock_nodes[node_idx], ColumnID{0}};
+      const auto b = LQPColumnReference{mock_nodes[node_idx], ColumnID{1}};
+
+      if (node_idx < num_joins) {
+        const auto next_b = LQPColumnReference{mock_nodes[node_idx + 1], ColumnID{1}};
+        const auto join_predicate_node = PredicateNode::make(a, PredicateCondition::Equals, next_b);
+        join_predicate_node->set_left_input(lqp);
+        lqp = join_predicate_node;
+      }
+
+      const auto scan_predicate_node = PredicateNode::make(b, PredicateCondition::GreaterThan, 10);
+      scan_predicate_node->set_left_input(lqp);
+      lqp = scan_predicate_node;
+    }
+
+    return lqp;
+  }
+
+ protected:
+  std::shared_ptr<Optimizer> _optimizer;
+};
+
+BENCHMARK_DEFINE_F(OptimizerBenchmark, BM_OptimizeTPCH)(benchmark::State& st) {
+  // Not all TPC-H queries are supported yet, see tpch_queries.cpp
+  const auto query_iter = tpch_queries.find(static_cast<size_t>(st.range(0)));
+  if (query_iter == tpch_queries.end()) {
+    st.SkipWithError("TPC-H query not supported");
+    return;
+  }
+
+  SQLParserResult result;
+  SQLParser::parseSQLString(query_iter->second, &result);
+  const auto lqp = SQLTranslator{false}.translate_parse_result(result)[0];
+
+  BM_Optimize(st, lqp);
+}
+BENCHMARK_REGISTER_F(OptimizerBenchmark, BM_OptimizeTPCH)->DenseRange(1, 22);
+
+BENCHMARK_DEFINE_F(OptimizerBenchmark, BM_OptimizeJoinChain)(benchmark::State& st) {
+  BM_Optimize(st, make_join_chain(static_cast<size_t>(st.range(0))));
+}
+BENCHMARK_REGISTER_F(OptimizerBenchmark, BM_OptimizeJoinChain)->Arg(10)->Arg(25)->Arg(50);
+
+}  // namespace opossum
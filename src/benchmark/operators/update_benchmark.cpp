@@ -0,0 +1,100 @@
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/pqp_expression.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/update.hpp"
+#include "operators/validate.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "table_generator.hpp"
+#include "tasks/merge_value_deltas_task.hpp"
+
+namespace opossum {
+
+namespace {
+
+const auto ROW_COUNT = size_t{40'000};
+const auto CHUNK_SIZE = size_t{2'000};
+const auto TABLE_NAME = std::string{"update_benchmark_table"};
+
+// Creates a table with the given number of columns. Values are uniformly distributed in [0, 10000]. In-place updates
+// only apply to mutable chunks, so the table is only dictionary encoded if they are disabled.
+void create_table(const size_t column_count, const bool in_place_updates) {
+  const auto column_data_distributions =
+      std::vector<ColumnDataDistribution>(column_count, ColumnDataDistribution::make_uniform_config(0.0, 10'000.0));
+  const auto encoding_type = in_place_updates ? std::nullopt : std::optional<EncodingType>{EncodingType::Dictionary};
+  const auto generated_table =
+      TableGenerator{}.generate_table(column_data_distributions, ROW_COUNT, CHUNK_SIZE, encoding_type);
+
+  // Update requires MvccColumns, which the TableGenerator does not create
+  auto table = std::make_shared<Table>(generated_table->column_definitions(), TableType::Data, CHUNK_SIZE, UseMvcc::Yes);
+  for (ChunkID chunk_id{0}; chunk_id < generated_table->chunk_count(); ++chunk_id) {
+    table->append_chunk(generated_table->get_chunk(chunk_id)->columns());
+  }
+  table->set_in_place_updates(in_place_updates);
+
+  StorageManager::get().add_table(TABLE_NAME, table);
+}
+
+void run_update_benchmark(benchmark::State& state, const bool in_place_updates) {
+  create_table(static_cast<size_t>(state.range(0)), in_place_updates);
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    // Keeps the number of versions from growing over the iterations
+    if (in_place_updates) MergeValueDeltasTask{TABLE_NAME}.execute();
+
+    auto transaction_context = TransactionManager::get().new_transaction_context();
+
+    auto get_table = std::make_shared<GetTable>(TABLE_NAME);
+    get_table->execute();
+
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+
+    auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, PredicateCondition::LessThan, 100);
+    table_scan->execute();
+
+    auto rows_to_update = std::make_shared<Projection>(
+        table_scan, Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{1})});
+    rows_to_update->execute();
+
+    auto updated_values = std::make_shared<Projection>(
+        table_scan, Projection::ColumnExpressions{PQPExpression::create_literal(42, {"updated"})});
+    updated_values->execute();
+    state.ResumeTiming();
+
+    auto update = std::make_shared<Update>(TABLE_NAME, rows_to_update, updated_values);
+    update->set_transaction_context(transaction_context);
+    update->execute();
+
+    transaction_context->commit();
+  }
+
+  StorageManager::get().reset();
+}
+
+}  // namespace
+
+/**
+ * Updates a single column of about 1% of the rows of a table with state.range(0) columns per iteration. All other
+ * columns of the updated rows have to be copied into the new row versions.
+ */
+void BM_UpdateWideTable(benchmark::State& state) { run_update_benchmark(state, false); }
+BENCHMARK(BM_UpdateWideTable)->Arg(2)->Arg(10)->Arg(50)->Arg(100);
+
+// Same as BM_UpdateWideTable, but only the new values of the updated column are written (see ValueDeltas)
+void BM_UpdateWideTableInPlace(benchmark::State& state) { run_update_benchmark(state, true); }
+BENCHMARK(BM_UpdateWideTableInPlace)->Arg(2)->Arg(10)->Arg(50)->Arg(100);
+
+}  // namespace opossum
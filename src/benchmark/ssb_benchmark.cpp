@@ -0,0 +1,92 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark_runner.hpp"
+#include "cxxopts.hpp"
+#include "json.hpp"
+#include "ssb/ssb_db_generator.hpp"
+#include "ssb/ssb_queries.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+
+/**
+ * This benchmark measures Hyrise's performance executing the queries of the Star Schema Benchmark (SSB, see
+ * https://www.cs.umb.edu/~poneil/StarSchemaB.PDF), a star-schema variant of TPC-H with one fact table (LINEORDER) and
+ * four dimension tables. The tables are generated in-process by the SsbDbGenerator. Apart from the scale factor and
+ * the query selection, the options are the same as those of the TPC-H benchmark.
+ */
+
+int main(int argc, char* argv[]) {
+  auto cli_options = opossum::BenchmarkRunner::get_default_cli_options("SSB Benchmark");
+
+  // clang-format off
+  cli_options.add_options()
+      ("s,scale", "Database scale factor (1.0 ~ 600MB)", cxxopts::value<float>()->default_value("0.01"))
+      ("queries", "Specify queries to run (e.g., 1.1,4.3), default is all that are supported", cxxopts::value<std::vector<std::string>>()); // NOLINT
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+
+  // Display usage and quit
+  if (cli_parse_result.count("help")) {
+    std::cout << cli_options.help({}) << std::endl;
+    return 0;
+  }
+
+  const bool verbose = cli_parse_result["verbose"].as<bool>();
+  auto& out = opossum::get_out_stream(verbose);
+
+  const auto config = opossum::BenchmarkRunner::parse_default_cli_options(cli_parse_result, cli_options);
+
+  // Build list of query ids to be benchmarked and display it
+  std::vector<std::string> query_ids;
+  if (cli_parse_result.count("queries")) {
+    query_ids = cli_parse_result["queries"].as<std::vector<std::string>>();
+  } else {
+    for (const auto& [query_id, query] : opossum::ssb_queries) {
+      query_ids.emplace_back(query_id);
+    }
+  }
+  out << "- Benchmarking Queries ";
+  for (const auto& query_id : query_ids) {
+    out << query_id << " ";
+  }
+  out << std::endl;
+
+  const auto scale_factor = cli_parse_result["scale"].as<float>();
+
+  // Set up SSB benchmark
+  opossum::NamedQueries queries;
+  queries.reserve(query_ids.size());
+
+  for (const auto& query_id : query_ids) {
+    const auto query_iter = opossum::ssb_queries.find(query_id);
+    if (query_iter == opossum::ssb_queries.end()) {
+      std::cerr << "Unknown or unsupported SSB query '" << query_id << "'" << std::endl;
+      return 1;
+    }
+    queries.emplace_back("SSB " + query_id, query_iter->second);
+  }
+
+  config.out << "- Generating SSB Tables with scale_factor=" << scale_factor << "..." << std::endl;
+
+  const auto tables = opossum::SsbDbGenerator(scale_factor, config.chunk_size).generate();
+
+  for (auto& table : tables) {
+    if (config.encoding_type != opossum::EncodingType::Unencoded) {
+      opossum::ChunkEncoder::encode_all_chunks(table.second, opossum::ColumnEncodingSpec{config.encoding_type});
+    }
+
+    opossum::StorageManager::get().add_table(opossum::ssb_table_names.at(table.first), table.second);
+  }
+  config.out << "- Done." << std::endl;
+
+  auto context = opossum::BenchmarkRunner::create_context(config);
+
+  // Add SSB-specific information
+  context.emplace("scale_factor", scale_factor);
+
+  // Run the benchmark
+  opossum::BenchmarkRunner(config, queries, context).run();
+}
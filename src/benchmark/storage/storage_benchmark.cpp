@@ -0,0 +1,374 @@
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "constant_mappings.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_column_encoder.hpp"
+#include "storage/column_encoding_utils.hpp"
+#include "storage/column_iterables/chunk_offset_mapping.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "table_generator.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// All values of a benchmarked column are stored in a single chunk
+const auto ROW_COUNT = size_t{100'000};
+
+// Number of random chunk offsets accessed by BM_Storage_PointAccess
+const auto POINT_ACCESS_COUNT = size_t{10'000};
+
+// Share of the rows that are referenced by the PosList of BM_Storage_PosListAccess
+const auto POS_LIST_SELECTIVITY = 0.1;
+
+// Number of chunk offsets of the compressed vectors benchmarked by BM_Storage_VectorDecode*
+const auto VECTOR_SIZE = size_t{1'000'000};
+
+struct BenchmarkedDataType {
+  DataType data_type;
+  std::string name;
+  // Strings are left-padded with zeros to this length, so that their order and distinct count remain unchanged
+  size_t min_string_length;
+};
+
+// The generated ints have at most 5 digits, so "string" stays within the small string optimization of std::string,
+// while "long_string" needs heap allocations like most real-world strings do
+const auto BENCHMARKED_DATA_TYPES = std::array<BenchmarkedDataType, 6>{{{DataType::Int, "int", 0},
+                                                                        {DataType::Long, "long", 0},
+                                                                        {DataType::Float, "float", 0},
+                                                                        {DataType::Double, "double", 0},
+                                                                        {DataType::String, "string", 0},
+                                                                        {DataType::String, "long_string", 32}}};
+
+const auto BENCHMARKED_DISTRIBUTIONS = std::array<ColumnDataDistribution, 3>{
+    ColumnDataDistribution::make_uniform_config(0.0, 10'000.0),
+    ColumnDataDistribution::make_skewed_normal_config(0.0, 100.0, 5.0), ColumnDataDistribution::make_pareto_config()};
+const auto BENCHMARKED_DISTRIBUTION_NAMES = std::array<std::string, 3>{"Uniform", "NormalSkewed", "Pareto"};
+
+const auto BENCHMARKED_ENCODING_TYPES = std::array<EncodingType, 4>{EncodingType::Unencoded, EncodingType::Dictionary,
+                                                        EncodingType::RunLength, EncodingType::FrameOfReference};
+
+const auto BENCHMARKED_VECTOR_COMPRESSION_TYPES =
+    std::array<VectorCompressionType, 2>{VectorCompressionType::FixedSizeByteAligned, VectorCompressionType::SimdBp128};
+
+// The maximum values of the compressed vectors, which determine the width FixedSizeByteAligned and SimdBp128 use
+const auto BENCHMARKED_VECTOR_MAX_VALUES =
+    std::array<uint32_t, 3>{std::numeric_limits<uint8_t>::max(), std::numeric_limits<uint16_t>::max(), 1'000'000u};
+
+/**
+ * Registers the arguments {data type, distribution, encoding type, vector compression type} of all supported
+ * combinations. The vector compression type is 0 for encodings that do not use vector compression, otherwise it is the
+ * index into BENCHMARKED_VECTOR_COMPRESSION_TYPES plus one.
+ */
+void register_arguments(benchmark::internal::Benchmark* benchmark, const bool include_unencoded) {
+  for (auto data_type_index = size_t{0}; data_type_index < BENCHMARKED_DATA_TYPES.size(); ++data_type_index) {
+    const auto data_type = BENCHMARKED_DATA_TYPES[data_type_index].data_type;
+
+    for (auto distribution_index = size_t{0}; distribution_index < BENCHMARKED_DISTRIBUTIONS.size();
+         ++distribution_index) {
+      for (auto encoding_index = size_t{0}; encoding_index < BENCHMARKED_ENCODING_TYPES.size(); ++encoding_index) {
+        const auto encoding_type = BENCHMARKED_ENCODING_TYPES[encoding_index];
+        const auto arguments = std::vector<int64_t>{static_cast<int64_t>(data_type_index),
+                                                    static_cast<int64_t>(distribution_index),
+                                                    static_cast<int64_t>(encoding_index)};
+
+        if (encoding_type == EncodingType::Unencoded) {
+          if (include_unencoded) benchmark->Args({arguments[0], arguments[1], arguments[2], 0});
+          continue;
+        }
+
+        const auto encoder = create_encoder(encoding_type);
+        if (!encoder->supports(data_type)) continue;
+
+        if (!encoder->uses_vector_compression()) {
+          benchmark->Args({arguments[0], arguments[1], arguments[2], 0});
+          continue;
+        }
+
+        for (auto compression_index = size_t{0}; compression_index < BENCHMARKED_VECTOR_COMPRESSION_TYPES.size();
+             ++compression_index) {
+          benchmark->Args({arguments[0], arguments[1], arguments[2], static_cast<int64_t>(compression_index + 1)});
+        }
+      }
+    }
+  }
+}
+
+void all_columns(benchmark::internal::Benchmark* benchmark) { register_arguments(benchmark, true); }
+void encoded_columns(benchmark::internal::Benchmark* benchmark) { register_arguments(benchmark, false); }
+
+// Registers the arguments {vector compression type, max value} as indices into the arrays above
+void compressed_vectors(benchmark::internal::Benchmark* benchmark) {
+  for (auto compression_index = size_t{0}; compression_index < BENCHMARKED_VECTOR_COMPRESSION_TYPES.size();
+       ++compression_index) {
+    for (auto max_value_index = size_t{0}; max_value_index < BENCHMARKED_VECTOR_MAX_VALUES.size(); ++max_value_index) {
+      benchmark->Args({static_cast<int64_t>(compression_index), static_cast<int64_t>(max_value_index)});
+    }
+  }
+}
+
+// Compresses uniformly distributed values up to the max value selected by the benchmark arguments
+std::unique_ptr<const BaseCompressedVector> create_compressed_vector(benchmark::State& state) {
+  const auto compression_type = BENCHMARKED_VECTOR_COMPRESSION_TYPES[state.range(0)];
+  const auto max_value = BENCHMARKED_VECTOR_MAX_VALUES[state.range(1)];
+  state.SetLabel(vector_compression_type_to_string.at(compression_type) + "/" + std::to_string(max_value));
+
+  auto random_engine = std::mt19937{};
+  auto value_distribution = std::uniform_int_distribution<uint32_t>{0u, max_value};
+  auto values = pmr_vector<uint32_t>(VECTOR_SIZE);
+  for (auto& value : values) value = value_distribution(random_engine);
+
+  return compress_vector(values, compression_type, {}, {max_value});
+}
+
+// Unsorted random indices into a compressed vector
+std::vector<size_t> create_random_indices() {
+  auto random_engine = std::mt19937{};
+  auto index_distribution = std::uniform_int_distribution<size_t>{0u, VECTOR_SIZE - 1};
+  auto indices = std::vector<size_t>(POINT_ACCESS_COUNT);
+  for (auto& index : indices) index = index_distribution(random_engine);
+  return indices;
+}
+
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Benchmarks the storage layer independently of the operators: the encoding of a value column, its memory usage and the
+ * access to its values through the column iterables (sequentially, at random chunk offsets, and through a
+ * ReferenceColumn). Each benchmark runs for all data types, value distributions of the TableGenerator, EncodingTypes
+ * and VectorCompressionTypes (see register_arguments()). The TableGenerator generates ints, which are converted into
+ * the other data types (see BENCHMARKED_DATA_TYPES). The label of a run names the combination.
+ */
+class StorageBenchmarkFixture : public benchmark::Fixture {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    const auto& benchmarked_data_type = BENCHMARKED_DATA_TYPES[state.range(0)];
+    _data_type = benchmarked_data_type.data_type;
+    _encoding_type = BENCHMARKED_ENCODING_TYPES[state.range(2)];
+    if (state.range(3) > 0) _vector_compression_type = BENCHMARKED_VECTOR_COMPRESSION_TYPES[state.range(3) - 1];
+
+    auto label = benchmarked_data_type.name + "/" + BENCHMARKED_DISTRIBUTION_NAMES[state.range(1)] + "/" +
+                 encoding_type_to_string.at(_encoding_type);
+    if (_vector_compression_type) label += "/" + vector_compression_type_to_string.at(*_vector_compression_type);
+    state.SetLabel(label);
+
+    const auto distribution = BENCHMARKED_DISTRIBUTIONS[state.range(1)];
+    const auto int_table = TableGenerator{}.generate_table({distribution}, ROW_COUNT, ROW_COUNT);
+    const auto& int_column =
+        static_cast<const ValueColumn<int32_t>&>(*int_table->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+
+    resolve_data_type(_data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto values = pmr_concurrent_vector<ColumnDataType>{};
+      values.reserve(int_column.size());
+      for (const auto value : int_column.values()) {
+        if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+          auto string = std::to_string(value);
+          if (string.size() < benchmarked_data_type.min_string_length) {
+            string.insert(0, benchmarked_data_type.min_string_length - string.size(), '0');
+          }
+          values.push_back(std::move(string));
+        } else {
+          values.push_back(static_cast<ColumnDataType>(value));
+        }
+      }
+      _value_column = std::make_shared<ValueColumn<ColumnDataType>>(std::move(values));
+    });
+
+    if (_encoding_type == EncodingType::Unencoded) {
+      _column = _value_column;
+    } else {
+      _column = _encode();
+    }
+  }
+
+  void TearDown(::benchmark::State&) override {
+    _value_column = nullptr;
+    _column = nullptr;
+  }
+
+ protected:
+  std::shared_ptr<BaseColumn> _encode() const {
+    return encode_column(_encoding_type, _data_type, _value_column, _vector_compression_type);
+  }
+
+  // Calls functor with the ColumnDataType and the typed column (e.g., a DictionaryColumn<ColumnDataType>)
+  template <typename Functor>
+  void _resolve_column(const BaseColumn& column, const Functor& functor) const {
+    resolve_data_type(_data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      resolve_column_type<ColumnDataType>(column, [&](const auto& typed_column) { functor(type, typed_column); });
+    });
+  }
+
+  DataType _data_type{};
+  EncodingType _encoding_type{};
+  std::optional<VectorCompressionType> _vector_compression_type;
+
+  std::shared_ptr<BaseValueColumn> _value_column;
+  std::shared_ptr<BaseColumn> _column;
+};
+
+BENCHMARK_DEFINE_F(StorageBenchmarkFixture, BM_Storage_Encode)(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(_encode());
+  }
+
+  state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+  state.counters["memory_bytes"] = _column->estimate_memory_usage();
+  state.counters["unencoded_memory_bytes"] = _value_column->estimate_memory_usage();
+}
+BENCHMARK_REGISTER_F(StorageBenchmarkFixture, BM_Storage_Encode)->Apply(encoded_columns);
+
+BENCHMARK_DEFINE_F(StorageBenchmarkFixture, BM_Storage_SequentialAccess)(benchmark::State& state) {
+  _resolve_column(*_column, [&](auto type, const auto& typed_column) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+
+    while (state.KeepRunning()) {
+      iterable.for_each([&](const auto& value) {
+        benchmark::DoNotOptimize(value.value());
+        benchmark::DoNotOptimize(value.is_null());
+      });
+    }
+  });
+
+  state.SetItemsProcessed(state.iterations() * ROW_COUNT);
+  state.counters["memory_bytes"] = _column->estimate_memory_usage();
+}
+BENCHMARK_REGISTER_F(StorageBenchmarkFixture, BM_Storage_SequentialAccess)->Apply(all_columns);
+
+BENCHMARK_DEFINE_F(StorageBenchmarkFixture, BM_Storage_PointAccess)(benchmark::State& state) {
+  // Unsorted random chunk offsets, e.g., the probe side of a join that materializes its output
+  auto random_engine = std::mt19937{};
+  auto offset_distribution = std::uniform_int_distribution<ChunkOffset>{0u, static_cast<ChunkOffset>(ROW_COUNT - 1)};
+  auto chunk_offsets = ChunkOffsetsList(POINT_ACCESS_COUNT);
+  for (auto index = size_t{0}; index < POINT_ACCESS_COUNT; ++index) {
+    chunk_offsets[index] = {static_cast<ChunkOffset>(index), offset_distribution(random_engine)};
+  }
+
+  _resolve_column(*_column, [&](auto type, const auto& typed_column) {
+    using ColumnDataType = typename decltype(type)::type;
+    using ColumnType = std::decay_t<decltype(typed_column)>;
+
+    if constexpr (std::is_same_v<ColumnType, ReferenceColumn>) {
+      Fail("Point access is benchmarked on data columns only");
+    } else {
+      const auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+
+      while (state.KeepRunning()) {
+        iterable.for_each(&chunk_offsets, [&](const auto& value) {
+          benchmark::DoNotOptimize(value.value());
+          benchmark::DoNotOptimize(value.is_null());
+        });
+      }
+    }
+  });
+
+  state.SetItemsProcessed(state.iterations() * POINT_ACCESS_COUNT);
+}
+BENCHMARK_REGISTER_F(StorageBenchmarkFixture, BM_Storage_PointAccess)->Apply(all_columns);
+
+BENCHMARK_DEFINE_F(StorageBenchmarkFixture, BM_Storage_PosListAccess)(benchmark::State& state) {
+  // A ReferenceColumn with a sorted PosList, like the output of a TableScan
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", _data_type}}, TableType::Data);
+  table->append_chunk(ChunkColumns{_column});
+
+  auto random_engine = std::mt19937{};
+  auto selection_distribution = std::bernoulli_distribution{POS_LIST_SELECTIVITY};
+  auto pos_list = std::make_shared<PosList>();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < ROW_COUNT; ++chunk_offset) {
+    if (selection_distribution(random_engine)) pos_list->emplace_back(RowID{ChunkID{0}, chunk_offset});
+  }
+
+  const auto reference_column = ReferenceColumn{table, ColumnID{0}, pos_list};
+
+  _resolve_column(reference_column, [&](auto type, const auto& typed_column) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+
+    while (state.KeepRunning()) {
+      iterable.for_each([&](const auto& value) {
+        benchmark::DoNotOptimize(value.value());
+        benchmark::DoNotOptimize(value.is_null());
+      });
+    }
+  });
+
+  state.SetItemsProcessed(state.iterations() * pos_list->size());
+}
+BENCHMARK_REGISTER_F(StorageBenchmarkFixture, BM_Storage_PosListAccess)->Apply(all_columns);
+
+/**
+ * The compressed vectors on their own, i.e., without the decoding of the values of the column (e.g., the dictionary
+ * lookup): sequentially via their iterators, and at random indices via their decoders, both with the concrete decoder
+ * type and through the virtual BaseVectorDecompressor interface that is used where the type is not resolved.
+ */
+void BM_Storage_VectorDecodeSequential(benchmark::State& state) {
+  const auto compressed_vector = create_compressed_vector(state);
+
+  resolve_compressed_vector_type(*compressed_vector, [&](const auto& vector) {
+    while (state.KeepRunning()) {
+      for (auto iter = vector.cbegin(); iter != vector.cend(); ++iter) {
+        benchmark::DoNotOptimize(*iter);
+      }
+    }
+  });
+
+  state.SetItemsProcessed(state.iterations() * VECTOR_SIZE);
+  state.counters["memory_bytes"] = compressed_vector->data_size();
+}
+BENCHMARK(BM_Storage_VectorDecodeSequential)->Apply(compressed_vectors);
+
+void BM_Storage_VectorDecodePointAccess(benchmark::State& state) {
+  const auto compressed_vector = create_compressed_vector(state);
+  const auto indices = create_random_indices();
+
+  resolve_compressed_vector_type(*compressed_vector, [&](const auto& vector) {
+    const auto decoder = vector.create_decoder();
+
+    while (state.KeepRunning()) {
+      for (const auto index : indices) {
+        benchmark::DoNotOptimize(decoder->get(index));
+      }
+    }
+  });
+
+  state.SetItemsProcessed(state.iterations() * POINT_ACCESS_COUNT);
+}
+BENCHMARK(BM_Storage_VectorDecodePointAccess)->Apply(compressed_vectors);
+
+void BM_Storage_VectorDecodeVirtualPointAccess(benchmark::State& state) {
+  const auto compressed_vector = create_compressed_vector(state);
+  const auto indices = create_random_indices();
+  const auto decoder = compressed_vector->create_base_decoder();
+
+  while (state.KeepRunning()) {
+    for (const auto index : indices) {
+      benchmark::DoNotOptimize(decoder->get(index));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * POINT_ACCESS_COUNT);
+}
+BENCHMARK(BM_Storage_VectorDecodeVirtualPointAccess)->Apply(compressed_vectors);
+
+}  // namespace opossum
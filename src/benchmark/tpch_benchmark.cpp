@@ -1,6 +1,9 @@
 #include <chrono>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
 #include <random>
 #include <string>
 
@@ -40,7 +43,10 @@ int main(int argc, char* argv[]) {
   // clang-format off
   cli_options.add_options()
       ("s,scale", "Database scale factor (1.0 ~ 1GB)", cxxopts::value<float>()->default_value("0.001"))
-      ("queries", "Specify queries to run, default is all that are supported", cxxopts::value<std::vector<opossum::QueryID>>()); // NOLINT
+      ("queries", "Specify queries to run, default is all that are supported", cxxopts::value<std::vector<opossum::QueryID>>()) // NOLINT
+      ("scalability_workers", "Run in scalability mode, sweeping these worker counts (e.g., 1,2,4,8; 0 runs without scheduler)", cxxopts::value<std::vector<uint32_t>>()) // NOLINT
+      ("scalability_chunk_sizes", "Chunk sizes swept in scalability mode, default is the chunk size", cxxopts::value<std::vector<opossum::ChunkOffset>>()) // NOLINT
+      ("scalability_encodings", "Encodings swept in scalability mode, default is the encoding", cxxopts::value<std::vector<std::string>>()); // NOLINT
   // clang-format on
 
   const auto cli_parse_result = cli_options.parse(argc, argv);
@@ -83,13 +89,62 @@ int main(int argc, char* argv[]) {
     queries.emplace_back("TPC-H " + std::to_string(query_id), opossum::tpch_queries.at(query_id));
   }
 
+  auto context = opossum::BenchmarkRunner::create_context(config);
+
+  // Add TPCH-specific information
+  context.emplace("scale_factor", scale_factor);
+
+  /**
+   * In scalability mode, the queries are benchmarked for each combination of worker count, chunk size and encoding
+   * (see BenchmarkRunner::run_scalability_sweep()). The tables are generated once per chunk size.
+   */
+  if (cli_parse_result.count("scalability_workers")) {
+    auto scalability_config = opossum::ScalabilityConfig{};
+    scalability_config.worker_counts = cli_parse_result["scalability_workers"].as<std::vector<uint32_t>>();
+
+    scalability_config.chunk_sizes = {config.chunk_size};
+    if (cli_parse_result.count("scalability_chunk_sizes")) {
+      scalability_config.chunk_sizes =
+          cli_parse_result["scalability_chunk_sizes"].as<std::vector<opossum::ChunkOffset>>();
+    }
+
+    scalability_config.encoding_types = {config.encoding_type};
+    if (cli_parse_result.count("scalability_encodings")) {
+      scalability_config.encoding_types.clear();
+      for (const auto& encoding_str : cli_parse_result["scalability_encodings"].as<std::vector<std::string>>()) {
+        const auto encoding_type = opossum::BenchmarkRunner::parse_encoding_type(encoding_str);
+        if (!encoding_type) throw std::runtime_error("Invalid encoding type: '" + encoding_str + "'");
+        scalability_config.encoding_types.emplace_back(*encoding_type);
+      }
+    }
+
+    const auto generate_tables = [&](const opossum::ChunkOffset chunk_size) {
+      config.out << "- Generating TPCH Tables with scale_factor=" << scale_factor << "..." << std::endl;
+      auto tables = std::map<std::string, std::shared_ptr<opossum::Table>>{};
+      for (const auto& [tpch_table, table] : opossum::TpchDbGenerator(scale_factor, chunk_size).generate()) {
+        tables.emplace(opossum::tpch_table_names.at(tpch_table), table);
+      }
+      return tables;
+    };
+
+    opossum::BenchmarkRunner::run_scalability_sweep(config, scalability_config, queries, generate_tables, context);
+    return 0;
+  }
+
   config.out << "- Generating TPCH Tables with scale_factor=" << scale_factor << "..." << std::endl;
 
   opossum::ColumnEncodingSpec encoding_spec{config.encoding_type};
-  const auto tables = opossum::TpchDbGenerator(scale_factor, config.chunk_size).generate();
+  const auto encode_tables = config.encoding_type != opossum::EncodingType::Unencoded;
+
+  // With the scheduler, the tables are generated and encoded in parallel
+  auto tpch_db_generator = opossum::TpchDbGenerator(scale_factor, config.chunk_size);
+  const auto tables = config.enable_scheduler
+                          ? tpch_db_generator.generate_parallel(
+                                encode_tables ? std::optional<opossum::ColumnEncodingSpec>{encoding_spec} : std::nullopt)
+                          : tpch_db_generator.generate();
 
   for (auto& table : tables) {
-    if (config.encoding_type != opossum::EncodingType::Unencoded) {
+    if (encode_tables && !config.enable_scheduler) {
       opossum::ChunkEncoder::encode_all_chunks(table.second, encoding_spec);
     }
 
@@ -97,11 +152,6 @@ int main(int argc, char* argv[]) {
   }
   config.out << "- Done." << std::endl;
 
-  auto context = opossum::BenchmarkRunner::create_context(config);
-
-  // Add TPCH-specific information
-  context.emplace("scale_factor", scale_factor);
-
   // Run the benchmark
   opossum::BenchmarkRunner(config, queries, context).run();
 }
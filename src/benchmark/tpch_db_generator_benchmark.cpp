@@ -1,5 +1,12 @@
+#include <memory>
+#include <optional>
+
 #include "benchmark/benchmark.h"
 
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "tpch/tpch_db_generator.hpp"
 
 namespace opossum {
@@ -16,4 +23,23 @@ static void BM_TpchDbGenerator(benchmark::State& state) {
 }
 BENCHMARK(BM_TpchDbGenerator);
 
+/**
+ * Generates the tables with TpchDbGenerator::generate_parallel() on all cores. With an argument of 1, the chunks are
+ * dictionary encoded while they are generated.
+ */
+static void BM_TpchDbGeneratorParallel(benchmark::State& state) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_numa_topology()));
+
+  const auto encoding_spec =
+      state.range(0) == 1 ? std::optional<ColumnEncodingSpec>{EncodingType::Dictionary} : std::nullopt;
+
+  while (state.KeepRunning()) {
+    TpchDbGenerator(0.5f, 1000).generate_parallel(encoding_spec);
+  }
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+BENCHMARK(BM_TpchDbGeneratorParallel)->Arg(0)->Arg(1);
+
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #include <json.hpp>
 
+#include <algorithm>
 #include <random>
 
 #include "benchmark_runner.hpp"
@@ -8,7 +9,10 @@
 #include "planviz/lqp_visualizer.hpp"
 #include "planviz/sql_query_plan_visualizer.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "sql/query_result_cache.hpp"
 #include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_query_cache.hpp"
+#include "sql/sql_query_plan.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "tpch/tpch_db_generator.hpp"
@@ -26,17 +30,7 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config, const NamedQueri
 void BenchmarkRunner::run() {
   _config.out << "\n- Starting Benchmark..." << std::endl;
 
-  // Run the queries in the selected mode
-  switch (_config.benchmark_mode) {
-    case BenchmarkMode::IndividualQueries: {
-      _benchmark_individual_queries();
-      break;
-    }
-    case BenchmarkMode::PermutedQuerySets: {
-      _benchmark_permuted_query_sets();
-      break;
-    }
-  }
+  _benchmark_queries();
 
   // Create report
   if (_config.output_file_path) {
@@ -70,6 +64,20 @@ void BenchmarkRunner::run() {
   }
 }
 
+void BenchmarkRunner::_benchmark_queries() {
+  // Run the queries in the selected mode
+  switch (_config.benchmark_mode) {
+    case BenchmarkMode::IndividualQueries: {
+      _benchmark_individual_queries();
+      break;
+    }
+    case BenchmarkMode::PermutedQuerySets: {
+      _benchmark_permuted_query_sets();
+      break;
+    }
+  }
+}
+
 void BenchmarkRunner::_benchmark_permuted_query_sets() {
   // Init results
   for (const auto& named_query : _queries) {
@@ -140,6 +148,12 @@ void BenchmarkRunner::_execute_query(const NamedQuery& named_query) {
 }
 
 void BenchmarkRunner::_create_report(std::ostream& stream) const {
+  nlohmann::json report{{"context", _context}, {"benchmarks", _create_benchmarks_json()}};
+
+  stream << std::setw(2) << report << std::endl;
+}
+
+nlohmann::json BenchmarkRunner::_create_benchmarks_json() const {
   nlohmann::json benchmarks;
 
   for (const auto& named_query : _queries) {
@@ -163,9 +177,7 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
     benchmarks.push_back(benchmark);
   }
 
-  nlohmann::json report{{"context", _context}, {"benchmarks", benchmarks}};
-
-  stream << std::setw(2) << report << std::endl;
+  return benchmarks;
 }
 
 BenchmarkRunner BenchmarkRunner::create(const BenchmarkConfig& config, const std::string& table_path,
@@ -197,6 +209,135 @@ BenchmarkRunner BenchmarkRunner::create(const BenchmarkConfig& config, const std
   return BenchmarkRunner(config, queries, create_context(config));
 }
 
+void BenchmarkRunner::run_scalability_sweep(const BenchmarkConfig& config, const ScalabilityConfig& scalability_config,
+                                            const NamedQueries& queries,
+                                            const BenchmarkTableGeneratorFunction& generate_tables,
+                                            const nlohmann::json& context) {
+  const auto& worker_counts = scalability_config.worker_counts;
+  Assert(!worker_counts.empty() && !scalability_config.chunk_sizes.empty() &&
+             !scalability_config.encoding_types.empty(),
+         "A scalability sweep needs at least one worker count, chunk size and encoding");
+
+  // The speedups are relative to the smallest worker count
+  const auto baseline_iter = std::min_element(worker_counts.begin(), worker_counts.end());
+  const auto baseline_index = static_cast<size_t>(std::distance(worker_counts.begin(), baseline_iter));
+
+  auto configurations = nlohmann::json::array();
+  auto speedups = nlohmann::json::array();
+
+  for (const auto chunk_size : scalability_config.chunk_sizes) {
+    // Generate the tables single-threaded, so that the scheduler of the previous configuration does not linger
+    CurrentScheduler::set(nullptr);
+    config.out << "- Generating tables with chunk size " << chunk_size << std::endl;
+    const auto tables = generate_tables(chunk_size);
+
+    for (const auto encoding_type : scalability_config.encoding_types) {
+      auto encoding_string = encoding_type_to_string.at(encoding_type);
+      boost::algorithm::to_lower(encoding_string);
+
+      // Encode copies, so that the unencoded tables can be encoded differently for the next encoding
+      config.out << "- Encoding tables with '" << encoding_string << "'" << std::endl;
+      for (const auto& [table_name, table] : tables) {
+        auto encoded_table = table;
+        if (encoding_type != EncodingType::Unencoded) {
+          encoded_table =
+              std::make_shared<Table>(table->column_definitions(), TableType::Data, chunk_size, table->has_mvcc());
+          for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+            encoded_table->append_chunk(table->get_chunk(chunk_id)->columns());
+          }
+          ChunkEncoder::encode_all_chunks(encoded_table, ColumnEncodingSpec{encoding_type});
+        }
+
+        if (StorageManager::get().has_table(table_name)) StorageManager::get().drop_table(table_name);
+        StorageManager::get().add_table(table_name, encoded_table);
+      }
+
+      // Cached plans (e.g., chunks excluded by the ChunkPruningRule) and results refer to the tables just replaced
+      SQLQueryCache<SQLQueryPlan>::get().clear();
+      QueryResultCache::get().clear();
+
+      // Time per query in ns, by query name, for each worker count
+      auto query_times = std::unordered_map<std::string, std::vector<double>>{};
+
+      for (const auto worker_count : worker_counts) {
+        // The Topology may have fewer workers than requested if the machine has fewer cores
+        auto actual_worker_count = size_t{0};
+        if (worker_count > 0) {
+          const auto topology = Topology::create_numa_topology(worker_count);
+          actual_worker_count = topology->num_cpus();
+          CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(topology));
+        } else {
+          CurrentScheduler::set(nullptr);
+        }
+
+        config.out << "- Benchmarking with chunk size " << chunk_size << ", encoding '" << encoding_string << "' and "
+                   << actual_worker_count << " workers" << std::endl;
+
+        // The report of the sweep is written below and plans are not visualized
+        const auto sweep_config =
+            BenchmarkConfig{config.benchmark_mode,     config.verbose,      chunk_size,       encoding_type,
+                            config.max_num_query_runs, config.max_duration, config.use_mvcc,  std::nullopt,
+                            worker_count > 0,          false,               config.out};
+        auto runner = BenchmarkRunner{sweep_config, queries, context};
+        runner._benchmark_queries();
+
+        const auto benchmarks = runner._create_benchmarks_json();
+        for (const auto& benchmark : benchmarks) {
+          query_times[benchmark.at("name").get<std::string>()].emplace_back(benchmark.at("real_time").get<double>());
+        }
+
+        configurations.push_back({{"workers", worker_count},
+                                  {"actual_workers", actual_worker_count},
+                                  {"chunk_size", chunk_size},
+                                  {"encoding", encoding_string},
+                                  {"benchmarks", benchmarks}});
+      }
+
+      for (const auto& named_query : queries) {
+        const auto& times = query_times.at(named_query.first);
+
+        auto curve = nlohmann::json::array();
+        for (auto worker_count_index = size_t{0}; worker_count_index < worker_counts.size(); ++worker_count_index) {
+          curve.push_back({{"workers", worker_counts[worker_count_index]},
+                           {"real_time", times[worker_count_index]},
+                           {"speedup", times[baseline_index] / times[worker_count_index]}});
+        }
+
+        speedups.push_back({{"name", named_query.first},
+                            {"chunk_size", chunk_size},
+                            {"encoding", encoding_string},
+                            {"time_unit", "ns"},
+                            {"curve", curve}});
+      }
+    }
+  }
+
+  CurrentScheduler::set(nullptr);
+
+  auto encoding_strings = std::vector<std::string>{};
+  for (const auto encoding_type : scalability_config.encoding_types) {
+    encoding_strings.emplace_back(boost::algorithm::to_lower_copy(encoding_type_to_string.at(encoding_type)));
+  }
+
+  // The swept parameters replace the single ones of the config
+  auto sweep_context = context;
+  sweep_context.erase("chunk_size");
+  sweep_context.erase("encoding");
+  sweep_context.erase("using_scheduler");
+  sweep_context["scalability"] = {{"worker_counts", worker_counts},
+                                  {"chunk_sizes", scalability_config.chunk_sizes},
+                                  {"encodings", encoding_strings}};
+
+  nlohmann::json report{{"context", sweep_context}, {"configurations", configurations}, {"speedups", speedups}};
+
+  if (config.output_file_path) {
+    std::ofstream output_file(*config.output_file_path);
+    output_file << std::setw(2) << report << std::endl;
+  } else {
+    std::cout << std::setw(2) << report << std::endl;
+  }
+}
+
 std::vector<std::string> BenchmarkRunner::_read_table_folder(const std::string& table_path) {
   const auto is_table_file = [](const std::string& filename) {
     return (boost::algorithm::ends_with(filename, ".csv") || boost::algorithm::ends_with(filename, ".tbl"));
@@ -363,19 +504,12 @@ BenchmarkConfig BenchmarkRunner::parse_default_cli_options(const cxxopts::ParseR
 
   // Get the specified encoding type
   const auto encoding_type_str = parse_result["encoding"].as<std::string>();
-  auto encoding_type = EncodingType::Dictionary;  // Just to init it deterministically
-  if (encoding_type_str == "dictionary") {
-    encoding_type = EncodingType::Dictionary;
-  } else if (encoding_type_str == "runlength") {
-    encoding_type = EncodingType::RunLength;
-  } else if (encoding_type_str == "frameofreference") {
-    encoding_type = EncodingType::FrameOfReference;
-  } else if (encoding_type_str == "unencoded") {
-    encoding_type = EncodingType::Unencoded;
-  } else {
+  const auto parsed_encoding_type = parse_encoding_type(encoding_type_str);
+  if (!parsed_encoding_type) {
     std::cerr << cli_options.help({}) << std::endl;
     throw std::runtime_error("Invalid encoding type: '" + encoding_type_str + "'");
   }
+  const auto encoding_type = *parsed_encoding_type;
 
   out << "- Encoding is '" << encoding_type_str << "'" << std::endl;
 
@@ -394,6 +528,14 @@ BenchmarkConfig BenchmarkRunner::parse_default_cli_options(const cxxopts::ParseR
       benchmark_mode, verbose,          chunk_size,       encoding_type,        max_runs, timeout_duration,
       use_mvcc,       output_file_path, enable_scheduler, enable_visualization, out};
 }
+
+std::optional<EncodingType> BenchmarkRunner::parse_encoding_type(const std::string& encoding_type_str) {
+  for (const auto& [encoding_type, name] : encoding_type_to_string) {
+    if (boost::algorithm::to_lower_copy(name) == encoding_type_str) return encoding_type;
+  }
+  return std::nullopt;
+}
+
 nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
   // Generate YY-MM-DD hh:mm::ss
   auto current_time = std::time(nullptr);
@@ -5,6 +5,7 @@
 #include <chrono>
 #include <iostream>
 #include <optional>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -32,7 +33,27 @@ class BenchmarkRunner {
 
   static nlohmann::json create_context(const BenchmarkConfig& config);
 
+  // Parses the names of the --encoding option (e.g., "dictionary"). Returns std::nullopt for unknown names.
+  static std::optional<EncodingType> parse_encoding_type(const std::string& encoding_type_str);
+
+  /**
+   * Benchmarks the queries for every combination of worker count, chunk size and encoding in scalability_config and
+   * writes one combined report to config.output_file_path (or stdout). All other parameters (e.g., the BenchmarkMode)
+   * are taken from config; its chunk size, encoding and scheduler setting are ignored.
+   *
+   * The tables are generated once per chunk size. For each encoding, encoded copies of these tables are added to the
+   * StorageManager, which all worker counts use. A worker count limits the Topology of the NodeQueueScheduler that is
+   * set for its runs. Besides the results of each configuration, the report contains a speedup curve for each query,
+   * chunk size and encoding: the query's speedup for each worker count over the smallest worker count.
+   */
+  static void run_scalability_sweep(const BenchmarkConfig& config, const ScalabilityConfig& scalability_config,
+                                    const NamedQueries& queries, const BenchmarkTableGeneratorFunction& generate_tables,
+                                    const nlohmann::json& context);
+
  private:
+  // Run benchmark in the BenchmarkMode of the config
+  void _benchmark_queries();
+
   // Run benchmark in BenchmarkMode::PermutedQuerySets mode
   void _benchmark_permuted_query_sets();
 
@@ -43,6 +64,9 @@ class BenchmarkRunner {
   // Create a report in roughly the same format as google benchmarks do when run with --benchmark_format=json
   void _create_report(std::ostream& stream) const;
 
+  // The results of all queries, as listed under "benchmarks" in the report
+  nlohmann::json _create_benchmarks_json() const;
+
   // Get all the files/tables/queries from a given path
   static std::vector<std::string> _read_table_folder(const std::string& table_path);
   static NamedQueries _read_query_folder(const std::string& query_path);
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "boost/hana/fold_left.hpp"
+#include "boost/hana/for_each.hpp"
+#include "boost/hana/integral_constant.hpp"
+#include "boost/hana/tuple.hpp"
+#include "boost/hana/zip_with.hpp"
+
+#include "logical_type.hpp"
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Helper to build a table with a static (specified by template args `ColumnTypes`) column type layout. Keeps a vector
+ * for each column and appends values to them in append_row(). Automatically creates chunks in accordance with the
+ * specified chunk size.
+ *
+ * Columns listed in `logical_types` get that LogicalType (e.g., DATE). Their values are appended as the integers the
+ * LogicalType stores, so their column type has to be LogicalType::data_type().
+ */
+template <typename... DataTypes>
+class TableBuilder {
+ public:
+  template <typename... Strings>
+  TableBuilder(size_t chunk_size, const boost::hana::tuple<DataTypes...>& column_types,
+               const boost::hana::tuple<Strings...>& column_names, UseMvcc use_mvcc,
+               const std::unordered_map<std::string, LogicalType>& logical_types = {})
+      : _use_mvcc(use_mvcc) {
+    /**
+     * Create a tuple ((column_name0, column_type0), (column_name1, column_type1), ...) so we can iterate over the
+     * columns.
+     * fold_left as below does this in order, I think boost::hana::zip_with() doesn't, which is why I'm doing two steps
+     * here.
+     */
+    const auto column_names_and_data_types = boost::hana::zip_with(
+        [&](auto column_type, auto column_name) {
+          return boost::hana::make_tuple(column_name, data_type_from_type<decltype(column_type)>());
+        },
+        column_types, column_names);
+
+    // Iterate over the column types/names and create the columns.
+    TableColumnDefinitions column_definitions;
+    boost::hana::fold_left(column_names_and_data_types, column_definitions,
+                           [](auto& column_definitions, auto column_name_and_type) -> decltype(auto) {
+                             column_definitions.emplace_back(column_name_and_type[boost::hana::llong_c<0>],
+                                                             column_name_and_type[boost::hana::llong_c<1>]);
+                             return column_definitions;
+                           });
+
+    for (auto& column_definition : column_definitions) {
+      const auto logical_type_iter = logical_types.find(column_definition.name);
+      if (logical_type_iter == logical_types.end()) continue;
+
+      Assert(logical_type_iter->second.data_type() == column_definition.data_type,
+             "Column " + column_definition.name + " needs to be of the type its LogicalType is stored as");
+      column_definition.logical_type = logical_type_iter->second;
+    }
+
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, use_mvcc);
+  }
+
+  std::shared_ptr<Table> finish_table() {
+    if (_current_chunk_row_count() > 0) {
+      _emit_chunk();
+    }
+
+    return _table;
+  }
+
+  void append_row(DataTypes&&... column_values) {
+    // Create a tuple ([&column_vector0, value0], ...)
+    auto vectors_and_values = boost::hana::zip_with(
+        [](auto& vector, auto&& value) { return boost::hana::make_tuple(std::reference_wrapper(vector), value); },
+        _column_vectors, boost::hana::make_tuple(std::forward<DataTypes>(column_values)...));
+
+    // Add the values to their respective column vector
+    boost::hana::for_each(vectors_and_values, [](auto vector_and_value) {
+      vector_and_value[boost::hana::llong_c<0>].get().push_back(vector_and_value[boost::hana::llong_c<1>]);
+    });
+
+    if (_current_chunk_row_count() >= _table->max_chunk_size()) {
+      _emit_chunk();
+    }
+  }
+
+ private:
+  std::shared_ptr<Table> _table;
+  UseMvcc _use_mvcc;
+  boost::hana::tuple<pmr_concurrent_vector<DataTypes>...> _column_vectors;
+
+  size_t _current_chunk_row_count() const { return _column_vectors[boost::hana::llong_c<0>].size(); }
+
+  void _emit_chunk() {
+    ChunkColumns chunk_columns;
+
+    // Create a column from each column vector and add it to the Chunk, then re-initialize the vector
+    boost::hana::for_each(_column_vectors, [&](auto&& vector) {
+      using T = typename std::decay_t<decltype(vector)>::value_type;
+      chunk_columns.push_back(std::make_shared<ValueColumn<T>>(std::move(vector)));
+      vector = std::decay_t<decltype(vector)>();
+    });
+    _table->append_chunk(chunk_columns);
+  }
+};
+
+}  // namespace opossum
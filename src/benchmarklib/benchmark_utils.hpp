@@ -3,14 +3,21 @@
 #include <cxxopts.hpp>
 
 #include <chrono>
+#include <functional>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "storage/chunk.hpp"
 #include "storage/encoding_type.hpp"
 
 namespace opossum {
 
+class Table;
+
 /**
  * IndividualQueries runs each query a number of times and then the next one
  * PermutedQuerySets runs the queries as sets permuting their order after each run (this exercises caches)
@@ -75,4 +82,18 @@ struct BenchmarkConfig {
   std::ostream& out;
 };
 
+/**
+ * The parameters swept by BenchmarkRunner::run_scalability_sweep(), which benchmarks every combination of them. A
+ * worker count of 0 runs the queries without a scheduler.
+ */
+struct ScalabilityConfig {
+  std::vector<uint32_t> worker_counts;
+  std::vector<ChunkOffset> chunk_sizes;
+  std::vector<EncodingType> encoding_types;
+};
+
+// Generates the unencoded tables of a benchmark, by table name, with the given chunk size
+using BenchmarkTableGeneratorFunction =
+    std::function<std::map<std::string, std::shared_ptr<Table>>(const ChunkOffset chunk_size)>;
+
 }  // namespace opossum
@@ -0,0 +1,182 @@
+#include "job_loader.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "import_export/csv_meta.hpp"
+#include "import_export/csv_parser.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/filesystem.hpp"
+
+namespace {
+
+// Column names and types, in the order of the CSV files, as defined by schema.sql of the JOB repository
+const auto job_table_columns = std::map<std::string, std::vector<std::pair<std::string, std::string>>>{
+    {"aka_name",
+     {{"id", "int"},
+      {"person_id", "int"},
+      {"name", "string"},
+      {"imdb_index", "string"},
+      {"name_pcode_cf", "string"},
+      {"name_pcode_nf", "string"},
+      {"surname_pcode", "string"},
+      {"md5sum", "string"}}},
+    {"aka_title",
+     {{"id", "int"},
+      {"movie_id", "int"},
+      {"title", "string"},
+      {"imdb_index", "string"},
+      {"kind_id", "int"},
+      {"production_year", "int"},
+      {"phonetic_code", "string"},
+      {"episode_of_id", "int"},
+      {"season_nr", "int"},
+      {"episode_nr", "int"},
+      {"note", "string"},
+      {"md5sum", "string"}}},
+    {"cast_info",
+     {{"id", "int"},
+      {"person_id", "int"},
+      {"movie_id", "int"},
+      {"person_role_id", "int"},
+      {"note", "string"},
+      {"nr_order", "int"},
+      {"role_id", "int"}}},
+    {"char_name",
+     {{"id", "int"},
+      {"name", "string"},
+      {"imdb_index", "string"},
+      {"imdb_id", "int"},
+      {"name_pcode_nf", "string"},
+      {"surname_pcode", "string"},
+      {"md5sum", "string"}}},
+    {"comp_cast_type", {{"id", "int"}, {"kind", "string"}}},
+    {"company_name",
+     {{"id", "int"},
+      {"name", "string"},
+      {"country_code", "string"},
+      {"imdb_id", "int"},
+      {"name_pcode_nf", "string"},
+      {"name_pcode_sf", "string"},
+      {"md5sum", "string"}}},
+    {"company_type", {{"id", "int"}, {"kind", "string"}}},
+    {"complete_cast", {{"id", "int"}, {"movie_id", "int"}, {"subject_id", "int"}, {"status_id", "int"}}},
+    {"info_type", {{"id", "int"}, {"info", "string"}}},
+    {"keyword", {{"id", "int"}, {"keyword", "string"}, {"phonetic_code", "string"}}},
+    {"kind_type", {{"id", "int"}, {"kind", "string"}}},
+    {"link_type", {{"id", "int"}, {"link", "string"}}},
+    {"movie_companies",
+     {{"id", "int"}, {"movie_id", "int"}, {"company_id", "int"}, {"company_type_id", "int"}, {"note", "string"}}},
+    {"movie_info",
+     {{"id", "int"}, {"movie_id", "int"}, {"info_type_id", "int"}, {"info", "string"}, {"note", "string"}}},
+    {"movie_info_idx",
+     {{"id", "int"}, {"movie_id", "int"}, {"info_type_id", "int"}, {"info", "string"}, {"note", "string"}}},
+    {"movie_keyword", {{"id", "int"}, {"movie_id", "int"}, {"keyword_id", "int"}}},
+    {"movie_link", {{"id", "int"}, {"movie_id", "int"}, {"linked_movie_id", "int"}, {"link_type_id", "int"}}},
+    {"name",
+     {{"id", "int"},
+      {"name", "string"},
+      {"imdb_index", "string"},
+      {"imdb_id", "int"},
+      {"gender", "string"},
+      {"name_pcode_cf", "string"},
+      {"name_pcode_nf", "string"},
+      {"surname_pcode", "string"},
+      {"md5sum", "string"}}},
+    {"person_info",
+     {{"id", "int"}, {"person_id", "int"}, {"info_type_id", "int"}, {"info", "string"}, {"note", "string"}}},
+    {"role_type", {{"id", "int"}, {"role", "string"}}},
+    {"title",
+     {{"id", "int"},
+      {"title", "string"},
+      {"imdb_index", "string"},
+      {"kind_id", "int"},
+      {"production_year", "int"},
+      {"imdb_id", "int"},
+      {"phonetic_code", "string"},
+      {"episode_of_id", "int"},
+      {"season_nr", "int"},
+      {"episode_nr", "int"},
+      {"series_years", "string"},
+      {"md5sum", "string"}}}};
+
+// Orders query names like 1a, 1b, 2a, ..., 10a numerically by their number and alphabetically by their letter
+bool job_query_name_less(const std::string& lhs, const std::string& rhs) {
+  const auto split = [](const std::string& name) {
+    const auto letters_begin = name.find_first_not_of("0123456789");
+    const auto number = letters_begin == 0 ? 0ul : std::stoul(name.substr(0, letters_begin));
+    return std::make_pair(number, letters_begin == std::string::npos ? std::string{} : name.substr(letters_begin));
+  };
+  return split(lhs) < split(rhs);
+}
+
+}  // namespace
+
+namespace opossum {
+
+const std::vector<std::string> job_table_names = [] {
+  auto names = std::vector<std::string>{};
+  for (const auto& [table_name, columns] : job_table_columns) {
+    names.emplace_back(table_name);
+  }
+  return names;
+}();
+
+std::map<std::string, std::shared_ptr<Table>> load_job_tables(const std::string& table_path,
+                                                              const ChunkOffset chunk_size) {
+  std::map<std::string, std::shared_ptr<Table>> tables;
+
+  for (const auto& [table_name, columns] : job_table_columns) {
+    const auto csv_path = (filesystem::path{table_path} / (table_name + ".csv")).string();
+    Assert(filesystem::exists(csv_path), "No such file '" + csv_path + "'");
+
+    CsvMeta csv_meta;
+    csv_meta.chunk_size = chunk_size;
+    csv_meta.config.escape = '\\';
+    // The IMDB data contains unquoted strings like 'Null' (e.g., names), which are not NULL values
+    csv_meta.config.reject_null_strings = false;
+
+    for (const auto& [column_name, column_type] : columns) {
+      csv_meta.columns.emplace_back(ColumnMeta{column_name, column_type, column_name != "id"});
+    }
+
+    tables.emplace(table_name, CsvParser{}.parse(csv_path, csv_meta));
+  }
+
+  return tables;
+}
+
+NamedQueries load_job_queries(const std::string& query_path) {
+  Assert(filesystem::is_directory(query_path), "No such directory '" + query_path + "'");
+
+  auto query_names = std::vector<std::string>{};
+  for (const auto& entry : filesystem::directory_iterator(query_path)) {
+    const auto& path = entry.path();
+    if (!filesystem::is_regular_file(path) || path.extension() != ".sql") continue;
+
+    const auto query_name = path.stem().string();
+    if (query_name == "schema" || query_name == "fkindexes") continue;
+
+    query_names.emplace_back(query_name);
+  }
+  Assert(!query_names.empty(), "No queries found in '" + query_path + "'");
+
+  std::sort(query_names.begin(), query_names.end(), job_query_name_less);
+
+  NamedQueries queries;
+  queries.reserve(query_names.size());
+  for (const auto& query_name : query_names) {
+    std::ifstream file{(filesystem::path{query_path} / (query_name + ".sql")).string()};
+    auto query = std::string{std::istreambuf_iterator<char>(file), {}};
+    queries.emplace_back("JOB " + query_name, std::move(query));
+  }
+
+  return queries;
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Loaders for the Join Order Benchmark (JOB, see Leis et al., "How Good Are Query Optimizers, Really?", VLDB 2015). JOB
+ * runs 113 queries with up to 16 joins each on the 21 tables of the IMDB dataset. Neither the data nor the queries are
+ * shipped with Hyrise, see https://github.com/gregrahn/join-order-benchmark for both.
+ */
+
+// The names of the 21 JOB tables
+extern const std::vector<std::string> job_table_names;
+
+/**
+ * Loads the JOB tables from <table_path>/<table name>.csv. The CSV files of the IMDB dataset have no meta files, so
+ * their columns are built in. Strings in these files escape quotes with backslashes. Empty fields are NULL, except for
+ * the id columns, which are not nullable.
+ */
+std::map<std::string, std::shared_ptr<Table>> load_job_tables(const std::string& table_path,
+                                                              const ChunkOffset chunk_size);
+
+/**
+ * Loads the JOB queries, i.e., the .sql files in query_path (e.g., 1a.sql). Unlike in the query files of the
+ * BenchmarkRunner, each file contains a single query, which may span multiple lines. The queries are named after their
+ * files and sorted by their number and letter. schema.sql and fkindexes.sql of the JOB repository are skipped.
+ */
+NamedQueries load_job_queries(const std::string& query_path);
+
+}  // namespace opossum
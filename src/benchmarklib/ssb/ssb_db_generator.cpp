@@ -0,0 +1,336 @@
+#include "ssb_db_generator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark_utilities/random_generator.hpp"
+#include "benchmark_utilities/table_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+// clang-format off
+const auto lineorder_column_types = boost::hana::tuple      <int32_t,      int32_t,         int32_t,      int32_t,      int32_t,      int32_t,         std::string,        int32_t,            int32_t,       int32_t,             int32_t,            int32_t,       int32_t,      int32_t,         int32_t,  int32_t,          std::string>();  // NOLINT
+const auto lineorder_column_names = boost::hana::make_tuple("lo_orderkey", "lo_linenumber", "lo_custkey", "lo_partkey", "lo_suppkey", "lo_orderdate", "lo_orderpriority", "lo_shippriority", "lo_quantity", "lo_extendedprice", "lo_ordtotalprice", "lo_discount", "lo_revenue", "lo_supplycost", "lo_tax", "lo_commitdate", "lo_shipmode");  // NOLINT
+
+const auto customer_column_types = boost::hana::tuple      <int32_t,     std::string, std::string, std::string, std::string, std::string, std::string, std::string>();  // NOLINT
+const auto customer_column_names = boost::hana::make_tuple("c_custkey", "c_name",    "c_address", "c_city",    "c_nation",  "c_region",  "c_phone",   "c_mktsegment");  // NOLINT
+
+const auto supplier_column_types = boost::hana::tuple      <int32_t,     std::string, std::string, std::string, std::string, std::string, std::string>();  // NOLINT
+const auto supplier_column_names = boost::hana::make_tuple("s_suppkey", "s_name",    "s_address", "s_city",    "s_nation",  "s_region",  "s_phone");  // NOLINT
+
+const auto part_column_types = boost::hana::tuple      <int32_t,     std::string, std::string, std::string,  std::string, std::string, std::string, int32_t,  std::string>();  // NOLINT
+const auto part_column_names = boost::hana::make_tuple("p_partkey", "p_name",    "p_mfgr",    "p_category", "p_brand1",  "p_color",   "p_type",    "p_size", "p_container");  // NOLINT
+
+const auto date_column_types = boost::hana::tuple      <int32_t,     std::string, std::string,   std::string, int32_t,  int32_t,          std::string,   int32_t,          int32_t,           int32_t,           int32_t,            int32_t,           std::string,       int32_t,             int32_t,              int32_t,      int32_t>();  // NOLINT
+const auto date_column_names = boost::hana::make_tuple("d_datekey", "d_date",    "d_dayofweek", "d_month",   "d_year", "d_yearmonthnum", "d_yearmonth", "d_daynuminweek", "d_daynuminmonth", "d_daynuminyear", "d_monthnuminyear", "d_weeknuminyear", "d_sellingseason", "d_lastdayinweekfl", "d_lastdayinmonthfl", "d_holidayfl", "d_weekdayfl");  // NOLINT
+
+// clang-format on
+
+// The value domains of TPC-H, which SSB reuses
+const auto nation_names = std::array<std::string, 25>{
+    "ALGERIA", "ARGENTINA", "BRAZIL",       "CANADA",  "EGYPT",  "ETHIOPIA",       "FRANCE",       "GERMANY", "INDIA",
+    "INDONESIA", "IRAN",    "IRAQ",         "JAPAN",   "JORDAN", "KENYA",          "MOROCCO",      "MOZAMBIQUE",
+    "PERU",    "CHINA",     "ROMANIA",      "SAUDI ARABIA", "VIETNAM", "RUSSIA",   "UNITED KINGDOM", "UNITED STATES"};
+const auto nation_region_keys =
+    std::array<size_t, 25>{0, 1, 1, 1, 4, 0, 3, 3, 2, 2, 4, 4, 2, 4, 0, 0, 0, 1, 2, 3, 4, 2, 3, 3, 1};
+const auto region_names = std::array<std::string, 5>{"AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"};
+
+const auto market_segments =
+    std::array<std::string, 5>{"AUTOMOBILE", "BUILDING", "FURNITURE", "MACHINERY", "HOUSEHOLD"};
+const auto order_priorities = std::array<std::string, 5>{"1-URGENT", "2-HIGH", "3-MEDIUM", "4-NOT SPECI", "5-LOW"};
+const auto ship_modes = std::array<std::string, 7>{"REG AIR", "AIR", "RAIL", "SHIP", "TRUCK", "MAIL", "FOB"};
+
+const auto colors = std::array<std::string, 92>{
+    "almond",    "antique",   "aquamarine", "azure",      "beige",     "bisque",     "black",     "blanched",
+    "blue",      "blush",     "brown",      "burlywood",  "burnished", "chartreuse", "chiffon",   "chocolate",
+    "coral",     "cornflower", "cornsilk",  "cream",      "cyan",      "dark",       "deep",      "dim",
+    "dodger",    "drab",      "firebrick",  "floral",     "forest",    "frosted",    "gainsboro", "ghost",
+    "goldenrod", "green",     "grey",       "honeydew",   "hot",       "indian",     "ivory",     "khaki",
+    "lace",      "lavender",  "lawn",       "lemon",      "light",     "lime",       "linen",     "magenta",
+    "maroon",    "medium",    "metallic",   "midnight",   "mint",      "misty",      "moccasin",  "navajo",
+    "navy",      "olive",     "orange",     "orchid",     "pale",      "papaya",     "peach",     "peru",
+    "pink",      "plum",      "powder",     "puff",       "purple",    "red",        "rose",      "rosy",
+    "royal",     "saddle",    "salmon",     "sandy",      "seashell",  "sienna",     "sky",       "slate",
+    "smoke",     "snow",      "spring",     "steel",      "tan",       "thistle",    "tomato",    "turquoise",
+    "violet",    "wheat",     "white",      "yellow"};
+const auto type_syllables_1 = std::array<std::string, 6>{"STANDARD", "SMALL", "MEDIUM", "LARGE", "ECONOMY", "PROMO"};
+const auto type_syllables_2 = std::array<std::string, 5>{"ANODIZED", "BURNISHED", "PLATED", "POLISHED", "BRUSHED"};
+const auto type_syllables_3 = std::array<std::string, 5>{"TIN", "NICKEL", "BRASS", "STEEL", "COPPER"};
+const auto container_syllables_1 = std::array<std::string, 5>{"SM", "LG", "MED", "JUMBO", "WRAP"};
+const auto container_syllables_2 =
+    std::array<std::string, 8>{"CASE", "BOX", "BAG", "JAR", "PKG", "PACK", "CAN", "DRUM"};
+
+const auto month_names = std::array<std::string, 12>{"January", "February", "March",     "April",
+                                                     "May",     "June",     "July",      "August",
+                                                     "September", "October", "November", "December"};
+const auto day_names =
+    std::array<std::string, 7>{"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+
+// The DATE table covers the seven years from 1992-01-01 (a Wednesday) to 1998-12-31
+const auto first_year = 1992;
+const auto last_year = 1998;
+const auto first_day_of_week = size_t{3};
+
+// Orders are committed 30 to 90 days after they were placed, so the last order date is 90 days before 1998-12-31
+const auto max_commit_delay = size_t{90};
+
+class SsbRowGenerator {
+ public:
+  explicit SsbRowGenerator(opossum::RandomGenerator& random) : _random(random) {}
+
+  template <typename Container>
+  const auto& pick(const Container& container) {
+    return container[_random.random_number<size_t>(0, container.size() - 1)];
+  }
+
+  std::string random_string(const size_t min_length, const size_t max_length) {
+    static const auto characters = std::string{"0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ,"};
+    auto string = std::string(_random.random_number<size_t>(min_length, max_length), ' ');
+    for (auto& character : string) {
+      character = pick(characters);
+    }
+    return string;
+  }
+
+  // E.g., "Customer#000000042"
+  static std::string key_name(const std::string& prefix, const size_t key) {
+    const auto digits = std::to_string(key);
+    return prefix + "#" + std::string(digits.size() < 9 ? 9 - digits.size() : 0, '0') + digits;
+  }
+
+  // The first nine characters of the nation name, padded with spaces, plus a digit, e.g., "UNITED KI1"
+  std::string city(const size_t nation_key) {
+    auto city = nation_names[nation_key].substr(0, 9);
+    city.resize(9, ' ');
+    return city + std::to_string(_random.random_number<size_t>(0, 9));
+  }
+
+  std::string phone(const size_t nation_key) {
+    return std::to_string(nation_key + 10) + "-" + std::to_string(_random.random_number<size_t>(100, 999)) + "-" +
+           std::to_string(_random.random_number<size_t>(100, 999)) + "-" +
+           std::to_string(_random.random_number<size_t>(1000, 9999));
+  }
+
+  size_t number(const size_t lower, const size_t upper) { return _random.random_number<size_t>(lower, upper); }
+
+ private:
+  opossum::RandomGenerator& _random;
+};
+
+// The retail price of a part in cents, as defined by TPC-H
+int32_t retail_price(const size_t part_key) {
+  return static_cast<int32_t>(90'000 + ((part_key / 10) % 20'001) + 100 * (part_key % 1'000));
+}
+
+bool is_leap_year(const int32_t year) { return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0; }
+
+/**
+ * Appends one row per day to the date builder and returns the date keys in ascending order. Fixed holidays are New
+ * Year's Day, Independence Day, Christmas Eve, Christmas Day and New Year's Eve.
+ */
+template <typename DateBuilder>
+std::vector<int32_t> generate_date_rows(DateBuilder& date_builder) {
+  static constexpr auto selling_seasons = std::array<const char*, 12>{"Winter", "Winter", "Spring", "Spring",
+                                                                      "Spring", "Summer", "Summer", "Summer",
+                                                                      "Fall",   "Fall",   "Fall",   "Christmas"};
+
+  auto date_keys = std::vector<int32_t>{};
+  auto day_of_week = first_day_of_week;
+
+  for (auto year = first_year; year <= last_year; ++year) {
+    auto day_of_year = 0;
+    auto week_of_year = 1;
+
+    for (auto month = 1; month <= 12; ++month) {
+      static constexpr auto month_lengths = std::array<int, 12>{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+      const auto month_length = month == 2 && is_leap_year(year) ? 29 : month_lengths[month - 1];
+
+      for (auto day = 1; day <= month_length; ++day) {
+        ++day_of_year;
+        const auto date_key = year * 10'000 + month * 100 + day;
+        const auto is_holiday = (month == 1 && day == 1) || (month == 7 && day == 4) ||
+                                (month == 12 && (day == 24 || day == 25 || day == 31));
+        const auto& month_name = month_names[month - 1];
+
+        date_builder.append_row(
+            int32_t{date_key}, month_name + " " + std::to_string(day) + ", " + std::to_string(year),
+            std::string{day_names[day_of_week]}, std::string{month_name}, int32_t{year}, int32_t{year * 100 + month},
+            month_name.substr(0, 3) + std::to_string(year), static_cast<int32_t>(day_of_week + 1), int32_t{day},
+            int32_t{day_of_year}, int32_t{month}, int32_t{week_of_year}, std::string{selling_seasons[month - 1]},
+            int32_t{day_of_week == 6 ? 1 : 0}, int32_t{day == month_length ? 1 : 0}, int32_t{is_holiday ? 1 : 0},
+            int32_t{day_of_week != 0 && day_of_week != 6 ? 1 : 0});
+        date_keys.emplace_back(date_key);
+
+        // Weeks start on Sundays
+        day_of_week = (day_of_week + 1) % 7;
+        if (day_of_week == 0) ++week_of_year;
+      }
+    }
+  }
+
+  return date_keys;
+}
+
+template <typename CustomerBuilder>
+void generate_customer_rows(CustomerBuilder& customer_builder, SsbRowGenerator& generator, size_t customer_count) {
+  for (auto customer_key = size_t{1}; customer_key <= customer_count; ++customer_key) {
+    const auto nation_key = generator.number(0, nation_names.size() - 1);
+    customer_builder.append_row(static_cast<int32_t>(customer_key),
+                                SsbRowGenerator::key_name("Customer", customer_key), generator.random_string(10, 25),
+                                generator.city(nation_key), std::string{nation_names[nation_key]},
+                                std::string{region_names[nation_region_keys[nation_key]]},
+                                generator.phone(nation_key), std::string{generator.pick(market_segments)});
+  }
+}
+
+template <typename SupplierBuilder>
+void generate_supplier_rows(SupplierBuilder& supplier_builder, SsbRowGenerator& generator, size_t supplier_count) {
+  for (auto supplier_key = size_t{1}; supplier_key <= supplier_count; ++supplier_key) {
+    const auto nation_key = generator.number(0, nation_names.size() - 1);
+    supplier_builder.append_row(static_cast<int32_t>(supplier_key),
+                                SsbRowGenerator::key_name("Supplier", supplier_key), generator.random_string(10, 25),
+                                generator.city(nation_key), std::string{nation_names[nation_key]},
+                                std::string{region_names[nation_region_keys[nation_key]]},
+                                generator.phone(nation_key));
+  }
+}
+
+template <typename PartBuilder>
+void generate_part_rows(PartBuilder& part_builder, SsbRowGenerator& generator, size_t part_count) {
+  for (auto part_key = size_t{1}; part_key <= part_count; ++part_key) {
+    // The brand determines the category, which determines the manufacturer, e.g., MFGR#1221 -> MFGR#12 -> MFGR#1
+    const auto manufacturer = "MFGR#" + std::to_string(generator.number(1, 5));
+    const auto category = manufacturer + std::to_string(generator.number(1, 5));
+    const auto& color = generator.pick(colors);
+
+    part_builder.append_row(static_cast<int32_t>(part_key), color + " " + generator.pick(colors),
+                            std::string{manufacturer}, std::string{category},
+                            category + std::to_string(generator.number(1, 40)), std::string{color},
+                            generator.pick(type_syllables_1) + " " + generator.pick(type_syllables_2) + " " +
+                                generator.pick(type_syllables_3),
+                            static_cast<int32_t>(generator.number(1, 50)),
+                            generator.pick(container_syllables_1) + " " + generator.pick(container_syllables_2));
+  }
+}
+
+template <typename LineOrderBuilder>
+void generate_lineorder_rows(LineOrderBuilder& lineorder_builder, SsbRowGenerator& generator, size_t order_count,
+                             size_t customer_count, size_t supplier_count, size_t part_count,
+                             const std::vector<int32_t>& date_keys) {
+  struct Line {
+    size_t part_key;
+    size_t supplier_key;
+    int32_t quantity;
+    int32_t extended_price;
+    int32_t discount;
+    int32_t revenue;
+    int32_t supply_cost;
+    int32_t tax;
+    size_t commit_date_index;
+    std::string ship_mode;
+  };
+
+  auto lines = std::vector<Line>{};
+
+  for (auto order_key = size_t{1}; order_key <= order_count; ++order_key) {
+    const auto customer_key = generator.number(1, customer_count);
+    const auto order_date_index = generator.number(0, date_keys.size() - 1 - max_commit_delay);
+    const auto& order_priority = generator.pick(order_priorities);
+
+    // The total price of an order is the sum of its lines' prices after discount and tax, so lines are generated first
+    lines.resize(generator.number(1, 7));
+    auto total_price = int32_t{0};
+    for (auto& line : lines) {
+      line.part_key = generator.number(1, part_count);
+      line.supplier_key = generator.number(1, supplier_count);
+      line.quantity = static_cast<int32_t>(generator.number(1, 50));
+      line.extended_price = line.quantity * retail_price(line.part_key);
+      line.discount = static_cast<int32_t>(generator.number(0, 10));
+      line.revenue = line.extended_price * (100 - line.discount) / 100;
+      line.supply_cost = 6 * retail_price(line.part_key) / 10;
+      line.tax = static_cast<int32_t>(generator.number(0, 8));
+      line.commit_date_index = order_date_index + generator.number(30, max_commit_delay);
+      line.ship_mode = generator.pick(ship_modes);
+
+      total_price += line.revenue * (100 + line.tax) / 100;
+    }
+
+    for (auto line_index = size_t{0}; line_index < lines.size(); ++line_index) {
+      auto& line = lines[line_index];
+      lineorder_builder.append_row(
+          static_cast<int32_t>(order_key), static_cast<int32_t>(line_index + 1), static_cast<int32_t>(customer_key),
+          static_cast<int32_t>(line.part_key), static_cast<int32_t>(line.supplier_key),
+          int32_t{date_keys[order_date_index]}, std::string{order_priority}, int32_t{0}, int32_t{line.quantity},
+          int32_t{line.extended_price}, int32_t{total_price}, int32_t{line.discount}, int32_t{line.revenue},
+          int32_t{line.supply_cost}, int32_t{line.tax}, int32_t{date_keys[line.commit_date_index]},
+          std::move(line.ship_mode));
+    }
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::unordered_map<SsbTable, std::string> ssb_table_names = {{SsbTable::LineOrder, "lineorder"},
+                                                             {SsbTable::Customer, "customer"},
+                                                             {SsbTable::Supplier, "supplier"},
+                                                             {SsbTable::Part, "part"},
+                                                             {SsbTable::Date, "date"}};
+
+SsbDbGenerator::SsbDbGenerator(float scale_factor, uint32_t chunk_size)
+    : _scale_factor(scale_factor), _chunk_size(chunk_size) {}
+
+std::unordered_map<SsbTable, std::shared_ptr<Table>> SsbDbGenerator::generate() {
+  TableBuilder lineorder_builder{_chunk_size, lineorder_column_types, lineorder_column_names, UseMvcc::Yes};
+  TableBuilder customer_builder{_chunk_size, customer_column_types, customer_column_names, UseMvcc::Yes};
+  TableBuilder supplier_builder{_chunk_size, supplier_column_types, supplier_column_names, UseMvcc::Yes};
+  TableBuilder part_builder{_chunk_size, part_column_types, part_column_names, UseMvcc::Yes};
+  TableBuilder date_builder{_chunk_size, date_column_types, date_column_names, UseMvcc::Yes};
+
+  // Generate at least one row per table, so that the foreign keys of LINEORDER can be drawn for tiny scale factors
+  const auto scaled_count = [&](const float base) {
+    return std::max(size_t{1}, static_cast<size_t>(base * _scale_factor));
+  };
+
+  const auto customer_count = scaled_count(30'000);
+  const auto supplier_count = scaled_count(2'000);
+  const auto order_count = scaled_count(1'500'000);
+
+  // PART grows logarithmically with the scale factor
+  const auto part_count = _scale_factor < 1.0f
+                              ? scaled_count(200'000)
+                              : static_cast<size_t>(200'000 * std::floor(1 + std::log2(_scale_factor)));
+
+  auto random = RandomGenerator{};
+  auto generator = SsbRowGenerator{random};
+
+  const auto date_keys = generate_date_rows(date_builder);
+  generate_customer_rows(customer_builder, generator, customer_count);
+  generate_supplier_rows(supplier_builder, generator, supplier_count);
+  generate_part_rows(part_builder, generator, part_count);
+  generate_lineorder_rows(lineorder_builder, generator, order_count, customer_count, supplier_count, part_count,
+                          date_keys);
+
+  return {{SsbTable::LineOrder, lineorder_builder.finish_table()},
+          {SsbTable::Customer, customer_builder.finish_table()},
+          {SsbTable::Supplier, supplier_builder.finish_table()},
+          {SsbTable::Part, part_builder.finish_table()},
+          {SsbTable::Date, date_builder.finish_table()}};
+}
+
+void SsbDbGenerator::generate_and_store() {
+  const auto tables = generate();
+
+  for (auto& table : tables) {
+    StorageManager::get().add_table(ssb_table_names.at(table.first), table.second);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "storage/chunk.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class SsbTable { LineOrder, Customer, Supplier, Part, Date };
+
+extern std::unordered_map<opossum::SsbTable, std::string> ssb_table_names;
+
+/**
+ * Generates the tables of the Star Schema Benchmark (SSB, see https://www.cs.umb.edu/~poneil/StarSchemaB.PDF) as
+ * opossum::Table instances, like the TpchDbGenerator does for TPC-H. SSB denormalizes TPC-H into the fact table
+ * LINEORDER and the dimension tables CUSTOMER, SUPPLIER, PART and DATE.
+ *
+ * The cardinalities and value domains follow the specification (and ssb-dbgen), e.g., there are 30,000 * scale_factor
+ * customers and 1,500,000 * scale_factor orders with 1-7 lines each. The values are drawn from a RandomGenerator with a
+ * fixed seed instead of dbgen's random number streams, so the data is deterministic, but not identical to the
+ * output of ssb-dbgen. Free-text columns (e.g., addresses) are random strings.
+ *
+ * Dates are stored as integers in the format YYYYMMDD, as specified.
+ */
+class SsbDbGenerator final {
+ public:
+  explicit SsbDbGenerator(float scale_factor, uint32_t chunk_size = Chunk::MAX_SIZE);
+
+  std::unordered_map<SsbTable, std::shared_ptr<Table>> generate();
+
+  /**
+   * Generate the SSB tables and store them in the StorageManager
+   */
+  void generate_and_store();
+
+ private:
+  float _scale_factor;
+  size_t _chunk_size;
+};
+}  // namespace opossum
@@ -0,0 +1,342 @@
+#include "ssb_queries.hpp"
+
+/**
+ * The queries of the Star Schema Benchmark, see https://www.cs.umb.edu/~poneil/StarSchemaB.PDF
+ *
+ * Changes that apply to all queries:
+ *  1. PART and DATE are keywords of the SQL parser, so the tables are quoted
+ */
+
+namespace {
+
+/**
+ * SSB 1.1
+ *
+ * Original:
+ *
+ * SELECT sum(lo_extendedprice*lo_discount) as revenue
+ * FROM lineorder, date
+ * WHERE lo_orderdate = d_datekey
+ *   AND d_year = 1993
+ *   AND lo_discount between 1 and 3
+ *   AND lo_quantity < 25;
+ */
+const char* const ssb_query_1_1 =
+    R"(SELECT SUM(lo_extendedprice*lo_discount) AS revenue
+      FROM lineorder, "date"
+      WHERE lo_orderdate = d_datekey AND d_year = 1993 AND lo_discount BETWEEN 1 AND 3 AND lo_quantity < 25;)";
+
+/**
+ * SSB 1.2
+ *
+ * Original:
+ *
+ * SELECT sum(lo_extendedprice*lo_discount) as revenue
+ * FROM lineorder, date
+ * WHERE lo_orderdate = d_datekey
+ *   AND d_yearmonthnum = 199401
+ *   AND lo_discount between 4 and 6
+ *   AND lo_quantity between 26 and 35;
+ */
+const char* const ssb_query_1_2 =
+    R"(SELECT SUM(lo_extendedprice*lo_discount) AS revenue
+      FROM lineorder, "date"
+      WHERE lo_orderdate = d_datekey AND d_yearmonthnum = 199401 AND lo_discount BETWEEN 4 AND 6
+      AND lo_quantity BETWEEN 26 AND 35;)";
+
+/**
+ * SSB 1.3
+ *
+ * Original:
+ *
+ * SELECT sum(lo_extendedprice*lo_discount) as revenue
+ * FROM lineorder, date
+ * WHERE lo_orderdate = d_datekey
+ *   AND d_weeknuminyear = 6
+ *   AND d_year = 1994
+ *   AND lo_discount between 5 and 7
+ *   AND lo_quantity between 26 and 35;
+ */
+const char* const ssb_query_1_3 =
+    R"(SELECT SUM(lo_extendedprice*lo_discount) AS revenue
+      FROM lineorder, "date"
+      WHERE lo_orderdate = d_datekey AND d_weeknuminyear = 6 AND d_year = 1994 AND lo_discount BETWEEN 5 AND 7
+      AND lo_quantity BETWEEN 26 AND 35;)";
+
+/**
+ * SSB 2.1
+ *
+ * Original:
+ *
+ * SELECT sum(lo_revenue), d_year, p_brand1
+ * FROM lineorder, date, part, supplier
+ * WHERE lo_orderdate = d_datekey
+ *   AND lo_partkey = p_partkey
+ *   AND lo_suppkey = s_suppkey
+ *   AND p_category = 'MFGR#12'
+ *   AND s_region = 'AMERICA'
+ * GROUP BY d_year, p_brand1
+ * ORDER BY d_year, p_brand1;
+ */
+const char* const ssb_query_2_1 =
+    R"(SELECT SUM(lo_revenue), d_year, p_brand1
+      FROM lineorder, "date", "part", supplier
+      WHERE lo_orderdate = d_datekey AND lo_partkey = p_partkey AND lo_suppkey = s_suppkey AND p_category = 'MFGR#12'
+      AND s_region = 'AMERICA'
+      GROUP BY d_year, p_brand1
+      ORDER BY d_year, p_brand1;)";
+
+/**
+ * SSB 2.2
+ *
+ * Original:
+ *
+ * SELECT sum(lo_revenue), d_year, p_brand1
+ * FROM lineorder, date, part, supplier
+ * WHERE lo_orderdate = d_datekey
+ *   AND lo_partkey = p_partkey
+ *   AND lo_suppkey = s_suppkey
+ *   AND p_brand1 between 'MFGR#2221' and 'MFGR#2228'
+ *   AND s_region = 'ASIA'
+ * GROUP BY d_year, p_brand1
+ * ORDER BY d_year, p_brand1;
+ */
+const char* const ssb_query_2_2 =
+    R"(SELECT SUM(lo_revenue), d_year, p_brand1
+      FROM lineorder, "date", "part", supplier
+      WHERE lo_orderdate = d_datekey AND lo_partkey = p_partkey AND lo_suppkey = s_suppkey
+      AND p_brand1 BETWEEN 'MFGR#2221' AND 'MFGR#2228' AND s_region = 'ASIA'
+      GROUP BY d_year, p_brand1
+      ORDER BY d_year, p_brand1;)";
+
+/**
+ * SSB 2.3
+ *
+ * Original:
+ *
+ * SELECT sum(lo_revenue), d_year, p_brand1
+ * FROM lineorder, date, part, supplier
+ * WHERE lo_orderdate = d_datekey
+ *   AND lo_partkey = p_partkey
+ *   AND lo_suppkey = s_suppkey
+ *   AND p_brand1 = 'MFGR#2239'
+ *   AND s_region = 'EUROPE'
+ * GROUP BY d_year, p_brand1
+ * ORDER BY d_year, p_brand1;
+ */
+const char* const ssb_query_2_3 =
+    R"(SELECT SUM(lo_revenue), d_year, p_brand1
+      FROM lineorder, "date", "part", supplier
+      WHERE lo_orderdate = d_datekey AND lo_partkey = p_partkey AND lo_suppkey = s_suppkey AND p_brand1 = 'MFGR#2239'
+      AND s_region = 'EUROPE'
+      GROUP BY d_year, p_brand1
+      ORDER BY d_year, p_brand1;)";
+
+/**
+ * SSB 3.1
+ *
+ * Original:
+ *
+ * SELECT c_nation, s_nation, d_year, sum(lo_revenue) as revenue
+ * FROM customer, lineorder, supplier, date
+ * WHERE lo_custkey = c_custkey
+ *   AND lo_suppkey = s_suppkey
+ *   AND lo_orderdate = d_datekey
+ *   AND c_region = 'ASIA'
+ *   AND s_region = 'ASIA'
+ *   AND d_year >= 1992 and d_year <= 1997
+ * GROUP BY c_nation, s_nation, d_year
+ * ORDER BY d_year asc, revenue desc;
+ */
+const char* const ssb_query_3_1 =
+    R"(SELECT c_nation, s_nation, d_year, SUM(lo_revenue) AS revenue
+      FROM customer, lineorder, supplier, "date"
+      WHERE lo_custkey = c_custkey AND lo_suppkey = s_suppkey AND lo_orderdate = d_datekey AND c_region = 'ASIA'
+      AND s_region = 'ASIA' AND d_year >= 1992 AND d_year <= 1997
+      GROUP BY c_nation, s_nation, d_year
+      ORDER BY d_year ASC, revenue DESC;)";
+
+/**
+ * SSB 3.2
+ *
+ * Original:
+ *
+ * SELECT c_city, s_city, d_year, sum(lo_revenue) as revenue
+ * FROM customer, lineorder, supplier, date
+ * WHERE lo_custkey = c_custkey
+ *   AND lo_suppkey = s_suppkey
+ *   AND lo_orderdate = d_datekey
+ *   AND c_nation = 'UNITED STATES'
+ *   AND s_nation = 'UNITED STATES'
+ *   AND d_year >= 1992 and d_year <= 1997
+ * GROUP BY c_city, s_city, d_year
+ * ORDER BY d_year asc, revenue desc;
+ */
+const char* const ssb_query_3_2 =
+    R"(SELECT c_city, s_city, d_year, SUM(lo_revenue) AS revenue
+      FROM customer, lineorder, supplier, "date"
+      WHERE lo_custkey = c_custkey AND lo_suppkey = s_suppkey AND lo_orderdate = d_datekey
+      AND c_nation = 'UNITED STATES' AND s_nation = 'UNITED STATES' AND d_year >= 1992 AND d_year <= 1997
+      GROUP BY c_city, s_city, d_year
+      ORDER BY d_year ASC, revenue DESC;)";
+
+/**
+ * SSB 3.3
+ *
+ * Original:
+ *
+ * SELECT c_city, s_city, d_year, sum(lo_revenue) as revenue
+ * FROM customer, lineorder, supplier, date
+ * WHERE lo_custkey = c_custkey
+ *   AND lo_suppkey = s_suppkey
+ *   AND lo_orderdate = d_datekey
+ *   AND (c_city='UNITED KI1' or c_city='UNITED KI5')
+ *   AND (s_city='UNITED KI1' or s_city='UNITED KI5')
+ *   AND d_year >= 1992 and d_year <= 1997
+ * GROUP BY c_city, s_city, d_year
+ * ORDER BY d_year asc, revenue desc;
+ */
+// const char* const ssb_query_3_3 =
+//    R"(SELECT c_city, s_city, d_year, SUM(lo_revenue) AS revenue
+//      FROM customer, lineorder, supplier, "date"
+//      WHERE lo_custkey = c_custkey AND lo_suppkey = s_suppkey AND lo_orderdate = d_datekey
+//      AND (c_city = 'UNITED KI1' OR c_city = 'UNITED KI5') AND (s_city = 'UNITED KI1' OR s_city = 'UNITED KI5')
+//      AND d_year >= 1992 AND d_year <= 1997
+//      GROUP BY c_city, s_city, d_year
+//      ORDER BY d_year ASC, revenue DESC;)";
+
+/**
+ * SSB 3.4
+ *
+ * Original:
+ *
+ * SELECT c_city, s_city, d_year, sum(lo_revenue) as revenue
+ * FROM customer, lineorder, supplier, date
+ * WHERE lo_custkey = c_custkey
+ *   AND lo_suppkey = s_suppkey
+ *   AND lo_orderdate = d_datekey
+ *   AND (c_city='UNITED KI1' or c_city='UNITED KI5')
+ *   AND (s_city='UNITED KI1' or s_city='UNITED KI5')
+ *   AND d_yearmonth = 'Dec1997'
+ * GROUP BY c_city, s_city, d_year
+ * ORDER BY d_year asc, revenue desc;
+ */
+// const char* const ssb_query_3_4 =
+//    R"(SELECT c_city, s_city, d_year, SUM(lo_revenue) AS revenue
+//      FROM customer, lineorder, supplier, "date"
+//      WHERE lo_custkey = c_custkey AND lo_suppkey = s_suppkey AND lo_orderdate = d_datekey
+//      AND (c_city = 'UNITED KI1' OR c_city = 'UNITED KI5') AND (s_city = 'UNITED KI1' OR s_city = 'UNITED KI5')
+//      AND d_yearmonth = 'Dec1997'
+//      GROUP BY c_city, s_city, d_year
+//      ORDER BY d_year ASC, revenue DESC;)";
+
+/**
+ * SSB 4.1
+ *
+ * Original:
+ *
+ * SELECT d_year, c_nation, sum(lo_revenue - lo_supplycost) as profit
+ * FROM date, customer, supplier, part, lineorder
+ * WHERE lo_custkey = c_custkey
+ *   AND lo_suppkey = s_suppkey
+ *   AND lo_partkey = p_partkey
+ *   AND lo_orderdate = d_datekey
+ *   AND c_region = 'AMERICA'
+ *   AND s_region = 'AMERICA'
+ *   AND (p_mfgr = 'MFGR#1' or p_mfgr = 'MFGR#2')
+ * GROUP BY d_year, c_nation
+ * ORDER BY d_year, c_nation;
+ *
+ * Changes:
+ *  1. OR is not supported. Manufacturers are MFGR#1 to MFGR#5, so the disjunction is replaced with the equivalent
+ *     BETWEEN 'MFGR#1' AND 'MFGR#2'
+ */
+const char* const ssb_query_4_1 =
+    R"(SELECT d_year, c_nation, SUM(lo_revenue - lo_supplycost) AS profit
+      FROM "date", customer, supplier, "part", lineorder
+      WHERE lo_custkey = c_custkey AND lo_suppkey = s_suppkey AND lo_partkey = p_partkey AND lo_orderdate = d_datekey
+      AND c_region = 'AMERICA' AND s_region = 'AMERICA' AND p_mfgr BETWEEN 'MFGR#1' AND 'MFGR#2'
+      GROUP BY d_year, c_nation
+      ORDER BY d_year, c_nation;)";
+
+/**
+ * SSB 4.2
+ *
+ * Original:
+ *
+ * SELECT d_year, s_nation, p_category, sum(lo_revenue - lo_supplycost) as profit
+ * FROM date, customer, supplier, part, lineorder
+ * WHERE lo_custkey = c_custkey
+ *   AND lo_suppkey = s_suppkey
+ *   AND lo_partkey = p_partkey
+ *   AND lo_orderdate = d_datekey
+ *   AND c_region = 'AMERICA'
+ *   AND s_region = 'AMERICA'
+ *   AND (d_year = 1997 or d_year = 1998)
+ *   AND (p_mfgr = 'MFGR#1' or p_mfgr = 'MFGR#2')
+ * GROUP BY d_year, s_nation, p_category
+ * ORDER BY d_year, s_nation, p_category;
+ *
+ * Changes:
+ *  1. OR is not supported, the disjunctions are replaced with equivalent BETWEENs (see SSB 4.1)
+ */
+const char* const ssb_query_4_2 =
+    R"(SELECT d_year, s_nation, p_category, SUM(lo_revenue - lo_supplycost) AS profit
+      FROM "date", customer, supplier, "part", lineorder
+      WHERE lo_custkey = c_custkey AND lo_suppkey = s_suppkey AND lo_partkey = p_partkey AND lo_orderdate = d_datekey
+      AND c_region = 'AMERICA' AND s_region = 'AMERICA' AND d_year BETWEEN 1997 AND 1998
+      AND p_mfgr BETWEEN 'MFGR#1' AND 'MFGR#2'
+      GROUP BY d_year, s_nation, p_category
+      ORDER BY d_year, s_nation, p_category;)";
+
+/**
+ * SSB 4.3
+ *
+ * Original:
+ *
+ * SELECT d_year, s_city, p_brand1, sum(lo_revenue - lo_supplycost) as profit
+ * FROM date, customer, supplier, part, lineorder
+ * WHERE lo_custkey = c_custkey
+ *   AND lo_suppkey = s_suppkey
+ *   AND lo_partkey = p_partkey
+ *   AND lo_orderdate = d_datekey
+ *   AND c_region = 'AMERICA'
+ *   AND s_nation = 'UNITED STATES'
+ *   AND (d_year = 1997 or d_year = 1998)
+ *   AND p_category = 'MFGR#14'
+ * GROUP BY d_year, s_city, p_brand1
+ * ORDER BY d_year, s_city, p_brand1;
+ *
+ * Changes:
+ *  1. OR is not supported, the disjunction is replaced with an equivalent BETWEEN
+ */
+const char* const ssb_query_4_3 =
+    R"(SELECT d_year, s_city, p_brand1, SUM(lo_revenue - lo_supplycost) AS profit
+      FROM "date", customer, supplier, "part", lineorder
+      WHERE lo_custkey = c_custkey AND lo_suppkey = s_suppkey AND lo_partkey = p_partkey AND lo_orderdate = d_datekey
+      AND c_region = 'AMERICA' AND s_nation = 'UNITED STATES' AND d_year BETWEEN 1997 AND 1998
+      AND p_category = 'MFGR#14'
+      GROUP BY d_year, s_city, p_brand1
+      ORDER BY d_year, s_city, p_brand1;)";
+
+}  // namespace
+
+namespace opossum {
+
+const std::map<std::string, const char*> ssb_queries = {
+    {"1.1", ssb_query_1_1},
+    {"1.2", ssb_query_1_2},
+    {"1.3", ssb_query_1_3},
+    {"2.1", ssb_query_2_1},
+    {"2.2", ssb_query_2_2},
+    {"2.3", ssb_query_2_3},
+    {"3.1", ssb_query_3_1},
+    {"3.2", ssb_query_3_2},
+    /* {"3.3", ssb_query_3_3}, Enable once we support OR in WHERE condition */
+    /* {"3.4", ssb_query_3_4}, Enable once we support OR in WHERE condition */
+    {"4.1", ssb_query_4_1},
+    {"4.2", ssb_query_4_2},
+    {"4.3", ssb_query_4_3},
+};
+
+}  // namespace opossum
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <map>
+#include <string>
+
+namespace opossum {
+
+/**
+ * Contains all supported queries of the Star Schema Benchmark, identified by their flight and number (e.g., "2.3").
+ * Use ordered map to have queries sorted by query id. This allows for guaranteed execution order when iterating over
+ * the queries.
+ */
+extern const std::map<std::string, const char*> ssb_queries;
+
+}  // namespace opossum
@@ -6,10 +6,20 @@ extern "C" {
 #include <rnd.h>
 }
 
+#include <algorithm>
+#include <map>
+#include <string>
+#include <unordered_map>
 #include <utility>
 
+#include "benchmark_utilities/table_builder.hpp"
+#include "logical_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
+#include "utils/assert.hpp"
 
 /**
  * Declare tpch_dbgen function we use that are not exposed by tpch-dbgen via headers
@@ -17,30 +27,30 @@ extern "C" {
 extern "C" {
 void row_start(int t);
 void row_stop(int t);
+void NthElement(DSS_HUGE N, DSS_HUGE* StartSeed);
 }
 
 extern char** asc_date;
-extern seed_t Seed[];
 
 namespace {
 
 // clang-format off
-const auto customer_column_types = boost::hana::tuple      <int32_t,    std::string, std::string, int32_t,       std::string, float,       std::string,    std::string>();  // NOLINT
+const auto customer_column_types = boost::hana::tuple      <int32_t,    std::string, std::string, int32_t,       std::string, int64_t,     std::string,    std::string>();  // NOLINT
 const auto customer_column_names = boost::hana::make_tuple("c_custkey", "c_name",    "c_address", "c_nationkey", "c_phone",   "c_acctbal", "c_mktsegment", "c_comment"); // NOLINT
 
-const auto order_column_types = boost::hana::tuple      <int32_t,     int32_t,     std::string,     float,          std::string,   std::string,       std::string, int32_t,          std::string>();  // NOLINT
+const auto order_column_types = boost::hana::tuple      <int32_t,     int32_t,     std::string,     int64_t,        int32_t,       std::string,       std::string, int32_t,          std::string>();  // NOLINT
 const auto order_column_names = boost::hana::make_tuple("o_orderkey", "o_custkey", "o_orderstatus", "o_totalprice", "o_orderdate", "o_orderpriority", "o_clerk",   "o_shippriority", "o_comment");  // NOLINT
 
-const auto lineitem_column_types = boost::hana::tuple      <int32_t,     int32_t,     int32_t,     int32_t,        float,        float,             float,        float,   std::string,    std::string,    std::string,  std::string,    std::string,     std::string,      std::string,  std::string>();  // NOLINT
+const auto lineitem_column_types = boost::hana::tuple      <int32_t,     int32_t,     int32_t,     int32_t,        int64_t,      int64_t,           int64_t,      int64_t, std::string,    std::string,    int32_t,      int32_t,        int32_t,         std::string,      std::string,  std::string>();  // NOLINT
 const auto lineitem_column_names = boost::hana::make_tuple("l_orderkey", "l_partkey", "l_suppkey", "l_linenumber", "l_quantity", "l_extendedprice", "l_discount", "l_tax", "l_returnflag", "l_linestatus", "l_shipdate", "l_commitdate", "l_receiptdate", "l_shipinstruct", "l_shipmode", "l_comment");  // NOLINT
 
-const auto part_column_types = boost::hana::tuple      <int32_t,    std::string, std::string, std::string, std::string, int32_t,  std::string,   int32_t,        std::string>();  // NOLINT
+const auto part_column_types = boost::hana::tuple      <int32_t,    std::string, std::string, std::string, std::string, int32_t,  std::string,   int64_t,        std::string>();  // NOLINT
 const auto part_column_names = boost::hana::make_tuple("p_partkey", "p_name",    "p_mfgr",    "p_brand",   "p_type",    "p_size", "p_container", "p_retailsize", "p_comment");  // NOLINT
 
-const auto partsupp_column_types = boost::hana::tuple<     int32_t,      int32_t,      int32_t,       float,           std::string>();  // NOLINT
+const auto partsupp_column_types = boost::hana::tuple<     int32_t,      int32_t,      int32_t,       int64_t,         std::string>();  // NOLINT
 const auto partsupp_column_names = boost::hana::make_tuple("ps_partkey", "ps_suppkey", "ps_availqty", "ps_supplycost", "ps_comment");  // NOLINT
 
-const auto supplier_column_types = boost::hana::tuple<     int32_t,     std::string, std::string, int32_t,       std::string, float,       std::string>();  // NOLINT
+const auto supplier_column_types = boost::hana::tuple<     int32_t,     std::string, std::string, int32_t,       std::string, int64_t,     std::string>();  // NOLINT
 const auto supplier_column_names = boost::hana::make_tuple("s_suppkey", "s_name",    "s_address", "s_nationkey", "s_phone",   "s_acctbal", "s_comment");  // NOLINT
 
 const auto nation_column_types = boost::hana::tuple<     int32_t,       std::string, int32_t,       std::string>();  // NOLINT
@@ -51,86 +61,19 @@ const auto region_column_names = boost::hana::make_tuple("r_regionkey", "r_name"
 
 // clang-format on
 
-/**
- * Helper to build a table with a static (specified by template args `ColumnTypes`) column type layout. Keeps a vector
- * for each column and appends values to them in append_row(). Automatically creates chunks in accordance with the
- * specified chunk size.
- *
- * No real need to tie this to TPCH, but atm it is only used here so that's where it resides.
- */
-template <typename... DataTypes>
-class TableBuilder {
- public:
-  template <typename... Strings>
-  TableBuilder(size_t chunk_size, const boost::hana::tuple<DataTypes...>& column_types,
-               const boost::hana::tuple<Strings...>& column_names, opossum::UseMvcc use_mvcc)
-      : _use_mvcc(use_mvcc) {
-    /**
-     * Create a tuple ((column_name0, column_type0), (column_name1, column_type1), ...) so we can iterate over the
-     * columns.
-     * fold_left as below does this in order, I think boost::hana::zip_with() doesn't, which is why I'm doing two steps
-     * here.
-     */
-    const auto column_names_and_data_types = boost::hana::zip_with(
-        [&](auto column_type, auto column_name) {
-          return boost::hana::make_tuple(column_name, opossum::data_type_from_type<decltype(column_type)>());
-        },
-        column_types, column_names);
-
-    // Iterate over the column types/names and create the columns.
-    opossum::TableColumnDefinitions column_definitions;
-    boost::hana::fold_left(column_names_and_data_types, column_definitions,
-                           [](auto& column_definitions, auto column_name_and_type) -> decltype(auto) {
-                             column_definitions.emplace_back(column_name_and_type[boost::hana::llong_c<0>],
-                                                             column_name_and_type[boost::hana::llong_c<1>]);
-                             return column_definitions;
-                           });
-    _table = std::make_shared<opossum::Table>(column_definitions, opossum::TableType::Data, chunk_size, use_mvcc);
-  }
-
-  std::shared_ptr<opossum::Table> finish_table() {
-    if (_current_chunk_row_count() > 0) {
-      _emit_chunk();
-    }
+// Monetary values and quantities are DECIMAL(15,2)s, dates are DATEs. Both are stored as integers, see LogicalType.
+using LogicalTypes = std::unordered_map<std::string, opossum::LogicalType>;
+const auto money_type = opossum::LogicalType::decimal(15, 2);
+const auto date_type = opossum::LogicalType::date();
 
-    return _table;
-  }
-
-  void append_row(DataTypes&&... column_values) {
-    // Create a tuple ([&column_vector0, value0], ...)
-    auto vectors_and_values = boost::hana::zip_with(
-        [](auto& vector, auto&& value) { return boost::hana::make_tuple(std::reference_wrapper(vector), value); },
-        _column_vectors, boost::hana::make_tuple(std::forward<DataTypes>(column_values)...));
-
-    // Add the values to their respective column vector
-    boost::hana::for_each(vectors_and_values, [](auto vector_and_value) {
-      vector_and_value[boost::hana::llong_c<0>].get().push_back(vector_and_value[boost::hana::llong_c<1>]);
-    });
-
-    if (_current_chunk_row_count() >= _table->max_chunk_size()) {
-      _emit_chunk();
-    }
-  }
-
- private:
-  std::shared_ptr<opossum::Table> _table;
-  opossum::UseMvcc _use_mvcc;
-  boost::hana::tuple<opossum::pmr_concurrent_vector<DataTypes>...> _column_vectors;
-
-  size_t _current_chunk_row_count() const { return _column_vectors[boost::hana::llong_c<0>].size(); }
-
-  void _emit_chunk() {
-    opossum::ChunkColumns chunk_columns;
-
-    // Create a column from each column vector and add it to the Chunk, then re-initialize the vector
-    boost::hana::for_each(_column_vectors, [&](auto&& vector) {
-      using T = typename std::decay_t<decltype(vector)>::value_type;
-      chunk_columns.push_back(std::make_shared<opossum::ValueColumn<T>>(std::move(vector)));
-      vector = std::decay_t<decltype(vector)>();
-    });
-    _table->append_chunk(chunk_columns);
-  }
-};
+const auto customer_logical_types = LogicalTypes{{"c_acctbal", money_type}};
+const auto order_logical_types = LogicalTypes{{"o_totalprice", money_type}, {"o_orderdate", date_type}};
+const auto lineitem_logical_types = LogicalTypes{
+    {"l_quantity", money_type}, {"l_extendedprice", money_type}, {"l_discount", money_type}, {"l_tax", money_type},
+    {"l_shipdate", date_type},  {"l_commitdate", date_type},     {"l_receiptdate", date_type}};
+const auto part_logical_types = LogicalTypes{{"p_retailsize", money_type}};
+const auto partsupp_logical_types = LogicalTypes{{"ps_supplycost", money_type}};
+const auto supplier_logical_types = LogicalTypes{{"s_acctbal", money_type}};
 
 std::unordered_map<opossum::TpchTable, std::underlying_type_t<opossum::TpchTable>> tpch_table_to_dbgen_id = {
     {opossum::TpchTable::Part, PART},     {opossum::TpchTable::PartSupp, PSUPP}, {opossum::TpchTable::Supplier, SUPP},
@@ -156,10 +99,106 @@ DSSType _call_dbgen_mk(size_t idx, MKRetType (*mk_fn)(DSS_HUGE, DSSType* val, Ar
   return value;
 }
 
-float _convert_money(DSS_HUGE cents) {
-  const auto dollars = cents / 100;
-  cents %= 100;
-  return dollars + (static_cast<float>(cents)) / 100.0f;
+// dbgen generates monetary values in cents, i.e., as DECIMAL(15,2)s are stored
+int64_t _convert_money(DSS_HUGE cents) { return static_cast<int64_t>(cents); }
+
+// dbgen generates quantities as integers
+int64_t _convert_quantity(DSS_HUGE quantity) { return static_cast<int64_t>(quantity) * 100; }
+
+/**
+ * Advances the random number streams of a dbgen table and of its child table as if `row_count` rows had been
+ * generated. row_stop() advances each stream to its boundary after every row, so each row consumes exactly `boundary`
+ * random numbers of each stream. This is what dbgen does for its -C/-S options, see sd_order() etc.
+ */
+void _dbgen_skip_rows(int dbgen_table_id, size_t row_count) {
+  for (auto stream_id = 0; stream_id <= MAX_STREAM; ++stream_id) {
+    auto& seed = Seed[stream_id];
+    if (seed.table == dbgen_table_id || seed.table == tdefs[dbgen_table_id].child) {
+      NthElement(static_cast<DSS_HUGE>(row_count) * seed.boundary, &seed.value);
+    }
+  }
+}
+
+/**
+ * The following functions append the rows [begin_row, end_row) of the TPCH tables to the builders. The random number
+ * streams of the calling thread need to be positioned at begin_row (see _dbgen_skip_rows()).
+ */
+
+template <typename CustomerBuilder>
+void _generate_customer_rows(CustomerBuilder& customer_builder, size_t begin_row, size_t end_row) {
+  for (auto row_idx = begin_row; row_idx < end_row; row_idx++) {
+    auto customer = _call_dbgen_mk<customer_t>(row_idx + 1, mk_cust, opossum::TpchTable::Customer);
+    customer_builder.append_row(customer.custkey, customer.name, customer.address, customer.nation_code, customer.phone,
+                                _convert_money(customer.acctbal), customer.mktsegment, customer.comment);
+  }
+}
+
+template <typename OrderBuilder, typename LineitemBuilder>
+void _generate_order_and_lineitem_rows(OrderBuilder& order_builder, LineitemBuilder& lineitem_builder,
+                                       size_t begin_row, size_t end_row, float scale_factor) {
+  for (auto order_idx = begin_row; order_idx < end_row; ++order_idx) {
+    const auto order = _call_dbgen_mk<order_t>(order_idx + 1, mk_order, opossum::TpchTable::Orders, 0l, scale_factor);
+
+    order_builder.append_row(order.okey, order.custkey, std::string(1, order.orderstatus),
+                             _convert_money(order.totalprice), opossum::date_to_days(order.odate), order.opriority,
+                             order.clerk,
+                             order.spriority, order.comment);
+
+    for (auto line_idx = 0; line_idx < order.lines; ++line_idx) {
+      const auto& lineitem = order.l[line_idx];
+
+      lineitem_builder.append_row(lineitem.okey, lineitem.partkey, lineitem.suppkey, lineitem.lcnt,
+                                  _convert_quantity(lineitem.quantity), _convert_money(lineitem.eprice),
+                                  _convert_money(lineitem.discount), _convert_money(lineitem.tax),
+                                  std::string(1, lineitem.rflag[0]), std::string(1, lineitem.lstatus[0]),
+                                  opossum::date_to_days(lineitem.sdate), opossum::date_to_days(lineitem.cdate),
+                                  opossum::date_to_days(lineitem.rdate), lineitem.shipinstruct, lineitem.shipmode,
+                                  lineitem.comment);
+    }
+  }
+}
+
+template <typename PartBuilder, typename PartsuppBuilder>
+void _generate_part_and_partsupp_rows(PartBuilder& part_builder, PartsuppBuilder& partsupp_builder, size_t begin_row,
+                                      size_t end_row, float scale_factor) {
+  for (auto part_idx = begin_row; part_idx < end_row; ++part_idx) {
+    const auto part = _call_dbgen_mk<part_t>(part_idx + 1, mk_part, opossum::TpchTable::Part, scale_factor);
+
+    part_builder.append_row(part.partkey, part.name, part.mfgr, part.brand, part.type, part.size, part.container,
+                            _convert_money(part.retailprice), part.comment);
+
+    for (const auto& partsupp : part.s) {
+      partsupp_builder.append_row(partsupp.partkey, partsupp.suppkey, partsupp.qty, _convert_money(partsupp.scost),
+                                  partsupp.comment);
+    }
+  }
+}
+
+template <typename SupplierBuilder>
+void _generate_supplier_rows(SupplierBuilder& supplier_builder, size_t begin_row, size_t end_row) {
+  for (auto supplier_idx = begin_row; supplier_idx < end_row; ++supplier_idx) {
+    const auto supplier = _call_dbgen_mk<supplier_t>(supplier_idx + 1, mk_supp, opossum::TpchTable::Supplier);
+
+    supplier_builder.append_row(supplier.suppkey, supplier.name, supplier.address, supplier.nation_code, supplier.phone,
+                                _convert_money(supplier.acctbal), supplier.comment);
+  }
+}
+
+template <typename NationBuilder, typename RegionBuilder>
+void _generate_nation_and_region_rows(NationBuilder& nation_builder, RegionBuilder& region_builder) {
+  const auto nation_count = static_cast<size_t>(tdefs[NATION].base);
+
+  for (size_t nation_idx = 0; nation_idx < nation_count; ++nation_idx) {
+    const auto nation = _call_dbgen_mk<code_t>(nation_idx + 1, mk_nation, opossum::TpchTable::Nation);
+    nation_builder.append_row(nation.code, nation.text, nation.join, nation.comment);
+  }
+
+  const auto region_count = static_cast<size_t>(tdefs[REGION].base);
+
+  for (size_t region_idx = 0; region_idx < region_count; ++region_idx) {
+    const auto region = _call_dbgen_mk<code_t>(region_idx + 1, mk_region, opossum::TpchTable::Region);
+    region_builder.append_row(region.code, region.text, region.comment);
+  }
 }
 
 /**
@@ -198,110 +237,172 @@ TpchDbGenerator::TpchDbGenerator(float scale_factor, uint32_t chunk_size)
     : _scale_factor(scale_factor), _chunk_size(chunk_size) {}
 
 std::unordered_map<TpchTable, std::shared_ptr<Table>> TpchDbGenerator::generate() {
-  TableBuilder customer_builder{_chunk_size, customer_column_types, customer_column_names, UseMvcc::Yes};
-  TableBuilder order_builder{_chunk_size, order_column_types, order_column_names, UseMvcc::Yes};
-  TableBuilder lineitem_builder{_chunk_size, lineitem_column_types, lineitem_column_names, UseMvcc::Yes};
-  TableBuilder part_builder{_chunk_size, part_column_types, part_column_names, UseMvcc::Yes};
-  TableBuilder partsupp_builder{_chunk_size, partsupp_column_types, partsupp_column_names, UseMvcc::Yes};
-  TableBuilder supplier_builder{_chunk_size, supplier_column_types, supplier_column_names, UseMvcc::Yes};
+  TableBuilder customer_builder{_chunk_size, customer_column_types, customer_column_names, UseMvcc::Yes,
+                                customer_logical_types};
+  TableBuilder order_builder{_chunk_size, order_column_types, order_column_names, UseMvcc::Yes, order_logical_types};
+  TableBuilder lineitem_builder{_chunk_size, lineitem_column_types, lineitem_column_names, UseMvcc::Yes,
+                                lineitem_logical_types};
+  TableBuilder part_builder{_chunk_size, part_column_types, part_column_names, UseMvcc::Yes, part_logical_types};
+  TableBuilder partsupp_builder{_chunk_size, partsupp_column_types, partsupp_column_names, UseMvcc::Yes,
+                                partsupp_logical_types};
+  TableBuilder supplier_builder{_chunk_size, supplier_column_types, supplier_column_names, UseMvcc::Yes,
+                                supplier_logical_types};
   TableBuilder nation_builder{_chunk_size, nation_column_types, nation_column_names, UseMvcc::Yes};
   TableBuilder region_builder{_chunk_size, region_column_types, region_column_names, UseMvcc::Yes};
 
   dbgen_reset_seeds();
 
-  /**
-   * CUSTOMER
-   */
   const auto customer_count = static_cast<size_t>(tdefs[CUST].base * _scale_factor);
+  _generate_customer_rows(customer_builder, 0, customer_count);
 
-  for (size_t row_idx = 0; row_idx < customer_count; row_idx++) {
-    auto customer = _call_dbgen_mk<customer_t>(row_idx + 1, mk_cust, TpchTable::Customer);
-    customer_builder.append_row(customer.custkey, customer.name, customer.address, customer.nation_code, customer.phone,
-                                _convert_money(customer.acctbal), customer.mktsegment, customer.comment);
-  }
-
-  /**
-   * ORDER and LINEITEM
-   */
   const auto order_count = static_cast<size_t>(tdefs[ORDER].base * _scale_factor);
+  _generate_order_and_lineitem_rows(order_builder, lineitem_builder, 0, order_count, _scale_factor);
 
-  for (size_t order_idx = 0; order_idx < order_count; ++order_idx) {
-    const auto order = _call_dbgen_mk<order_t>(order_idx + 1, mk_order, TpchTable::Orders, 0l, _scale_factor);
-
-    order_builder.append_row(order.okey, order.custkey, std::string(1, order.orderstatus),
-                             _convert_money(order.totalprice), order.odate, order.opriority, order.clerk,
-                             order.spriority, order.comment);
+  const auto part_count = static_cast<size_t>(tdefs[PART].base * _scale_factor);
+  _generate_part_and_partsupp_rows(part_builder, partsupp_builder, 0, part_count, _scale_factor);
 
-    for (auto line_idx = 0; line_idx < order.lines; ++line_idx) {
-      const auto& lineitem = order.l[line_idx];
+  const auto supplier_count = static_cast<size_t>(tdefs[SUPP].base * _scale_factor);
+  _generate_supplier_rows(supplier_builder, 0, supplier_count);
 
-      lineitem_builder.append_row(lineitem.okey, lineitem.partkey, lineitem.suppkey, lineitem.lcnt, lineitem.quantity,
-                                  _convert_money(lineitem.eprice), _convert_money(lineitem.discount),
-                                  _convert_money(lineitem.tax), std::string(1, lineitem.rflag[0]),
-                                  std::string(1, lineitem.lstatus[0]), lineitem.sdate, lineitem.cdate, lineitem.rdate,
-                                  lineitem.shipinstruct, lineitem.shipmode, lineitem.comment);
-    }
-  }
+  _generate_nation_and_region_rows(nation_builder, region_builder);
 
   /**
-   * PART and PARTSUPP
+   * Clean up dbgen every time we finish table generation to avoid memory leaks in dbgen
    */
-  const auto part_count = static_cast<size_t>(tdefs[PART].base * _scale_factor);
-
-  for (size_t part_idx = 0; part_idx < part_count; ++part_idx) {
-    const auto part = _call_dbgen_mk<part_t>(part_idx + 1, mk_part, TpchTable::Part, _scale_factor);
+  _dbgen_cleanup();
 
-    part_builder.append_row(part.partkey, part.name, part.mfgr, part.brand, part.type, part.size, part.container,
-                            _convert_money(part.retailprice), part.comment);
+  return {
+      {TpchTable::Customer, customer_builder.finish_table()}, {TpchTable::Orders, order_builder.finish_table()},
+      {TpchTable::LineItem, lineitem_builder.finish_table()}, {TpchTable::Part, part_builder.finish_table()},
+      {TpchTable::PartSupp, partsupp_builder.finish_table()}, {TpchTable::Supplier, supplier_builder.finish_table()},
+      {TpchTable::Nation, nation_builder.finish_table()},     {TpchTable::Region, region_builder.finish_table()}};
+}
 
-    for (const auto& partsupp : part.s) {
-      partsupp_builder.append_row(partsupp.partkey, partsupp.suppkey, partsupp.qty, _convert_money(partsupp.scost),
-                                  partsupp.comment);
-    }
-  }
+std::unordered_map<TpchTable, std::shared_ptr<Table>> TpchDbGenerator::generate_parallel(
+    const std::optional<ColumnEncodingSpec>& encoding_spec) {
+  // O_CKEY_SD and L_PKEY_SD use 64 bit random numbers for these scale factors, which _dbgen_skip_rows() cannot skip
+  Assert(_scale_factor < 30'000, "Scale factor too large for parallel generation");
 
   /**
-   * SUPPLIER
+   * dbgen initializes some static data (e.g., its text pool and date strings) when the first row of a table is
+   * generated. Do this before the jobs run so that they only read it.
    */
-  const auto supplier_count = static_cast<size_t>(tdefs[SUPP].base * _scale_factor);
+  dbgen_reset_seeds();
+  _call_dbgen_mk<customer_t>(1, mk_cust, TpchTable::Customer);
+  _call_dbgen_mk<order_t>(1, mk_order, TpchTable::Orders, 0l, _scale_factor);
+  _call_dbgen_mk<part_t>(1, mk_part, TpchTable::Part, _scale_factor);
+  _call_dbgen_mk<supplier_t>(1, mk_supp, TpchTable::Supplier);
 
-  for (size_t supplier_idx = 0; supplier_idx < supplier_count; ++supplier_idx) {
-    const auto supplier = _call_dbgen_mk<supplier_t>(supplier_idx + 1, mk_supp, TpchTable::Supplier);
+  // The tables generated by a job, in the order of the job's TpchTables
+  struct JobResult {
+    std::vector<TpchTable> tpch_tables;
+    std::vector<std::shared_ptr<Table>> tables;
+  };
 
-    supplier_builder.append_row(supplier.suppkey, supplier.name, supplier.address, supplier.nation_code, supplier.phone,
-                                _convert_money(supplier.acctbal), supplier.comment);
-  }
+  auto job_results = std::vector<std::shared_ptr<JobResult>>{};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
 
   /**
-   * NATION
+   * Adds jobs that generate `rows_per_job` rows of a table (and the matching rows of its child table) each.
+   * generate_rows(begin_row, end_row) returns the generated tables. Always adds at least one job, so that tables without
+   * rows are created as well.
    */
-  const auto nation_count = static_cast<size_t>(tdefs[NATION].base);
+  const auto add_jobs = [&](const std::vector<TpchTable>& tpch_tables, const size_t row_count,
+                            const size_t rows_per_job, const auto& generate_rows) {
+    const auto dbgen_table_id = tpch_table_to_dbgen_id.at(tpch_tables.front());
 
-  for (size_t nation_idx = 0; nation_idx < nation_count; ++nation_idx) {
-    const auto nation = _call_dbgen_mk<code_t>(nation_idx + 1, mk_nation, TpchTable::Nation);
-    nation_builder.append_row(nation.code, nation.text, nation.join, nation.comment);
-  }
+    auto begin_row = size_t{0};
+    do {
+      const auto end_row = std::min(begin_row + rows_per_job, row_count);
 
-  /**
-   * REGION
-   */
-  const auto region_count = static_cast<size_t>(tdefs[REGION].base);
+      auto job_result = std::make_shared<JobResult>();
+      job_result->tpch_tables = tpch_tables;
+      job_results.emplace_back(job_result);
 
-  for (size_t region_idx = 0; region_idx < region_count; ++region_idx) {
-    const auto region = _call_dbgen_mk<code_t>(region_idx + 1, mk_region, TpchTable::Region);
-    region_builder.append_row(region.code, region.text, region.comment);
-  }
+      jobs.emplace_back(std::make_shared<JobTask>([=, &encoding_spec]() {
+        // The random number streams are thread local
+        dbgen_reset_seeds();
+        _dbgen_skip_rows(dbgen_table_id, begin_row);
+
+        job_result->tables = generate_rows(begin_row, end_row);
+
+        if (encoding_spec) {
+          for (const auto& table : job_result->tables) {
+            ChunkEncoder::encode_all_chunks(table, *encoding_spec);
+          }
+        }
+      }));
+
+      begin_row = end_row;
+    } while (begin_row < row_count);
+  };
+
+  // Each job generates (at most) one chunk of the parent table, i.e., one or more chunks of its child table
+  const auto chunk_size = _chunk_size;
+  const auto scale_factor = _scale_factor;
+
+  const auto customer_count = static_cast<size_t>(tdefs[CUST].base * _scale_factor);
+  add_jobs({TpchTable::Customer}, customer_count, chunk_size, [=](size_t begin_row, size_t end_row) {
+    TableBuilder customer_builder{chunk_size, customer_column_types, customer_column_names, UseMvcc::Yes,
+                                  customer_logical_types};
+    _generate_customer_rows(customer_builder, begin_row, end_row);
+    return std::vector<std::shared_ptr<Table>>{customer_builder.finish_table()};
+  });
+
+  const auto order_count = static_cast<size_t>(tdefs[ORDER].base * _scale_factor);
+  add_jobs({TpchTable::Orders, TpchTable::LineItem}, order_count, chunk_size, [=](size_t begin_row, size_t end_row) {
+    TableBuilder order_builder{chunk_size, order_column_types, order_column_names, UseMvcc::Yes, order_logical_types};
+    TableBuilder lineitem_builder{chunk_size, lineitem_column_types, lineitem_column_names, UseMvcc::Yes,
+                                  lineitem_logical_types};
+    _generate_order_and_lineitem_rows(order_builder, lineitem_builder, begin_row, end_row, scale_factor);
+    return std::vector<std::shared_ptr<Table>>{order_builder.finish_table(), lineitem_builder.finish_table()};
+  });
+
+  const auto part_count = static_cast<size_t>(tdefs[PART].base * _scale_factor);
+  add_jobs({TpchTable::Part, TpchTable::PartSupp}, part_count, chunk_size, [=](size_t begin_row, size_t end_row) {
+    TableBuilder part_builder{chunk_size, part_column_types, part_column_names, UseMvcc::Yes, part_logical_types};
+    TableBuilder partsupp_builder{chunk_size, partsupp_column_types, partsupp_column_names, UseMvcc::Yes,
+                                  partsupp_logical_types};
+    _generate_part_and_partsupp_rows(part_builder, partsupp_builder, begin_row, end_row, scale_factor);
+    return std::vector<std::shared_ptr<Table>>{part_builder.finish_table(), partsupp_builder.finish_table()};
+  });
+
+  const auto supplier_count = static_cast<size_t>(tdefs[SUPP].base * _scale_factor);
+  add_jobs({TpchTable::Supplier}, supplier_count, chunk_size, [=](size_t begin_row, size_t end_row) {
+    TableBuilder supplier_builder{chunk_size, supplier_column_types, supplier_column_names, UseMvcc::Yes,
+                                  supplier_logical_types};
+    _generate_supplier_rows(supplier_builder, begin_row, end_row);
+    return std::vector<std::shared_ptr<Table>>{supplier_builder.finish_table()};
+  });
+
+  // NATION and REGION are tiny and always generated by a single job
+  add_jobs({TpchTable::Nation, TpchTable::Region}, 0, chunk_size, [=](size_t, size_t) {
+    TableBuilder nation_builder{chunk_size, nation_column_types, nation_column_names, UseMvcc::Yes};
+    TableBuilder region_builder{chunk_size, region_column_types, region_column_names, UseMvcc::Yes};
+    _generate_nation_and_region_rows(nation_builder, region_builder);
+    return std::vector<std::shared_ptr<Table>>{nation_builder.finish_table(), region_builder.finish_table()};
+  });
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
 
-  /**
-   * Clean up dbgen every time we finish table generation to avoid memory leaks in dbgen
-   */
   _dbgen_cleanup();
 
-  return {
-      {TpchTable::Customer, customer_builder.finish_table()}, {TpchTable::Orders, order_builder.finish_table()},
-      {TpchTable::LineItem, lineitem_builder.finish_table()}, {TpchTable::Part, part_builder.finish_table()},
-      {TpchTable::PartSupp, partsupp_builder.finish_table()}, {TpchTable::Supplier, supplier_builder.finish_table()},
-      {TpchTable::Nation, nation_builder.finish_table()},     {TpchTable::Region, region_builder.finish_table()}};
+  // Concatenate the chunks generated by the jobs in the order of their rows
+  auto tables = std::unordered_map<TpchTable, std::shared_ptr<Table>>{};
+  for (const auto& job_result : job_results) {
+    for (auto table_idx = size_t{0}; table_idx < job_result->tables.size(); ++table_idx) {
+      const auto& job_table = job_result->tables[table_idx];
+
+      const auto [iter, inserted] = tables.emplace(job_result->tpch_tables[table_idx], job_table);
+      if (inserted) continue;
+
+      for (const auto& chunk : job_table->chunks()) {
+        iter->second->append_chunk(chunk);
+      }
+    }
+  }
+
+  return tables;
 }
 
 void TpchDbGenerator::generate_and_store() {
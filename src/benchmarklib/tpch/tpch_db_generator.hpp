@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -11,6 +12,7 @@
 
 #include "resolve_type.hpp"
 #include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "storage/value_column.hpp"
 #include "types.hpp"
@@ -28,7 +30,8 @@ extern std::unordered_map<opossum::TpchTable, std::string> tpch_table_names;
  * Wrapper around the official tpch-dbgen tool, making it directly generate opossum::Table instances without having
  * to generate and then load .tbl files.
  *
- * NOT thread safe because the underlying tpch-dbgen is not since it has global data and malloc races.
+ * NOT thread safe because the underlying tpch-dbgen is not since it has global data and malloc races. Only
+ * generate_parallel() uses multiple threads, which it coordinates.
  */
 class TpchDbGenerator final {
  public:
@@ -36,6 +39,17 @@ class TpchDbGenerator final {
 
   std::unordered_map<TpchTable, std::shared_ptr<Table>> generate();
 
+  /**
+   * Generates the same tables as generate(), but splits the tables into ranges of chunk_size rows that are generated
+   * concurrently by jobs on the CurrentScheduler. Each job positions dbgen's (thread local) random number streams at
+   * the first row of its range, like dbgen's -C/-S options do. If an encoding_spec is passed, each job encodes the
+   * chunks it generated right away.
+   *
+   * The chunks of LINEITEM, which are generated alongside the ORDERS ranges, may contain fewer than chunk_size rows.
+   */
+  std::unordered_map<TpchTable, std::shared_ptr<Table>> generate_parallel(
+      const std::optional<ColumnEncodingSpec>& encoding_spec = std::nullopt);
+
   /**
    * Generate the TPCH tables and store them in the StorageManager
    */
@@ -28,8 +28,8 @@ namespace {
  *      l_returnflag, l_linestatus
  *
  * Changes:
- *  1. dates are not supported
- *    a. use strings as data type for now
+ *  1. date literals and intervals are not supported
+ *    a. give dates as strings, which are converted for the DATE columns
  *    b. pre-calculate date operation
  *  2. implicit type conversions for arithmetic operations are not supported
  *    a. changed 1 to 1.0 explicitly
@@ -133,8 +133,8 @@ const char* const tpch_query_3 =
  *
  * Changes:
  *  1. Random values are hardcoded
- *  2. dates are not supported
- *    a. use strings as data type for now
+ *  2. date literals and intervals are not supported
+ *    a. give dates as strings, which are converted for the DATE columns
  *    b. pre-calculate date operation
  */
 // const char* const tpch_query_4 =
@@ -175,8 +175,8 @@ const char* const tpch_query_3 =
  *
  * Changes:
  *  1. Random values are hardcoded
- *  2. dates are not supported
- *    a. use strings as data type for now
+ *  2. date literals and intervals are not supported
+ *    a. give dates as strings, which are converted for the DATE columns
  *    b. pre-calculate date operation
  *  3. implicit type conversions for arithmetic operations are not supported
  *    a. changed 1 to 1.0 explicitly
@@ -201,8 +201,8 @@ const char* const tpch_query_5 =
  * AND L_DISCOUNT BETWEEN .06 - 0.01 AND .06 + 0.01 AND L_QUANTITY < 24
  *
  * Changes:
- *  1. dates are not supported
- *    a. use strings as data type for now
+ *  1. date literals and intervals are not supported
+ *    a. give dates as strings, which are converted for the DATE columns
  *    b. pre-calculate date operation
  *  2. arithmetic expressions with constants are not resolved automatically yet, so pre-calculate them as well
  */
@@ -242,8 +242,8 @@ const char* const tpch_query_6 =
  *
  * Changes:
  *  1. Random values are hardcoded
- *  2. dates are not supported
- *    a. use strings as data type for now
+ *  2. date literals and intervals are not supported
+ *    a. give dates as strings, which are converted for the DATE columns
  *    b. pre-calculate date operation
  *  3. Extract is not supported
  *    a. Use full date instead
@@ -327,8 +327,8 @@ const char* const tpch_query_7 =
  *
  * Changes:
  *  1. Random values are hardcoded
- *  2. dates are not supported
- *    a. use strings as data type for now
+ *  2. date literals and intervals are not supported
+ *    a. give dates as strings, which are converted for the DATE columns
  *  3. Extract is not supported
  *    a. Use full date instead
  */
@@ -425,8 +425,8 @@ const char* const tpch_query_9 =
  *
  * Changes:
  *  1. Random values are hardcoded
- *  2. dates are not supported
- *    a. use strings as data type for now
+ *  2. date literals and intervals are not supported
+ *    a. give dates as strings, which are converted for the DATE columns
  *    b. pre-calculate date operation
  *  3. implicit type conversions for arithmetic operations are not supported
  *    a. changed 1 to 1.0 explicitly
@@ -506,8 +506,8 @@ const char* const tpch_query_10 =
  *
  * Changes:
  *  1. Random values are hardcoded
- *  2. dates are not supported
- *    a. use strings as data type for now
+ *  2. date literals and intervals are not supported
+ *    a. give dates as strings, which are converted for the DATE columns
  *    b. pre-calculate date operation
  */
 // const char* const tpch_query_12 =
@@ -561,8 +561,8 @@ const char* const tpch_query_13 =
  *
  * Changes:
  *  1. Random values are hardcoded
- *  2. dates are not supported
- *    a. use strings as data type for now
+ *  2. date literals and intervals are not supported
+ *    a. give dates as strings, which are converted for the DATE columns
  *    b. pre-calculate date operation
  *  3. implicit type conversions for arithmetic operations are not supported
  *    a. changed 1 to 1.0 explicitly
@@ -599,8 +599,8 @@ const char* const tpch_query_13 =
  *
  * Changes:
  *  1. Random values are hardcoded
- *  2. dates are not supported
- *    a. use strings as data type for now
+ *  2. date literals and intervals are not supported
+ *    a. give dates as strings, which are converted for the DATE columns
  *    b. pre-calculate date operation
  */
 // const char* const tpch_query_15 =
@@ -785,8 +785,8 @@ const char* const tpch_query_13 =
  *
  * Changes:
  *  1. Random values are hardcoded
- *  2. dates are not supported
- *    a. use strings as data type for now
+ *  2. date literals and intervals are not supported
+ *    a. give dates as strings, which are converted for the DATE columns
  *    b. pre-calculate date operation
 
  */
@@ -830,8 +830,8 @@ const char* const tpch_query_13 =
  *
  * Changes:
  *  1. Random values are hardcoded
- *  2. dates are not supported
- *    a. use strings as data type for now
+ *  2. date literals and intervals are not supported
+ *    a. give dates as strings, which are converted for the DATE columns
  *    b. pre-calculate date operation
 
  */
@@ -1,5 +1,6 @@
 #include <boost/asio/io_service.hpp>
 
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 
@@ -7,6 +8,7 @@
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/topology.hpp"
 #include "server/server.hpp"
+#include "sql/slow_query_log.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/load_table.hpp"
 
@@ -18,6 +20,13 @@ int main(int argc, char* argv[]) {
       port = static_cast<uint16_t>(std::atoi(argv[1]));
     }
 
+    // Usage: server [port] [slow_query_log_path] [slow_query_threshold_ms]
+    if (argc >= 3) {
+      const auto threshold = std::chrono::milliseconds{argc >= 4 ? std::atoi(argv[3]) : 1000};
+      opossum::SlowQueryLog::get().enable(argv[2], threshold);
+      std::cout << "Logging queries slower than " << threshold.count() << " ms to " << argv[2] << std::endl;
+    }
+
     // Set scheduler so that the server can execute the tasks on separate threads.
     opossum::CurrentScheduler::set(
         std::make_shared<opossum::NodeQueueScheduler>(opossum::Topology::create_numa_topology()));
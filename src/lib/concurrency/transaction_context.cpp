@@ -38,6 +38,8 @@ TransactionContext::~TransactionContext() {
                 return !has_registered_operators || committed_or_rolled_back;
               }()),
               "Has registered operators but has neither been committed nor rolled back.");
+
+  _deregister();
 }
 
 TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
@@ -61,6 +63,8 @@ bool TransactionContext::rollback() {
 
   if (!success) return false;
 
+  _deregister();
+
   for (const auto& op : _rw_operators) {
     op->rollback_records();
   }
@@ -75,6 +79,8 @@ bool TransactionContext::commit_async(std::function<void(TransactionID)> callbac
 
   if (!success) return false;
 
+  _deregister();
+
   for (const auto& op : _rw_operators) {
     op->commit_records(commit_id());
   }
@@ -194,4 +200,11 @@ bool TransactionContext::_transition(TransactionPhase from_phase, TransactionPha
   }
 }
 
+void TransactionContext::_deregister() {
+  if (!_is_registered) return;
+
+  _is_registered = false;
+  TransactionManager::get()._deregister_transaction(_transaction_id, _snapshot_commit_id);
+}
+
 }  // namespace opossum
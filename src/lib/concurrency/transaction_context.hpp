@@ -108,10 +108,14 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   /**
    * Add an operator to the list of read-write operators.
-   * Update must not call this because it consists of a Delete and an Insert, which call this themselves.
+   * Update only calls this when it updates values in place. Otherwise, it consists of a Delete and an Insert, which
+   * call this themselves.
    */
   void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) { _rw_operators.push_back(op); }
 
+  // Whether this transaction has (uncommitted) modifications that only it can see
+  bool has_read_write_operators() const { return !_rw_operators.empty(); }
+
   /**
    * @defgroup Update the counter of active operators
    * @{
@@ -171,9 +175,15 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   bool _transition(TransactionPhase from_phase, TransactionPhase to_phase, TransactionPhase end_phase);
 
+  // Tells the TransactionManager that this transaction does not read anymore, i.e., once it commits or rolls back
+  void _deregister();
+
  private:
   const TransactionID _transaction_id;
   const CommitID _snapshot_commit_id;
+
+  // Whether the TransactionManager tracks the snapshot commit id of this context (see new_transaction_context())
+  bool _is_registered{false};
   std::vector<std::shared_ptr<AbstractReadWriteOperator>> _rw_operators;
 
   std::atomic<TransactionPhase> _phase;
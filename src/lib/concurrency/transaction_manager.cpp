@@ -1,6 +1,9 @@
 #include "transaction_manager.hpp"
 
 #include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "commit_context.hpp"
 #include "transaction_context.hpp"
@@ -18,6 +21,10 @@ void TransactionManager::reset() {
   manager._next_transaction_id = INITIAL_TRANSACTION_ID;
   manager._last_commit_id = INITIAL_COMMIT_ID;
   manager._last_commit_context = std::make_shared<CommitContext>(INITIAL_COMMIT_ID);
+
+  std::lock_guard<std::mutex> lock(manager._active_snapshot_commit_ids_mutex);
+  manager._active_snapshot_commit_ids.clear();
+  manager._active_transaction_contexts.clear();
 }
 
 TransactionManager::TransactionManager()
@@ -27,8 +34,47 @@ TransactionManager::TransactionManager()
 
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
+CommitID TransactionManager::lowest_active_snapshot_commit_id() const {
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+  if (_active_snapshot_commit_ids.empty()) return _last_commit_id;
+  return *_active_snapshot_commit_ids.begin();
+}
+
 std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
-  return std::make_shared<TransactionContext>(_next_transaction_id++, _last_commit_id);
+  // The snapshot commit id is taken and registered atomically, so that lowest_active_snapshot_commit_id() never
+  // returns a commit id that is higher than the snapshot of a transaction that is just being created.
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+
+  const auto snapshot_commit_id = _last_commit_id.load();
+  _active_snapshot_commit_ids.insert(snapshot_commit_id);
+
+  auto context = std::make_shared<TransactionContext>(_next_transaction_id++, snapshot_commit_id);
+  context->_is_registered = true;
+  _active_transaction_contexts.emplace(context->transaction_id(), context);
+  return context;
+}
+
+std::vector<std::shared_ptr<TransactionContext>> TransactionManager::active_transaction_contexts() const {
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+
+  auto contexts = std::vector<std::shared_ptr<TransactionContext>>{};
+  contexts.reserve(_active_transaction_contexts.size());
+  for (const auto& [transaction_id, weak_context] : _active_transaction_contexts) {
+    // The context might be in its destructor, waiting to deregister itself
+    if (auto context = weak_context.lock()) contexts.emplace_back(std::move(context));
+  }
+  return contexts;
+}
+
+void TransactionManager::_deregister_transaction(const TransactionID transaction_id,
+                                                 const CommitID snapshot_commit_id) {
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+
+  // The transaction might have been created before the last reset()
+  const auto iter = _active_snapshot_commit_ids.find(snapshot_commit_id);
+  if (iter != _active_snapshot_commit_ids.end()) _active_snapshot_commit_ids.erase(iter);
+
+  _active_transaction_contexts.erase(transaction_id);
 }
 
 /**
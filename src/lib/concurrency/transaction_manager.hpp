@@ -2,7 +2,11 @@
 
 #include <atomic>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
 
 #include "types.hpp"
 
@@ -52,11 +56,25 @@ class TransactionManager : private Noncopyable {
 
   CommitID last_commit_id() const;
 
+  /**
+   * The lowest snapshot commit id of all transactions that have neither committed nor rolled back, or last_commit_id()
+   * if there are none.
+   * Every transaction, including those that are created later, sees all commits up to this commit id. Used to decide
+   * which versions of values can be merged (see ValueDeltas).
+   */
+  CommitID lowest_active_snapshot_commit_id() const;
+
   /**
    * Creates a new transaction context
    */
   std::shared_ptr<TransactionContext> new_transaction_context();
 
+  /**
+   * The contexts created by new_transaction_context() that have neither committed nor rolled back yet, ordered by their
+   * transaction id
+   */
+  std::vector<std::shared_ptr<TransactionContext>> active_transaction_contexts() const;
+
  private:
   friend class TransactionContext;
 
@@ -68,6 +86,9 @@ class TransactionManager : private Noncopyable {
   std::shared_ptr<CommitContext> _new_commit_context();
   void _try_increment_last_commit_id(std::shared_ptr<CommitContext> context);
 
+  // Called by the TransactionContexts created by new_transaction_context() once they commit, roll back or are destroyed
+  void _deregister_transaction(const TransactionID transaction_id, const CommitID snapshot_commit_id);
+
  private:
   std::atomic<TransactionID> _next_transaction_id;
   // TransactionID = 0 means "not set" in the MVCC columns
@@ -79,5 +100,11 @@ class TransactionManager : private Noncopyable {
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
   std::shared_ptr<CommitContext> _last_commit_context;
+
+  // The snapshot commit ids and the contexts of all transactions that have not been deregistered yet. The contexts are
+  // not owned, as a context deregisters itself when it is destroyed.
+  mutable std::mutex _active_snapshot_commit_ids_mutex;
+  std::multiset<CommitID> _active_snapshot_commit_ids;
+  std::map<TransactionID, std::weak_ptr<TransactionContext>> _active_transaction_contexts;
 };
 }  // namespace opossum
@@ -9,6 +9,8 @@
 #include "sql/Expr.h"
 #include "sql/SelectStatement.h"
 
+#include "cost_model/cost_feature.hpp"
+#include "operators/abstract_operator.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/table.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
@@ -140,6 +142,12 @@ const std::unordered_map<JoinMode, std::string> join_mode_to_string = {
 
 const std::unordered_map<UnionMode, std::string> union_mode_to_string = {{UnionMode::Positions, "UnionPositions"}};
 
+const std::unordered_map<SetOperationType, std::string> set_operation_type_to_string = {
+    {SetOperationType::Intersect, "Intersect"}, {SetOperationType::Except, "Except"}};
+
+const std::unordered_map<SetOperationMode, std::string> set_operation_mode_to_string = {
+    {SetOperationMode::Distinct, "Distinct"}, {SetOperationMode::All, "All"}};
+
 const boost::bimap<AggregateFunction, std::string> aggregate_function_to_string =
     make_bimap<AggregateFunction, std::string>({
         {AggregateFunction::Min, "MIN"},
@@ -172,4 +180,65 @@ const std::unordered_map<VectorCompressionType, std::string> vector_compression_
 const boost::bimap<TableType, std::string> table_type_to_string =
     make_bimap<TableType, std::string>({{TableType::Data, "Data"}, {TableType::References, "References"}});
 
+const boost::bimap<OperatorType, std::string> operator_type_to_string = make_bimap<OperatorType, std::string>({
+    {OperatorType::Aggregate, "Aggregate"},
+    {OperatorType::Delete, "Delete"},
+    {OperatorType::Difference, "Difference"},
+    {OperatorType::Distinct, "Distinct"},
+    {OperatorType::ExportBinary, "ExportBinary"},
+    {OperatorType::ExportCsv, "ExportCsv"},
+    {OperatorType::GetMetaTable, "GetMetaTable"},
+    {OperatorType::GetTable, "GetTable"},
+    {OperatorType::ImportBinary, "ImportBinary"},
+    {OperatorType::ImportCsv, "ImportCsv"},
+    {OperatorType::IndexScan, "IndexScan"},
+    {OperatorType::Insert, "Insert"},
+    {OperatorType::JitOperatorWrapper, "JitOperatorWrapper"},
+    {OperatorType::JoinHash, "JoinHash"},
+    {OperatorType::JoinIndex, "JoinIndex"},
+    {OperatorType::JoinNestedLoop, "JoinNestedLoop"},
+    {OperatorType::JoinSortMerge, "JoinSortMerge"},
+    {OperatorType::Limit, "Limit"},
+    {OperatorType::Print, "Print"},
+    {OperatorType::Product, "Product"},
+    {OperatorType::Projection, "Projection"},
+    {OperatorType::RebuildChunks, "RebuildChunks"},
+    {OperatorType::SetOperationHash, "SetOperationHash"},
+    {OperatorType::Sort, "Sort"},
+    {OperatorType::TableScan, "TableScan"},
+    {OperatorType::TableWrapper, "TableWrapper"},
+    {OperatorType::UnionAll, "UnionAll"},
+    {OperatorType::UnionPositions, "UnionPositions"},
+    {OperatorType::Update, "Update"},
+    {OperatorType::Validate, "Validate"},
+    {OperatorType::CreateView, "CreateView"},
+    {OperatorType::DropView, "DropView"},
+    {OperatorType::ShowColumns, "ShowColumns"},
+    {OperatorType::ShowTables, "ShowTables"},
+    {OperatorType::Mock, "Mock"},
+});
+
+const boost::bimap<CostFeature, std::string> cost_feature_to_string = make_bimap<CostFeature, std::string>({
+    {CostFeature::LeftInputRowCount, "LeftInputRowCount"},
+    {CostFeature::RightInputRowCount, "RightInputRowCount"},
+    {CostFeature::InputRowCountProduct, "InputRowCountProduct"},
+    {CostFeature::LeftInputReferenceRowCount, "LeftInputReferenceRowCount"},
+    {CostFeature::RightInputReferenceRowCount, "RightInputReferenceRowCount"},
+    {CostFeature::LeftInputRowCountLogN, "LeftInputRowCountLogN"},
+    {CostFeature::RightInputRowCountLogN, "RightInputRowCountLogN"},
+    {CostFeature::LargerInputRowCount, "LargerInputRowCount"},
+    {CostFeature::SmallerInputRowCount, "SmallerInputRowCount"},
+    {CostFeature::LargerInputReferenceRowCount, "LargerInputReferenceRowCount"},
+    {CostFeature::SmallerInputReferenceRowCount, "SmallerInputReferenceRowCount"},
+    {CostFeature::OutputRowCount, "OutputRowCount"},
+    {CostFeature::OutputReferenceRowCount, "OutputReferenceRowCount"},
+    {CostFeature::LeftDataType, "LeftDataType"},
+    {CostFeature::RightDataType, "RightDataType"},
+    {CostFeature::PredicateCondition, "PredicateCondition"},
+    {CostFeature::LeftInputIsReferences, "LeftInputIsReferences"},
+    {CostFeature::RightInputIsReferences, "RightInputIsReferences"},
+    {CostFeature::RightOperandIsColumn, "RightOperandIsColumn"},
+    {CostFeature::LeftInputIsMajor, "LeftInputIsMajor"},
+});
+
 }  // namespace opossum
@@ -11,7 +11,9 @@
 
 namespace opossum {
 
+enum class CostFeature;
 enum class EncodingType : uint8_t;
+enum class OperatorType;
 enum class VectorCompressionType : uint8_t;
 enum class TableType;
 
@@ -24,10 +26,14 @@ extern const std::unordered_map<hsql::OrderType, OrderByMode> order_type_to_orde
 extern const std::unordered_map<ExpressionType, std::string> expression_type_to_operator_string;
 extern const std::unordered_map<JoinMode, std::string> join_mode_to_string;
 extern const std::unordered_map<UnionMode, std::string> union_mode_to_string;
+extern const std::unordered_map<SetOperationType, std::string> set_operation_type_to_string;
+extern const std::unordered_map<SetOperationMode, std::string> set_operation_mode_to_string;
 extern const boost::bimap<AggregateFunction, std::string> aggregate_function_to_string;
 extern const boost::bimap<DataType, std::string> data_type_to_string;
 extern const std::unordered_map<EncodingType, std::string> encoding_type_to_string;
 extern const std::unordered_map<VectorCompressionType, std::string> vector_compression_type_to_string;
 extern const boost::bimap<TableType, std::string> table_type_to_string;
+extern const boost::bimap<OperatorType, std::string> operator_type_to_string;
+extern const boost::bimap<CostFeature, std::string> cost_feature_to_string;
 
 }  // namespace opossum
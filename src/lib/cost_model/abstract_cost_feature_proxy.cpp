@@ -1,5 +1,6 @@
 #include "abstract_cost_feature_proxy.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 #include "logical_query_plan/abstract_lqp_node.hpp"
@@ -19,13 +20,14 @@ CostFeatureVariant AbstractCostFeatureProxy::extract_feature(const CostFeature c
       return extract_feature(CostFeature::RightInputIsReferences).boolean()
                  ? extract_feature(CostFeature::RightInputRowCount).scalar()
                  : 0.0f;
+    // Clamped, so that empty inputs yield 0 instead of NaN (0 * -inf)
     case CostFeature::LeftInputRowCountLogN: {
       const auto row_count = extract_feature(CostFeature::LeftInputRowCount).scalar();
-      return row_count * std::log(row_count);
+      return row_count * std::log(std::max(row_count, 1.0f));
     }
     case CostFeature::RightInputRowCountLogN: {
       const auto row_count = extract_feature(CostFeature::RightInputRowCount).scalar();
-      return row_count * std::log(row_count);
+      return row_count * std::log(std::max(row_count, 1.0f));
     }
     case CostFeature::LargerInputRowCount: {
       const auto left_input_row_count = extract_feature(CostFeature::LeftInputRowCount).scalar();
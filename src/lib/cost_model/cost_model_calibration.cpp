@@ -0,0 +1,187 @@
+#include "cost_model_calibration.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "abstract_cost_feature_proxy.hpp"
+#include "cost_feature_operator_proxy.hpp"
+#include "operators/abstract_operator.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+/**
+ * Solves the linear equation system `matrix * x = vector` in place using Gaussian elimination with partial pivoting.
+ * Matrix is expected to be square and regular.
+ */
+std::vector<double> solve_linear_equation_system(std::vector<std::vector<double>> matrix, std::vector<double> vector) {
+  const auto size = vector.size();
+
+  for (auto pivot_idx = size_t{0}; pivot_idx < size; ++pivot_idx) {
+    auto max_row_idx = pivot_idx;
+    for (auto row_idx = pivot_idx + 1; row_idx < size; ++row_idx) {
+      if (std::abs(matrix[row_idx][pivot_idx]) > std::abs(matrix[max_row_idx][pivot_idx])) max_row_idx = row_idx;
+    }
+    std::swap(matrix[pivot_idx], matrix[max_row_idx]);
+    std::swap(vector[pivot_idx], vector[max_row_idx]);
+
+    for (auto row_idx = pivot_idx + 1; row_idx < size; ++row_idx) {
+      const auto factor = matrix[row_idx][pivot_idx] / matrix[pivot_idx][pivot_idx];
+      for (auto column_idx = pivot_idx; column_idx < size; ++column_idx) {
+        matrix[row_idx][column_idx] -= factor * matrix[pivot_idx][column_idx];
+      }
+      vector[row_idx] -= factor * vector[pivot_idx];
+    }
+  }
+
+  auto solution = std::vector<double>(size);
+  for (auto row_idx = size; row_idx-- > 0;) {
+    auto sum = vector[row_idx];
+    for (auto column_idx = row_idx + 1; column_idx < size; ++column_idx) {
+      sum -= matrix[row_idx][column_idx] * solution[column_idx];
+    }
+    solution[row_idx] = sum / matrix[row_idx][row_idx];
+  }
+
+  return solution;
+}
+
+}  // namespace
+
+namespace opossum {
+
+const CostModelCalibration::OperatorFeatures& CostModelCalibration::default_operator_features() {
+  static const auto operator_features = OperatorFeatures{
+      {OperatorType::TableScan,
+       {CostFeature::LeftInputRowCount, CostFeature::LeftInputReferenceRowCount, CostFeature::OutputRowCount}},
+      {OperatorType::JoinHash,
+       {CostFeature::LeftInputRowCount, CostFeature::RightInputRowCount, CostFeature::LeftInputReferenceRowCount,
+        CostFeature::RightInputReferenceRowCount, CostFeature::OutputRowCount}},
+      {OperatorType::JoinSortMerge,
+       {CostFeature::LeftInputRowCountLogN, CostFeature::RightInputRowCountLogN,
+        CostFeature::LeftInputReferenceRowCount, CostFeature::RightInputReferenceRowCount,
+        CostFeature::OutputRowCount}},
+      {OperatorType::JoinNestedLoop, {CostFeature::InputRowCountProduct, CostFeature::OutputRowCount}},
+      {OperatorType::Product, {CostFeature::InputRowCountProduct}},
+      {OperatorType::UnionPositions,
+       {CostFeature::LeftInputRowCountLogN, CostFeature::RightInputRowCountLogN, CostFeature::OutputRowCount}}};
+
+  return operator_features;
+}
+
+CostModelCalibration::CostModelCalibration(const OperatorFeatures& operator_features)
+    : _operator_features(operator_features) {}
+
+void CostModelCalibration::add_sample(const std::shared_ptr<AbstractOperator>& op) {
+  Assert(op->get_output(), "Can only calibrate with executed Operators");
+
+  const auto feature_proxy = CostFeatureOperatorProxy{op};
+  add_sample(op->type(), feature_proxy, static_cast<Cost>(op->base_performance_data().walltime.count()));
+}
+
+void CostModelCalibration::add_sample(const OperatorType operator_type, const AbstractCostFeatureProxy& feature_proxy,
+                                      const Cost cost) {
+  const auto features_iter = _operator_features.find(operator_type);
+  Assert(features_iter != _operator_features.end(), "No CostFeatures specified for this OperatorType");
+
+  auto sample = Sample{{}, cost};
+  sample.feature_values.reserve(features_iter->second.size());
+
+  for (const auto cost_feature : features_iter->second) {
+    const auto feature_value = feature_proxy.extract_feature(cost_feature).scalar();
+    // E.g., LeftInputRowCountLogN is NaN for empty inputs. Such samples carry no information for the fit.
+    if (!std::isfinite(feature_value)) return;
+    sample.feature_values.emplace_back(feature_value);
+  }
+
+  _samples[operator_type].emplace_back(std::move(sample));
+}
+
+size_t CostModelCalibration::sample_count(const OperatorType operator_type) const {
+  const auto samples_iter = _samples.find(operator_type);
+  return samples_iter == _samples.end() ? 0 : samples_iter->second.size();
+}
+
+CostModelRuntimeConfig CostModelCalibration::fit() const {
+  CostModelRuntimeConfig config;
+
+  for (const auto& [operator_type, samples] : _samples) {
+    config.operator_feature_weights.emplace(operator_type,
+                                            _fit_weights(_operator_features.at(operator_type), samples));
+  }
+
+  return config;
+}
+
+CostFeatureWeights CostModelCalibration::_fit_weights(const std::vector<CostFeature>& features,
+                                                      const std::vector<Sample>& samples) {
+  const auto feature_count = features.size();
+
+  /**
+   * Row counts and their N*log(N) terms differ by orders of magnitude. To keep the normal equations well-conditioned,
+   * every feature is scaled by its maximum value. Features that are zero in all samples (e.g. reference row counts if
+   * only data tables were measured) cannot be fitted and are excluded from the beginning.
+   */
+  auto scales = std::vector<double>(feature_count, 0.0);
+  for (const auto& sample : samples) {
+    for (auto feature_idx = size_t{0}; feature_idx < feature_count; ++feature_idx) {
+      scales[feature_idx] = std::max(scales[feature_idx], std::abs(sample.feature_values[feature_idx]));
+    }
+  }
+
+  auto active_feature_indices = std::vector<size_t>{};
+  for (auto feature_idx = size_t{0}; feature_idx < feature_count; ++feature_idx) {
+    if (scales[feature_idx] > 0.0) active_feature_indices.emplace_back(feature_idx);
+  }
+
+  auto weights = std::vector<double>(feature_count, 0.0);
+
+  while (!active_feature_indices.empty()) {
+    const auto active_count = active_feature_indices.size();
+
+    // Build the normal equations (X^T * X) * w = X^T * y for the active features
+    auto gram_matrix = std::vector<std::vector<double>>(active_count, std::vector<double>(active_count, 0.0));
+    auto moment_vector = std::vector<double>(active_count, 0.0);
+
+    for (const auto& sample : samples) {
+      for (auto row_idx = size_t{0}; row_idx < active_count; ++row_idx) {
+        const auto row_feature_idx = active_feature_indices[row_idx];
+        const auto row_value = sample.feature_values[row_feature_idx] / scales[row_feature_idx];
+
+        moment_vector[row_idx] += row_value * sample.cost;
+        for (auto column_idx = size_t{0}; column_idx < active_count; ++column_idx) {
+          const auto column_feature_idx = active_feature_indices[column_idx];
+          gram_matrix[row_idx][column_idx] +=
+              row_value * sample.feature_values[column_feature_idx] / scales[column_feature_idx];
+        }
+      }
+    }
+
+    // A small ridge keeps the system regular if features are collinear (e.g. too few distinct input sizes measured)
+    for (auto diagonal_idx = size_t{0}; diagonal_idx < active_count; ++diagonal_idx) {
+      gram_matrix[diagonal_idx][diagonal_idx] += 1e-9 * static_cast<double>(samples.size());
+    }
+
+    const auto solution = solve_linear_equation_system(gram_matrix, moment_vector);
+
+    const auto min_iter = std::min_element(solution.begin(), solution.end());
+    if (*min_iter >= 0.0) {
+      for (auto active_idx = size_t{0}; active_idx < active_count; ++active_idx) {
+        const auto feature_idx = active_feature_indices[active_idx];
+        weights[feature_idx] = solution[active_idx] / scales[feature_idx];
+      }
+      break;
+    }
+
+    active_feature_indices.erase(active_feature_indices.begin() + std::distance(solution.begin(), min_iter));
+  }
+
+  auto feature_weights = CostFeatureWeights{};
+  for (auto feature_idx = size_t{0}; feature_idx < feature_count; ++feature_idx) {
+    feature_weights.emplace(features[feature_idx], static_cast<float>(weights[feature_idx]));
+  }
+
+  return feature_weights;
+}
+
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "cost.hpp"
+#include "cost_feature.hpp"
+#include "cost_model_runtime.hpp"
+
+namespace opossum {
+
+class AbstractCostFeatureProxy;
+class AbstractOperator;
+
+/**
+ * Collects the CostFeatures and measured runtimes of executed Operators and fits the weights of a CostModelRuntime to
+ * them.
+ *
+ * The weights of each OperatorType are obtained by a least-squares fit over the CostFeatures configured for that
+ * OperatorType. Since negative weights would make an Operator cheaper the more rows it processes, CostFeatures that
+ * would receive a negative weight are successively removed from the fit (i.e., receive a weight of 0).
+ */
+class CostModelCalibration final {
+ public:
+  using OperatorFeatures = std::unordered_map<OperatorType, std::vector<CostFeature>>;
+
+  /**
+   * The numerical CostFeatures fitted for each OperatorType if no others are specified
+   */
+  static const OperatorFeatures& default_operator_features();
+
+  explicit CostModelCalibration(const OperatorFeatures& operator_features = default_operator_features());
+
+  /**
+   * Record an **executed** Operator with its walltime as the measured cost
+   */
+  void add_sample(const std::shared_ptr<AbstractOperator>& op);
+  void add_sample(const OperatorType operator_type, const AbstractCostFeatureProxy& feature_proxy, const Cost cost);
+
+  size_t sample_count(const OperatorType operator_type) const;
+
+  /**
+   * @return a config containing fitted weights for each OperatorType that at least one sample was recorded for
+   */
+  CostModelRuntimeConfig fit() const;
+
+ private:
+  struct Sample final {
+    std::vector<double> feature_values;
+    double cost;
+  };
+
+  static CostFeatureWeights _fit_weights(const std::vector<CostFeature>& features, const std::vector<Sample>& samples);
+
+  const OperatorFeatures _operator_features;
+  std::unordered_map<OperatorType, std::vector<Sample>> _samples;
+};
+
+}  // namespace opossum
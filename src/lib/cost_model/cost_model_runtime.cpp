@@ -0,0 +1,125 @@
+#include "cost_model_runtime.hpp"
+
+#include <fstream>
+
+#include "abstract_cost_feature_proxy.hpp"
+#include "constant_mappings.hpp"
+#include "operators/abstract_operator.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CostModelRuntimeConfig import_cost_model_runtime_config(const std::string& path) {
+  std::ifstream stream(path);
+  Assert(stream.good(), std::string("Couldn't open file '") + path + "'");
+
+  nlohmann::json json;
+  stream >> json;
+  return import_cost_model_runtime_config(json);
+}
+
+void export_cost_model_runtime_config(const CostModelRuntimeConfig& config, const std::string& path) {
+  std::ofstream stream(path);
+  Assert(stream.good(), std::string("Couldn't open file '") + path + "'");
+  stream << export_cost_model_runtime_config(config).dump(2);
+}
+
+CostModelRuntimeConfig import_cost_model_runtime_config(const nlohmann::json& json) {
+  Assert(json.is_object(), "CostModelRuntimeConfig should be stored as an object");
+
+  CostModelRuntimeConfig config;
+
+  for (auto operator_iter = json.begin(); operator_iter != json.end(); ++operator_iter) {
+    const auto operator_type_iter = operator_type_to_string.right.find(operator_iter.key());
+    Assert(operator_type_iter != operator_type_to_string.right.end(), "No such OperatorType: " + operator_iter.key());
+
+    auto& feature_weights = config.operator_feature_weights[operator_type_iter->second];
+    for (auto feature_iter = operator_iter.value().begin(); feature_iter != operator_iter.value().end(); ++feature_iter) {
+      const auto cost_feature_iter = cost_feature_to_string.right.find(feature_iter.key());
+      Assert(cost_feature_iter != cost_feature_to_string.right.end(), "No such CostFeature: " + feature_iter.key());
+
+      feature_weights.emplace(cost_feature_iter->second, feature_iter.value().get<float>());
+    }
+  }
+
+  return config;
+}
+
+nlohmann::json export_cost_model_runtime_config(const CostModelRuntimeConfig& config) {
+  auto json = nlohmann::json::object();
+
+  for (const auto& [operator_type, feature_weights] : config.operator_feature_weights) {
+    auto& operator_json = json[operator_type_to_string.left.at(operator_type)];
+    operator_json = nlohmann::json::object();
+
+    for (const auto& [cost_feature, weight] : feature_weights) {
+      operator_json[cost_feature_to_string.left.at(cost_feature)] = weight;
+    }
+  }
+
+  return json;
+}
+
+CostModelRuntimeConfig CostModelRuntime::default_config() {
+  CostModelRuntimeConfig config;
+
+  // clang-format off
+  config.operator_feature_weights[OperatorType::TableScan] = {
+    {CostFeature::LeftInputRowCount, 0.001f},
+    {CostFeature::LeftInputReferenceRowCount, 0.004f},
+    {CostFeature::OutputRowCount, 0.002f}};
+
+  config.operator_feature_weights[OperatorType::JoinHash] = {
+    {CostFeature::LeftInputRowCount, 0.015f},
+    {CostFeature::RightInputRowCount, 0.015f},
+    {CostFeature::LeftInputReferenceRowCount, 0.005f},
+    {CostFeature::RightInputReferenceRowCount, 0.005f},
+    {CostFeature::OutputRowCount, 0.01f}};
+
+  config.operator_feature_weights[OperatorType::JoinSortMerge] = {
+    {CostFeature::LeftInputRowCountLogN, 0.004f},
+    {CostFeature::RightInputRowCountLogN, 0.004f},
+    {CostFeature::LeftInputReferenceRowCount, 0.005f},
+    {CostFeature::RightInputReferenceRowCount, 0.005f},
+    {CostFeature::OutputRowCount, 0.01f}};
+
+  config.operator_feature_weights[OperatorType::JoinNestedLoop] = {
+    {CostFeature::InputRowCountProduct, 0.002f},
+    {CostFeature::OutputRowCount, 0.01f}};
+
+  config.operator_feature_weights[OperatorType::Product] = {
+    {CostFeature::InputRowCountProduct, 0.005f}};
+
+  config.operator_feature_weights[OperatorType::UnionPositions] = {
+    {CostFeature::LeftInputRowCountLogN, 0.004f},
+    {CostFeature::RightInputRowCountLogN, 0.004f},
+    {CostFeature::OutputRowCount, 0.002f}};
+  // clang-format on
+
+  return config;
+}
+
+CostModelRuntime::CostModelRuntime(const CostModelRuntimeConfig& config) : _config(config) {}
+
+std::string CostModelRuntime::name() const { return "CostModelRuntime"; }
+
+Cost CostModelRuntime::get_reference_operator_cost(const std::shared_ptr<AbstractOperator>& op) const {
+  return static_cast<Cost>(op->base_performance_data().walltime.count());
+}
+
+const CostModelRuntimeConfig& CostModelRuntime::config() const { return _config; }
+
+Cost CostModelRuntime::_cost_model_impl(const OperatorType operator_type,
+                                        const AbstractCostFeatureProxy& feature_proxy) const {
+  const auto feature_weights_iter = _config.operator_feature_weights.find(operator_type);
+  if (feature_weights_iter == _config.operator_feature_weights.end()) return 0.0f;
+
+  auto cost = Cost{0};
+  for (const auto& [cost_feature, weight] : feature_weights_iter->second) {
+    cost += feature_proxy.extract_feature(cost_feature).scalar() * weight;
+  }
+
+  return cost;
+}
+
+}  // namespace opossum
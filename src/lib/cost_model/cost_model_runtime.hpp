@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "json.hpp"
+
+#include "abstract_cost_model.hpp"
+#include "cost_feature.hpp"
+
+namespace opossum {
+
+/**
+ * Weights that CostModelRuntime multiplies the CostFeatures of an Operator with, per OperatorType. The weights are in
+ * microseconds per unit of the respective CostFeature.
+ * Hardware-specific weights are produced by CostModelCalibration (e.g. via the hyriseCostModelCalibration binary)
+ */
+struct CostModelRuntimeConfig final {
+  std::unordered_map<OperatorType, CostFeatureWeights> operator_feature_weights;
+};
+
+CostModelRuntimeConfig import_cost_model_runtime_config(const std::string& path);
+void export_cost_model_runtime_config(const CostModelRuntimeConfig& config, const std::string& path);
+
+CostModelRuntimeConfig import_cost_model_runtime_config(const nlohmann::json& json);
+nlohmann::json export_cost_model_runtime_config(const CostModelRuntimeConfig& config);
+
+/**
+ * Cost model that predicts the runtime of an Operator in microseconds as a linear combination of its numerical
+ * CostFeatures. In contrast to CostModelLogical, every OperatorType has its own weights so that, e.g., JoinHash and
+ * JoinSortMerge or scans on data and reference tables can have very different constants.
+ *
+ * OperatorTypes without weights in the config are costed with 0.
+ */
+class CostModelRuntime : public AbstractCostModel {
+ public:
+  /**
+   * Rough, uncalibrated weights that only reflect the relative cost of the Operators. Run the calibration to obtain
+   * weights for the actual hardware.
+   */
+  static CostModelRuntimeConfig default_config();
+
+  explicit CostModelRuntime(const CostModelRuntimeConfig& config = default_config());
+
+  std::string name() const override;
+
+  /**
+   * @return the measured walltime of the executed Operator in microseconds
+   */
+  Cost get_reference_operator_cost(const std::shared_ptr<AbstractOperator>& op) const override;
+
+  const CostModelRuntimeConfig& config() const;
+
+ protected:
+  Cost _cost_model_impl(const OperatorType operator_type, const AbstractCostFeatureProxy& feature_proxy) const override;
+
+ private:
+  const CostModelRuntimeConfig _config;
+};
+
+}  // namespace opossum
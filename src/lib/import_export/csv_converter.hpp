@@ -10,6 +10,7 @@
 #include <utility>
 
 #include "csv_meta.hpp"
+#include "logical_type.hpp"
 #include "storage/base_column.hpp"
 #include "storage/value_column.hpp"
 #include "types.hpp"
@@ -46,8 +47,13 @@ class BaseCsvConverter {
 template <typename T>
 class CsvConverter : public BaseCsvConverter {
  public:
-  explicit CsvConverter(ChunkOffset size, const ParseConfig& config = {}, bool is_nullable = false)
-      : _parsed_values(size), _null_values(size, false), _is_nullable(is_nullable), _config(config) {}
+  explicit CsvConverter(ChunkOffset size, const ParseConfig& config = {}, bool is_nullable = false,
+                        const LogicalType& logical_type = {})
+      : _parsed_values(size),
+        _null_values(size, false),
+        _is_nullable(is_nullable),
+        _config(config),
+        _logical_type(logical_type) {}
 
   void insert(std::string& value, ChunkOffset position) override {
     if (_is_nullable && value.length() == 0) {
@@ -78,6 +84,12 @@ class CsvConverter : public BaseCsvConverter {
       }
     }
 
+    // DATEs and DECIMALs are stored as integers, see LogicalType
+    if (_logical_type.kind != LogicalType::Kind::None) {
+      _parsed_values[position] = boost::get<T>(_logical_type.encode(value));
+      return;
+    }
+
     _parsed_values[position] = _get_conversion_function()(value);
   }
 
@@ -101,6 +113,7 @@ class CsvConverter : public BaseCsvConverter {
   tbb::concurrent_vector<bool> _null_values;
   const bool _is_nullable;
   ParseConfig _config;
+  const LogicalType _logical_type;
 };
 
 template <>
@@ -88,6 +88,11 @@ std::shared_ptr<Table> CsvParser::_create_table_from_meta() {
     auto column_type = column_meta.type;
     BaseCsvConverter::unescape(column_type);
 
+    if (const auto logical_type = LogicalType::from_name(column_type)) {
+      colum_definitions.emplace_back(column_name, *logical_type, column_meta.nullable);
+      continue;
+    }
+
     const auto data_type = data_type_to_string.right.at(column_type);
 
     colum_definitions.emplace_back(column_name, data_type, column_meta.nullable);
@@ -158,8 +163,8 @@ size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vecto
     const auto is_nullable = table.column_is_nullable(column_id);
     const auto column_type = table.column_data_type(column_id);
 
-    converters.emplace_back(
-        make_unique_by_data_type<BaseCsvConverter, CsvConverter>(column_type, row_count, _meta.config, is_nullable));
+    converters.emplace_back(make_unique_by_data_type<BaseCsvConverter, CsvConverter>(
+        column_type, row_count, _meta.config, is_nullable, table.column_logical_type(column_id)));
   }
 
   size_t start = 0;
@@ -28,19 +28,24 @@ std::string CsvWriter::escape(const std::string& string) {
 }
 
 void CsvWriter::write(const AllTypeVariant& value) {
-  if (_current_col_count > 0) {
-    _stream << _config.separator;
-  }
-
+  _write_separator();
   _write_value(value);
-  ++_current_col_count;
 }
 
+void CsvWriter::write_null() { _write_separator(); }
+
 void CsvWriter::end_line() {
   _stream << _config.delimiter;
   _current_col_count = 0;
 }
 
+void CsvWriter::_write_separator() {
+  if (_current_col_count > 0) {
+    _stream << _config.separator;
+  }
+  ++_current_col_count;
+}
+
 void CsvWriter::_write_value(const AllTypeVariant& value) {
   if (variant_is_null(value)) return;
 
@@ -2,6 +2,7 @@
 
 #include <fstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "all_type_variant.hpp"
@@ -21,6 +22,20 @@ class CsvWriter {
 
   void write(const AllTypeVariant& value);
 
+  // Typed counterparts of write(), which do not construct an AllTypeVariant per value
+  template <typename T>
+  void write_value(const T& value) {
+    _write_separator();
+
+    if constexpr (std::is_same_v<T, std::string>) {
+      _write_string_value(value);
+    } else {
+      _stream << value;
+    }
+  }
+
+  void write_null();
+
   /*
    * Ends a row of entries in the csv file.
    */
@@ -29,6 +44,7 @@ class CsvWriter {
  protected:
   std::string escape(const std::string& string);
 
+  void _write_separator();
   void _write_value(const AllTypeVariant& value);
   void _write_string_value(const std::string& value);
 
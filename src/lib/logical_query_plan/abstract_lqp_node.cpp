@@ -319,14 +319,23 @@ std::shared_ptr<const AbstractLQPNode> AbstractLQPNode::find_table_name_origin(c
 }
 
 std::optional<ColumnID> AbstractLQPNode::find_output_column_id(const LQPColumnReference& column_reference) const {
-  const auto& output_column_references = this->output_column_references();
-  const auto iter = std::find(output_column_references.begin(), output_column_references.end(), column_reference);
+  if (!_output_column_ids) {
+    const auto& output_column_references = this->output_column_references();
+
+    _output_column_ids.emplace();
+    _output_column_ids->reserve(output_column_references.size());
+    for (auto column_id = ColumnID{0}; column_id < output_column_references.size(); ++column_id) {
+      // emplace() doesn't overwrite, so the leftmost ColumnID wins
+      _output_column_ids->emplace(output_column_references[column_id], column_id);
+    }
+  }
 
-  if (iter == output_column_references.end()) {
+  const auto iter = _output_column_ids->find(column_reference);
+  if (iter == _output_column_ids->end()) {
     return std::nullopt;
   }
 
-  return static_cast<ColumnID>(std::distance(output_column_references.begin(), iter));
+  return iter->second;
 }
 
 ColumnID AbstractLQPNode::get_output_column_id(const LQPColumnReference& column_reference) const {
@@ -460,6 +469,7 @@ std::optional<QualifiedColumnName> AbstractLQPNode::_resolve_local_table_name(
 void AbstractLQPNode::_input_changed() {
   _statistics.reset();
   _output_column_references.reset();
+  _output_column_ids.reset();
 
   _on_input_changed();
   for (auto& output : outputs()) {
@@ -26,6 +26,9 @@ enum class LQPNodeType {
   Insert,
   Join,
   Limit,
+  Materialized,
+  MaterializedView,
+  MetaTable,
   Predicate,
   Projection,
   Root,
@@ -342,6 +345,10 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode>, pr
   // mutable, so it can be lazily initialized in output_column_references() overrides
   mutable std::optional<std::vector<LQPColumnReference>> _output_column_references;
 
+  // Lazily built index into output_column_references(), so find_output_column_id() doesn't need a linear search.
+  // Reset together with _output_column_references.
+  mutable std::optional<std::unordered_map<LQPColumnReference, ColumnID>> _output_column_ids;
+
   /**
    * If qualified_column_name.table_name is the alias set for this subtree, remove the table_name so that we
    * only operate on the column name. If an alias for this subtree is set, but qualified_column_name.table_name does not
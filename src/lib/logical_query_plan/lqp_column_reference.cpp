@@ -1,5 +1,7 @@
 #include "lqp_column_reference.hpp"
 
+#include <boost/functional/hash.hpp>
+
 #include "abstract_lqp_node.hpp"
 #include "utils/assert.hpp"
 
@@ -35,3 +37,13 @@ std::ostream& operator<<(std::ostream& os, const LQPColumnReference& column_refe
   return os;
 }
 }  // namespace opossum
+
+namespace std {
+
+size_t hash<opossum::LQPColumnReference>::operator()(const opossum::LQPColumnReference& column_reference) const {
+  auto hash = boost::hash_value(column_reference.original_node().get());
+  boost::hash_combine(hash, static_cast<opossum::ColumnID::base_type>(column_reference.original_column_id()));
+  return hash;
+}
+
+}  // namespace std
@@ -16,8 +16,13 @@
 #include "join_node.hpp"
 #include "limit_node.hpp"
 #include "lqp_expression.hpp"
+#include "materialized_node.hpp"
+#include "materialized_view_node.hpp"
+#include "meta_table_node.hpp"
 #include "operators/aggregate.hpp"
 #include "operators/delete.hpp"
+#include "operators/distinct.hpp"
+#include "operators/get_meta_table.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
@@ -75,6 +80,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
   }
 
   const auto pqp = _translate_by_node_type(node->type(), node);
+  if (!pqp->lqp_node()) pqp->set_lqp_node(node);
   _operator_by_lqp_node.emplace(node, pqp);
   return pqp;
 }
@@ -251,6 +257,31 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     groupby_columns.emplace_back(node->left_input()->get_output_column_id(groupby_column_reference));
   }
 
+  /**
+   * 0. Without aggregate functions, the aggregation only eliminates duplicate GROUP BY values (e.g., for SELECT
+   * DISTINCT), which the Distinct operator does without building AggregateKeys. If the GROUP BY columns are not
+   * exactly the input columns, they are selected by a Projection first.
+   */
+  if (aggregate_expressions.empty() && !groupby_columns.empty()) {
+    auto distinct_input_operator = input_operator;
+
+    auto groupby_columns_are_input_columns = groupby_columns.size() == node->left_input()->output_column_count();
+    for (ColumnID column_id{0}; column_id < groupby_columns.size() && groupby_columns_are_input_columns; ++column_id) {
+      groupby_columns_are_input_columns = groupby_columns[column_id] == column_id;
+    }
+
+    if (!groupby_columns_are_input_columns) {
+      auto projection_expressions = Projection::ColumnExpressions{};
+      projection_expressions.reserve(groupby_columns.size());
+      for (const auto groupby_column : groupby_columns) {
+        projection_expressions.emplace_back(PQPExpression::create_column(groupby_column));
+      }
+      distinct_input_operator = std::make_shared<Projection>(input_operator, projection_expressions);
+    }
+
+    return std::make_shared<Distinct>(distinct_input_operator);
+  }
+
   auto aggregate_input_operator = input_operator;
 
   /**
@@ -395,6 +426,14 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
   return std::make_shared<Validate>(input_operator);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_materialized_view_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto materialized_view_node = std::static_pointer_cast<MaterializedViewNode>(node);
+  auto get_table = std::make_shared<GetTable>(materialized_view_node->view_name());
+  get_table->set_materialized_view_subplan(translate_node(materialized_view_node->subplan()));
+  return get_table;
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_show_tables_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   DebugAssert(node->left_input() == nullptr, "ShowTables should not have an input operator.");
@@ -420,6 +459,12 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_drop_view_node(
   return std::make_shared<DropView>(drop_view_node->view_name());
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_meta_table_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto meta_table_node = std::dynamic_pointer_cast<MetaTableNode>(node);
+  return std::make_shared<GetMetaTable>(meta_table_node->table_name());
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_dummy_table_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   return std::make_shared<TableWrapper>(Projection::dummy_table());
@@ -431,6 +476,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     // SQL operators
     case LQPNodeType::StoredTable:
       return _translate_stored_table_node(node);
+    case LQPNodeType::MetaTable:
+      return _translate_meta_table_node(node);
     case LQPNodeType::Predicate:
       return _translate_predicate_node(node);
     case LQPNodeType::Projection:
@@ -455,6 +502,10 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
       return _translate_validate_node(node);
     case LQPNodeType::Union:
       return _translate_union_node(node);
+    case LQPNodeType::Materialized:
+      return std::static_pointer_cast<MaterializedNode>(node)->materialized_operator();
+    case LQPNodeType::MaterializedView:
+      return _translate_materialized_view_node(node);
 
     // Maintenance operators
     case LQPNodeType::ShowTables:
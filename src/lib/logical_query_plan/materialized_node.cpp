@@ -0,0 +1,89 @@
+#include "materialized_node.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MaterializedNode::MaterializedNode(const std::shared_ptr<AbstractLQPNode>& subplan,
+                                   const std::shared_ptr<AbstractOperator>& materialized_operator)
+    : AbstractLQPNode(LQPNodeType::Materialized), _subplan(subplan), _materialized_operator(materialized_operator) {
+  Assert(_materialized_operator->get_output(), "MaterializedNode requires an executed operator");
+  DebugAssert(_subplan->output_column_count() == _materialized_operator->get_output()->column_count(),
+              "Subplan and operator output need to have the same number of columns");
+
+  _estimated_row_count = _subplan->get_statistics()->row_count();
+}
+
+std::shared_ptr<AbstractLQPNode> MaterializedNode::_deep_copy_impl(
+    const std::shared_ptr<AbstractLQPNode>& copied_left_input,
+    const std::shared_ptr<AbstractLQPNode>& copied_right_input) const {
+  const auto copy = MaterializedNode::make(_subplan, _materialized_operator);
+  copy->set_triggered_reoptimization(_triggered_reoptimization);
+  return copy;
+}
+
+std::string MaterializedNode::description() const {
+  auto description = "[Materialized] " + std::to_string(static_cast<size_t>(actual_row_count())) +
+                     " row(s), estimated " + std::to_string(static_cast<size_t>(_estimated_row_count));
+  if (_triggered_reoptimization) description += ", re-optimized";
+  return description;
+}
+
+std::string MaterializedNode::get_verbose_column_name(ColumnID column_id) const {
+  return _subplan->get_verbose_column_name(column_id);
+}
+
+const std::vector<std::string>& MaterializedNode::output_column_names() const {
+  return _subplan->output_column_names();
+}
+
+const std::vector<LQPColumnReference>& MaterializedNode::output_column_references() const {
+  return _subplan->output_column_references();
+}
+
+std::shared_ptr<const AbstractLQPNode> MaterializedNode::find_table_name_origin(const std::string& table_name) const {
+  return _subplan->find_table_name_origin(table_name);
+}
+
+std::shared_ptr<TableStatistics> MaterializedNode::derive_statistics_from(
+    const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
+  DebugAssert(!left_input && !right_input, "MaterializedNode must be leaf");
+
+  const auto& subplan_statistics = _subplan->get_statistics();
+  return std::make_shared<TableStatistics>(_materialized_operator->get_output()->type(), actual_row_count(),
+                                           subplan_statistics->column_statistics());
+}
+
+const std::shared_ptr<AbstractLQPNode>& MaterializedNode::subplan() const { return _subplan; }
+
+const std::shared_ptr<AbstractOperator>& MaterializedNode::materialized_operator() const {
+  return _materialized_operator;
+}
+
+float MaterializedNode::estimated_row_count() const { return _estimated_row_count; }
+
+float MaterializedNode::actual_row_count() const {
+  return static_cast<float>(_materialized_operator->get_output()->row_count());
+}
+
+bool MaterializedNode::triggered_reoptimization() const { return _triggered_reoptimization; }
+
+void MaterializedNode::set_triggered_reoptimization(const bool triggered_reoptimization) {
+  _triggered_reoptimization = triggered_reoptimization;
+}
+
+bool MaterializedNode::shallow_equals(const AbstractLQPNode& rhs) const {
+  Assert(rhs.type() == type(), "Can only compare nodes of the same type()");
+  const auto& materialized_node = static_cast<const MaterializedNode&>(rhs);
+
+  return _materialized_operator == materialized_node._materialized_operator;
+}
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+/**
+ * Stands in for a subplan that has already been executed, e.g., by the AdaptiveQueryExecutor. The node is a leaf that
+ * forwards the output columns of the original subplan (so that LQPColumnReferences into it stay valid), and its
+ * statistics are those of the subplan with the row count replaced by the actual one.
+ *
+ * The LQPTranslator translates it into the operator that produced the result, so it will not be executed again.
+ */
+class MaterializedNode : public EnableMakeForLQPNode<MaterializedNode>, public AbstractLQPNode {
+ public:
+  MaterializedNode(const std::shared_ptr<AbstractLQPNode>& subplan,
+                   const std::shared_ptr<AbstractOperator>& materialized_operator);
+
+  std::string description() const override;
+  std::string get_verbose_column_name(ColumnID column_id) const override;
+
+  const std::vector<std::string>& output_column_names() const override;
+  const std::vector<LQPColumnReference>& output_column_references() const override;
+
+  std::shared_ptr<const AbstractLQPNode> find_table_name_origin(const std::string& table_name) const override;
+
+  std::shared_ptr<TableStatistics> derive_statistics_from(
+      const std::shared_ptr<AbstractLQPNode>& left_input,
+      const std::shared_ptr<AbstractLQPNode>& right_input) const override;
+
+  const std::shared_ptr<AbstractLQPNode>& subplan() const;
+  const std::shared_ptr<AbstractOperator>& materialized_operator() const;
+
+  // The number of rows the optimizer expected the subplan to produce
+  float estimated_row_count() const;
+  float actual_row_count() const;
+
+  // Whether the remaining plan was re-optimized because of the deviation between estimated and actual row count
+  bool triggered_reoptimization() const;
+  void set_triggered_reoptimization(const bool triggered_reoptimization);
+
+  bool shallow_equals(const AbstractLQPNode& rhs) const override;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _deep_copy_impl(
+      const std::shared_ptr<AbstractLQPNode>& copied_left_input,
+      const std::shared_ptr<AbstractLQPNode>& copied_right_input) const override;
+
+ private:
+  const std::shared_ptr<AbstractLQPNode> _subplan;
+  const std::shared_ptr<AbstractOperator> _materialized_operator;
+  float _estimated_row_count;
+  bool _triggered_reoptimization{false};
+};
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#include "materialized_view_node.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "statistics/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MaterializedViewNode::MaterializedViewNode(const std::string& view_name,
+                                           const std::shared_ptr<AbstractLQPNode>& subplan)
+    : AbstractLQPNode(LQPNodeType::MaterializedView), _view_name(view_name), _subplan(subplan) {}
+
+std::shared_ptr<AbstractLQPNode> MaterializedViewNode::_deep_copy_impl(
+    const std::shared_ptr<AbstractLQPNode>& copied_left_input,
+    const std::shared_ptr<AbstractLQPNode>& copied_right_input) const {
+  return std::make_shared<MaterializedViewNode>(_view_name, _subplan);
+}
+
+const std::string& MaterializedViewNode::view_name() const { return _view_name; }
+
+const std::shared_ptr<AbstractLQPNode>& MaterializedViewNode::subplan() const { return _subplan; }
+
+std::string MaterializedViewNode::description() const { return "[MaterializedView] Name: '" + _view_name + "'"; }
+
+std::string MaterializedViewNode::get_verbose_column_name(ColumnID column_id) const {
+  return _subplan->get_verbose_column_name(column_id);
+}
+
+const std::vector<std::string>& MaterializedViewNode::output_column_names() const {
+  return _subplan->output_column_names();
+}
+
+const std::vector<LQPColumnReference>& MaterializedViewNode::output_column_references() const {
+  return _subplan->output_column_references();
+}
+
+std::shared_ptr<const AbstractLQPNode> MaterializedViewNode::find_table_name_origin(
+    const std::string& table_name) const {
+  return _subplan->find_table_name_origin(table_name);
+}
+
+std::shared_ptr<TableStatistics> MaterializedViewNode::derive_statistics_from(
+    const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
+  DebugAssert(!left_input && !right_input, "MaterializedViewNode must be leaf");
+  return StorageManager::get().get_table(_view_name)->table_statistics();
+}
+
+bool MaterializedViewNode::shallow_equals(const AbstractLQPNode& rhs) const {
+  Assert(rhs.type() == type(), "Can only compare nodes of the same type()");
+  const auto& materialized_view_node = static_cast<const MaterializedViewNode&>(rhs);
+
+  return _view_name == materialized_view_node._view_name;
+}
+
+void MaterializedViewNode::_on_input_changed() { Fail("MaterializedViewNode cannot have inputs."); }
+
+}  // namespace opossum
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+
+namespace opossum {
+
+/**
+ * Reads the result of the materialized view view_name, which replaces subplan. The node is a leaf that forwards the
+ * output columns of the subplan (so that LQPColumnReferences into it stay valid), while its statistics are those of
+ * the view's result.
+ *
+ * Created by the MaterializedViewRule, translated into a GetTable operator that refreshes the view before reading it.
+ * The GetTable executes the subplan instead if the view cannot provide its result for the snapshot of the transaction.
+ */
+class MaterializedViewNode : public AbstractLQPNode {
+ public:
+  MaterializedViewNode(const std::string& view_name, const std::shared_ptr<AbstractLQPNode>& subplan);
+
+  const std::string& view_name() const;
+  const std::shared_ptr<AbstractLQPNode>& subplan() const;
+
+  std::string description() const override;
+  std::string get_verbose_column_name(ColumnID column_id) const override;
+
+  const std::vector<std::string>& output_column_names() const override;
+  const std::vector<LQPColumnReference>& output_column_references() const override;
+
+  std::shared_ptr<const AbstractLQPNode> find_table_name_origin(const std::string& table_name) const override;
+
+  std::shared_ptr<TableStatistics> derive_statistics_from(
+      const std::shared_ptr<AbstractLQPNode>& left_input = nullptr,
+      const std::shared_ptr<AbstractLQPNode>& right_input = nullptr) const override;
+
+  bool shallow_equals(const AbstractLQPNode& rhs) const override;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _deep_copy_impl(
+      const std::shared_ptr<AbstractLQPNode>& copied_left_input,
+      const std::shared_ptr<AbstractLQPNode>& copied_right_input) const override;
+  void _on_input_changed() override;
+
+ private:
+  const std::string _view_name;
+  const std::shared_ptr<AbstractLQPNode> _subplan;
+};
+
+}  // namespace opossum
@@ -0,0 +1,78 @@
+#include "meta_table_node.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "statistics/generate_table_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/meta_table_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+MetaTableNode::MetaTableNode(const std::string& table_name)
+    : AbstractLQPNode(LQPNodeType::MetaTable), _table_name(table_name) {
+  _output_column_names = MetaTableManager::generate_table(_table_name)->column_names();
+}
+
+std::shared_ptr<AbstractLQPNode> MetaTableNode::_deep_copy_impl(
+    const std::shared_ptr<AbstractLQPNode>& copied_left_input,
+    const std::shared_ptr<AbstractLQPNode>& copied_right_input) const {
+  return MetaTableNode::make(_table_name);
+}
+
+std::string MetaTableNode::description() const { return "[MetaTable] Name: '" + _table_name + "'"; }
+
+std::shared_ptr<const AbstractLQPNode> MetaTableNode::find_table_name_origin(const std::string& table_name) const {
+  if (_table_alias) {
+    return *_table_alias == table_name ? shared_from_this() : nullptr;
+  }
+
+  return table_name == _table_name ? shared_from_this() : nullptr;
+}
+
+const std::vector<std::string>& MetaTableNode::output_column_names() const { return _output_column_names; }
+
+std::shared_ptr<TableStatistics> MetaTableNode::derive_statistics_from(
+    const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
+  DebugAssert(!left_input && !right_input, "MetaTableNode must be leaf");
+  const auto table = MetaTableManager::generate_table(_table_name);
+  return std::make_shared<TableStatistics>(generate_table_statistics(*table));
+}
+
+const std::string& MetaTableNode::table_name() const { return _table_name; }
+
+std::string MetaTableNode::get_verbose_column_name(ColumnID column_id) const {
+  if (_table_alias) {
+    return "(" + _table_name + " AS " + *_table_alias + ")." + output_column_names()[column_id];
+  }
+  return _table_name + "." + output_column_names()[column_id];
+}
+
+bool MetaTableNode::shallow_equals(const AbstractLQPNode& rhs) const {
+  Assert(rhs.type() == type(), "Can only compare nodes of the same type()");
+  const auto& meta_table_node = static_cast<const MetaTableNode&>(rhs);
+
+  return _table_name == meta_table_node._table_name;
+}
+
+void MetaTableNode::_on_input_changed() { Fail("MetaTableNode cannot have inputs."); }
+
+std::optional<QualifiedColumnName> MetaTableNode::_resolve_local_table_name(
+    const QualifiedColumnName& qualified_column_name) const {
+  if (!qualified_column_name.table_name) {
+    return qualified_column_name;
+  }
+
+  if (*qualified_column_name.table_name != (_table_alias ? *_table_alias : _table_name)) {
+    return std::nullopt;
+  }
+
+  auto reference_without_local_alias = qualified_column_name;
+  reference_without_local_alias.table_name = std::nullopt;
+  return reference_without_local_alias;
+}
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+
+namespace opossum {
+
+class TableStatistics;
+
+/**
+ * This node type represents a meta table (see MetaTableManager). Like the StoredTableNode, it is a leaf. It is
+ * translated into a GetMetaTable operator, which generates the table when it is executed.
+ */
+class MetaTableNode : public EnableMakeForLQPNode<MetaTableNode>, public AbstractLQPNode {
+ public:
+  explicit MetaTableNode(const std::string& table_name);
+
+  const std::string& table_name() const;
+
+  std::string description() const override;
+  std::shared_ptr<const AbstractLQPNode> find_table_name_origin(const std::string& table_name) const override;
+  const std::vector<std::string>& output_column_names() const override;
+
+  // Generates the meta table to compute its statistics, as meta tables are not stored
+  std::shared_ptr<TableStatistics> derive_statistics_from(
+      const std::shared_ptr<AbstractLQPNode>& left_input = nullptr,
+      const std::shared_ptr<AbstractLQPNode>& right_input = nullptr) const override;
+
+  std::string get_verbose_column_name(ColumnID column_id) const override;
+
+  bool shallow_equals(const AbstractLQPNode& rhs) const override;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _deep_copy_impl(
+      const std::shared_ptr<AbstractLQPNode>& copied_left_input,
+      const std::shared_ptr<AbstractLQPNode>& copied_right_input) const override;
+  void _on_input_changed() override;
+  std::optional<QualifiedColumnName> _resolve_local_table_name(
+      const QualifiedColumnName& qualified_column_name) const override;
+
+ private:
+  const std::string _table_name;
+  std::vector<std::string> _output_column_names;
+};
+
+}  // namespace opossum
@@ -0,0 +1,301 @@
+#include "logical_type.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/materialize.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+int64_t power_of_ten(const uint8_t exponent) {
+  auto result = int64_t{1};
+  for (auto i = uint8_t{0}; i < exponent; ++i) {
+    result *= 10;
+  }
+  return result;
+}
+
+bool is_leap_year(const int32_t year) { return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0; }
+
+uint32_t days_in_month(const int32_t year, const uint32_t month) {
+  static constexpr uint32_t days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  return month == 2 && is_leap_year(year) ? 29u : days[month - 1];
+}
+
+// Based on days_from_civil() and civil_from_days() from http://howardhinnant.github.io/date_algorithms.html
+int32_t days_from_civil(int32_t year, const uint32_t month, const uint32_t day) {
+  year -= month <= 2 ? 1 : 0;
+  const auto era = (year >= 0 ? year : year - 399) / 400;
+  const auto year_of_era = static_cast<uint32_t>(year - era * 400);
+  const auto day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const auto day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + static_cast<int32_t>(day_of_era) - 719468;
+}
+
+void civil_from_days(int32_t days, int32_t& year, uint32_t& month, uint32_t& day) {
+  days += 719468;
+  const auto era = (days >= 0 ? days : days - 146096) / 146097;
+  const auto day_of_era = static_cast<uint32_t>(days - era * 146097);
+  const auto year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+  const auto day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const auto shifted_month = (5 * day_of_year + 2) / 153;
+  day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+  month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+  year = static_cast<int32_t>(year_of_era) + era * 400 + (month <= 2 ? 1 : 0);
+}
+
+int64_t parse_decimal(const std::string& string, const uint8_t precision, const uint8_t scale,
+                      const opossum::LogicalType::Rounding rounding) {
+  auto position = size_t{0};
+  const auto negative = !string.empty() && string[0] == '-';
+  if (!string.empty() && (string[0] == '-' || string[0] == '+')) ++position;
+  Assert(position < string.size(), "Invalid DECIMAL: '" + string + "'");
+
+  auto integer_digits = 0;
+  auto fraction_digits = 0;
+  auto in_fraction = false;
+  auto value = int64_t{0};
+  auto is_truncated = false;
+
+  for (; position < string.size(); ++position) {
+    const auto character = string[position];
+    if (character == '.' && !in_fraction) {
+      in_fraction = true;
+      continue;
+    }
+    Assert(character >= '0' && character <= '9', "Invalid DECIMAL: '" + string + "'");
+
+    // Leading zeros do not count towards the precision
+    if (!in_fraction && value == 0 && character == '0') continue;
+
+    if (in_fraction) {
+      if (fraction_digits == scale) {
+        Assert(rounding != opossum::LogicalType::Rounding::Exact,
+               "DECIMAL " + string + " has more than " + std::to_string(scale) + " decimal places");
+        is_truncated |= character != '0';
+        continue;
+      }
+      ++fraction_digits;
+    } else {
+      ++integer_digits;
+      Assert(integer_digits + scale <= precision,
+             "DECIMAL " + string + " exceeds the precision of " + std::to_string(precision) + " digits");
+    }
+    value = value * 10 + (character - '0');
+  }
+
+  value *= power_of_ten(static_cast<uint8_t>(scale - fraction_digits));
+
+  // Dropping digits rounded the magnitude down
+  const auto away_from_zero = negative ? opossum::LogicalType::Rounding::Floor : opossum::LogicalType::Rounding::Ceil;
+  if (is_truncated && rounding == away_from_zero) ++value;
+
+  return negative ? -value : value;
+}
+
+}  // namespace
+
+namespace opossum {
+
+LogicalType LogicalType::date() { return LogicalType{Kind::Date, 0, 0}; }
+
+LogicalType LogicalType::decimal(const uint8_t precision, const uint8_t scale) {
+  Assert(precision > 0 && precision <= MAX_DECIMAL_PRECISION,
+         "DECIMAL precision must be between 1 and " + std::to_string(MAX_DECIMAL_PRECISION));
+  Assert(scale <= precision, "DECIMAL scale must not exceed the precision");
+  return LogicalType{Kind::Decimal, precision, scale};
+}
+
+std::optional<LogicalType> LogicalType::from_name(const std::string& name) {
+  if (name == "date") return date();
+
+  const auto prefix = std::string{"decimal("};
+  if (name.compare(0, prefix.size(), prefix) != 0 || name.back() != ')') return std::nullopt;
+
+  const auto separator = name.find(',', prefix.size());
+  Assert(separator != std::string::npos, "Expected decimal(precision,scale), got " + name);
+  const auto precision = std::stoi(name.substr(prefix.size(), separator - prefix.size()));
+  const auto scale = std::stoi(name.substr(separator + 1, name.size() - separator - 2));
+  Assert(precision >= 0 && scale >= 0 && precision <= std::numeric_limits<uint8_t>::max(),
+         "Invalid DECIMAL type " + name);
+  return decimal(static_cast<uint8_t>(precision), static_cast<uint8_t>(scale));
+}
+
+DataType LogicalType::data_type() const {
+  switch (kind) {
+    case Kind::Date:
+      return DataType::Int;
+    case Kind::Decimal:
+      return DataType::Long;
+    case Kind::None:
+      break;
+  }
+  Fail("Columns without a logical type are stored as their DataType");
+}
+
+std::string LogicalType::name() const {
+  switch (kind) {
+    case Kind::Date:
+      return "date";
+    case Kind::Decimal:
+      return "decimal(" + std::to_string(precision) + "," + std::to_string(scale) + ")";
+    case Kind::None:
+      break;
+  }
+  Fail("Columns without a logical type are named by their DataType");
+}
+
+AllTypeVariant LogicalType::encode(const AllTypeVariant& value) const { return encode(value, Rounding::Exact); }
+
+AllTypeVariant LogicalType::encode(const AllTypeVariant& value, const Rounding rounding) const {
+  if (kind == Kind::None || variant_is_null(value)) return value;
+
+  const auto data_type = data_type_from_all_type_variant(value);
+
+  if (kind == Kind::Date) {
+    switch (data_type) {
+      case DataType::String:
+        return date_to_days(boost::get<std::string>(value));
+      case DataType::Int:
+        return value;
+      case DataType::Long:
+        return static_cast<int32_t>(boost::get<int64_t>(value));
+      default:
+        Fail("Cannot convert " + type_cast<std::string>(value) + " to a DATE");
+    }
+  }
+
+  const auto factor = power_of_ten(scale);
+  const auto max_integer = power_of_ten(static_cast<uint8_t>(precision - scale));
+  const auto check_range = [&](const auto integer) {
+    Assert(std::abs(static_cast<int64_t>(integer)) < max_integer,
+           "DECIMAL " + type_cast<std::string>(value) + " exceeds the precision of " + std::to_string(precision) +
+               " digits");
+  };
+
+  switch (data_type) {
+    case DataType::String:
+      return parse_decimal(boost::get<std::string>(value), precision, scale, rounding);
+    case DataType::Int:
+      check_range(boost::get<int32_t>(value));
+      return int64_t{boost::get<int32_t>(value)} * factor;
+    case DataType::Long:
+      check_range(boost::get<int64_t>(value));
+      return boost::get<int64_t>(value) * factor;
+    case DataType::Float:
+    case DataType::Double: {
+      const auto scaled = type_cast<double>(value) * static_cast<double>(factor);
+      auto rounded = std::llround(scaled);
+      if (std::abs(scaled - static_cast<double>(rounded)) > 1e-6 * std::max(1.0, std::abs(scaled))) {
+        Assert(rounding != Rounding::Exact, "DECIMAL " + type_cast<std::string>(value) + " has more than " +
+                                                std::to_string(scale) + " decimal places");
+        rounded = std::llround(rounding == Rounding::Floor ? std::floor(scaled) : std::ceil(scaled));
+      }
+      check_range(rounded / factor);
+      return static_cast<int64_t>(rounded);
+    }
+    default:
+      Fail("Cannot convert value to a DECIMAL");
+  }
+}
+
+std::string LogicalType::format(const AllTypeVariant& stored_value) const {
+  if (kind == Kind::None || variant_is_null(stored_value)) return type_cast<std::string>(stored_value);
+
+  return format(type_cast<int64_t>(stored_value));
+}
+
+std::string LogicalType::format(const int64_t stored_value) const {
+  DebugAssert(kind != Kind::None, "Columns without a logical type are formatted by type_cast");
+
+  if (kind == Kind::Date) return days_to_date(static_cast<int32_t>(stored_value));
+
+  const auto factor = static_cast<uint64_t>(power_of_ten(scale));
+  // Negating int64_t's minimum would overflow
+  const auto magnitude =
+      stored_value < 0 ? ~static_cast<uint64_t>(stored_value) + 1u : static_cast<uint64_t>(stored_value);
+
+  auto stream = std::stringstream{};
+  if (stored_value < 0) stream << '-';
+  stream << magnitude / factor;
+  if (scale > 0) stream << '.' << std::setw(scale) << std::setfill('0') << magnitude % factor;
+  return stream.str();
+}
+
+bool LogicalType::operator==(const LogicalType& rhs) const {
+  return kind == rhs.kind && precision == rhs.precision && scale == rhs.scale;
+}
+
+bool LogicalType::operator!=(const LogicalType& rhs) const { return !(*this == rhs); }
+
+int64_t decimal_factor(const uint8_t scale) { return power_of_ten(scale); }
+
+int32_t date_to_days(const std::string& date) {
+  const auto is_digit = [&](const size_t position) { return date[position] >= '0' && date[position] <= '9'; };
+  Assert(date.size() == 10 && date[4] == '-' && date[7] == '-' && is_digit(0) && is_digit(1) && is_digit(2) &&
+             is_digit(3) && is_digit(5) && is_digit(6) && is_digit(8) && is_digit(9),
+         "Expected a DATE in the format YYYY-MM-DD, got '" + date + "'");
+
+  const auto year = std::stoi(date.substr(0, 4));
+  const auto month = static_cast<uint32_t>(std::stoi(date.substr(5, 2)));
+  const auto day = static_cast<uint32_t>(std::stoi(date.substr(8, 2)));
+  Assert(month >= 1 && month <= 12 && day >= 1 && day <= days_in_month(year, month), "Invalid DATE '" + date + "'");
+
+  return days_from_civil(year, month, day);
+}
+
+std::string days_to_date(const int32_t days) {
+  auto year = int32_t{0};
+  auto month = uint32_t{0};
+  auto day = uint32_t{0};
+  civil_from_days(days, year, month, day);
+
+  auto stream = std::stringstream{};
+  stream << std::setfill('0') << std::setw(4) << year << '-' << std::setw(2) << month << '-' << std::setw(2) << day;
+  return stream.str();
+}
+
+std::vector<std::string> format_column_values(const BaseColumn& column, const DataType data_type,
+                                              const LogicalType& logical_type) {
+  auto strings = std::vector<std::string>(column.size());
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto values = std::vector<ColumnDataType>{};
+    auto nulls = std::vector<bool>{};
+    materialize_values_and_nulls(column, ChunkOffset{0}, static_cast<ChunkOffset>(column.size()), values, nulls);
+
+    // Streamed like type_cast<std::string>() does, so that, e.g., floats are printed the same way
+    auto stream = std::ostringstream{};
+    for (auto index = size_t{0}; index < values.size(); ++index) {
+      if (nulls[index]) {
+        strings[index] = "NULL";
+      } else if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        strings[index] = values[index];
+      } else if constexpr (std::is_integral_v<ColumnDataType>) {
+        const auto value = values[index];
+        const auto has_logical_type = logical_type.kind != LogicalType::Kind::None;
+        strings[index] = has_logical_type ? logical_type.format(value) : std::to_string(value);
+      } else {
+        stream.str("");
+        stream << values[index];
+        strings[index] = stream.str();
+      }
+    }
+  });
+
+  return strings;
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+/**
+ * DATE and DECIMAL(precision, scale) are logical types of columns, which are stored as one of the DataTypes:
+ *
+ *   - DATE is stored as Int, the number of days since 1970-01-01.
+ *   - DECIMAL(precision, scale) is stored as Long, the value multiplied by 10^scale. At most 18 digits are supported.
+ *
+ * Thus, encodings (e.g., FrameOfReference), scans and indices handle them as integers and predicates on them are
+ * integer comparisons. The logical type of a column is part of its TableColumnDefinition and is passed on by the
+ * operators that forward input columns. The SQLTranslator encodes literals that are compared to such columns (e.g.,
+ * '1995-03-15' for a DATE column) and values are formatted for output by Print and the server.
+ */
+struct LogicalType final {
+  enum class Kind : uint8_t { None, Date, Decimal };
+
+  // How encode() treats DECIMALs with more decimal places than the scale: Exact fails, Floor and Ceil round them
+  // towards negative and positive infinity, respectively
+  enum class Rounding : uint8_t { Exact, Floor, Ceil };
+
+  static constexpr uint8_t MAX_DECIMAL_PRECISION = 18;
+
+  static LogicalType date();
+  static LogicalType decimal(const uint8_t precision, const uint8_t scale);
+
+  // Parses the names returned by name(), i.e., "date" and "decimal(p,s)". Returns std::nullopt for all other names.
+  static std::optional<LogicalType> from_name(const std::string& name);
+
+  // The DataType the values are stored as
+  DataType data_type() const;
+
+  std::string name() const;
+
+  /**
+   * Converts a value to its stored representation. DATEs can be given as strings (YYYY-MM-DD), DECIMALs as strings
+   * or numbers. Values that already are stored DATEs (i.e., integers) and NULL are returned unchanged. Fails for
+   * values that cannot be represented without loss, e.g., 1.234 for DECIMAL(10,2).
+   */
+  AllTypeVariant encode(const AllTypeVariant& value) const;
+  AllTypeVariant encode(const AllTypeVariant& value, const Rounding rounding) const;
+
+  // Formats a stored value, e.g., "1995-03-15" for DATEs and "-12.50" for DECIMAL(10,2)
+  std::string format(const AllTypeVariant& stored_value) const;
+  std::string format(const int64_t stored_value) const;
+
+  bool operator==(const LogicalType& rhs) const;
+  bool operator!=(const LogicalType& rhs) const;
+
+  Kind kind{Kind::None};
+  uint8_t precision{0};
+  uint8_t scale{0};
+};
+
+// 10^scale, i.e., the factor DECIMALs of that scale are stored multiplied with
+int64_t decimal_factor(const uint8_t scale);
+
+// Converts between dates in the format YYYY-MM-DD and the number of days since 1970-01-01
+int32_t date_to_days(const std::string& date);
+std::string days_to_date(const int32_t days);
+
+class BaseColumn;
+
+// Formats all values of a column like LogicalType::format() does, NULLs as "NULL"
+std::vector<std::string> format_column_values(const BaseColumn& column, const DataType data_type,
+                                              const LogicalType& logical_type);
+
+}  // namespace opossum
@@ -7,6 +7,7 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
@@ -27,6 +28,7 @@ void AbstractOperator::execute() {
   DebugAssert(!_output, "Operator has already been executed");
 
   Timer performance_timer;
+  const JobTaskCounter job_task_counter;
 
   auto transaction_context = this->transaction_context();
 
@@ -50,6 +52,7 @@ void AbstractOperator::execute() {
   _on_cleanup();
 
   _base_performance_data.walltime = performance_timer.lap();
+  _base_performance_data.job_task_count = job_task_counter.count();
 }
 
 // returns the result of the operator
@@ -110,6 +113,10 @@ std::shared_ptr<AbstractOperator> AbstractOperator::mutable_input_right() const
 
 const BaseOperatorPerformanceData& AbstractOperator::base_performance_data() const { return _base_performance_data; }
 
+std::shared_ptr<const AbstractLQPNode> AbstractOperator::lqp_node() const { return _lqp_node.lock(); }
+
+void AbstractOperator::set_lqp_node(const std::shared_ptr<const AbstractLQPNode>& lqp_node) { _lqp_node = lqp_node; }
+
 std::shared_ptr<const AbstractOperator> AbstractOperator::input_left() const { return _input_left; }
 
 std::shared_ptr<const AbstractOperator> AbstractOperator::input_right() const { return _input_right; }
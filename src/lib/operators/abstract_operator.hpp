@@ -11,6 +11,7 @@
 
 namespace opossum {
 
+class AbstractLQPNode;
 class OperatorTask;
 class Table;
 class TransactionContext;
@@ -19,8 +20,10 @@ enum class OperatorType {
   Aggregate,
   Delete,
   Difference,
+  Distinct,
   ExportBinary,
   ExportCsv,
+  GetMetaTable,
   GetTable,
   ImportBinary,
   ImportCsv,
@@ -35,6 +38,8 @@ enum class OperatorType {
   Print,
   Product,
   Projection,
+  RebuildChunks,
+  SetOperationHash,
   Sort,
   TableScan,
   TableWrapper,
@@ -114,6 +119,11 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Derived operators may produce more finely grained performance data (e.g. JoinHash::join_hash_performance_data())
   const BaseOperatorPerformanceData& base_performance_data() const;
 
+  // The LQP node this operator was created from, if any. Set by the LQPTranslator and used, e.g., to compare
+  // estimated and actual cardinalities. Held weakly, as LQP nodes may in turn hold operators (see MaterializedNode).
+  std::shared_ptr<const AbstractLQPNode> lqp_node() const;
+  void set_lqp_node(const std::shared_ptr<const AbstractLQPNode>& lqp_node);
+
   void print(std::ostream& stream = std::cout) const;
 
  protected:
@@ -153,6 +163,8 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
 
   BaseOperatorPerformanceData _base_performance_data;
 
+  std::weak_ptr<const AbstractLQPNode> _lqp_node;
+
   std::weak_ptr<OperatorTask> _operator_task;
 };
 
@@ -201,9 +201,11 @@ struct AggregateTraits<
 The AggregateFunctionBuilder is used to create the lambda function that will be used by
 the AggregateVisitor. It is a separate class because methods cannot be partially specialized.
 Therefore, we partially specialize the whole class and define the get_aggregate_function anew every time.
+The functions update the current aggregate in place, so that, e.g., MIN() and MAX() on strings only copy a value if
+it is a new minimum or maximum.
 */
 template <typename ColumnType, typename AggregateType>
-using AggregateFunctor = std::function<std::optional<AggregateType>(ColumnType, std::optional<AggregateType>)>;
+using AggregateFunctor = std::function<void(const ColumnType&, std::optional<AggregateType>&)>;
 
 template <typename ColumnType, typename AggregateType, AggregateFunction function>
 struct AggregateFunctionBuilder {
@@ -213,12 +215,11 @@ struct AggregateFunctionBuilder {
 template <typename ColumnType, typename AggregateType>
 struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Min> {
   AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType new_value, std::optional<AggregateType> current_aggregate) {
+    return [](const ColumnType& new_value, std::optional<AggregateType>& current_aggregate) {
       if (!current_aggregate || value_smaller(new_value, *current_aggregate)) {
         // New minimum found
-        return new_value;
+        current_aggregate = new_value;
       }
-      return *current_aggregate;
     };
   }
 };
@@ -226,12 +227,11 @@ struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Mi
 template <typename ColumnType, typename AggregateType>
 struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Max> {
   AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType new_value, std::optional<AggregateType> current_aggregate) {
+    return [](const ColumnType& new_value, std::optional<AggregateType>& current_aggregate) {
       if (!current_aggregate || value_greater(new_value, *current_aggregate)) {
         // New maximum found
-        return new_value;
+        current_aggregate = new_value;
       }
-      return *current_aggregate;
     };
   }
 };
@@ -239,9 +239,17 @@ struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Ma
 template <typename ColumnType, typename AggregateType>
 struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Sum> {
   AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType new_value, std::optional<AggregateType> current_aggregate) {
+    return [](const ColumnType& new_value, std::optional<AggregateType>& current_aggregate) {
       // add new value to sum
-      return new_value + (!current_aggregate ? 0 : *current_aggregate);
+      if constexpr (std::is_integral_v<AggregateType>) {
+        // Integer sums (and thereby DECIMAL sums, which are stored as integers) must not silently wrap around
+        auto sum = AggregateType{};
+        const auto overflow = __builtin_add_overflow(!current_aggregate ? 0 : *current_aggregate, new_value, &sum);
+        Assert(!overflow, "Overflow in SUM()");
+        current_aggregate = sum;
+      } else {
+        current_aggregate = new_value + (!current_aggregate ? 0 : *current_aggregate);
+      }
     };
   }
 };
@@ -249,9 +257,9 @@ struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Su
 template <typename ColumnType, typename AggregateType>
 struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Avg> {
   AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType new_value, std::optional<AggregateType> current_aggregate) {
+    return [](const ColumnType& new_value, std::optional<AggregateType>& current_aggregate) {
       // add new value to sum
-      return new_value + (!current_aggregate ? 0 : *current_aggregate);
+      current_aggregate = new_value + (!current_aggregate ? 0 : *current_aggregate);
     };
   }
 };
@@ -259,14 +267,14 @@ struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Av
 template <typename ColumnType, typename AggregateType>
 struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Count> {
   AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType, std::optional<AggregateType> current_aggregate) { return std::nullopt; };
+    return [](const ColumnType&, std::optional<AggregateType>&) {};
   }
 };
 
 template <typename ColumnType, typename AggregateType>
 struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::CountDistinct> {
   AggregateFunctor<ColumnType, AggregateType> get_aggregate_function() {
-    return [](ColumnType, std::optional<AggregateType> current_aggregate) { return std::nullopt; };
+    return [](const ColumnType&, std::optional<AggregateType>&) {};
   }
 };
 
@@ -298,16 +306,17 @@ void Aggregate::_aggregate_column(ChunkID chunk_id, ColumnID column_index, const
          */
         results.try_emplace((*hash_keys)[chunk_offset]);
       } else {
+        auto& result = results[(*hash_keys)[chunk_offset]];
+
         // If we have a value, use the aggregator lambda to update the current aggregate value for this group
-        results[(*hash_keys)[chunk_offset]].current_aggregate =
-            aggregator(value.value(), results[(*hash_keys)[chunk_offset]].current_aggregate);
+        aggregator(value.value(), result.current_aggregate);
 
         // increase value counter
-        ++results[(*hash_keys)[chunk_offset]].aggregate_count;
+        ++result.aggregate_count;
 
         if (function == AggregateFunction::CountDistinct) {
           // for the case of CountDistinct, insert this value into the set to keep track of distinct values
-          results[(*hash_keys)[chunk_offset]].distinct_values.insert(value.value());
+          result.distinct_values.insert(value.value());
         }
       }
 
@@ -350,6 +359,8 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
   jobs.reserve(input_table->chunk_count());
 
   for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto node_id = input_table->get_chunk(chunk_id)->node_id();
+
     jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, this]() {
       auto chunk_in = input_table->get_chunk(chunk_id);
 
@@ -378,7 +389,7 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
       }
 
       _keys_per_chunk[chunk_id] = hash_keys;
-    }));
+    }, node_id));
     jobs.back()->schedule();
   }
 
@@ -525,7 +536,8 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
   // add group by columns
   for (const auto column_id : _groupby_column_ids) {
     _output_column_definitions.emplace_back(input_table->column_name(column_id),
-                                            input_table->column_data_type(column_id));
+                                            input_table->column_data_type(column_id), false,
+                                            input_table->column_logical_type(column_id));
 
     auto groupby_column =
         make_shared_by_data_type<BaseColumn, ValueColumn>(input_table->column_data_type(column_id), true);
@@ -710,8 +722,18 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
     }
   }
 
+  // MIN and MAX of DATEs are DATEs, also the SUM of DECIMALs is a DECIMAL of the same scale
+  auto logical_type = LogicalType{};
+  if (aggregate.column) {
+    const auto& input_logical_type = input_table_left()->column_logical_type(*aggregate.column);
+    if (function == AggregateFunction::Min || function == AggregateFunction::Max ||
+        (function == AggregateFunction::Sum && input_logical_type.kind == LogicalType::Kind::Decimal)) {
+      logical_type = input_logical_type;
+    }
+  }
+
   constexpr bool needs_null = (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct);
-  _output_column_definitions.emplace_back(output_column_name, aggregate_data_type, needs_null);
+  _output_column_definitions.emplace_back(output_column_name, aggregate_data_type, needs_null, logical_type);
 
   auto col = std::make_shared<ValueColumn<decltype(aggregate_type)>>(needs_null);
 
@@ -730,6 +752,17 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
   // write aggregated values into the column
   if (!context->results->empty()) {
     _write_aggregate_values<ColumnType, decltype(aggregate_type), function>(col, context->results);
+
+    // DECIMALs are stored multiplied by 10^scale, but their AVG is a Double of the actual value
+    if constexpr (function == AggregateFunction::Avg && std::is_arithmetic_v<decltype(aggregate_type)>) {
+      const auto& input_logical_type = input_table_left()->column_logical_type(*aggregate.column);
+      if (input_logical_type.kind == LogicalType::Kind::Decimal) {
+        const auto factor = static_cast<double>(decimal_factor(input_logical_type.scale));
+        for (auto& value : col->values()) {
+          value /= factor;
+        }
+      }
+    }
   } else if (_groupby_columns.empty()) {
     // If we did not GROUP BY anything and we have no results, we need to add NULL for most aggregates and 0 for count
     col->values().push_back(decltype(aggregate_type){});
@@ -1,11 +1,20 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 
 namespace opossum {
 
 struct BaseOperatorPerformanceData final {
   std::chrono::microseconds walltime{0};
+
+  // The chunks an operator read from its input or from a stored table and the chunks it skipped because they were
+  // pruned. Only set by operators that scan chunks (GetTable, TableScan and IndexScan).
+  size_t chunks_scanned{0};
+  size_t chunks_pruned{0};
+
+  // The JobTasks the operator created while it was executed, including the ones these created, see JobTaskCounter
+  size_t job_task_count{0};
 };
 
 }  // namespace opossum
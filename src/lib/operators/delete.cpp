@@ -1,12 +1,16 @@
 #include "delete.hpp"
 
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "concurrency/transaction_context.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/value_deltas.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -24,45 +28,75 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
   _table = StorageManager::get().get_table(_table_name);
   _transaction_id = context->transaction_id();
 
-  const auto values_to_delete = input_table_left();
+  // Group the rows to delete by the chunk they belong to, so that the MvccColumns of each chunk only need to be
+  // acquired once and its rows can be locked in one go.
+  auto rows_to_delete = std::map<ChunkID, std::vector<ChunkOffset>>{};
 
+  const auto values_to_delete = input_table_left();
   for (ChunkID chunk_id{0}; chunk_id < values_to_delete->chunk_count(); ++chunk_id) {
     const auto chunk = values_to_delete->get_chunk(chunk_id);
 
     // we have already verified that all columns reference the same table
     const auto first_column = std::static_pointer_cast<const ReferenceColumn>(chunk->get_column(ColumnID{0}));
-    const auto pos_list = first_column->pos_list();
 
-    _pos_lists.emplace_back(pos_list);
+    for (const auto& row_id : *first_column->pos_list()) {
+      rows_to_delete[row_id.chunk_id].emplace_back(row_id.chunk_offset);
+    }
+  }
+
+  _locked_rows.reserve(rows_to_delete.size());
+
+  const auto snapshot_commit_id = context->snapshot_commit_id();
+
+  for (auto& [referenced_chunk_id, chunk_offsets] : rows_to_delete) {
+    const auto referenced_chunk = _table->get_chunk(referenced_chunk_id);
+    const auto value_deltas = referenced_chunk->value_deltas();
+    auto mvcc_columns = referenced_chunk->mvcc_columns();
+    auto& tids = mvcc_columns->tids;
 
-    for (const auto& row_id : *pos_list) {
-      auto referenced_chunk = _table->get_chunk(row_id.chunk_id);
+    for (auto index = size_t{0}; index < chunk_offsets.size(); ++index) {
+      const auto chunk_offset = chunk_offsets[index];
 
-      auto expected = 0u;
+      auto expected = TransactionID{0};
       // Actual row lock for delete happens here
-      const auto success = referenced_chunk->mvcc_columns()->tids[row_id.chunk_offset].compare_exchange_strong(
-          expected, _transaction_id);
+      auto success = tids[chunk_offset].compare_exchange_strong(expected, _transaction_id);
 
-      // the row is already locked and the transaction needs to be rolled back
+      // Values of the row that were updated in place by a transaction that we do not see are a conflict as well
+      if (success && !value_deltas->empty() &&
+          !value_deltas->row_is_writable(chunk_offset, _transaction_id, snapshot_commit_id)) {
+        tids[chunk_offset] = 0u;
+        success = false;
+      }
+
+      // the row is already locked and the transaction needs to be rolled back. Only remember the rows that were
+      // actually locked, so that the rollback releases exactly those.
       if (!success) {
+        chunk_offsets.resize(index);
+        _locked_rows.emplace_back(referenced_chunk_id, std::move(chunk_offsets));
         _mark_as_failed();
         return nullptr;
       }
     }
+
+    _locked_rows.emplace_back(referenced_chunk_id, std::move(chunk_offsets));
   }
 
   return nullptr;
 }
 
 void Delete::_on_commit_records(const CommitID cid) {
-  for (const auto& pos_list : _pos_lists) {
-    for (const auto& row_id : *pos_list) {
-      auto chunk = _table->get_chunk(row_id.chunk_id);
+  for (const auto& [chunk_id, chunk_offsets] : _locked_rows) {
+    auto mvcc_columns = _table->get_chunk(chunk_id)->mvcc_columns();
+    auto& end_cids = mvcc_columns->end_cids;
 
-      chunk->mvcc_columns()->end_cids[row_id.chunk_offset] = cid;
+    for (const auto chunk_offset : chunk_offsets) {
+      end_cids[chunk_offset] = cid;
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
     }
+    mvcc_columns->update_last_commit_id(cid);
   }
+
+  _table->update_last_commit_id(cid);
 }
 
 void Delete::_finish_commit() {
@@ -77,19 +111,15 @@ void Delete::_finish_commit() {
 }
 
 void Delete::_on_rollback_records() {
-  for (const auto& pos_list : _pos_lists) {
-    for (const auto& row_id : *pos_list) {
-      auto chunk = _table->get_chunk(row_id.chunk_id);
+  // unlock all rows locked in _on_execute
+  for (const auto& [chunk_id, chunk_offsets] : _locked_rows) {
+    auto mvcc_columns = _table->get_chunk(chunk_id)->mvcc_columns();
+    auto& tids = mvcc_columns->tids;
 
+    for (const auto chunk_offset : chunk_offsets) {
       auto expected = _transaction_id;
-
-      // unlock all rows locked in _on_execute
-      const auto result = chunk->mvcc_columns()->tids[row_id.chunk_offset].compare_exchange_strong(expected, 0u);
-
-      // If the above operation fails, it means the row is locked by another transaction. This must have been
-      // the reason why the rollback was initiated. Since _on_execute stopped at this row, we can stop
-      // unlocking rows here as well.
-      if (!result) return;
+      [[maybe_unused]] const auto result = tids[chunk_offset].compare_exchange_strong(expected, 0u);
+      DebugAssert(result, "Row was expected to be locked by this transaction");
     }
   }
 }
@@ -118,7 +148,8 @@ bool Delete::_execution_input_valid(const std::shared_ptr<TransactionContext>& c
 
     const auto first_column = std::static_pointer_cast<const ReferenceColumn>(chunk->get_column(ColumnID{0}));
 
-    if (table != first_column->referenced_table()) return false;
+    const auto referenced_table = first_column->referenced_table();
+    if (table != referenced_table && table != referenced_table->origin_table()) return false;
   }
 
   return true;
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "abstract_read_write_operator.hpp"
@@ -14,6 +15,9 @@ namespace opossum {
  * Expects a table with one chunk referencing only one table which
  * is passed via the AbstractOperator in the constructor.
  *
+ * The rows are grouped by the chunk they belong to and locked chunk by chunk, so that the MvccColumns of a chunk are
+ * only acquired once instead of for every row. The same holds for committing and rolling back.
+ *
  * Assumption: The input has been validated before.
  */
 class Delete : public AbstractReadWriteOperator {
@@ -41,6 +45,8 @@ class Delete : public AbstractReadWriteOperator {
   const std::string _table_name;
   std::shared_ptr<Table> _table;
   TransactionID _transaction_id;
-  std::vector<std::shared_ptr<const PosList>> _pos_lists;
+
+  // The rows of _table that have been locked by this operator, grouped by their chunk
+  std::vector<std::pair<ChunkID, std::vector<ChunkOffset>>> _locked_rows;
 };
 }  // namespace opossum
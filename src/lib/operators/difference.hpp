@@ -1,7 +1,6 @@
 #pragma once
 
 #include <memory>
-#include <sstream>
 #include <string>
 #include <vector>
 
@@ -12,7 +11,10 @@
 namespace opossum {
 
 /**
- * Note: Difference does not support null values at the moment
+ * Outputs all rows of the left input that do not occur in the right input. Duplicates within the left input are kept.
+ * Rows are hashed and compared with their typed values, see MaterializedRows. NULLs are considered equal to each other.
+ *
+ * For EXCEPT [ALL] with SQL semantics, see SetOperationHash.
  */
 class Difference : public AbstractReadOnlyOperator {
  public:
@@ -26,9 +28,5 @@ class Difference : public AbstractReadOnlyOperator {
   std::shared_ptr<AbstractOperator> _on_recreate(
       const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
       const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
-
- private:
-  void initialize_chunk(const size_t chunk_id);
-  void append_string_representation(std::ostream& row_string_buffer, const AllTypeVariant value);
 };
 }  // namespace opossum
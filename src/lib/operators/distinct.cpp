@@ -0,0 +1,169 @@
+#include "distinct.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "set_operation_hash/materialized_rows.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Distinct::Distinct(const std::shared_ptr<const AbstractOperator>& in)
+    : AbstractReadOnlyOperator(OperatorType::Distinct, in) {}
+
+const std::string Distinct::name() const { return "Distinct"; }
+
+std::shared_ptr<AbstractOperator> Distinct::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<Distinct>(recreated_input_left);
+}
+
+std::shared_ptr<const Table> Distinct::_on_execute() {
+  const auto input_table = input_table_left();
+
+  const auto distinct_rows =
+      _is_dictionary_encoded_single_column() ? _find_distinct_rows_in_dictionary_column() : _find_distinct_rows();
+
+  auto output = std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    if (distinct_rows[chunk_id].empty()) continue;
+    output->append_chunk(create_reference_columns(input_table, chunk_id, distinct_rows[chunk_id]));
+  }
+
+  return output;
+}
+
+bool Distinct::_is_dictionary_encoded_single_column() const {
+  const auto input_table = input_table_left();
+  if (input_table->column_count() != 1 || input_table->type() != TableType::Data) return false;
+
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto column = input_table->get_chunk(chunk_id)->get_column(ColumnID{0});
+    if (!std::dynamic_pointer_cast<const BaseDictionaryColumn>(column)) return false;
+  }
+
+  return true;
+}
+
+std::vector<std::vector<ChunkOffset>> Distinct::_find_distinct_rows() const {
+  const auto input_table = input_table_left();
+  const auto rows = MaterializedRows{input_table};
+
+  using RowSet = std::unordered_set<MaterializedRow, MaterializedRowHash, MaterializedRowEqual>;
+
+  // 1. Remove the duplicates within each chunk
+  auto distinct_rows = std::vector<std::vector<ChunkOffset>>(input_table->chunk_count());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(input_table->chunk_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_size = input_table->get_chunk(chunk_id)->size();
+      const auto chunk_begin = rows.chunk_begin(chunk_id);
+
+      auto chunk_row_set = RowSet(chunk_size);
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (chunk_row_set.emplace(MaterializedRow{&rows, chunk_begin + chunk_offset}).second) {
+          distinct_rows[chunk_id].emplace_back(chunk_offset);
+        }
+      }
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // 2. Remove the rows that already occurred in a previous chunk
+  auto row_set = RowSet(rows.row_count());
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto chunk_begin = rows.chunk_begin(chunk_id);
+    auto& chunk_offsets = distinct_rows[chunk_id];
+
+    chunk_offsets.erase(std::remove_if(chunk_offsets.begin(), chunk_offsets.end(),
+                                       [&](const auto chunk_offset) {
+                                         return !row_set.emplace(MaterializedRow{&rows, chunk_begin + chunk_offset})
+                                                     .second;
+                                       }),
+                        chunk_offsets.end());
+  }
+
+  return distinct_rows;
+}
+
+std::vector<std::vector<ChunkOffset>> Distinct::_find_distinct_rows_in_dictionary_column() const {
+  const auto input_table = input_table_left();
+
+  auto distinct_rows = std::vector<std::vector<ChunkOffset>>(input_table->chunk_count());
+
+  resolve_data_type(input_table->column_data_type(ColumnID{0}), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // 1. Find the first occurrence of each ValueID within each chunk
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(input_table->chunk_count());
+
+    for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        const auto& column = static_cast<const DictionaryColumn<ColumnDataType>&>(
+            *input_table->get_chunk(chunk_id)->get_column(ColumnID{0}));
+
+        // Indexed by ValueID, including the null_value_id (== unique_values_count())
+        auto first_occurrences = std::vector<ChunkOffset>(column.unique_values_count() + 1, INVALID_CHUNK_OFFSET);
+
+        resolve_compressed_vector_type(*column.attribute_vector(), [&](const auto& attribute_vector) {
+          auto chunk_offset = ChunkOffset{0};
+          for (const auto value_id : attribute_vector) {
+            if (first_occurrences[value_id] == INVALID_CHUNK_OFFSET) first_occurrences[value_id] = chunk_offset;
+            ++chunk_offset;
+          }
+        });
+
+        auto& chunk_offsets = distinct_rows[chunk_id];
+        chunk_offsets.reserve(first_occurrences.size());
+        for (const auto chunk_offset : first_occurrences) {
+          if (chunk_offset != INVALID_CHUNK_OFFSET) chunk_offsets.emplace_back(chunk_offset);
+        }
+        std::sort(chunk_offsets.begin(), chunk_offsets.end());
+      }));
+    }
+
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+    // 2. Remove the values that already occurred in a previous chunk
+    auto value_set = std::unordered_set<ColumnDataType>{};
+    auto null_occurred = false;
+
+    for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      const auto& column = static_cast<const DictionaryColumn<ColumnDataType>&>(
+          *input_table->get_chunk(chunk_id)->get_column(ColumnID{0}));
+      const auto& dictionary = *column.dictionary();
+      const auto null_value_id = column.null_value_id();
+      const auto decoder = column.attribute_vector()->create_base_decoder();
+
+      auto& chunk_offsets = distinct_rows[chunk_id];
+      chunk_offsets.erase(std::remove_if(chunk_offsets.begin(), chunk_offsets.end(),
+                                         [&](const auto chunk_offset) {
+                                           const auto value_id = decoder->get(chunk_offset);
+                                           if (value_id == null_value_id) return std::exchange(null_occurred, true);
+                                           return !value_set.emplace(dictionary[value_id]).second;
+                                         }),
+                          chunk_offsets.end());
+    }
+  });
+
+  return distinct_rows;
+}
+
+}  // namespace opossum
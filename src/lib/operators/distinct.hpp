@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Eliminates duplicate rows. The output references the first occurrence of each distinct row of the input, in the
+ * order of the input. As in SQL, NULLs are considered equal to each other.
+ *
+ * The input is materialized into typed columns and hashed per row (see MaterializedRows). Each chunk first removes
+ * the duplicates within itself, in parallel, so that only the remaining rows need to be checked against the rows of
+ * the other chunks.
+ *
+ * For a single column whose chunks are all dictionary encoded, the duplicates within a chunk are found via their
+ * ValueIDs and only the dictionary values of the remaining rows are hashed.
+ *
+ * Used for SELECT DISTINCT and aggregations without aggregate functions (e.g., SELECT a FROM t GROUP BY a).
+ */
+class Distinct : public AbstractReadOnlyOperator {
+ public:
+  explicit Distinct(const std::shared_ptr<const AbstractOperator>& in);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+
+ private:
+  bool _is_dictionary_encoded_single_column() const;
+
+  // The distinct rows of each chunk of the input, as ascending ChunkOffsets
+  std::vector<std::vector<ChunkOffset>> _find_distinct_rows() const;
+  std::vector<std::vector<ChunkOffset>> _find_distinct_rows_in_dictionary_column() const;
+};
+
+}  // namespace opossum
@@ -8,6 +8,7 @@
 
 #include "import_export/binary.hpp"
 #include "storage/dictionary_column.hpp"
+#include "storage/materialize.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
@@ -195,38 +196,12 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_column(const ReferenceColumn&
   // We materialize reference columns and save them as value columns
   _export_value(context->ofstream, BinaryColumnType::value_column);
 
-  // Unfortunately, we have to iterate over all values of the reference column
-  // to materialize its contents. Then we can write them to the file
-  for (ChunkOffset row = 0; row < ref_column.size(); ++row) {
-    _export_value(context->ofstream, type_cast<T>(ref_column[row]));
-  }
-}
-
-// handle_column implementation for string columns
-template <>
-void ExportBinary::ExportBinaryVisitor<std::string>::handle_column(
-    const ReferenceColumn& ref_column, std::shared_ptr<ColumnVisitableContext> base_context) {
-  auto context = std::static_pointer_cast<ExportContext>(base_context);
-
-  // We materialize reference columns and save them as value columns
-  _export_value(context->ofstream, BinaryColumnType::value_column);
-
-  // If there is no data, we can skip all of the coming steps.
-  if (ref_column.size() == 0) return;
-
-  std::stringstream values;
-  std::string value;
-  std::vector<StringLength> string_lengths(ref_column.size());
-
-  // We export the values materialized
-  for (ChunkOffset row = 0; row < ref_column.size(); ++row) {
-    value = type_cast<std::string>(ref_column[row]);
-    string_lengths[row] = static_cast<StringLength>(value.length());
-    values << value;
-  }
+  // The referenced values are decoded in bulk and then written to the file
+  auto values = std::vector<T>{};
+  auto nulls = std::vector<bool>{};
+  materialize_values_and_nulls(ref_column, ChunkOffset{0}, static_cast<ChunkOffset>(ref_column.size()), values, nulls);
 
-  _export_values(context->ofstream, string_lengths);
-  context->ofstream << values.rdbuf();
+  _export_values(context->ofstream, values);
 }
 
 template <typename T>
@@ -1,5 +1,6 @@
 #include "export_csv.hpp"
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -75,19 +76,37 @@ void ExportCsv::_generate_content_file(const std::shared_ptr<const Table>& table
    * in the chunks and afterwards through the columns of the chunks.
    *
    * This is a lot of iterating, but to convert a column-based table to
-   * a row-based representation takes some effort.
+   * a row-based representation takes some effort. To keep the per-value
+   * work small, the columns of a chunk are decoded into typed vectors first.
    */
+  auto column_writers = std::vector<std::function<void(ChunkOffset)>>{};
+
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
     const auto chunk = table->get_chunk(chunk_id);
 
-    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk->size(); ++chunk_offset) {
-      for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
-        const auto column = chunk->get_column(column_id);
+    column_writers.clear();
+    for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+      resolve_data_type(table->column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        auto values = std::vector<ColumnDataType>{};
+        auto nulls = std::vector<bool>{};
+        materialize_values_and_nulls(*chunk->get_column(column_id), ChunkOffset{0}, chunk->size(), values, nulls);
+
+        column_writers.emplace_back([&writer, values = std::move(values), nulls = std::move(nulls)](
+                                        const ChunkOffset chunk_offset) {
+          if (nulls[chunk_offset]) {
+            writer.write_null();
+          } else {
+            writer.write_value(values[chunk_offset]);
+          }
+        });
+      });
+    }
 
-        // The previous implementation did a double dispatch (at least two virtual method calls)
-        // So the subscript operator cannot be much slower.
-        const auto value = (*column)[chunk_offset];
-        writer.write(value);
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk->size(); ++chunk_offset) {
+      for (const auto& column_writer : column_writers) {
+        column_writer(chunk_offset);
       }
 
       writer.end_line();
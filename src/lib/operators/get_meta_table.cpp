@@ -0,0 +1,32 @@
+#include "get_meta_table.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/meta_table_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+GetMetaTable::GetMetaTable(const std::string& table_name)
+    : AbstractReadOnlyOperator(OperatorType::GetMetaTable), _table_name(table_name) {}
+
+const std::string GetMetaTable::name() const { return "GetMetaTable"; }
+
+const std::string GetMetaTable::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+  return name() + separator + "(" + table_name() + ")";
+}
+
+const std::string& GetMetaTable::table_name() const { return _table_name; }
+
+std::shared_ptr<AbstractOperator> GetMetaTable::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<GetMetaTable>(_table_name);
+}
+
+std::shared_ptr<const Table> GetMetaTable::_on_execute() { return MetaTableManager::generate_table(_table_name); }
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+
+namespace opossum {
+
+// Generates a meta table (see MetaTableManager) every time it is executed
+class GetMetaTable : public AbstractReadOnlyOperator {
+ public:
+  explicit GetMetaTable(const std::string& table_name);
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  const std::string& table_name() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+
+ private:
+  const std::string _table_name;
+};
+
+}  // namespace opossum
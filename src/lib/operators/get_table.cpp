@@ -7,7 +7,15 @@
 #include <unordered_set>
 #include <vector>
 
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/materialized_view.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/table_placement.hpp"
+#include "storage/value_deltas.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -32,18 +40,40 @@ void GetTable::set_excluded_chunk_ids(const std::vector<ChunkID>& excluded_chunk
   _excluded_chunk_ids = excluded_chunk_ids;
 }
 
+void GetTable::set_materialized_view_subplan(const std::shared_ptr<AbstractOperator>& subplan) {
+  _materialized_view_subplan = subplan;
+}
+
 std::shared_ptr<AbstractOperator> GetTable::_on_recreate(
     const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
     const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
   auto copy = std::make_shared<GetTable>(_name);
   copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  if (_materialized_view_subplan) copy->set_materialized_view_subplan(_materialized_view_subplan->recreate(args));
   return copy;
 }
 
-std::shared_ptr<const Table> GetTable::_on_execute() {
-  auto original_table = StorageManager::get().get_table(_name);
+std::shared_ptr<const Table> GetTable::_on_execute() { return _on_execute(nullptr); }
+
+std::shared_ptr<const Table> GetTable::_on_execute(std::shared_ptr<TransactionContext> transaction_context) {
+  auto& storage_manager = StorageManager::get();
+
+  if (storage_manager.has_materialized_view(_name)) return _read_materialized_view(transaction_context);
+
+  const auto transaction_id = transaction_context ? transaction_context->transaction_id() : TransactionID{0};
+  const auto snapshot_commit_id = transaction_context ? transaction_context->snapshot_commit_id()
+                                                      : TransactionManager::get().last_commit_id();
+  // Replicated tables are read from the replica on the node of the executing worker
+  const auto stored_table = storage_manager.get_table(_name);
+  const auto original_table = create_table_with_visible_values(TablePlacement::local_table(stored_table),
+                                                               transaction_id, snapshot_commit_id);
+
+  _base_performance_data.chunks_pruned = _excluded_chunk_ids.size();
+  _base_performance_data.chunks_scanned = original_table->chunk_count() - _excluded_chunk_ids.size();
+
+  // All results that are derived from the output reference it, and keep the stored table pinned (see Table::pin())
   if (_excluded_chunk_ids.empty()) {
-    return original_table;
+    return Table::pin(stored_table, original_table);
   }
 
   // we create a copy of the original table and don't include the excluded chunks
@@ -53,11 +83,34 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
       std::unordered_set<ChunkID>(_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend());
   for (ChunkID chunk_id{0}; chunk_id < original_table->chunk_count(); ++chunk_id) {
     if (excluded_chunks_set.find(chunk_id) == excluded_chunks_set.end()) {
-      pruned_table->append_chunk(original_table->get_chunk(chunk_id));
+      pruned_table->append_chunk(original_table->chunks()[chunk_id]);
     }
   }
 
-  return pruned_table;
+  return Table::pin(stored_table, pruned_table);
+}
+
+std::shared_ptr<const Table> GetTable::_read_materialized_view(
+    const std::shared_ptr<TransactionContext>& transaction_context) {
+  DebugAssert(_excluded_chunk_ids.empty(), "Chunks of materialized views are not pruned");
+
+  const auto materialized_view = StorageManager::get().get_materialized_view(_name);
+  const auto snapshot_commit_id = transaction_context ? transaction_context->snapshot_commit_id()
+                                                      : TransactionManager::get().last_commit_id();
+  const auto is_up_to_date = materialized_view->refresh(snapshot_commit_id);
+
+  // Own writes of the transaction are not part of the view. As in the QueryResultCache, any write counts.
+  const auto has_own_writes = transaction_context && transaction_context->has_read_write_operators();
+
+  if (_materialized_view_subplan && (!is_up_to_date || has_own_writes)) {
+    _materialized_view_subplan->set_transaction_context_recursively(transaction_context);
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(_materialized_view_subplan));
+    return _materialized_view_subplan->get_output();
+  }
+
+  const auto rows = materialized_view->rows_at(snapshot_commit_id);
+  _base_performance_data.chunks_scanned = rows->chunk_count();
+  return rows;
 }
 
 }  // namespace opossum
@@ -21,15 +21,34 @@ class GetTable : public AbstractReadOnlyOperator {
 
   void set_excluded_chunk_ids(const std::vector<ChunkID>& excluded_chunk_ids);
 
+  /**
+   * For reads of a materialized view that replaces a subplan (see MaterializedViewRule): the subplan is executed
+   * instead of reading the view if the view does not hold the result for the snapshot of the transaction, or if the
+   * transaction wrote data that the subplan would see.
+   */
+  void set_materialized_view_subplan(const std::shared_ptr<AbstractOperator>& subplan);
+
   std::shared_ptr<AbstractOperator> _on_recreate(
       const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
       const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
 
  protected:
+  /**
+   * For tables with in-place updated values (see ValueDeltas), the output is a copy of the table with the values that
+   * the transaction sees, or, without a transaction, with all committed values.
+   */
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
 
+  /**
+   * Materialized views are refreshed to the snapshot of the transaction when they are read. The output references the
+   * rows of the view that are visible at that snapshot.
+   */
+  std::shared_ptr<const Table> _read_materialized_view(const std::shared_ptr<TransactionContext>& transaction_context);
+
   // name of the table to retrieve
   const std::string _name;
   std::vector<ChunkID> _excluded_chunk_ids;
+  std::shared_ptr<AbstractOperator> _materialized_view_subplan;
 };
 }  // namespace opossum
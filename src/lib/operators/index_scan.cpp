@@ -49,6 +49,9 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
     }
   }
 
+  _base_performance_data.chunks_scanned = jobs.size();
+  _base_performance_data.chunks_pruned = _in_table->chunk_count() - jobs.size();
+
   CurrentScheduler::wait_for_tasks(jobs);
 
   return _out_table;
@@ -3,11 +3,15 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_column.hpp"
+#include "storage/column_iterables/chunk_offset_mapping.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_column.hpp"
 #include "type_cast.hpp"
@@ -72,11 +76,14 @@ class TypedColumnProcessor : public AbstractTypedColumnProcessor {
 
       // Ignore source value and only set null to true
       casted_target->null_values()[target_start_index] = true;
+    } else if (auto casted_reference_source = std::dynamic_pointer_cast<const ReferenceColumn>(source);
+               casted_reference_source && casted_reference_source->referenced_table()->column_data_type(
+                                              casted_reference_source->referenced_column_id()) ==
+                                              data_type_from_type<T>()) {
+      // This is the case, e.g., for the unchanged columns of rows written by Update.
+      _copy_referenced_data(*casted_reference_source, source_start_index, *casted_target, target_start_index, length);
     } else {
-      // } else if(auto casted_source = std::dynamic_pointer_cast<ReferenceColumn>(source)){
-      // since we have no guarantee that a referenceColumn references only a single other column,
-      // this would require us to find out the referenced column's type for each single row.
-      // instead, we just use the slow path below.
+      // The referenced column has a different type, so we need to cast each value. We use the slow path below.
       for (auto i = 0u; i < length; i++) {
         auto ref_value = (*source)[source_start_index + i];
         if (variant_is_null(ref_value)) {
@@ -89,6 +96,53 @@ class TypedColumnProcessor : public AbstractTypedColumnProcessor {
       }
     }
   }
+
+ private:
+  // Copies the values referenced by source to target. The referenced rows are grouped by their chunk, so that each
+  // referenced column is resolved once and then accessed through its typed iterable instead of value by value.
+  void _copy_referenced_data(const ReferenceColumn& source, size_t source_start_index, ValueColumn<T>& target,
+                             size_t target_start_index, size_t length) {
+    const auto& pos_list = *source.pos_list();
+    auto& values = target.values();
+
+    auto chunk_offsets_by_chunk_id = ChunkOffsetsByChunkID{};
+    for (auto i = 0u; i < length; ++i) {
+      const auto row_id = pos_list[source_start_index + i];
+      if (row_id.is_null()) {
+        Assert(target.is_nullable(), "Cannot insert NULL into NOT NULL target");
+        values[target_start_index + i] = T{};
+        target.null_values()[target_start_index + i] = true;
+        continue;
+      }
+
+      chunk_offsets_by_chunk_id[row_id.chunk_id].push_back({i, row_id.chunk_offset});
+    }
+
+    for (const auto& [referenced_chunk_id, mapped_chunk_offsets] : chunk_offsets_by_chunk_id) {
+      const auto referenced_column =
+          source.referenced_table()->get_chunk(referenced_chunk_id)->get_column(source.referenced_column_id());
+
+      resolve_column_type<T>(*referenced_column, [&](const auto& typed_column) {
+        using ColumnType = std::decay_t<decltype(typed_column)>;
+
+        if constexpr (std::is_same_v<ColumnType, ReferenceColumn>) {
+          Fail("ReferenceColumns must not reference other ReferenceColumns");
+        } else {
+          create_iterable_from_column<T>(typed_column).for_each(&mapped_chunk_offsets, [&](const auto& value) {
+            // chunk_offset() is the offset into the range of source that is copied
+            const auto target_index = target_start_index + value.chunk_offset();
+            if (value.is_null()) {
+              Assert(target.is_nullable(), "Cannot insert NULL into NOT NULL target");
+              values[target_index] = T{};
+              target.null_values()[target_index] = true;
+            } else {
+              values[target_index] = value.value();
+            }
+          });
+        }
+      });
+    }
+  }
 };
 
 Insert::Insert(const std::string& target_table_name, const std::shared_ptr<AbstractOperator>& values_to_insert)
@@ -214,7 +268,10 @@ void Insert::_on_commit_records(const CommitID cid) {
     auto mvcc_columns = chunk->mvcc_columns();
     mvcc_columns->begin_cids[row_id.chunk_offset] = cid;
     mvcc_columns->tids[row_id.chunk_offset] = 0u;
+    mvcc_columns->update_last_commit_id(cid);
   }
+
+  if (!_inserted_rows.empty()) _target_table->update_last_commit_id(cid);
 }
 
 void Insert::_on_rollback_records() {
@@ -2,17 +2,21 @@
 
 #include <boost/lexical_cast.hpp>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "join_hash/hash_traits.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_scheduler.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/column_visitable.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "type_cast.hpp"
@@ -116,6 +120,18 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<LeftType, RightType>::HashType;
 
+  /*
+  If both columns are string columns, the materialized values are views of the strings in the input columns instead of
+  copies. The input operators keep the tables alive, but only the chunks own the columns and they may replace them
+  while the join is running (e.g., ChunkCompressionTask). So the columns the views point into, including the ones a
+  ReferenceColumn refers to, are kept in _materialized_columns until the join has been executed.
+  */
+  template <typename T>
+  using MaterializedType = std::conditional_t<std::is_same_v<HashedType, std::string_view>, std::string_view, T>;
+
+  std::vector<std::shared_ptr<const BaseColumn>> _materialized_columns;
+  std::mutex _materialized_columns_mutex;
+
   using PosLists = std::vector<std::shared_ptr<const PosList>>;
   using PosListsByColumn = std::vector<std::shared_ptr<PosLists>>;
 
@@ -147,27 +163,33 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   };
 
   /*
-  Hashes the given value into the HashedType that is defined by the current Hash Traits.
-  Performs a lexical cast first, if necessary.
+  Converts the given value into the HashedType that is defined by the current Hash Traits.
+  Performs a lexical cast, if necessary.
   */
   template <typename T>
-  constexpr uint32_t hash_value(T& value) {
+  static HashedType _to_hashed_type(const T& value) {
     // clang-format off
     // doesn't deal with constexpr nicely
     if constexpr(!std::is_same_v<T, HashedType>) {
-        return murmur2<HashedType>(type_cast<HashedType>(value), _partitioning_seed);
+        return type_cast<HashedType>(value);
     } else {
-      return murmur2<HashedType>(value, _partitioning_seed);
+      return value;
     }
     // clang-format on
   }
 
+  // Hashes the given value into the HashedType that is defined by the current Hash Traits.
+  template <typename T>
+  uint32_t hash_value(const T& value) {
+    return murmur2<HashedType>(_to_hashed_type(value), _partitioning_seed);
+  }
+
   template <typename T>
-  std::shared_ptr<Partition<T>> _materialize_input(const std::shared_ptr<const Table> in_table, ColumnID column_id,
-                                                   std::vector<std::shared_ptr<std::vector<size_t>>>& histograms,
-                                                   bool keep_nulls = false) {
+  std::shared_ptr<Partition<MaterializedType<T>>> _materialize_input(
+      const std::shared_ptr<const Table> in_table, ColumnID column_id,
+      std::vector<std::shared_ptr<std::vector<size_t>>>& histograms, bool keep_nulls = false) {
     // list of all elements that will be partitioned
-    auto elements = std::make_shared<Partition<T>>();
+    auto elements = std::make_shared<Partition<MaterializedType<T>>>();
     elements->resize(in_table->row_count());
 
     // fan-out
@@ -196,31 +218,50 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     jobs.reserve(in_table->chunk_count());
 
     for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
+      const auto node_id = in_table->get_chunk(chunk_id)->node_id();
+
       jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
         // Get information from work queue
         auto output_offset = chunk_offsets[chunk_id];
         auto column = in_table->get_chunk(chunk_id)->get_column(column_id);
-        auto& output = static_cast<Partition<T>&>(*elements);
+        auto& output = static_cast<Partition<MaterializedType<T>>&>(*elements);
 
         // prepare histogram
         histograms[chunk_id] = std::make_shared<std::vector<size_t>>(num_partitions);
 
         auto& histogram = static_cast<std::vector<size_t>&>(*histograms[chunk_id]);
 
-        auto materialized_chunk = std::vector<std::pair<RowID, T>>();
+        auto materialized_chunk = std::vector<std::pair<RowID, MaterializedType<T>>>();
 
         // Materialize the chunk
         resolve_column_type<T>(*column, [&, chunk_id, keep_nulls](auto& typed_column) {
-          auto iterable = create_iterable_from_column<T>(typed_column);
-
-          iterable.for_each([&, chunk_id, keep_nulls](const auto& value) {
+          const auto materialize_value = [&, chunk_id, keep_nulls](const auto& value) {
             if (!value.is_null() || keep_nulls) {
               materialized_chunk.emplace_back(RowID{chunk_id, value.chunk_offset()}, value.value());
             } else {
               // We need to add this to avoid gaps in the list of offsets when we iterate later on
-              materialized_chunk.emplace_back(NULL_ROW_ID, T{});
+              materialized_chunk.emplace_back(NULL_ROW_ID, MaterializedType<T>{});
             }
-          });
+          };
+
+          auto columns = std::vector<std::shared_ptr<const BaseColumn>>{column};
+
+          if constexpr (std::is_same_v<std::decay_t<decltype(typed_column)>, ReferenceColumn>) {
+            auto iterable = ReferenceColumnIterable<T>{typed_column};
+            iterable.for_each(materialize_value);
+
+            for (const auto& chunk_id_and_column : iterable.referenced_columns()) {
+              columns.emplace_back(chunk_id_and_column.second);
+            }
+          } else {
+            auto iterable = create_iterable_from_column<T>(typed_column);
+            iterable.for_each(materialize_value);
+          }
+
+          if constexpr (std::is_same_v<MaterializedType<T>, std::string_view>) {
+            const auto lock = std::lock_guard<std::mutex>{_materialized_columns_mutex};
+            _materialized_columns.insert(_materialized_columns.end(), columns.cbegin(), columns.cend());
+          }
         });
 
         size_t row_id = output_offset;
@@ -236,8 +277,9 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
           ChunkOffset offset = 0;
           for (auto&& elem : materialized_chunk) {
             if (elem.first.chunk_offset != INVALID_CHUNK_OFFSET) {
-              uint32_t hashed_value = hash_value<T>(elem.second);
-              output[row_id] = PartitionedElement<T>{RowID{chunk_id, offset}, hashed_value, elem.second};
+              uint32_t hashed_value = hash_value(elem.second);
+              output[row_id] =
+                  PartitionedElement<MaterializedType<T>>{RowID{chunk_id, offset}, hashed_value, elem.second};
 
               const Hash radix = (output[row_id].partition_hash >> (32 - _radix_bits * (pass + 1))) & mask;
               histogram[radix]++;
@@ -252,8 +294,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
           for (auto&& elem : materialized_chunk) {
             if (elem.first.chunk_offset == INVALID_CHUNK_OFFSET) continue;
 
-            uint32_t hashed_value = hash_value<T>(elem.second);
-            output[row_id] = PartitionedElement<T>{elem.first, hashed_value, elem.second};
+            uint32_t hashed_value = hash_value(elem.second);
+            output[row_id] = PartitionedElement<MaterializedType<T>>{elem.first, hashed_value, elem.second};
 
             const Hash radix = (output[row_id].partition_hash >> (32 - _radix_bits * (pass + 1))) & mask;
             histogram[radix]++;
@@ -261,7 +303,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
             row_id++;
           }
         }
-      }));
+      }, node_id));
       jobs.back()->schedule();
     }
 
@@ -273,6 +315,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   template <typename T>
   RadixContainer<T> _partition_radix_parallel(std::shared_ptr<Partition<T>> materialized,
                                               std::shared_ptr<std::vector<size_t>> chunk_offsets,
+                                              const std::vector<NodeID>& chunk_node_ids,
                                               std::vector<std::shared_ptr<std::vector<size_t>>>& histograms,
                                               bool keep_nulls = false) {
     // fan-out
@@ -361,7 +404,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
           out[output_offsets[radix]++] = element;
         }
-      }));
+      }, chunk_node_ids[chunk_id]));
       jobs.back()->schedule();
     }
 
@@ -370,10 +413,22 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     return radix_output;
   }
 
+  /*
+  The build and probe jobs of a radix partition are scheduled on the same node, so that the hash table is placed on
+  (by the allocations of the build job) and probed from the same node. Partitions are distributed round robin across
+  the nodes of the scheduler.
+  */
+  NodeID _partition_node_id(const size_t partition_id) const {
+    if (!CurrentScheduler::is_set()) return CURRENT_NODE_ID;
+
+    const auto node_count = CurrentScheduler::get()->topology()->nodes().size();
+    return NodeID{static_cast<NodeID::base_type>(partition_id % node_count)};
+  }
+
   /*
   Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left
   */
-  void _build(const RadixContainer<LeftType>& radix_container,
+  void _build(const RadixContainer<MaterializedType<LeftType>>& radix_container,
               std::vector<std::shared_ptr<HashTable<HashedType>>>& hashtables) {
     std::vector<std::shared_ptr<AbstractTask>> jobs;
     jobs.reserve(radix_container.partition_offsets.size() - 1);
@@ -381,7 +436,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     for (size_t current_partition_id = 0; current_partition_id < (radix_container.partition_offsets.size() - 1);
          ++current_partition_id) {
       jobs.emplace_back(std::make_shared<JobTask>([&, current_partition_id]() {
-        auto& partition_left = static_cast<Partition<LeftType>&>(*radix_container.elements);
+        auto& partition_left = static_cast<Partition<MaterializedType<LeftType>>&>(*radix_container.elements);
         const auto& partition_left_begin = radix_container.partition_offsets[current_partition_id];
         const auto& partition_left_end = radix_container.partition_offsets[current_partition_id + 1];
         const auto partition_size = partition_left_end - partition_left_begin;
@@ -397,11 +452,11 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
              ++partition_offset) {
           auto& element = partition_left[partition_offset];
 
-          hashtable->put(type_cast<HashedType>(element.value), element.row_id);
+          hashtable->put(_to_hashed_type(element.value), element.row_id);
         }
 
         hashtables[current_partition_id] = hashtable;
-      }));
+      }, _partition_node_id(current_partition_id)));
       jobs.back()->schedule();
     }
 
@@ -413,7 +468,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   with the values in the hash table. Since Left and Right are hashed using the same hash function, we can reduce the
   number of hash tables that need to be looked into to just 1.
   */
-  void _probe(const RadixContainer<RightType>& radix_container,
+  void _probe(const RadixContainer<MaterializedType<RightType>>& radix_container,
               const std::vector<std::shared_ptr<HashTable<HashedType>>>& hashtables,
               std::vector<PosList>& pos_list_left, std::vector<PosList>& pos_list_right) {
     std::vector<std::shared_ptr<AbstractTask>> jobs;
@@ -422,16 +477,15 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     /*
     NUMA notes:
     At this point both input relations are partitioned using radix partitioning.
-    Probing will be done per partition for both sides.
-    Therefore, inputs for one partition should be located on the same NUMA node,
-    and the job that probes that partition should also be on that NUMA node.
+    Probing is done per partition for both sides. The job that probes a partition is scheduled on the node
+    that built its hash table (see _partition_node_id()).
     */
 
     for (size_t current_partition_id = 0; current_partition_id < (radix_container.partition_offsets.size() - 1);
          ++current_partition_id) {
       jobs.emplace_back(std::make_shared<JobTask>([&, current_partition_id]() {
         // Get information from work queue
-        auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
+        auto& partition = static_cast<Partition<MaterializedType<RightType>>&>(*radix_container.elements);
         const auto& partition_begin = radix_container.partition_offsets[current_partition_id];
         const auto& partition_end = radix_container.partition_offsets[current_partition_id + 1];
 
@@ -492,14 +546,14 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
           pos_list_left[current_partition_id] = std::move(pos_list_left_local);
           pos_list_right[current_partition_id] = std::move(pos_list_right_local);
         }
-      }));
+      }, _partition_node_id(current_partition_id)));
       jobs.back()->schedule();
     }
 
     CurrentScheduler::wait_for_tasks(jobs);
   }
 
-  void _probe_semi_anti(const RadixContainer<RightType>& radix_container,
+  void _probe_semi_anti(const RadixContainer<MaterializedType<RightType>>& radix_container,
                         const std::vector<std::shared_ptr<HashTable<HashedType>>>& hashtables,
                         std::vector<PosList>& pos_lists) {
     std::vector<std::shared_ptr<AbstractTask>> jobs;
@@ -509,7 +563,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
          ++current_partition_id) {
       jobs.emplace_back(std::make_shared<JobTask>([&, current_partition_id]() {
         // Get information from work queue
-        auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
+        auto& partition = static_cast<Partition<MaterializedType<RightType>>&>(*radix_container.elements);
         const auto& partition_begin = radix_container.partition_offsets[current_partition_id];
         const auto& partition_end = radix_container.partition_offsets[current_partition_id + 1];
 
@@ -549,7 +603,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         if (!pos_list_local.empty()) {
           pos_lists[current_partition_id] = std::move(pos_list_local);
         }
-      }));
+      }, _partition_node_id(current_partition_id)));
       jobs.back()->schedule();
     }
 
@@ -598,16 +652,22 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     left_chunk_offsets->resize(left_chunk_count);
     right_chunk_offsets->resize(right_chunk_count);
 
+    // The chunks are materialized and partitioned on the node their memory is placed on
+    auto left_chunk_node_ids = std::vector<NodeID>(left_chunk_count);
+    auto right_chunk_node_ids = std::vector<NodeID>(right_chunk_count);
+
     size_t offset_left = 0;
     for (ChunkID i{0}; i < left_chunk_count; ++i) {
       left_chunk_offsets->operator[](i) = offset_left;
       offset_left += _left_in_table->get_chunk(i)->size();
+      left_chunk_node_ids[i] = _left_in_table->get_chunk(i)->node_id();
     }
 
     size_t offset_right = 0;
     for (ChunkID i{0}; i < right_chunk_count; ++i) {
       right_chunk_offsets->operator[](i) = offset_right;
       offset_right += _right_in_table->get_chunk(i)->size();
+      right_chunk_node_ids[i] = _right_in_table->get_chunk(i)->node_id();
     }
 
     Timer performance_timer;
@@ -618,8 +678,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     /*
     NUMA notes:
     The materialized vectors don't have any strong NUMA preference because they haven't been partitioned yet.
-    However, it would be a good idea to keep each materialized vector on one node if possible.
-    This helps choosing a scheduler node for the radix phase (see below).
+    Each chunk is materialized by a job on the node the chunk is placed on (see Chunk::node_id()).
     */
     // Scheduler note: parallelize this at some point. Currently, the amount of jobs would be too high
     auto materialized_left = _materialize_input<LeftType>(_left_in_table, _column_ids.first, histograms_left);
@@ -630,18 +689,18 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     // Radix Partitioning phase
     /*
     NUMA notes:
-    If the input vectors (the materialized vectors) reside on a specific node, the partitioning worker for
-    this phase should be scheduled on the same node.
+    The range of the materialized vectors that belongs to a chunk is partitioned on the node that materialized it.
     Additionally, the output vectors in this phase are partitioned by a radix key. Therefore it would be good
     to pin the outputs from both sides on the same node for each radix partition. For example, if there are
     only two radix partitions A and B, the partitions leftA and rightA should be on the same node, and the
     partitions leftB and leftB should also be on the same node.
     */
     // Scheduler note: parallelize this at some point. Currently, the amount of jobs would be too high
-    auto radix_left = _partition_radix_parallel<LeftType>(materialized_left, left_chunk_offsets, histograms_left);
+    auto radix_left = _partition_radix_parallel(materialized_left, left_chunk_offsets, left_chunk_node_ids,
+                                                histograms_left);
     // 'keep_nulls' makes sure that the relation on the right keeps NULL values when executing an OUTER join.
-    auto radix_right =
-        _partition_radix_parallel<RightType>(materialized_right, right_chunk_offsets, histograms_right, keep_nulls);
+    auto radix_right = _partition_radix_parallel(materialized_right, right_chunk_offsets, right_chunk_node_ids,
+                                                 histograms_right, keep_nulls);
 
     // Build phase
     std::vector<std::shared_ptr<HashTable<HashedType>>> hashtables;
@@ -649,6 +708,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     /*
     NUMA notes:
     The hashtables for each partition P should also reside on the same node as the two vectors leftP and rightP.
+    The build job of P is scheduled on the node that probes P later.
     */
     _build(radix_left, hashtables);
 
@@ -660,7 +720,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     /*
     NUMA notes:
     The workers for each radix partition P should be scheduled on the same node as the input data:
-    leftP, rightP and hashtableP.
+    leftP, rightP and hashtableP. Currently, only the hashtables are placed by partition.
     */
     if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
       _probe_semi_anti(radix_right, hashtables, right_pos_lists);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+#include <string_view>
 #include <type_traits>
 
 namespace opossum {
@@ -33,9 +35,16 @@ struct JoinHashTraits<L, R, std::enable_if_t<(std::is_integral_v<L> && std::is_f
   static constexpr bool needs_lexical_cast = false;
 };
 
-// Joining with strings will use strings for hashing and a lexical cast if necessary
+// Joining two string columns will hash views of the strings in the columns, so that they are not copied
 template <typename L, typename R>
-struct JoinHashTraits<L, R, std::enable_if_t<std::is_same_v<R, std::string> || std::is_same_v<L, std::string>>> {
+struct JoinHashTraits<L, R, std::enable_if_t<std::is_same_v<R, std::string> && std::is_same_v<L, std::string>>> {
+  using HashType = std::string_view;
+  static constexpr bool needs_lexical_cast = false;
+};
+
+// Joining a string column with a numerical column will use strings for hashing and a lexical cast
+template <typename L, typename R>
+struct JoinHashTraits<L, R, std::enable_if_t<std::is_same_v<R, std::string> != std::is_same_v<L, std::string>>> {
   using HashType = std::string;
   static constexpr bool needs_lexical_cast = true;
 };
@@ -62,7 +62,7 @@ class ColumnMaterializer {
 
  private:
   /**
-   * Creates a job to materialize and sort a chunk.
+   * Creates a job to materialize and sort a chunk on the node the chunk is placed on.
    **/
   std::shared_ptr<JobTask> _create_chunk_materialization_job(std::unique_ptr<MaterializedColumnList<T>>& output,
                                                              std::unique_ptr<PosList>& null_rows_output,
@@ -73,7 +73,7 @@ class ColumnMaterializer {
       resolve_column_type<T>(*column, [&](auto& typed_column) {
         (*output)[chunk_id] = _materialize_column(typed_column, chunk_id, null_rows_output);
       });
-    });
+    }, input->get_chunk(chunk_id)->node_id());
   }
 
   /**
@@ -1,6 +1,7 @@
 #include "limit.hpp"
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -27,38 +28,84 @@ size_t Limit::num_rows() const { return _num_rows; }
 std::shared_ptr<const Table> Limit::_on_execute() {
   const auto input_table = input_table_left();
 
+  // Find the chunks that the output consists of
+  auto chunk_count = ChunkID{0};
+  auto row_count = size_t{0};
+  while (chunk_count < input_table->chunk_count() && row_count < _num_rows) {
+    row_count += input_table->get_chunk(chunk_count)->size();
+    ++chunk_count;
+  }
+
+  // If no chunk has to be cut, the output shares the chunks of the input and has the same type. Data chunks are only
+  // shared if no rows can be appended to them anymore, i.e., if they are encoded or full. Otherwise, rows inserted
+  // after the Limit was executed would appear in its output.
+  const auto chunks_are_complete = [&]() {
+    if (input_table->type() == TableType::References) return true;
+
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      if (chunk->is_mutable() && chunk->size() < input_table->max_chunk_size()) return false;
+    }
+    return true;
+  };
+
+  if (row_count <= _num_rows && chunks_are_complete()) {
+    auto output_table = std::make_shared<Table>(input_table->column_definitions(), input_table->type(),
+                                                input_table->max_chunk_size(), input_table->has_mvcc());
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      // While we don't modify the chunk, we need to get a non-const pointer so that we can put it into the table
+      output_table->append_chunk(std::const_pointer_cast<Chunk>(input_table->get_chunk(chunk_id)));
+    }
+    return output_table;
+  }
+
   auto output_table = std::make_shared<Table>(input_table->column_definitions(), TableType::References);
 
-  ChunkID chunk_id{0};
-  for (size_t i = 0; i < _num_rows && chunk_id < input_table->chunk_count(); chunk_id++) {
+  auto remaining_row_count = _num_rows;
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
     const auto input_chunk = input_table->get_chunk(chunk_id);
-    ChunkColumns output_columns;
+    // The size is only read once, so that rows appended concurrently are not referenced
+    const auto output_chunk_row_count = std::min<size_t>(input_chunk->size(), remaining_row_count);
+    remaining_row_count -= output_chunk_row_count;
+
+    // Complete chunks of a reference table can be used as they are
+    if (output_chunk_row_count == input_chunk->size() && input_table->type() == TableType::References) {
+      output_table->append_chunk(std::const_pointer_cast<Chunk>(input_chunk));
+      continue;
+    }
 
-    size_t output_chunk_row_count = std::min<size_t>(input_chunk->size(), _num_rows - i);
+    // Columns that share a position list in the input share it in the output as well. nullptr stands for the
+    // positions in a data chunk.
+    auto output_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
 
+    ChunkColumns output_columns;
     for (ColumnID column_id{0}; column_id < input_table->column_count(); column_id++) {
       const auto input_base_column = input_chunk->get_column(column_id);
-      auto output_pos_list = std::make_shared<PosList>(output_chunk_row_count);
-      std::shared_ptr<const Table> referenced_table;
-      ColumnID output_column_id = column_id;
-
-      if (auto input_ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(input_base_column)) {
-        output_column_id = input_ref_column->referenced_column_id();
-        referenced_table = input_ref_column->referenced_table();
-        // TODO(all): optimize using whole chunk whenever possible
-        auto begin = input_ref_column->pos_list()->begin();
-        std::copy(begin, begin + output_chunk_row_count, output_pos_list->begin());
-      } else {
-        referenced_table = input_table;
-        for (ChunkOffset chunk_offset = 0; chunk_offset < output_chunk_row_count; chunk_offset++) {
-          (*output_pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+      const auto input_ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(input_base_column);
+
+      const auto input_pos_list = input_ref_column ? input_ref_column->pos_list() : nullptr;
+      auto& output_pos_list = output_pos_lists[input_pos_list];
+
+      if (!output_pos_list) {
+        output_pos_list = std::make_shared<PosList>(output_chunk_row_count);
+        if (input_pos_list) {
+          std::copy(input_pos_list->begin(), input_pos_list->begin() + output_chunk_row_count,
+                    output_pos_list->begin());
+        } else {
+          for (ChunkOffset chunk_offset = 0; chunk_offset < output_chunk_row_count; chunk_offset++) {
+            (*output_pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+          }
         }
       }
 
-      output_columns.push_back(std::make_shared<ReferenceColumn>(referenced_table, output_column_id, output_pos_list));
+      if (input_ref_column) {
+        output_columns.push_back(std::make_shared<ReferenceColumn>(
+            input_ref_column->referenced_table(), input_ref_column->referenced_column_id(), output_pos_list));
+      } else {
+        output_columns.push_back(std::make_shared<ReferenceColumn>(input_table, column_id, output_pos_list));
+      }
     }
 
-    i += output_chunk_row_count;
     output_table->append_chunk(output_columns);
   }
 
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "constant_mappings.hpp"
+#include "logical_type.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/base_column.hpp"
 #include "type_cast.hpp"
@@ -51,7 +52,10 @@ std::shared_ptr<const Table> Print::_on_execute() {
   }
   _out << "|" << std::endl;
   for (ColumnID col{0}; col < input_table_left()->column_count(); ++col) {
-    const auto data_type = data_type_to_string.left.at(input_table_left()->column_data_type(col));
+    const auto& logical_type = input_table_left()->column_logical_type(col);
+    const auto data_type = logical_type.kind != LogicalType::Kind::None
+                               ? logical_type.name()
+                               : data_type_to_string.left.at(input_table_left()->column_data_type(col));
     _out << "|" << std::setw(widths[col]) << data_type << std::setw(0);
   }
   if (_flags & PrintMvcc) {
@@ -73,14 +77,19 @@ std::shared_ptr<const Table> Print::_on_execute() {
       continue;
     }
 
+    auto cells = std::vector<std::vector<std::string>>{};
+    cells.reserve(chunk->column_count());
+    for (ColumnID col{0}; col < chunk->column_count(); ++col) {
+      cells.emplace_back(format_column_values(*chunk->get_column(col), input_table_left()->column_data_type(col),
+                                              input_table_left()->column_logical_type(col)));
+    }
+
     // print the rows in the chunk
     for (size_t row = 0; row < chunk->size(); ++row) {
       _out << "|";
       for (ColumnID col{0}; col < chunk->column_count(); ++col) {
-        // well yes, we use BaseColumn::operator[] here, but since Print is not an operation that should
-        // be part of a regular query plan, let's keep things simple here
         auto col_width = widths[col];
-        auto cell = _truncate_cell((*chunk->get_column(col))[row], col_width);
+        auto cell = _truncate_cell(cells[col][row], col_width);
         _out << std::setw(col_width) << cell << "|" << std::setw(0);
       }
 
@@ -122,8 +131,10 @@ std::vector<uint16_t> Print::_column_string_widths(uint16_t min, uint16_t max, s
     auto chunk = input_table_left()->get_chunk(chunk_id);
 
     for (ColumnID col{0}; col < chunk->column_count(); ++col) {
-      for (size_t row = 0; row < chunk->size(); ++row) {
-        auto cell_length = static_cast<uint16_t>(to_string((*chunk->get_column(col))[row]).size());
+      const auto cells = format_column_values(*chunk->get_column(col), t->column_data_type(col),
+                                              t->column_logical_type(col));
+      for (const auto& cell : cells) {
+        auto cell_length = static_cast<uint16_t>(cell.size());
         widths[col] = std::max({min, widths[col], std::min(max, cell_length)});
       }
     }
@@ -131,8 +142,7 @@ std::vector<uint16_t> Print::_column_string_widths(uint16_t min, uint16_t max, s
   return widths;
 }
 
-std::string Print::_truncate_cell(const AllTypeVariant& cell, uint16_t max_width) const {
-  auto cell_str = type_cast<std::string>(cell);
+std::string Print::_truncate_cell(const std::string& cell_str, uint16_t max_width) const {
   DebugAssert(max_width > 3, "Cannot truncate string with '...' at end with max_width <= 3");
   if (cell_str.length() > max_width) {
     return cell_str.substr(0, max_width - 3) + "...";
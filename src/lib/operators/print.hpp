@@ -24,7 +24,7 @@ class Print : public AbstractReadOnlyOperator {
 
  protected:
   std::vector<uint16_t> _column_string_widths(uint16_t min, uint16_t max, std::shared_ptr<const Table> t) const;
-  std::string _truncate_cell(const AllTypeVariant& cell, uint16_t max_width) const;
+  std::string _truncate_cell(const std::string& cell_str, uint16_t max_width) const;
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_recreate(
       const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
@@ -1,6 +1,7 @@
 #include "projection.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <memory>
 #include <numeric>
@@ -9,6 +10,7 @@
 #include <vector>
 
 #include "constant_mappings.hpp"
+#include "logical_type.hpp"
 #include "operators/pqp_expression.hpp"
 #include "resolve_type.hpp"
 
@@ -18,10 +20,223 @@
 #include "storage/create_iterable_from_column.hpp"
 #include "storage/materialize.hpp"
 #include "storage/reference_column.hpp"
+#include "type_cast.hpp"
 #include "utils/arithmetic_operator_expression.hpp"
 
 namespace opossum {
 
+namespace {
+
+// The decimal places that Double literals are rounded to in arithmetic on DECIMALs
+constexpr auto MAX_LITERAL_SCALE = uint8_t{6};
+
+// The minimum number of decimal places of quotients of DECIMALs
+constexpr auto MIN_QUOTIENT_SCALE = uint8_t{6};
+
+bool is_decimal_column(const PQPExpression& expression, const Table& table) {
+  return expression.type() == ExpressionType::Column &&
+         table.column_logical_type(expression.column_id()).kind == LogicalType::Kind::Decimal;
+}
+
+// Whether an arithmetic expression has a DECIMAL operand, see evaluate_decimal_expression()
+bool is_decimal_arithmetic(const PQPExpression& expression, const Table& table) {
+  if (!expression.is_arithmetic_operator()) return false;
+
+  const auto is_decimal = [&](const auto& operand) {
+    return is_decimal_column(*operand, table) || is_decimal_arithmetic(*operand, table);
+  };
+  return is_decimal(expression.left_child()) || is_decimal(expression.right_child());
+}
+
+// A literal in arithmetic on DECIMALs as stored value and scale, e.g., 0.25 as {25, 2}
+std::pair<int64_t, uint8_t> decimal_literal(const AllTypeVariant& value) {
+  switch (data_type_from_all_type_variant(value)) {
+    case DataType::Null:
+      return {0, 0};
+    case DataType::Int:
+    case DataType::Long:
+      return {type_cast<int64_t>(value), 0};
+    case DataType::Float:
+    case DataType::Double: {
+      const auto double_value = type_cast<double>(value);
+      for (auto scale = uint8_t{0}; scale < MAX_LITERAL_SCALE; ++scale) {
+        const auto scaled = double_value * static_cast<double>(decimal_factor(scale));
+        if (std::abs(scaled - std::round(scaled)) <= 1e-9 * std::max(1.0, std::abs(scaled))) {
+          return {std::llround(scaled), scale};
+        }
+      }
+      return {std::llround(double_value * static_cast<double>(decimal_factor(MAX_LITERAL_SCALE))), MAX_LITERAL_SCALE};
+    }
+    default:
+      Fail("Only numbers can be combined with DECIMALs");
+  }
+}
+
+/**
+ * The scale of the values of an operand of arithmetic on DECIMALs. Sums and differences have the larger scale of their
+ * operands, products the sum of the scales, and quotients at least MIN_QUOTIENT_SCALE decimal places.
+ */
+uint8_t decimal_scale(const PQPExpression& expression, const Table& table) {
+  if (expression.type() == ExpressionType::Literal) return decimal_literal(expression.value()).second;
+
+  if (expression.type() == ExpressionType::Column) {
+    const auto column_id = expression.column_id();
+    if (is_decimal_column(expression, table)) return table.column_logical_type(column_id).scale;
+
+    const auto data_type = table.column_data_type(column_id);
+    Assert((data_type == DataType::Int || data_type == DataType::Long) &&
+               table.column_logical_type(column_id).kind == LogicalType::Kind::None,
+           "Only DECIMALs and integers can be combined with DECIMALs");
+    return 0;
+  }
+
+  Assert(expression.is_arithmetic_operator(), "Arithmetic on DECIMALs only supports literals and columns as operands");
+
+  const auto left_scale = decimal_scale(*expression.left_child(), table);
+  const auto right_scale = decimal_scale(*expression.right_child(), table);
+
+  switch (expression.type()) {
+    case ExpressionType::Addition:
+    case ExpressionType::Subtraction:
+    case ExpressionType::Modulo:
+      return std::max(left_scale, right_scale);
+    case ExpressionType::Multiplication: {
+      const auto scale = left_scale + right_scale;
+      Assert(scale <= LogicalType::MAX_DECIMAL_PRECISION, "Product of DECIMALs has too many decimal places");
+      return static_cast<uint8_t>(scale);
+    }
+    case ExpressionType::Division:
+      return std::max({left_scale, right_scale, MIN_QUOTIENT_SCALE});
+    default:
+      Fail("Operator not supported for DECIMALs");
+  }
+}
+
+// Rescales a stored DECIMAL to a scale that is not smaller
+int64_t rescale_decimal(const int64_t value, const uint8_t scale, const uint8_t new_scale) {
+  auto result = int64_t{0};
+  const auto overflow = __builtin_mul_overflow(value, decimal_factor(static_cast<uint8_t>(new_scale - scale)), &result);
+  Assert(!overflow, "DECIMAL overflow");
+  return result;
+}
+
+/**
+ * Evaluates arithmetic on DECIMALs on their stored integers, so that the result is exact (except for quotients, which
+ * are rounded to their scale). The results are stored values of the scale decimal_scale() returns, NULLs are
+ * {true, 0}.
+ */
+std::vector<std::pair<bool, int64_t>> evaluate_decimal_expression(const PQPExpression& expression, const Table& table,
+                                                                  const ChunkID chunk_id) {
+  const auto chunk = table.get_chunk(chunk_id);
+  auto values = std::vector<std::pair<bool, int64_t>>(chunk->size());
+
+  if (expression.type() == ExpressionType::Literal) {
+    const auto& value = expression.value();
+    std::fill(values.begin(), values.end(), std::make_pair(variant_is_null(value), decimal_literal(value).first));
+    return values;
+  }
+
+  if (expression.type() == ExpressionType::Column) {
+    // decimal_scale() ensures that the column stores integers
+    resolve_data_type(table.column_data_type(expression.column_id()), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      if constexpr (std::is_integral_v<ColumnDataType>) {
+        auto column_values = std::vector<std::pair<bool, ColumnDataType>>{};
+        column_values.reserve(chunk->size());
+        materialize_values_and_nulls(*chunk->get_column(expression.column_id()), column_values);
+        std::transform(column_values.begin(), column_values.end(), values.begin(), [](const auto& value) {
+          return std::make_pair(value.first, static_cast<int64_t>(value.second));
+        });
+      }
+    });
+    return values;
+  }
+
+  const auto scale = decimal_scale(expression, table);
+  const auto left_scale = decimal_scale(*expression.left_child(), table);
+  const auto right_scale = decimal_scale(*expression.right_child(), table);
+  const auto left_values = evaluate_decimal_expression(*expression.left_child(), table, chunk_id);
+  const auto right_values = evaluate_decimal_expression(*expression.right_child(), table, chunk_id);
+
+  for (auto chunk_offset = size_t{0}; chunk_offset < values.size(); ++chunk_offset) {
+    const auto& [left_is_null, left] = left_values[chunk_offset];
+    const auto& [right_is_null, right] = right_values[chunk_offset];
+    if (left_is_null || right_is_null) {
+      values[chunk_offset] = {true, 0};
+      continue;
+    }
+
+    auto result = int64_t{0};
+    auto overflow = false;
+    switch (expression.type()) {
+      case ExpressionType::Addition:
+        overflow = __builtin_add_overflow(rescale_decimal(left, left_scale, scale),
+                                          rescale_decimal(right, right_scale, scale), &result);
+        break;
+      case ExpressionType::Subtraction:
+        overflow = __builtin_sub_overflow(rescale_decimal(left, left_scale, scale),
+                                          rescale_decimal(right, right_scale, scale), &result);
+        break;
+      case ExpressionType::Multiplication:
+        overflow = __builtin_mul_overflow(left, right, &result);
+        break;
+      case ExpressionType::Division: {
+        Assert(right != 0, "Division by zero");
+        // left / 10^left_scale / (right / 10^right_scale) * 10^scale
+        const auto quotient = static_cast<long double>(left) / static_cast<long double>(right) *
+                              std::pow(10.0L, scale + right_scale - left_scale);
+        result = std::llround(quotient);
+        break;
+      }
+      case ExpressionType::Modulo:
+        Assert(right != 0, "Division by zero");
+        result = rescale_decimal(left, left_scale, scale) % rescale_decimal(right, right_scale, scale);
+        break;
+      default:
+        Fail("Operator not supported for DECIMALs");
+    }
+    Assert(!overflow, "DECIMAL overflow");
+
+    values[chunk_offset] = {false, result};
+  }
+
+  return values;
+}
+
+std::shared_ptr<BaseColumn> create_decimal_column(const PQPExpression& expression, const Table& table,
+                                                  const ChunkID chunk_id) {
+  const auto values_and_nulls = evaluate_decimal_expression(expression, table, chunk_id);
+
+  auto values = pmr_concurrent_vector<int64_t>{};
+  values.reserve(values_and_nulls.size());
+  auto null_values = pmr_concurrent_vector<bool>{};
+  null_values.reserve(values_and_nulls.size());
+
+  for (const auto& [is_null, value] : values_and_nulls) {
+    values.push_back(value);
+    null_values.push_back(is_null);
+  }
+
+  return std::make_shared<ValueColumn<int64_t>>(std::move(values), std::move(null_values));
+}
+
+// DATE plus or minus a number of days is a DATE
+bool is_date_arithmetic(const PQPExpression& expression, const Table& table) {
+  if (expression.type() != ExpressionType::Addition && expression.type() != ExpressionType::Subtraction) return false;
+
+  const auto is_date = [&](const auto& operand) {
+    return (operand->type() == ExpressionType::Column &&
+            table.column_logical_type(operand->column_id()).kind == LogicalType::Kind::Date) ||
+           is_date_arithmetic(*operand, table);
+  };
+
+  const auto left_is_date = is_date(expression.left_child());
+  const auto right_is_date = is_date(expression.right_child());
+  return expression.type() == ExpressionType::Addition ? left_is_date != right_is_date : left_is_date && !right_is_date;
+}
+
+}  // namespace
+
 Projection::Projection(const std::shared_ptr<const AbstractOperator> in, const ColumnExpressions& column_expressions)
     : AbstractReadOnlyOperator(OperatorType::Projection, in), _column_expressions(column_expressions) {}
 
@@ -171,13 +386,26 @@ std::shared_ptr<const Table> Projection::_on_execute() {
       reuse_columns_from_input = false;
     }
 
-    const auto type = _get_type_of_expression(column_expression, input_table_left());
-    if (type == DataType::Null) {
-      // in case of a NULL literal, simply add a nullable int column
-      column_definition.data_type = DataType::Int;
-      column_definition.nullable = true;
+    if (is_decimal_arithmetic(*column_expression, *input_table_left())) {
+      column_definition.logical_type = LogicalType::decimal(LogicalType::MAX_DECIMAL_PRECISION,
+                                                            decimal_scale(*column_expression, *input_table_left()));
+      column_definition.data_type = column_definition.logical_type.data_type();
     } else {
-      column_definition.data_type = type;
+      const auto type = _get_type_of_expression(column_expression, input_table_left());
+      if (type == DataType::Null) {
+        // in case of a NULL literal, simply add a nullable int column
+        column_definition.data_type = DataType::Int;
+        column_definition.nullable = true;
+      } else {
+        column_definition.data_type = type;
+      }
+    }
+
+    // Forwarded columns keep their logical type, e.g., DATE
+    if (column_expression->type() == ExpressionType::Column) {
+      column_definition.logical_type = input_table_left()->column_logical_type(column_expression->column_id());
+    } else if (is_date_arithmetic(*column_expression, *input_table_left())) {
+      column_definition.logical_type = LogicalType::date();
     }
 
     column_definitions.emplace_back(column_definition);
@@ -193,6 +421,13 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     ChunkColumns output_columns;
 
     for (uint16_t expression_index = 0u; expression_index < _column_expressions.size(); ++expression_index) {
+      const auto& column_expression = _column_expressions[expression_index];
+      if (column_expression->is_arithmetic_operator() &&
+          output_table->column_logical_type(ColumnID{expression_index}).kind == LogicalType::Kind::Decimal) {
+        output_columns.push_back(create_decimal_column(*column_expression, *input_table_left(), chunk_id));
+        continue;
+      }
+
       resolve_data_type(output_table->column_data_type(ColumnID{expression_index}), [&](auto type) {
         const auto column = _create_column(type, chunk_id, _column_expressions[expression_index], input_table_left(),
                                            reuse_columns_from_input);
@@ -0,0 +1,250 @@
+#include "rebuild_chunks.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "delete.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/column_iterables/chunk_offset_mapping.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/value_column.hpp"
+#include "storage/value_deltas.hpp"
+#include "table_wrapper.hpp"
+#include "validate.hpp"
+
+namespace opossum {
+
+RebuildChunks::RebuildChunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                             const ColumnEncodingSpec& column_encoding_spec)
+    : AbstractReadWriteOperator(OperatorType::RebuildChunks),
+      _table_name{table_name},
+      _chunk_ids{chunk_ids},
+      _column_encoding_spec{column_encoding_spec} {}
+
+const std::string RebuildChunks::name() const { return "RebuildChunks"; }
+
+const std::vector<ChunkID>& RebuildChunks::new_chunk_ids() const { return _new_chunk_ids; }
+
+std::shared_ptr<const Table> RebuildChunks::_on_execute(std::shared_ptr<TransactionContext> context) {
+  DebugAssert(context != nullptr, "RebuildChunks needs a transaction context");
+
+  context->register_read_write_operator(std::static_pointer_cast<AbstractReadWriteOperator>(shared_from_this()));
+
+  _table = StorageManager::get().get_table(_table_name);
+  _transaction_id = context->transaction_id();
+
+  Assert(_table->has_mvcc() == UseMvcc::Yes, "RebuildChunks requires a table with MVCC columns");
+
+  // 1. Determine the rows visible to the transaction and invalidate them
+  auto all_rows = std::make_shared<PosList>();
+  for (const auto chunk_id : _chunk_ids) {
+    Assert(chunk_id < _table->chunk_count(), "Chunk with given ID does not exist.");
+
+    const auto chunk_size = _table->get_chunk(chunk_id)->size();
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      all_rows->emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  auto all_rows_table = std::make_shared<Table>(_table->column_definitions(), TableType::References);
+  ChunkColumns all_rows_columns;
+  for (ColumnID column_id{0}; column_id < _table->column_count(); ++column_id) {
+    all_rows_columns.push_back(std::make_shared<ReferenceColumn>(_table, column_id, all_rows));
+  }
+  all_rows_table->append_chunk(all_rows_columns);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(all_rows_table);
+  table_wrapper->execute();
+
+  auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  const auto visible_rows = validate->get_output();
+  if (visible_rows->empty()) return nullptr;
+
+  _delete = std::make_shared<Delete>(_table_name, validate);
+  _delete->set_transaction_context(context);
+  _delete->execute();
+
+  if (_delete->execute_failed()) {
+    _mark_as_failed();
+    return nullptr;
+  }
+
+  // 2. Copy the rows into new chunks. Values updated in place (see ValueDeltas) are taken from their visible versions.
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->reserve(visible_rows->row_count());
+  for (ChunkID chunk_id{0}; chunk_id < visible_rows->chunk_count(); ++chunk_id) {
+    const auto column = std::static_pointer_cast<const ReferenceColumn>(
+        visible_rows->get_chunk(chunk_id)->get_column(ColumnID{0}));
+    pos_list->insert(pos_list->end(), column->pos_list()->cbegin(), column->pos_list()->cend());
+  }
+
+  const auto table_with_visible_values =
+      create_table_with_visible_values(_table, _transaction_id, context->snapshot_commit_id());
+  const auto new_chunks = _copy_rows(table_with_visible_values, pos_list);
+  _moved_row_count = pos_list->size();
+
+  // 3. Append the new chunks. Their rows stay invisible to other transactions until the commit.
+  {
+    auto scoped_lock = _table->acquire_append_mutex();
+    for (const auto& new_chunk : new_chunks) {
+      _new_chunk_ids.emplace_back(_table->chunk_count());
+      _table->append_chunk(new_chunk);
+    }
+  }
+
+  return nullptr;
+}
+
+std::vector<std::shared_ptr<Chunk>> RebuildChunks::_copy_rows(const std::shared_ptr<const Table>& table,
+                                                              const std::shared_ptr<const PosList>& pos_list) const {
+  const auto row_count = pos_list->size();
+  const auto max_chunk_size = static_cast<size_t>(table->max_chunk_size());
+  const auto chunk_count = (row_count + max_chunk_size - 1) / max_chunk_size;
+
+  const auto chunk_size = [&](const size_t chunk_index) {
+    return std::min(max_chunk_size, row_count - chunk_index * max_chunk_size);
+  };
+
+  const auto chunk_offsets_by_chunk_id = split_pos_list_by_chunk_id(*pos_list);
+
+  auto columns_by_chunk = std::vector<ChunkColumns>(chunk_count, ChunkColumns(table->column_count()));
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(table->column_count());
+
+  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id]() {
+      resolve_data_type(table->column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        const auto is_nullable = table->column_is_nullable(column_id);
+
+        auto values = std::vector<pmr_concurrent_vector<ColumnDataType>>(chunk_count);
+        auto null_values = std::vector<pmr_concurrent_vector<bool>>(is_nullable ? chunk_count : 0u);
+        for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+          values[chunk_index].resize(chunk_size(chunk_index));
+          if (is_nullable) null_values[chunk_index].resize(chunk_size(chunk_index), false);
+        }
+
+        for (const auto& [chunk_id, chunk_offsets] : chunk_offsets_by_chunk_id) {
+          const auto column = table->get_chunk(chunk_id)->get_column(column_id);
+
+          resolve_column_type<ColumnDataType>(*column, [&](const auto& typed_column) {
+            using ColumnType = std::decay_t<decltype(typed_column)>;
+
+            if constexpr (std::is_same_v<ColumnType, ReferenceColumn>) {
+              Fail("Stored tables cannot contain ReferenceColumns");
+            } else {
+              create_iterable_from_column<ColumnDataType>(typed_column).for_each(&chunk_offsets, [&](const auto& value) {
+                // chunk_offset() is the position of the row in pos_list
+                const auto chunk_index = value.chunk_offset() / max_chunk_size;
+                const auto chunk_offset = value.chunk_offset() % max_chunk_size;
+
+                if (value.is_null()) {
+                  null_values[chunk_index][chunk_offset] = true;
+                } else {
+                  values[chunk_index][chunk_offset] = value.value();
+                }
+              });
+            }
+          });
+        }
+
+        for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+          if (is_nullable) {
+            columns_by_chunk[chunk_index][column_id] = std::make_shared<ValueColumn<ColumnDataType>>(
+                std::move(values[chunk_index]), std::move(null_values[chunk_index]));
+          } else {
+            columns_by_chunk[chunk_index][column_id] =
+                std::make_shared<ValueColumn<ColumnDataType>>(std::move(values[chunk_index]));
+          }
+        }
+      });
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+
+  jobs.clear();
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_index]() {
+      // Locked by this transaction and not yet committed, as if they were inserted
+      auto mvcc_columns = std::make_shared<MvccColumns>(chunk_size(chunk_index));
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size(chunk_index); ++chunk_offset) {
+        mvcc_columns->tids[chunk_offset] = _transaction_id;
+        mvcc_columns->begin_cids[chunk_offset] = MvccColumns::MAX_COMMIT_ID;
+      }
+
+      auto chunk = std::make_shared<Chunk>(columns_by_chunk[chunk_index], mvcc_columns);
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types(), _column_encoding_spec);
+      chunks[chunk_index] = chunk;
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  return chunks;
+}
+
+void RebuildChunks::_on_commit_records(const CommitID cid) {
+  for (const auto chunk_id : _new_chunk_ids) {
+    auto mvcc_columns = _table->get_chunk(chunk_id)->mvcc_columns();
+    for (ChunkOffset chunk_offset{0}; chunk_offset < mvcc_columns->size(); ++chunk_offset) {
+      mvcc_columns->begin_cids[chunk_offset] = cid;
+      mvcc_columns->tids[chunk_offset] = 0u;
+    }
+    mvcc_columns->update_last_commit_id(cid);
+  }
+
+  if (!_new_chunk_ids.empty()) _table->update_last_commit_id(cid);
+}
+
+void RebuildChunks::_finish_commit() {
+  // The Delete reduced the row count of the statistics, but the rows were only moved
+  const auto table_statistics = _table->table_statistics();
+  if (table_statistics) {
+    _table->set_table_statistics(std::make_shared<TableStatistics>(table_statistics->table_type(),
+                                                                   table_statistics->row_count() + _moved_row_count,
+                                                                   table_statistics->column_statistics()));
+  }
+}
+
+void RebuildChunks::_on_rollback_records() {
+  // As in Insert, the rows are made invisible for everyone. The end is written before the begin.
+  for (const auto chunk_id : _new_chunk_ids) {
+    auto mvcc_columns = _table->get_chunk(chunk_id)->mvcc_columns();
+    for (ChunkOffset chunk_offset{0}; chunk_offset < mvcc_columns->size(); ++chunk_offset) {
+      mvcc_columns->end_cids[chunk_offset] = 0u;
+      std::atomic_thread_fence(std::memory_order_release);
+      mvcc_columns->begin_cids[chunk_offset] = 0u;
+      mvcc_columns->tids[chunk_offset] = 0u;
+    }
+  }
+}
+
+std::shared_ptr<AbstractOperator> RebuildChunks::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<RebuildChunks>(_table_name, _chunk_ids, _column_encoding_spec);
+}
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_write_operator.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class Delete;
+
+/**
+ * Operator that moves the rows of a number of chunks of a stored table into new, encoded chunks (see DeltaMergeTask).
+ * Rows that are not visible anymore are dropped, so that the new chunks are dense and have new dictionaries.
+ *
+ * The rows of the chunks that are visible to the transaction are locked and invalidated by a Delete. They are copied
+ * column by column into new chunks of the maximum chunk size of the table, one job per column, which are then encoded
+ * in parallel, one job per chunk, and appended to the table. The chunks are built before they are appended, so that
+ * readers never see them in an intermediate state. The rows in the new chunks become visible with the commit of the
+ * transaction, in which the old rows become invisible. Thus, every transaction sees each row exactly once, and readers
+ * are never blocked.
+ *
+ * The old chunks stay in the table, as chunks cannot be removed from tables. Since all of their rows are invisible to
+ * transactions that start after the commit, Validate filters them out. Once no transaction sees their rows anymore,
+ * the DeltaMergeTask frees the memory of their values.
+ *
+ * Fails if a row is locked by another transaction, like Delete.
+ */
+class RebuildChunks : public AbstractReadWriteOperator {
+ public:
+  RebuildChunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                const ColumnEncodingSpec& column_encoding_spec = {});
+
+  const std::string name() const override;
+
+  // The ChunkIDs of the chunks appended to the table, available after execution
+  const std::vector<ChunkID>& new_chunk_ids() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+  void _on_commit_records(const CommitID cid) override;
+  void _finish_commit() override;
+  void _on_rollback_records() override;
+
+ private:
+  // Copies the given rows of table into new chunks of ValueColumns, which are encoded afterwards
+  std::vector<std::shared_ptr<Chunk>> _copy_rows(const std::shared_ptr<const Table>& table,
+                                                 const std::shared_ptr<const PosList>& pos_list) const;
+
+  const std::string _table_name;
+  const std::vector<ChunkID> _chunk_ids;
+  const ColumnEncodingSpec _column_encoding_spec;
+
+  std::shared_ptr<Table> _table;
+  TransactionID _transaction_id{0};
+  std::shared_ptr<Delete> _delete;
+  std::vector<ChunkID> _new_chunk_ids;
+  size_t _moved_row_count{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,175 @@
+#include "set_operation_hash.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "set_operation_hash/materialized_rows.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Equal rows have equal hashes and thus end up in the same partition, so that each partition can be counted and probed
+// by its own JobTask
+constexpr auto PARTITION_COUNT = size_t{64};
+
+// The rows of each chunk, by partition, in their original order
+using PartitionedRows = std::vector<std::array<std::vector<size_t>, PARTITION_COUNT>>;
+
+PartitionedRows partition_rows(const Table& table, const MaterializedRows& rows) {
+  auto partitioned_rows = PartitionedRows(table.chunk_count());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(table.chunk_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_begin = rows.chunk_begin(chunk_id);
+      const auto chunk_end = chunk_begin + table.get_chunk(chunk_id)->size();
+      for (auto row = chunk_begin; row < chunk_end; ++row) {
+        partitioned_rows[chunk_id][rows.hash(row) % PARTITION_COUNT].emplace_back(row);
+      }
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  return partitioned_rows;
+}
+
+}  // namespace
+
+SetOperationHash::SetOperationHash(const std::shared_ptr<const AbstractOperator>& left,
+                                   const std::shared_ptr<const AbstractOperator>& right,
+                                   const SetOperationType set_operation_type, const SetOperationMode mode)
+    : AbstractReadOnlyOperator(OperatorType::SetOperationHash, left, right),
+      _set_operation_type(set_operation_type),
+      _mode(mode) {}
+
+const std::string SetOperationHash::name() const { return "SetOperationHash"; }
+
+const std::string SetOperationHash::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+  return name() + separator + "(" + set_operation_type_to_string.at(_set_operation_type) + " " +
+         set_operation_mode_to_string.at(_mode) + ")";
+}
+
+SetOperationType SetOperationHash::set_operation_type() const { return _set_operation_type; }
+
+SetOperationMode SetOperationHash::mode() const { return _mode; }
+
+std::shared_ptr<AbstractOperator> SetOperationHash::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<SetOperationHash>(recreated_input_left, recreated_input_right, _set_operation_type, _mode);
+}
+
+std::shared_ptr<const Table> SetOperationHash::_on_execute() {
+  const auto left_table = input_table_left();
+  const auto right_table = input_table_right();
+
+  Assert(left_table->column_count() == right_table->column_count(), "Inputs need to have the same number of columns");
+  for (ColumnID column_id{0}; column_id < left_table->column_count(); ++column_id) {
+    Assert(left_table->column_data_type(column_id) == right_table->column_data_type(column_id),
+           "Inputs need to have the same column data types");
+  }
+
+  const auto left_rows = MaterializedRows{left_table};
+  const auto right_rows = MaterializedRows{right_table};
+  const auto left_partitions = partition_rows(*left_table, left_rows);
+  const auto right_partitions = partition_rows(*right_table, right_rows);
+
+  // Whether each row of the left input is part of the output. One byte per row, so that the partitions can set them
+  // concurrently.
+  auto emitted_rows = std::vector<uint8_t>(left_rows.row_count());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(PARTITION_COUNT);
+
+  for (auto partition_id = size_t{0}; partition_id < PARTITION_COUNT; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto right_row_count = size_t{0};
+      for (const auto& chunk_partitions : right_partitions) right_row_count += chunk_partitions[partition_id].size();
+
+      // The number of occurrences of each right row that have not been matched by a left row yet
+      auto remaining_row_counts =
+          std::unordered_map<MaterializedRow, size_t, MaterializedRowHash, MaterializedRowEqual>(right_row_count);
+      for (const auto& chunk_partitions : right_partitions) {
+        for (const auto row : chunk_partitions[partition_id]) {
+          ++remaining_row_counts[MaterializedRow{&right_rows, row}];
+        }
+      }
+
+      // The left rows are probed in their original order, so that the first occurrences of a row are emitted
+      for (const auto& chunk_partitions : left_partitions) {
+        for (const auto row : chunk_partitions[partition_id]) {
+          const auto left_row = MaterializedRow{&left_rows, row};
+
+          auto emit = false;
+          if (_set_operation_type == SetOperationType::Intersect) {
+            const auto iter = remaining_row_counts.find(left_row);
+            if (iter != remaining_row_counts.end() && iter->second > 0) {
+              emit = true;
+              // For Distinct, the row must not be emitted again
+              iter->second = _mode == SetOperationMode::All ? iter->second - 1 : 0;
+            }
+          } else {
+            const auto [iter, inserted] = remaining_row_counts.try_emplace(left_row, 0);
+            if (iter->second > 0) {
+              --iter->second;
+            } else {
+              // For Distinct, the row (inserted with count 0 if it did not occur on the right) must not be emitted
+              // again
+              emit = _mode == SetOperationMode::All || inserted;
+            }
+          }
+
+          if (emit) emitted_rows[row] = 1;
+        }
+      }
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // The columns of the output chunk of each left chunk, empty if none of its rows is emitted
+  auto output_chunk_columns = std::vector<ChunkColumns>(left_table->chunk_count());
+
+  jobs.clear();
+  jobs.reserve(left_table->chunk_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < left_table->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_size = left_table->get_chunk(chunk_id)->size();
+      const auto chunk_begin = left_rows.chunk_begin(chunk_id);
+
+      auto matched_chunk_offsets = std::vector<ChunkOffset>{};
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (emitted_rows[chunk_begin + chunk_offset]) matched_chunk_offsets.emplace_back(chunk_offset);
+      }
+
+      if (matched_chunk_offsets.empty()) return;
+      output_chunk_columns[chunk_id] = create_reference_columns(left_table, chunk_id, matched_chunk_offsets);
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto output = std::make_shared<Table>(left_table->column_definitions(), TableType::References);
+  for (const auto& chunk_columns : output_chunk_columns) {
+    if (!chunk_columns.empty()) output->append_chunk(chunk_columns);
+  }
+
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Computes INTERSECT [ALL] and EXCEPT [ALL] of two inputs with the same column data types:
+ *  - Intersect/Distinct: each distinct row of the left input that also occurs in the right input, once
+ *  - Intersect/All:      each row of the left input min(m, n) times, where it occurs m times on the left and n times
+ *                        on the right
+ *  - Except/Distinct:    each distinct row of the left input that does not occur in the right input, once
+ *  - Except/All:         each row of the left input max(m - n, 0) times
+ *
+ * As in SQL, NULLs are considered equal to each other. The output references rows of the left input, in their original
+ * order.
+ *
+ * Both inputs are materialized chunk-parallel into typed columns and each row is hashed (see MaterializedRows). The
+ * rows are then partitioned by their hashes. For each partition, a JobTask counts the right rows in a hash map and
+ * probes the left rows against it. Finally, the output chunks are created chunk-parallel.
+ */
+class SetOperationHash : public AbstractReadOnlyOperator {
+ public:
+  SetOperationHash(const std::shared_ptr<const AbstractOperator>& left,
+                   const std::shared_ptr<const AbstractOperator>& right, const SetOperationType set_operation_type,
+                   const SetOperationMode mode);
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  SetOperationType set_operation_type() const;
+  SetOperationMode mode() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+
+ private:
+  const SetOperationType _set_operation_type;
+  const SetOperationMode _mode;
+};
+
+}  // namespace opossum
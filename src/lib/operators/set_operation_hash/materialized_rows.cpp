@@ -0,0 +1,170 @@
+#include "materialized_rows.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class BaseMaterializedRowColumn {
+ public:
+  virtual ~BaseMaterializedRowColumn() = default;
+
+  // Materializes the column of a chunk whose first row is begin and combines the hash of each value into hashes
+  virtual void materialize(const BaseColumn& column, const size_t begin, std::vector<size_t>& hashes) = 0;
+
+  virtual bool equals(const size_t row, const BaseMaterializedRowColumn& other, const size_t other_row) const = 0;
+};
+
+namespace {
+
+template <typename T>
+class MaterializedRowColumn final : public BaseMaterializedRowColumn {
+ public:
+  explicit MaterializedRowColumn(const size_t row_count) : _values(row_count), _nulls(row_count) {}
+
+  void materialize(const BaseColumn& column, const size_t begin, std::vector<size_t>& hashes) override {
+    resolve_column_type<T>(column, [&](const auto& typed_column) {
+      create_iterable_from_column<T>(typed_column).for_each([&](const auto& value) {
+        const auto row = begin + value.chunk_offset();
+
+        if (value.is_null()) {
+          _nulls[row] = true;
+          boost::hash_combine(hashes[row], 0);
+        } else {
+          _values[row] = value.value();
+          boost::hash_combine(hashes[row], value.value());
+        }
+      });
+    });
+  }
+
+  bool equals(const size_t row, const BaseMaterializedRowColumn& other, const size_t other_row) const override {
+    const auto& typed_other = static_cast<const MaterializedRowColumn<T>&>(other);
+
+    if (_nulls[row] || typed_other._nulls[other_row]) return _nulls[row] && typed_other._nulls[other_row];
+    return _values[row] == typed_other._values[other_row];
+  }
+
+ private:
+  std::vector<T> _values;
+
+  // Not std::vector<bool>, as the chunks are materialized concurrently
+  std::vector<uint8_t> _nulls;
+};
+
+}  // namespace
+
+MaterializedRows::MaterializedRows(const std::shared_ptr<const Table>& table) {
+  const auto chunk_count = table->chunk_count();
+
+  _chunk_begins.reserve(chunk_count);
+  auto row_count = size_t{0};
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    _chunk_begins.emplace_back(row_count);
+    row_count += table->get_chunk(chunk_id)->size();
+  }
+
+  _columns.reserve(table->column_count());
+  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+    resolve_data_type(table->column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _columns.emplace_back(std::make_unique<MaterializedRowColumn<ColumnDataType>>(row_count));
+    });
+  }
+
+  _hashes.resize(row_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = table->get_chunk(chunk_id);
+      for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+        _columns[column_id]->materialize(*chunk->get_column(column_id), _chunk_begins[chunk_id], _hashes);
+      }
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+}
+
+MaterializedRows::~MaterializedRows() = default;
+
+size_t MaterializedRows::row_count() const { return _hashes.size(); }
+
+size_t MaterializedRows::chunk_begin(const ChunkID chunk_id) const { return _chunk_begins[chunk_id]; }
+
+size_t MaterializedRows::hash(const size_t row) const { return _hashes[row]; }
+
+bool MaterializedRows::equals(const size_t row, const MaterializedRows& other, const size_t other_row) const {
+  DebugAssert(_columns.size() == other._columns.size(), "Rows need to have the same number of columns");
+
+  if (_hashes[row] != other._hashes[other_row]) return false;
+
+  for (auto column_id = size_t{0}; column_id < _columns.size(); ++column_id) {
+    if (!_columns[column_id]->equals(row, *other._columns[column_id], other_row)) return false;
+  }
+
+  return true;
+}
+
+ChunkColumns create_reference_columns(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
+                                      const std::vector<ChunkOffset>& chunk_offsets) {
+  auto output_columns = ChunkColumns{};
+
+  if (table->type() == TableType::Data) {
+    auto pos_list = std::make_shared<PosList>();
+    pos_list->reserve(chunk_offsets.size());
+    for (const auto chunk_offset : chunk_offsets) {
+      pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+    }
+
+    for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+      output_columns.push_back(std::make_shared<ReferenceColumn>(table, column_id, pos_list));
+    }
+
+    return output_columns;
+  }
+
+  const auto chunk = table->get_chunk(chunk_id);
+
+  // Input columns that share a position list get an output position list in common, see TableScan
+  auto output_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+    const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk->get_column(column_id));
+    DebugAssert(reference_column, "All columns of a reference table need to be ReferenceColumns");
+
+    const auto& input_pos_list = reference_column->pos_list();
+    auto& output_pos_list = output_pos_lists[input_pos_list];
+
+    if (!output_pos_list) {
+      output_pos_list = std::make_shared<PosList>();
+      output_pos_list->reserve(chunk_offsets.size());
+      for (const auto chunk_offset : chunk_offsets) {
+        output_pos_list->emplace_back((*input_pos_list)[chunk_offset]);
+      }
+    }
+
+    output_columns.push_back(std::make_shared<ReferenceColumn>(reference_column->referenced_table(),
+                                                               reference_column->referenced_column_id(),
+                                                               output_pos_list));
+  }
+
+  return output_columns;
+}
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseMaterializedRowColumn;
+class Table;
+
+/**
+ * The rows of a Table, materialized column by column with their original data types, together with a hash of each
+ * row. Used by the set operators (SetOperationHash, Difference) to hash and compare whole rows without going through
+ * AllTypeVariants. Two rows are equal if all of their values are equal, where NULL equals NULL (as in SQL's set
+ * operations).
+ *
+ * Rows are addressed by their position within the Table, i.e., the rows of chunk c are found at
+ * [chunk_begin(c), chunk_begin(c) + chunk size). The chunks are materialized and hashed in parallel.
+ */
+class MaterializedRows final {
+ public:
+  explicit MaterializedRows(const std::shared_ptr<const Table>& table);
+  ~MaterializedRows();
+
+  size_t row_count() const;
+  size_t chunk_begin(const ChunkID chunk_id) const;
+
+  size_t hash(const size_t row) const;
+
+  // other must have been materialized from a Table with the same column data types
+  bool equals(const size_t row, const MaterializedRows& other, const size_t other_row) const;
+
+ private:
+  std::vector<std::unique_ptr<BaseMaterializedRowColumn>> _columns;
+  std::vector<size_t> _chunk_begins;
+  std::vector<size_t> _hashes;
+};
+
+/**
+ * A row of MaterializedRows, usable as key in hash maps via MaterializedRowHash and MaterializedRowEqual. Keys from
+ * different MaterializedRows can be mixed as long as their Tables have the same column data types.
+ */
+struct MaterializedRow {
+  const MaterializedRows* rows;
+  size_t row;
+};
+
+struct MaterializedRowHash {
+  size_t operator()(const MaterializedRow& row) const { return row.rows->hash(row.row); }
+};
+
+struct MaterializedRowEqual {
+  bool operator()(const MaterializedRow& lhs, const MaterializedRow& rhs) const {
+    return lhs.rows->equals(lhs.row, *rhs.rows, rhs.row);
+  }
+};
+
+/**
+ * Creates the columns of an output chunk that contains the rows at chunk_offsets (in that order) of the given chunk of
+ * table. References to ReferenceColumns are resolved, and position lists are shared between the output columns
+ * wherever the input columns share them.
+ */
+ChunkColumns create_reference_columns(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
+                                      const std::vector<ChunkOffset>& chunk_offsets);
+
+}  // namespace opossum
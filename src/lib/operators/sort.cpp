@@ -3,6 +3,8 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -130,7 +132,10 @@ class Sort::SortImplMaterializeOutput {
 template <typename SortColumnType>
 class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
  public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
+  // Strings are sorted as views of the strings in the input table instead of copies (see _materialized_columns)
+  using SortValueType =
+      std::conditional_t<std::is_same_v<SortColumnType, std::string>, std::string_view, SortColumnType>;
+  using RowIDValuePair = std::pair<RowID, SortValueType>;
 
   SortImpl(const std::shared_ptr<const Table> table_in, const ColumnID column_id,
            const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0)
@@ -167,8 +172,8 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
 
     // 3. Materialization of the result: We take the sorted ValueRowID Vector, create chunks fill them until they are
     // full and create the next one. Each chunk is filled row by row.
-    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(_table_in, _row_id_value_vector,
-                                                                                       _output_chunk_size);
+    auto materialization = std::make_shared<SortImplMaterializeOutput<SortValueType>>(_table_in, _row_id_value_vector,
+                                                                                      _output_chunk_size);
     return materialization->execute();
   }
 
@@ -185,15 +190,31 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
       auto base_column = chunk->get_column(_column_id);
 
       resolve_column_type<SortColumnType>(*base_column, [&](auto& typed_column) {
-        auto iterable = create_iterable_from_column<SortColumnType>(typed_column);
-
-        iterable.for_each([&](const auto& value) {
+        const auto materialize_value = [&](const auto& value) {
           if (value.is_null()) {
-            null_value_rows.emplace_back(RowID{chunk_id, value.chunk_offset()}, SortColumnType{});
+            null_value_rows.emplace_back(RowID{chunk_id, value.chunk_offset()}, SortValueType{});
           } else {
             row_id_value_vector.emplace_back(RowID{chunk_id, value.chunk_offset()}, value.value());
           }
-        });
+        };
+
+        if constexpr (std::is_same_v<std::decay_t<decltype(typed_column)>, ReferenceColumn>) {
+          auto iterable = ReferenceColumnIterable<SortColumnType>{typed_column};
+          iterable.for_each(materialize_value);
+
+          if constexpr (std::is_same_v<SortValueType, std::string_view>) {
+            for (const auto& chunk_id_and_column : iterable.referenced_columns()) {
+              _materialized_columns.emplace_back(chunk_id_and_column.second);
+            }
+          }
+        } else {
+          auto iterable = create_iterable_from_column<SortColumnType>(typed_column);
+          iterable.for_each(materialize_value);
+
+          if constexpr (std::is_same_v<SortValueType, std::string_view>) {
+            _materialized_columns.emplace_back(base_column);
+          }
+        }
       });
     }
   }
@@ -202,7 +223,9 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
   void sort_with_operator() {
     Comparator comparator;
     std::stable_sort(_row_id_value_vector->begin(), _row_id_value_vector->end(),
-                     [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
+                     [comparator](const RowIDValuePair& a, const RowIDValuePair& b) {
+                       return comparator(a.second, b.second);
+                     });
   }
 
   const std::shared_ptr<const Table> _table_in;
@@ -215,6 +238,10 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
 
   std::shared_ptr<std::vector<RowIDValuePair>> _row_id_value_vector;
   std::shared_ptr<std::vector<RowIDValuePair>> _null_value_rows;
+
+  // Only the chunks own their columns and they may replace them while the sort is running (e.g., when they are
+  // compressed). The string_views point into these columns, so they are kept until the output has been written.
+  std::vector<std::shared_ptr<const BaseColumn>> _materialized_columns;
 };
 
 }  // namespace opossum
@@ -90,6 +90,9 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   for (ChunkID chunk_id{0u}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
     if (excluded_chunk_set.count(chunk_id)) continue;
 
+    // Scan the chunk on the node its memory is placed on
+    const auto node_id = _in_table->get_chunk(chunk_id)->node_id();
+
     auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
       const auto chunk_guard = _in_table->get_chunk_with_access_counting(chunk_id);
       // The actual scan happens in the sub classes of BaseTableScanImpl
@@ -150,12 +153,15 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
       std::lock_guard<std::mutex> lock(output_mutex);
       _output_table->append_chunk(out_columns, chunk_guard->get_allocator(), chunk_guard->access_counter());
-    });
+    }, node_id);
 
     jobs.push_back(job_task);
     job_task->schedule();
   }
 
+  _base_performance_data.chunks_scanned = jobs.size();
+  _base_performance_data.chunks_pruned = _in_table->chunk_count() - jobs.size();
+
   CurrentScheduler::wait_for_tasks(jobs);
 
   return _output_table;
@@ -9,6 +9,7 @@
 #include <regex>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -174,32 +175,32 @@ void LikeTableScanImpl::resolve_pattern_matcher(const AllPatternVariant& pattern
                                                 const Functor& functor) {
   if (pattern_variant.type() == typeid(StartsWithPattern)) {
     const auto& prefix = boost::get<StartsWithPattern>(pattern_variant).string;
-    functor([&](const std::string& string) -> bool {
+    functor([&](const std::string_view& string) -> bool {
       if (string.size() < prefix.size()) return invert_results;
       return (string.compare(0, prefix.size(), prefix) == 0) ^ invert_results;
     });
 
   } else if (pattern_variant.type() == typeid(EndsWithPattern)) {
     const auto& suffix = boost::get<EndsWithPattern>(pattern_variant).string;
-    functor([&](const std::string& string) -> bool {
+    functor([&](const std::string_view& string) -> bool {
       if (string.size() < suffix.size()) return invert_results;
       return (string.compare(string.size() - suffix.size(), suffix.size(), suffix) == 0) ^ invert_results;
     });
 
   } else if (pattern_variant.type() == typeid(ContainsPattern)) {
     const auto& contains_str = boost::get<ContainsPattern>(pattern_variant).string;
-    functor([&](const std::string& string) -> bool {
-      return (string.find(contains_str) != std::string::npos) ^ invert_results;
+    functor([&](const std::string_view& string) -> bool {
+      return (string.find(contains_str) != std::string_view::npos) ^ invert_results;
     });
 
   } else if (pattern_variant.type() == typeid(MultipleContainsPattern)) {
     const auto& contains_strs = boost::get<MultipleContainsPattern>(pattern_variant).strings;
 
-    functor([&](const std::string& string) -> bool {
+    functor([&](const std::string_view& string) -> bool {
       auto current_position = size_t{0};
       for (const auto& contains_str : contains_strs) {
         current_position = string.find(contains_str, current_position);
-        if (current_position == std::string::npos) return invert_results;
+        if (current_position == std::string_view::npos) return invert_results;
         current_position += contains_str.size();
       }
       return !invert_results;
@@ -208,7 +209,9 @@ void LikeTableScanImpl::resolve_pattern_matcher(const AllPatternVariant& pattern
   } else if (pattern_variant.type() == typeid(std::regex)) {
     const auto& regex = boost::get<std::regex>(pattern_variant);
 
-    functor([&](const std::string& string) -> bool { return std::regex_match(string, regex) ^ invert_results; });
+    functor([&](const std::string_view& string) -> bool {
+      return std::regex_match(string.cbegin(), string.cend(), regex) ^ invert_results;
+    });
 
   } else {
     Fail("Pattern not implemented. Probably a bug.");
@@ -89,7 +89,8 @@ class LikeTableScanImpl : public BaseSingleColumnTableScanImpl {
   static AllPatternVariant pattern_string_to_pattern_variant(const std::string& pattern);
 
   /**
-   * Call functor with the resolved Pattern
+   * Call functor with the resolved Pattern. The matcher takes a std::string_view, so that values can be matched without
+   * being copied.
    */
   template <typename Functor>
   static void resolve_pattern_matcher(const AllPatternVariant& pattern_variant, const bool invert_results,
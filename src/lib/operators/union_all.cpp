@@ -1,13 +1,71 @@
 #include "union_all.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
+
+namespace {
+
+/**
+ * Copies the rows a mutable chunk has now. Rows may still be appended to it, which must not show up in the output of
+ * the UnionAll (see Limit). The columns are resized one after the other when rows are inserted, so the smallest
+ * column determines how many rows are complete.
+ */
+std::shared_ptr<Chunk> copy_current_rows(const Chunk& chunk, const UseMvcc use_mvcc) {
+  auto row_count = chunk.size();
+  for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+    row_count = std::min(row_count, static_cast<uint32_t>(chunk.get_column(column_id)->size()));
+  }
+
+  auto columns = ChunkColumns{};
+  for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+    const auto column = chunk.get_column(column_id);
+
+    resolve_data_type(column->data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto& value_column = static_cast<const ValueColumn<ColumnDataType>&>(*column);
+      const auto& values = value_column.values();
+      auto copied_values = pmr_concurrent_vector<ColumnDataType>(row_count);
+      std::copy_n(values.cbegin(), row_count, copied_values.begin());
+
+      if (value_column.is_nullable()) {
+        const auto& null_values = value_column.null_values();
+        auto copied_null_values = pmr_concurrent_vector<bool>(row_count);
+        std::copy_n(null_values.cbegin(), row_count, copied_null_values.begin());
+        columns.emplace_back(
+            std::make_shared<ValueColumn<ColumnDataType>>(std::move(copied_values), std::move(copied_null_values)));
+      } else {
+        columns.emplace_back(std::make_shared<ValueColumn<ColumnDataType>>(std::move(copied_values)));
+      }
+    });
+  }
+
+  auto mvcc_columns = std::shared_ptr<MvccColumns>{};
+  if (use_mvcc == UseMvcc::Yes) {
+    const auto input_mvcc_columns = chunk.mvcc_columns();
+    mvcc_columns = std::make_shared<MvccColumns>(row_count);
+    for (ChunkOffset chunk_offset{0}; chunk_offset < row_count; ++chunk_offset) {
+      mvcc_columns->tids[chunk_offset] = input_mvcc_columns->tids[chunk_offset].load();
+      mvcc_columns->begin_cids[chunk_offset] = input_mvcc_columns->begin_cids[chunk_offset];
+      mvcc_columns->end_cids[chunk_offset] = input_mvcc_columns->end_cids[chunk_offset];
+    }
+  }
+
+  return std::make_shared<Chunk>(columns, mvcc_columns, chunk.get_allocator(), chunk.access_counter());
+}
+
+}  // namespace
+
 UnionAll::UnionAll(const std::shared_ptr<const AbstractOperator> left_in,
                    const std::shared_ptr<const AbstractOperator> right_in)
     : AbstractReadOnlyOperator(OperatorType::UnionAll, left_in, right_in) {
@@ -17,32 +75,44 @@ UnionAll::UnionAll(const std::shared_ptr<const AbstractOperator> left_in,
 const std::string UnionAll::name() const { return "UnionAll"; }
 
 std::shared_ptr<const Table> UnionAll::_on_execute() {
-  DebugAssert(input_table_left()->column_definitions() == input_table_right()->column_definitions(),
+  const auto left_table = input_table_left();
+  const auto right_table = input_table_right();
+
+  DebugAssert(left_table->column_definitions() == right_table->column_definitions(),
               "Input tables must have same number of columns");
-  DebugAssert(input_table_left()->type() == input_table_left()->type(), "Input tables must have the same type");
+  DebugAssert(left_table->type() == right_table->type(), "Input tables must have the same type");
+
+  // The output keeps MVCC information only if both inputs have it, so that it can be validated
+  const auto use_mvcc = left_table->has_mvcc() == UseMvcc::Yes && right_table->has_mvcc() == UseMvcc::Yes
+                            ? UseMvcc::Yes
+                            : UseMvcc::No;
+  const auto max_chunk_size = std::max(left_table->max_chunk_size(), right_table->max_chunk_size());
 
-  auto output = std::make_shared<Table>(input_table_left()->column_definitions(), input_table_left()->type());
+  auto output = std::make_shared<Table>(left_table->column_definitions(), left_table->type(), max_chunk_size, use_mvcc);
 
-  // add positions to output by iterating over both input tables
-  for (const auto& input : {input_table_left(), input_table_right()}) {
-    // iterating over all chunks of table input
-    for (ChunkID in_chunk_id{0}; in_chunk_id < input->chunk_count(); in_chunk_id++) {
-      // creating empty chunk to add columns with positions
-      ChunkColumns output_columns;
+  for (const auto& input : {left_table, right_table}) {
+    for (ChunkID chunk_id{0}; chunk_id < input->chunk_count(); ++chunk_id) {
+      // While we don't modify the chunk, we need to get a non-const pointer so that we can put it into the table
+      const auto chunk = std::const_pointer_cast<Chunk>(input->get_chunk(chunk_id));
 
-      // iterating over all columns of the current chunk
-      for (ColumnID column_id{0}; column_id < input->column_count(); ++column_id) {
-        // While we don't modify the column, we need to get a non-const pointer so that we can put it into the chunk
-        output_columns.push_back(input->get_chunk(in_chunk_id)->get_mutable_column(column_id));
+      // Data chunks that rows can still be appended to, i.e., that are neither encoded nor full, are copied
+      if (input->type() == TableType::Data && chunk->is_mutable() && chunk->size() < input->max_chunk_size()) {
+        output->append_chunk(copy_current_rows(*chunk, use_mvcc));
+        continue;
       }
 
-      // adding newly filled chunk to the output table
-      output->append_chunk(output_columns);
+      // The chunks of the inputs are shared with the output, unless their MVCC columns have to be dropped
+      if (input->has_mvcc() == use_mvcc) {
+        output->append_chunk(chunk);
+      } else {
+        output->append_chunk(chunk->columns(), chunk->get_allocator(), chunk->access_counter());
+      }
     }
   }
 
   return output;
 }
+
 std::shared_ptr<AbstractOperator> UnionAll::_on_recreate(
     const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
     const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
@@ -1,6 +1,9 @@
 #include "update.hpp"
 
+#include <algorithm>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -10,6 +13,7 @@
 #include "insert.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/value_deltas.hpp"
 #include "table_wrapper.hpp"
 #include "utils/assert.hpp"
 
@@ -31,6 +35,19 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
 
   const auto table_to_update = StorageManager::get().get_table(_table_to_update_name);
 
+  if (table_to_update->in_place_updates() && _can_update_in_place(table_to_update) &&
+      _try_start_writing_in_place(table_to_update)) {
+    _update_in_place(context, table_to_update);
+    _finish_writing_in_place();
+    return nullptr;
+  }
+
+  // The rows to update may reference a copy of table_to_update with the values visible to this transaction (see
+  // create_table_with_visible_values()). The unchanged values have to be taken from there.
+  const auto referenced_table = std::static_pointer_cast<const ReferenceColumn>(
+                                    input_table_left()->get_chunk(ChunkID{0})->get_column(ColumnID{0}))
+                                    ->referenced_table();
+
   // 1. Create insert_table with ReferenceColumns that contain all rows that should be updated
   TableColumnDefinitions insert_table_column_definitions;
   for (ColumnID column_id{0}; column_id < table_to_update->column_count(); ++column_id) {
@@ -63,7 +80,7 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
     // Add ReferenceColumns with built poslist.
     ChunkColumns insert_table_columns;
     for (ColumnID column_id{0}; column_id < table_to_update->column_count(); ++column_id) {
-      insert_table_columns.push_back(std::make_shared<ReferenceColumn>(table_to_update, column_id, pos_list));
+      insert_table_columns.push_back(std::make_shared<ReferenceColumn>(referenced_table, column_id, pos_list));
     }
 
     insert_table->append_chunk(insert_table_columns);
@@ -128,12 +145,182 @@ bool Update::_execution_input_valid(const std::shared_ptr<TransactionContext>& c
     if (!chunk->references_exactly_one_table()) return false;
 
     const auto first_column = std::static_pointer_cast<const ReferenceColumn>(chunk->get_column(ColumnID{0}));
-    if (table_to_update != first_column->referenced_table()) return false;
+    const auto referenced_table = first_column->referenced_table();
+    if (table_to_update != referenced_table && table_to_update != referenced_table->origin_table()) return false;
   }
 
   return true;
 }
 
+bool Update::_can_update_in_place(const std::shared_ptr<const Table>& table_to_update) const {
+  if (table_to_update->has_mvcc() == UseMvcc::No) return false;
+
+  const auto left_chunk = input_table_left()->get_chunk(ChunkID{0});
+
+  std::vector<ColumnID> updated_column_ids;
+  for (ColumnID column_id{0}; column_id < input_table_left()->column_count(); ++column_id) {
+    const auto left_column = std::static_pointer_cast<const ReferenceColumn>(left_chunk->get_column(column_id));
+    const auto updated_column_id = left_column->referenced_column_id();
+
+    // Strings are not fixed-width, updating them in place would not save anything
+    if (table_to_update->column_data_type(updated_column_id) == DataType::String) return false;
+
+    updated_column_ids.emplace_back(updated_column_id);
+  }
+
+  // Indexes are not aware of the versions
+  for (const auto& index_info : table_to_update->get_indexes()) {
+    for (const auto indexed_column_id : index_info.column_ids) {
+      if (std::find(updated_column_ids.cbegin(), updated_column_ids.cend(), indexed_column_id) !=
+          updated_column_ids.cend()) {
+        return false;
+      }
+    }
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
+    const auto pos_list = std::static_pointer_cast<const ReferenceColumn>(
+                              input_table_left()->get_chunk(chunk_id)->get_column(ColumnID{0}))
+                              ->pos_list();
+
+    for (const auto& row_id : *pos_list) {
+      const auto chunk = table_to_update->get_chunk(row_id.chunk_id);
+      if (chunk->size() != table_to_update->max_chunk_size() || !chunk->is_mutable()) return false;
+    }
+  }
+
+  return true;
+}
+
+bool Update::_try_start_writing_in_place(const std::shared_ptr<Table>& table_to_update) {
+  auto chunk_ids = std::set<ChunkID>{};
+  for (ChunkID chunk_id{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
+    const auto pos_list = std::static_pointer_cast<const ReferenceColumn>(
+                              input_table_left()->get_chunk(chunk_id)->get_column(ColumnID{0}))
+                              ->pos_list();
+    for (const auto& row_id : *pos_list) chunk_ids.emplace(row_id.chunk_id);
+  }
+
+  _table = table_to_update;
+  for (const auto chunk_id : chunk_ids) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    if (!chunk->value_deltas()->try_start_writing()) {
+      _finish_writing_in_place();
+      return false;
+    }
+    _writing_chunk_ids.emplace_back(chunk_id);
+
+    // The chunk may have been compressed since _can_update_in_place() checked it. Once a writer is registered, it
+    // cannot be anymore (see ValueDeltas::try_freeze()).
+    if (!chunk->is_mutable()) {
+      _finish_writing_in_place();
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void Update::_finish_writing_in_place() {
+  for (const auto chunk_id : _writing_chunk_ids) {
+    _table->get_chunk(chunk_id)->value_deltas()->finish_writing();
+  }
+  _writing_chunk_ids.clear();
+}
+
+void Update::_update_in_place(const std::shared_ptr<TransactionContext>& context,
+                              const std::shared_ptr<Table>& table_to_update) {
+  context->register_read_write_operator(std::static_pointer_cast<AbstractReadWriteOperator>(shared_from_this()));
+
+  _table = table_to_update;
+  _transaction_id = context->transaction_id();
+
+  const auto left_chunk = input_table_left()->get_chunk(ChunkID{0});
+  std::vector<ColumnID> updated_column_ids;
+  for (ColumnID column_id{0}; column_id < input_table_left()->column_count(); ++column_id) {
+    updated_column_ids.emplace_back(
+        std::static_pointer_cast<const ReferenceColumn>(left_chunk->get_column(column_id))->referenced_column_id());
+  }
+
+  // Pair the rows to update with their new values, grouped by the chunk they belong to. As in the Delete and Insert
+  // path, the i-th row of the left input is updated with the i-th row of the right input.
+  std::map<ChunkID, std::vector<std::pair<ChunkOffset, RowID>>> rows_by_chunk;
+  auto right_chunk_id = ChunkID{0};
+  auto right_chunk_offset = ChunkOffset{0};
+  for (ChunkID left_chunk_id{0}; left_chunk_id < input_table_left()->chunk_count(); ++left_chunk_id) {
+    const auto pos_list = std::static_pointer_cast<const ReferenceColumn>(
+                              input_table_left()->get_chunk(left_chunk_id)->get_column(ColumnID{0}))
+                              ->pos_list();
+
+    for (const auto& row_id : *pos_list) {
+      while (right_chunk_offset == input_table_right()->get_chunk(right_chunk_id)->size()) {
+        ++right_chunk_id;
+        right_chunk_offset = 0;
+      }
+
+      rows_by_chunk[row_id.chunk_id].emplace_back(row_id.chunk_offset, RowID{right_chunk_id, right_chunk_offset});
+      ++right_chunk_offset;
+    }
+  }
+
+  const auto snapshot_commit_id = context->snapshot_commit_id();
+
+  for (const auto& [chunk_id, rows] : rows_by_chunk) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    const auto value_deltas = chunk->value_deltas();
+    auto mvcc_columns = chunk->mvcc_columns();
+    auto& tids = mvcc_columns->tids;
+
+    // Registered before any version is added, so that a rollback removes all of them
+    _updated_chunk_ids.emplace_back(chunk_id);
+
+    for (const auto& [chunk_offset, right_row_id] : rows) {
+      // The row is only locked while its versions are added, so that concurrent writers of the row either fail to
+      // lock it or see the versions afterwards
+      auto expected = TransactionID{0};
+      if (!tids[chunk_offset].compare_exchange_strong(expected, _transaction_id)) {
+        _mark_as_failed();
+        return;
+      }
+
+      const auto row_is_writable = value_deltas->row_is_writable(chunk_offset, _transaction_id, snapshot_commit_id);
+
+      if (row_is_writable) {
+        const auto right_chunk = input_table_right()->get_chunk(right_row_id.chunk_id);
+        for (ColumnID column_id{0}; column_id < right_chunk->column_count(); ++column_id) {
+          const auto value = (*right_chunk->get_column(column_id))[right_row_id.chunk_offset];
+          const auto updated_column_id = updated_column_ids[column_id];
+          Assert(!variant_is_null(value) || _table->column_is_nullable(updated_column_id),
+                 "Cannot update NOT NULL column to NULL");
+
+          value_deltas->add(updated_column_id, chunk_offset, value, _transaction_id);
+        }
+      }
+
+      tids[chunk_offset] = 0u;
+
+      if (!row_is_writable) {
+        _mark_as_failed();
+        return;
+      }
+    }
+  }
+}
+
+void Update::_on_commit_records(const CommitID cid) {
+  for (const auto chunk_id : _updated_chunk_ids) {
+    _table->get_chunk(chunk_id)->value_deltas()->commit(_transaction_id, cid);
+  }
+
+  _table->update_last_commit_id(cid);
+}
+
+void Update::_on_rollback_records() {
+  for (const auto chunk_id : _updated_chunk_ids) {
+    _table->get_chunk(chunk_id)->value_deltas()->rollback(_transaction_id);
+  }
+}
+
 std::shared_ptr<AbstractOperator> Update::_on_recreate(
     const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
     const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
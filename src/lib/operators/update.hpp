@@ -20,6 +20,16 @@ class Insert;
  * The second input table must have the exact same column layout and number of rows as the first table and contains the
  * data that is used to update the rows specified by the first table.
  *
+ * The old row versions are locked and invalidated by a Delete. The new row versions are written by an Insert whose
+ * input consists of the columns of the second table for the updated columns and of ReferenceColumns to the old row
+ * versions for all other columns. This way, only the updated columns are taken from the second table, while the
+ * unchanged values are copied column by column from the old row versions without materializing the rows in between.
+ *
+ * For tables with in-place updates (see Table::set_in_place_updates()), the new values of fixed-width columns are
+ * written as versions of the values instead (see ValueDeltas), so that the table does not grow and only the updated
+ * columns are touched. This is only done if all updated rows are in full, mutable chunks that are not being
+ * compressed and no index covers an updated column. Otherwise, Update falls back to Delete and Insert.
+ *
  * Assumption: The input has been validated before.
  *
  * Note: Update does not support null values at the moment
@@ -40,15 +50,29 @@ class Update : public AbstractReadWriteOperator {
       const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
   bool _execution_input_valid(const std::shared_ptr<TransactionContext>& context) const;
 
-  // Commit happens in Insert and Delete operators
-  void _on_commit_records(const CommitID cid) override {}
+  // Only called for in-place updates. Otherwise, commit and rollback happen in the Insert and Delete operators.
+  void _on_commit_records(const CommitID cid) override;
+  void _on_rollback_records() override;
+
+  bool _can_update_in_place(const std::shared_ptr<const Table>& table_to_update) const;
 
-  // Rollback happens in Insert and Delete operators
-  void _on_rollback_records() override {}
+  // Registers the operator as a writer of the ValueDeltas of all chunks to update (see
+  // ValueDeltas::try_start_writing()). Returns false, with no writer registered, if a chunk is or was being compressed.
+  bool _try_start_writing_in_place(const std::shared_ptr<Table>& table_to_update);
+  void _finish_writing_in_place();
+
+  void _update_in_place(const std::shared_ptr<TransactionContext>& context,
+                        const std::shared_ptr<Table>& table_to_update);
 
  protected:
   const std::string _table_to_update_name;
   std::shared_ptr<Delete> _delete;
   std::shared_ptr<Insert> _insert;
+
+  // Only set for in-place updates
+  std::shared_ptr<Table> _table;
+  TransactionID _transaction_id{0};
+  std::vector<ChunkID> _updated_chunk_ids;
+  std::vector<ChunkID> _writing_chunk_ids;
 };
 }  // namespace opossum
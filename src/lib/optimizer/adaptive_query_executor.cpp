@@ -0,0 +1,204 @@
+#include "adaptive_query_executor.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/logical_plan_root_node.hpp"
+#include "logical_query_plan/lqp_expression.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/materialized_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "optimizer/join_ordering/greedy_operator_ordering.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/join_graph_builder.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Whether the JoinGraphBuilder traverses past this node, i.e., the node is part of a join cluster
+bool is_join_graph_node(const std::shared_ptr<AbstractLQPNode>& node) {
+  switch (node->type()) {
+    case LQPNodeType::Join: {
+      const auto join_mode = std::static_pointer_cast<JoinNode>(node)->join_mode();
+      return join_mode == JoinMode::Inner || join_mode == JoinMode::Cross;
+    }
+    case LQPNodeType::Predicate:
+      return true;
+    case LQPNodeType::Union:
+      return std::static_pointer_cast<UnionNode>(node)->union_mode() == UnionMode::Positions;
+    default:
+      return false;
+  }
+}
+
+void collect_cluster_nodes(const std::shared_ptr<AbstractLQPNode>& node,
+                           const std::unordered_set<std::shared_ptr<AbstractLQPNode>>& vertices,
+                           std::unordered_set<std::shared_ptr<AbstractLQPNode>>& cluster_nodes) {
+  if (!node || vertices.count(node) || !cluster_nodes.emplace(node).second) return;
+
+  collect_cluster_nodes(node->left_input(), vertices, cluster_nodes);
+  collect_cluster_nodes(node->right_input(), vertices, cluster_nodes);
+}
+
+}  // namespace
+
+namespace opossum {
+
+AdaptiveQueryExecutor::AdaptiveQueryExecutor(const std::shared_ptr<LQPTranslator>& lqp_translator,
+                                             const float reoptimization_factor,
+                                             const std::shared_ptr<TransactionContext>& transaction_context)
+    : _lqp_translator(lqp_translator),
+      _reoptimization_factor(reoptimization_factor),
+      _transaction_context(transaction_context) {
+  Assert(_reoptimization_factor >= 1.0f, "Re-optimization factor must not be smaller than 1");
+}
+
+std::shared_ptr<AbstractOperator> AdaptiveQueryExecutor::execute(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  Assert(lqp->subplan_is_read_only(), "Only read-only LQPs can be executed adaptively");
+
+  // The root node makes it possible to replace the topmost node of the LQP
+  const auto root_node = LogicalPlanRootNode::make();
+  root_node->set_left_input(lqp);
+
+  while (const auto join_node = _find_lowest_join(root_node)) {
+    auto materialized_inputs = std::vector<std::shared_ptr<MaterializedNode>>{};
+
+    for (const auto& input : {join_node->left_input(), join_node->right_input()}) {
+      if (!input || input->type() == LQPNodeType::Materialized) continue;
+
+      const auto materialized_node = _materialize(input);
+      if (!materialized_node) return _lqp_translator->translate_node(input);
+      materialized_inputs.emplace_back(materialized_node);
+    }
+
+    // Both inputs were available already, so it's the join's turn
+    if (materialized_inputs.empty()) {
+      const auto materialized_node = _materialize(join_node);
+      if (!materialized_node) return _lqp_translator->translate_node(join_node);
+      materialized_inputs.emplace_back(materialized_node);
+    }
+
+    // A single re-optimization covers the whole join cluster, so stop after the first one
+    for (const auto& materialized_node : materialized_inputs) {
+      if (_needs_reoptimization(*materialized_node) && _reoptimize(materialized_node)) {
+        materialized_node->set_triggered_reoptimization(true);
+        ++_reoptimization_count;
+        break;
+      }
+    }
+  }
+
+  _executed_lqp = root_node->left_input();
+  root_node->set_left_input(nullptr);
+
+  const auto root_operator = _lqp_translator->translate_node(_executed_lqp);
+  if (!root_operator->get_output()) _execute(root_operator);
+
+  return root_operator;
+}
+
+const std::shared_ptr<AbstractLQPNode>& AdaptiveQueryExecutor::executed_lqp() const { return _executed_lqp; }
+
+size_t AdaptiveQueryExecutor::reoptimization_count() const { return _reoptimization_count; }
+
+std::shared_ptr<AbstractLQPNode> AdaptiveQueryExecutor::_find_lowest_join(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (!node) return nullptr;
+
+  if (const auto join_node = _find_lowest_join(node->left_input())) return join_node;
+  if (const auto join_node = _find_lowest_join(node->right_input())) return join_node;
+
+  return node->type() == LQPNodeType::Join ? node : nullptr;
+}
+
+std::shared_ptr<MaterializedNode> AdaptiveQueryExecutor::_materialize(const std::shared_ptr<AbstractLQPNode>& node) {
+  const auto op = _lqp_translator->translate_node(node);
+  _execute(op);
+
+  if (!op->get_output()) return nullptr;
+
+  const auto materialized_node = MaterializedNode::make(node, op);
+  op->set_lqp_node(materialized_node);
+
+  for (const auto& output_relation : node->output_relations()) {
+    output_relation.output->set_input(output_relation.input_side, materialized_node);
+  }
+
+  return materialized_node;
+}
+
+void AdaptiveQueryExecutor::_execute(const std::shared_ptr<AbstractOperator>& op) const {
+  if (_transaction_context) op->set_transaction_context_recursively(_transaction_context);
+  CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(op));
+}
+
+bool AdaptiveQueryExecutor::_needs_reoptimization(const MaterializedNode& materialized_node) const {
+  // q-error, smoothed so that empty results and estimates don't divide by zero
+  const auto estimated_row_count = materialized_node.estimated_row_count() + 1.0f;
+  const auto actual_row_count = materialized_node.actual_row_count() + 1.0f;
+
+  return std::max(estimated_row_count / actual_row_count, actual_row_count / estimated_row_count) >
+         _reoptimization_factor;
+}
+
+bool AdaptiveQueryExecutor::_reoptimize(const std::shared_ptr<AbstractLQPNode>& materialized_node) {
+  // Walk up to the topmost node of the join cluster that the materialized node is a vertex of
+  auto cluster_root = std::shared_ptr<AbstractLQPNode>{};
+  for (auto node = materialized_node; node->output_count() == 1;) {
+    node = node->outputs().front();
+    if (!is_join_graph_node(node)) break;
+    cluster_root = node;
+  }
+
+  if (!cluster_root) return false;
+
+  const auto join_graph = JoinGraphBuilder{}(cluster_root);  // NOLINT - doesn't like {} followed by ()
+
+  // With two vertices, there is no join order to choose
+  if (join_graph->vertices.size() < 3) return false;
+
+  const auto vertices =
+      std::unordered_set<std::shared_ptr<AbstractLQPNode>>(join_graph->vertices.begin(), join_graph->vertices.end());
+  auto cluster_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+  collect_cluster_nodes(cluster_root, vertices, cluster_nodes);
+
+  const auto column_references = cluster_root->output_column_references();
+
+  // Untie the cluster from its vertices and outputs
+  for (const auto& output_relation : join_graph->output_relations) {
+    output_relation.output->set_input(output_relation.input_side, nullptr);
+  }
+
+  for (const auto& vertex : join_graph->vertices) {
+    for (const auto& output : vertex->outputs()) {
+      if (cluster_nodes.count(output)) vertex->remove_output(output);
+    }
+  }
+
+  auto reoptimized_cluster = GreedyOperatorOrdering{}(join_graph);  // NOLINT - doesn't like {} followed by ()
+
+  // Restore the column order expected by the outputs of the cluster
+  if (reoptimized_cluster->output_column_references() != column_references) {
+    const auto projection_node = ProjectionNode::make(LQPExpression::create_columns(column_references));
+    projection_node->set_left_input(reoptimized_cluster);
+    reoptimized_cluster = projection_node;
+  }
+
+  for (const auto& output_relation : join_graph->output_relations) {
+    output_relation.output->set_input(output_relation.input_side, reoptimized_cluster);
+  }
+
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AbstractOperator;
+class LQPTranslator;
+class MaterializedNode;
+class TransactionContext;
+
+/**
+ * Executes an LQP step by step, re-optimizing the join order of the remaining plan whenever an intermediate result
+ * turns out to be much smaller or larger than estimated.
+ *
+ * Joins are the pipeline breakers we look at: the executor repeatedly picks the lowest JoinNode, executes its inputs
+ * (and, once they are available, the join itself) and replaces the executed subplans with MaterializedNodes that carry
+ * the actual cardinality. If estimated and actual cardinality differ by more than `reoptimization_factor` (in either
+ * direction), the join cluster above the result is reordered by the GreedyOperatorOrdering, which then works with the
+ * actual cardinalities. Once no joins are left, the remaining plan is executed as usual.
+ *
+ * The build side of hash joins does not need to be re-optimized, as the JoinHash already chooses the smaller input at
+ * runtime.
+ *
+ * The LQP is modified in the process. The decisions are recorded in the MaterializedNodes, which the
+ * SQLQueryPlanVisualizer picks up via AbstractOperator::lqp_node().
+ */
+class AdaptiveQueryExecutor final {
+ public:
+  AdaptiveQueryExecutor(const std::shared_ptr<LQPTranslator>& lqp_translator, const float reoptimization_factor,
+                        const std::shared_ptr<TransactionContext>& transaction_context = nullptr);
+
+  /**
+   * Executes @param lqp and returns the root of the executed PQP. The returned operator has no output if the
+   * transaction was aborted during execution.
+   */
+  std::shared_ptr<AbstractOperator> execute(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // The LQP as it was finally executed, i.e., with MaterializedNodes and re-optimized join clusters
+  const std::shared_ptr<AbstractLQPNode>& executed_lqp() const;
+
+  size_t reoptimization_count() const;
+
+ private:
+  // Returns a JoinNode without joins below it, or nullptr if no joins are left
+  std::shared_ptr<AbstractLQPNode> _find_lowest_join(const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  // Executes @param node and replaces it with a MaterializedNode. Returns nullptr if the transaction was aborted.
+  std::shared_ptr<MaterializedNode> _materialize(const std::shared_ptr<AbstractLQPNode>& node);
+
+  void _execute(const std::shared_ptr<AbstractOperator>& op) const;
+
+  bool _needs_reoptimization(const MaterializedNode& materialized_node) const;
+
+  // Reorders the joins of the cluster that @param materialized_node is a vertex of. Returns false if nothing was done.
+  bool _reoptimize(const std::shared_ptr<AbstractLQPNode>& materialized_node);
+
+  const std::shared_ptr<LQPTranslator> _lqp_translator;
+  const float _reoptimization_factor;
+  const std::shared_ptr<TransactionContext> _transaction_context;
+
+  std::shared_ptr<AbstractLQPNode> _executed_lqp;
+  size_t _reoptimization_count{0};
+};
+
+}  // namespace opossum
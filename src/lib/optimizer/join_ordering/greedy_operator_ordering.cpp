@@ -0,0 +1,185 @@
+#include "greedy_operator_ordering.hpp"
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "join_graph.hpp"
+#include "join_plan_predicate.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "statistics/table_statistics.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<AbstractLQPNode> GreedyOperatorOrdering::operator()(
+    const std::shared_ptr<const JoinGraph>& join_graph) {
+  Assert(!join_graph->vertices.empty(), "Cannot order a JoinGraph without vertices");
+
+  const auto vertex_count = join_graph->vertices.size();
+
+  // Start with one subplan per vertex, with the predicates that only access this vertex already applied
+  std::vector<Subplan> subplans;
+  subplans.reserve(vertex_count);
+  for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+    JoinVertexSet vertex_set{vertex_count};
+    vertex_set.set(vertex_idx);
+
+    const auto lqp = _add_predicates(join_graph->vertices[vertex_idx], join_graph->find_predicates(vertex_set));
+    subplans.emplace_back(Subplan{vertex_set, lqp});
+  }
+
+  while (subplans.size() > 1) {
+    std::optional<JoinCandidate> best_candidate;
+    auto best_candidate_is_connected = false;
+    auto best_row_count = 0.0f;
+    auto best_left_idx = size_t{0};
+    auto best_right_idx = size_t{0};
+
+    for (auto left_idx = size_t{0}; left_idx < subplans.size(); ++left_idx) {
+      for (auto right_idx = left_idx + 1; right_idx < subplans.size(); ++right_idx) {
+        const auto predicates =
+            join_graph->find_predicates(subplans[left_idx].vertex_set, subplans[right_idx].vertex_set);
+        const auto is_connected = !predicates.empty();
+
+        // Don't bother estimating cross joins once a predicated join was found
+        if (best_candidate && best_candidate_is_connected && !is_connected) continue;
+
+        const auto candidate = _join(subplans[left_idx].lqp, subplans[right_idx].lqp, predicates);
+        const auto row_count = candidate.lqp->get_statistics()->row_count();
+
+        const auto is_better = !best_candidate || (is_connected && !best_candidate_is_connected) ||
+                               (is_connected == best_candidate_is_connected && row_count < best_row_count);
+
+        if (!is_better) {
+          _untie(candidate.join_node);
+          continue;
+        }
+
+        if (best_candidate) _untie(best_candidate->join_node);
+
+        best_candidate = candidate;
+        best_candidate_is_connected = is_connected;
+        best_row_count = row_count;
+        best_left_idx = left_idx;
+        best_right_idx = right_idx;
+      }
+    }
+
+    DebugAssert(best_candidate, "Expected to find a join candidate");
+
+    subplans[best_left_idx] =
+        Subplan{subplans[best_left_idx].vertex_set | subplans[best_right_idx].vertex_set, best_candidate->lqp};
+    subplans.erase(subplans.begin() + best_right_idx);
+  }
+
+  return subplans.front().lqp;
+}
+
+GreedyOperatorOrdering::JoinCandidate GreedyOperatorOrdering::_join(
+    const std::shared_ptr<AbstractLQPNode>& left, const std::shared_ptr<AbstractLQPNode>& right,
+    std::vector<std::shared_ptr<const AbstractJoinPlanPredicate>> predicates) {
+  /**
+   * Look for an atomic predicate comparing a column of the left with a column of the right subplan to use as the join
+   * predicate, preferring equi joins as these can be executed as hash joins. All other predicates are placed above
+   * the join.
+   */
+  auto join_predicate_iter = predicates.end();
+  auto join_predicate_is_flipped = false;
+
+  for (auto iter = predicates.begin(); iter != predicates.end(); ++iter) {
+    if ((*iter)->type() != JoinPlanPredicateType::Atomic) continue;
+
+    const auto atomic_predicate = std::static_pointer_cast<const JoinPlanAtomicPredicate>(*iter);
+    if (!is_lqp_column_reference(atomic_predicate->right_operand)) continue;
+
+    const auto& left_operand = atomic_predicate->left_operand;
+    const auto& right_operand = boost::get<LQPColumnReference>(atomic_predicate->right_operand);
+
+    auto is_flipped = false;
+    if (left->find_output_column_id(left_operand) && right->find_output_column_id(right_operand)) {
+      is_flipped = false;
+    } else if (right->find_output_column_id(left_operand) && left->find_output_column_id(right_operand)) {
+      is_flipped = true;
+    } else {
+      continue;
+    }
+
+    const auto is_equi_join = atomic_predicate->predicate_condition == PredicateCondition::Equals;
+    if (join_predicate_iter == predicates.end() || is_equi_join) {
+      join_predicate_iter = iter;
+      join_predicate_is_flipped = is_flipped;
+      if (is_equi_join) break;
+    }
+  }
+
+  std::shared_ptr<JoinNode> join_node;
+  if (join_predicate_iter != predicates.end()) {
+    const auto join_predicate = std::static_pointer_cast<const JoinPlanAtomicPredicate>(*join_predicate_iter);
+    predicates.erase(join_predicate_iter);
+
+    // Instead of flipping the PredicateCondition, the subplan containing the left operand becomes the left input
+    join_node = JoinNode::make(JoinMode::Inner,
+                               LQPColumnReferencePair{join_predicate->left_operand,
+                                                      boost::get<LQPColumnReference>(join_predicate->right_operand)},
+                               join_predicate->predicate_condition);
+    join_node->set_left_input(join_predicate_is_flipped ? right : left);
+    join_node->set_right_input(join_predicate_is_flipped ? left : right);
+  } else {
+    join_node = JoinNode::make(JoinMode::Cross);
+    join_node->set_left_input(left);
+    join_node->set_right_input(right);
+  }
+
+  return {_add_predicates(join_node, predicates), join_node};
+}
+
+void GreedyOperatorOrdering::_untie(const std::shared_ptr<JoinNode>& join_node) {
+  // Removes a discarded candidate from the outputs of the subplans it joins
+  join_node->set_left_input(nullptr);
+  join_node->set_right_input(nullptr);
+}
+
+std::shared_ptr<AbstractLQPNode> GreedyOperatorOrdering::_add_predicates(
+    const std::shared_ptr<AbstractLQPNode>& lqp,
+    const std::vector<std::shared_ptr<const AbstractJoinPlanPredicate>>& predicates) {
+  auto current_node = lqp;
+  for (const auto& predicate : predicates) {
+    current_node = _add_predicate(current_node, predicate);
+  }
+  return current_node;
+}
+
+std::shared_ptr<AbstractLQPNode> GreedyOperatorOrdering::_add_predicate(
+    const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<const AbstractJoinPlanPredicate>& predicate) {
+  if (predicate->type() == JoinPlanPredicateType::Atomic) {
+    const auto atomic_predicate = std::static_pointer_cast<const JoinPlanAtomicPredicate>(predicate);
+
+    const auto predicate_node = PredicateNode::make(
+        atomic_predicate->left_operand, atomic_predicate->predicate_condition, atomic_predicate->right_operand);
+    predicate_node->set_left_input(lqp);
+    return predicate_node;
+  }
+
+  const auto logical_predicate = std::static_pointer_cast<const JoinPlanLogicalPredicate>(predicate);
+
+  switch (logical_predicate->logical_operator) {
+    case JoinPlanPredicateLogicalOperator::And:
+      return _add_predicate(_add_predicate(lqp, logical_predicate->left_operand), logical_predicate->right_operand);
+
+    case JoinPlanPredicateLogicalOperator::Or: {
+      // Disjunctions are evaluated by scanning the same input for both operands and merging the resulting positions
+      const auto union_node = UnionNode::make(UnionMode::Positions);
+      union_node->set_left_input(_add_predicate(lqp, logical_predicate->left_operand));
+      union_node->set_right_input(_add_predicate(lqp, logical_predicate->right_operand));
+      return union_node;
+    }
+  }
+
+  Fail("Invalid enum value");
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "join_vertex_set.hpp"
+
+namespace opossum {
+
+class AbstractJoinPlanPredicate;
+class AbstractLQPNode;
+class JoinGraph;
+class JoinNode;
+
+/**
+ * Greedy Operator Ordering (GOO, see Fegaras, "A New Heuristic for Optimizing Large Queries", 1998).
+ *
+ * Starting with one subplan per vertex of the JoinGraph, the two subplans whose join has the lowest estimated
+ * cardinality are joined until a single plan is left. Subplans connected by predicates are preferred over cross joins.
+ * Cardinalities are taken from the TableStatistics of the LQP, so vertices that carry actual cardinalities (e.g.
+ * MaterializedNodes) are ordered accordingly.
+ *
+ * Each predicate is placed directly above the first join that makes all vertices it accesses available. The column
+ * order of the result depends on the chosen join order - callers that care about the column order need to restore it.
+ *
+ * The vertices of the JoinGraph get the returned plan as an additional output. Callers are expected to untie them from
+ * their previous outputs.
+ */
+class GreedyOperatorOrdering final {
+ public:
+  std::shared_ptr<AbstractLQPNode> operator()(const std::shared_ptr<const JoinGraph>& join_graph);
+
+ private:
+  struct Subplan {
+    JoinVertexSet vertex_set;
+    std::shared_ptr<AbstractLQPNode> lqp;
+  };
+
+  struct JoinCandidate {
+    std::shared_ptr<AbstractLQPNode> lqp;
+    std::shared_ptr<JoinNode> join_node;
+  };
+
+  static JoinCandidate _join(const std::shared_ptr<AbstractLQPNode>& left,
+                             const std::shared_ptr<AbstractLQPNode>& right,
+                             std::vector<std::shared_ptr<const AbstractJoinPlanPredicate>> predicates);
+
+  static void _untie(const std::shared_ptr<JoinNode>& join_node);
+
+  static std::shared_ptr<AbstractLQPNode> _add_predicates(
+      const std::shared_ptr<AbstractLQPNode>& lqp,
+      const std::vector<std::shared_ptr<const AbstractJoinPlanPredicate>>& predicates);
+
+  static std::shared_ptr<AbstractLQPNode> _add_predicate(
+      const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<const AbstractJoinPlanPredicate>& predicate);
+};
+
+}  // namespace opossum
@@ -29,6 +29,8 @@ class Optimizer final {
   std::shared_ptr<AbstractLQPNode> optimize(const std::shared_ptr<AbstractLQPNode>& input) const;
 
  private:
+  void _apply_rules_until_fixpoint(const RuleBatch& rule_batch, const std::shared_ptr<AbstractLQPNode>& root_node) const;
+
   std::vector<RuleBatch> _rule_batches;
 
   // Rather arbitrary right now, atm all rules should be done after one iteration
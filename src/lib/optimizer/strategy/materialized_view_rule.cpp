@@ -0,0 +1,34 @@
+#include "materialized_view_rule.hpp"
+
+#include <memory>
+#include <string>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/materialized_view_node.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+std::string MaterializedViewRule::name() const { return "Materialized View Rule"; }
+
+bool MaterializedViewRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) {
+  const auto& storage_manager = StorageManager::get();
+
+  for (const auto& view_name : storage_manager.materialized_view_names()) {
+    const auto& view_lqp = storage_manager.get_materialized_view(view_name)->lqp();
+    if (node->type() != view_lqp->type() || node->find_first_subplan_mismatch(view_lqp)) continue;
+
+    // The subplan is kept by the MaterializedViewNode, so that the column references of the outputs stay valid
+    const auto materialized_view_node = std::make_shared<MaterializedViewNode>(view_name, node);
+    for (const auto& output_relation : node->output_relations()) {
+      output_relation.output->set_input(output_relation.input_side, materialized_view_node);
+    }
+
+    return true;
+  }
+
+  return _apply_to_inputs(node);
+}
+
+}  // namespace opossum
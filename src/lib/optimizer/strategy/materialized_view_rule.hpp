@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Replaces subplans that are equal to the definition of a materialized view by a MaterializedViewNode, so that the
+ * stored result of the view is read instead of computing the subplan.
+ *
+ * The read keeps the subplan. It is executed instead of reading the view if the view was refreshed past the snapshot
+ * of the transaction after a base table changed, or if the transaction wrote data (see GetTable). Thus, the query
+ * result is the same as without the rule. As the rule runs before all others, the subplan is not optimized.
+ */
+class MaterializedViewRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) override;
+};
+
+}  // namespace opossum
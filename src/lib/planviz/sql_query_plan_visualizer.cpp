@@ -2,6 +2,7 @@
 #include <string>
 #include <utility>
 
+#include "logical_query_plan/materialized_node.hpp"
 #include "planviz/abstract_visualizer.hpp"
 #include "planviz/sql_query_plan_visualizer.hpp"
 #include "sql/sql_query_plan.hpp"
@@ -61,6 +62,21 @@ void SQLQueryPlanVisualizer::_build_dataflow(const std::shared_ptr<const Abstrac
     info.pen_width = std::fmax(1, std::ceil(std::log10(output->row_count()) / 2));
   }
 
+  // Show the cardinalities that the AdaptiveQueryExecutor checked and whether they lead to a re-optimization
+  const auto lqp_node = from->lqp_node();
+  if (lqp_node && lqp_node->type() == LQPNodeType::Materialized) {
+    const auto materialized_node = std::static_pointer_cast<const MaterializedNode>(lqp_node);
+
+    info.label += "\nestimated " + std::to_string(static_cast<size_t>(materialized_node->estimated_row_count())) +
+                  " row(s)";
+
+    if (materialized_node->triggered_reoptimization()) {
+      info.label += "\nre-optimized remaining joins";
+      info.color = "red";
+      info.font_color = "red";
+    }
+  }
+
   _add_edge(from, to, info);
 }
 
@@ -8,6 +8,7 @@
 #include "abstract_scheduler.hpp"
 #include "current_scheduler.hpp"
 #include "task_queue.hpp"
+#include "task_tracer.hpp"
 #include "worker.hpp"
 
 #include "utils/assert.hpp"
@@ -28,6 +29,8 @@ std::string AbstractTask::description() const {
   return _description.empty() ? "{Task with id: " + std::to_string(_id) + "}" : _description;
 }
 
+std::string AbstractTask::name() const { return "Task"; }
+
 void AbstractTask::set_id(TaskID id) { _id = id; }
 
 void AbstractTask::set_as_predecessor_of(std::shared_ptr<AbstractTask> successor) {
@@ -41,6 +44,14 @@ const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() con
 
 void AbstractTask::set_node_id(NodeID node_id) { _node_id = node_id; }
 
+NodeID AbstractTask::preferred_node_id() const { return _preferred_node_id; }
+
+void AbstractTask::set_preferred_node_id(NodeID preferred_node_id) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the preferred node after the Task was scheduled");
+
+  _preferred_node_id = preferred_node_id;
+}
+
 bool AbstractTask::try_mark_as_enqueued() { return !_is_enqueued.exchange(true); }
 
 void AbstractTask::set_done_callback(const std::function<void()>& done_callback) {
@@ -52,6 +63,8 @@ void AbstractTask::set_done_callback(const std::function<void()>& done_callback)
 void AbstractTask::schedule(NodeID preferred_node_id, SchedulePriority priority) {
   _mark_as_scheduled();
 
+  if (preferred_node_id == CURRENT_NODE_ID) preferred_node_id = _preferred_node_id;
+
   if (CurrentScheduler::is_set()) {
     CurrentScheduler::get()->schedule(shared_from_this(), preferred_node_id, priority);
   } else {
@@ -87,8 +100,14 @@ void AbstractTask::execute() {
   DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
+  auto& tracer = TaskTracer::get();
+  const auto traced = tracer.is_enabled();
+  const auto trace_begin = traced ? TaskTracer::Clock::now() : TaskTracer::Clock::time_point{};
+
   _on_execute();
 
+  if (traced) tracer.record_task(*this, trace_begin, TaskTracer::Clock::now());
+
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
   }
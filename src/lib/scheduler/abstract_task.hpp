@@ -46,6 +46,11 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   virtual std::string description() const;
 
+  /**
+   * Short name of the kind of task, e.g., the name of the operator of an OperatorTask. Used by the TaskTracer.
+   */
+  virtual std::string name() const;
+
   /**
    * Task ids are determined on scheduling, no one else but the Scheduler should have any reason to call this
    * @param id id, unique during the lifetime of the program, of the task
@@ -68,6 +73,13 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_node_id(NodeID node_id);
 
+  /**
+   * The node the Task is scheduled on if schedule() is called without a preferred node, e.g., by
+   * CurrentScheduler::schedule_tasks(). Used to process data on the node its memory is placed on.
+   */
+  NodeID preferred_node_id() const;
+  void set_preferred_node_id(NodeID preferred_node_id);
+
   /**
    * Callback to be executed right after the Task finished.
    * Notice the execution of the callback might happen on ANY thread
@@ -129,6 +141,7 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   TaskID _id = INVALID_TASK_ID;
   NodeID _node_id = INVALID_NODE_ID;
+  NodeID _preferred_node_id = CURRENT_NODE_ID;
   bool _done = false;
   std::function<void()> _done_callback;
 
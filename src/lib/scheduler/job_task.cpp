@@ -1,7 +1,43 @@
 #include "job_task.hpp"
 
+#include <utility>
+
+namespace {
+
+// The count of the JobTaskCounter that is active in this thread
+thread_local std::shared_ptr<std::atomic<size_t>> active_job_task_counter;
+
+}  // namespace
+
 namespace opossum {
 
-void JobTask::_on_execute() { _fn(); }
+JobTask::JobTask(const std::function<void()>& fn, NodeID preferred_node_id)
+    : _fn(fn), _counter(active_job_task_counter) {
+  set_preferred_node_id(preferred_node_id);
+  if (_counter) ++(*_counter);
+}
+
+std::string JobTask::name() const { return "JobTask"; }
+
+void JobTask::_on_execute() {
+  // The job is executed on behalf of the scope it was created in, which might not be the one active in this thread
+  const auto previous_counter = std::exchange(active_job_task_counter, _counter);
+  try {
+    _fn();
+  } catch (...) {
+    active_job_task_counter = previous_counter;
+    throw;
+  }
+  active_job_task_counter = previous_counter;
+}
+
+JobTaskCounter::JobTaskCounter()
+    : _count(std::make_shared<std::atomic<size_t>>(0)), _previous_count(active_job_task_counter) {
+  active_job_task_counter = _count;
+}
+
+JobTaskCounter::~JobTaskCounter() { active_job_task_counter = _previous_count; }
+
+size_t JobTaskCounter::count() const { return *_count; }
 
 }  // namespace opossum
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <functional>
+#include <memory>
 
 #include "abstract_task.hpp"
 
@@ -25,15 +27,49 @@ namespace opossum {
  *
  * // c == 2 now
  *
+ * If the job processes data placed on a specific NUMA node, pass that node (e.g., Chunk::node_id()) as
+ * preferred_node_id, so that the job is executed by a worker of that node unless it is stolen by another one.
+ *
+ * Each JobTask is attributed to the JobTaskCounter that is active in the thread that creates it. While the job is
+ * executed, that counter is active in the executing thread, so that JobTasks created by the job are attributed to it
+ * as well.
  */
 class JobTask : public AbstractTask {
  public:
-  explicit JobTask(const std::function<void()>& fn) : _fn(fn) {}
+  explicit JobTask(const std::function<void()>& fn, NodeID preferred_node_id = CURRENT_NODE_ID);
+
+  std::string name() const override;
 
  protected:
   void _on_execute() override;
 
  private:
   std::function<void()> _fn;
+
+  // The count of the JobTaskCounter this job is attributed to, nullptr if none was active
+  std::shared_ptr<std::atomic<size_t>> _counter;
 };
+
+/**
+ * Counts the JobTasks created by the calling thread while the counter is active, i.e., from its construction to its
+ * destruction, and the JobTasks these create, transitively and on any thread. Counters nest: while a counter is
+ * active, JobTasks are attributed to it only, not to the counter that was active before. Tasks that the thread
+ * executes in between (e.g., other operators) are not counted unless they run within the scope of this counter.
+ *
+ * Used to report the JobTasks an operator created, see BaseOperatorPerformanceData::job_task_count.
+ */
+class JobTaskCounter final : private Noncopyable {
+ public:
+  JobTaskCounter();
+  ~JobTaskCounter();
+
+  // The JobTasks attributed to this counter so far. Jobs may still be executed (and create JobTasks) after the
+  // counter became inactive, so only wait for them before reading the final count.
+  size_t count() const;
+
+ private:
+  const std::shared_ptr<std::atomic<size_t>> _count;
+  const std::shared_ptr<std::atomic<size_t>> _previous_count;
+};
+
 }  // namespace opossum
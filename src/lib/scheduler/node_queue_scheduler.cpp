@@ -104,8 +104,9 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   if (!task->is_ready()) return;
 
-  // Lookup node id for current worker.
-  if (preferred_node_id == CURRENT_NODE_ID) {
+  // Lookup node id for current worker. Tasks that prefer the node their data is placed on (see Chunk::node_id()) are
+  // treated the same if the Scheduler has no queue for that node, e.g., if it uses fewer nodes than the machine has.
+  if (preferred_node_id == CURRENT_NODE_ID || static_cast<size_t>(preferred_node_id) >= _queues.size()) {
     auto worker = Worker::get_this_thread_worker();
     if (worker) {
       preferred_node_id = worker->queue()->node_id();
@@ -115,9 +116,6 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
     }
   }
 
-  DebugAssert(!(static_cast<size_t>(preferred_node_id) >= _queues.size()),
-              "preferred_node_id is not within range of available nodes");
-
   auto queue = _queues[preferred_node_id];
   queue->push(std::move(task), static_cast<uint32_t>(priority));
 }
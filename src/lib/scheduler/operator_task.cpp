@@ -20,6 +20,8 @@ std::string OperatorTask::description() const {
   return "OperatorTask with id: " + std::to_string(id()) + " for op: " + _op->description();
 }
 
+std::string OperatorTask::name() const { return _op->name(); }
+
 const std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_operator(
     std::shared_ptr<AbstractOperator> op) {
   std::vector<std::shared_ptr<OperatorTask>> tasks;
@@ -37,12 +39,15 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
   const auto task = std::make_shared<OperatorTask>(op);
   task_by_op.emplace(op, task);
 
-  if (auto left = op->mutable_input_left()) {
+  // Operators that have already been executed (e.g., by the AdaptiveQueryExecutor) are not scheduled again
+  auto left = op->mutable_input_left();
+  if (left && !left->get_output()) {
     auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op);
     subtree_root->set_as_predecessor_of(task);
   }
 
-  if (auto right = op->mutable_input_right()) {
+  auto right = op->mutable_input_right();
+  if (right && !right->get_output()) {
     auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op);
     subtree_root->set_as_predecessor_of(task);
   }
@@ -27,6 +27,9 @@ class OperatorTask : public AbstractTask {
 
   std::string description() const override;
 
+  // The name of the operator
+  std::string name() const override;
+
  protected:
   void _on_execute() override;
 
@@ -12,6 +12,8 @@ TaskQueue::TaskQueue(NodeID node_id) : _node_id(node_id) {}
 
 bool TaskQueue::empty() const { return _num_tasks == 0; }
 
+size_t TaskQueue::size() const { return _num_tasks; }
+
 NodeID TaskQueue::node_id() const { return _node_id; }
 
 void TaskQueue::push(std::shared_ptr<AbstractTask> task, uint32_t priority) {
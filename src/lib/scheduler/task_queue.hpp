@@ -23,6 +23,9 @@ class TaskQueue {
 
   bool empty() const;
 
+  // The number of queued tasks, which may already be outdated when it is returned
+  size_t size() const;
+
   NodeID node_id() const;
 
   void push(std::shared_ptr<AbstractTask> task, uint32_t priority);
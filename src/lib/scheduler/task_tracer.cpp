@@ -0,0 +1,172 @@
+#include "task_tracer.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "json.hpp"
+
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
+
+namespace {
+
+using opossum::TaskTracer;
+
+std::string event_type_name(const TaskTracer::EventType type) {
+  switch (type) {
+    case TaskTracer::EventType::Task:
+      return "Task";
+    case TaskTracer::EventType::Idle:
+      return "Idle";
+    case TaskTracer::EventType::Hibernate:
+      return "Hibernate";
+    case TaskTracer::EventType::WaitForTasks:
+      return "WaitForTasks";
+    case TaskTracer::EventType::Steal:
+      return "Steal";
+    case TaskTracer::EventType::TokenAcquired:
+      return "TokenAcquired";
+    case TaskTracer::EventType::TokenYielded:
+      return "TokenYielded";
+  }
+  return "Unknown";
+}
+
+double to_trace_microseconds(const TaskTracer::Clock::time_point time_point) {
+  return std::chrono::duration<double, std::micro>(time_point.time_since_epoch()).count();
+}
+
+}  // namespace
+
+namespace opossum {
+
+TaskTracer& TaskTracer::get() {
+  static TaskTracer instance;
+  return instance;
+}
+
+void TaskTracer::enable(const size_t buffer_capacity) {
+  DebugAssert(buffer_capacity > 0, "Buffers need to hold at least one event");
+  _buffer_capacity = buffer_capacity;
+  clear();
+  _enabled = true;
+}
+
+void TaskTracer::disable() { _enabled = false; }
+
+void TaskTracer::clear() {
+  std::lock_guard<std::mutex> buffers_lock(_buffers_mutex);
+  for (const auto& buffer : _buffers) {
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+    buffer->events.clear();
+    buffer->next_position = 0;
+  }
+}
+
+void TaskTracer::record_task(const AbstractTask& task, const Clock::time_point begin, const Clock::time_point end) {
+  if (!is_enabled()) return;
+  _record(Event{EventType::Task, begin, end, task.name(), task.id(), task.node_id()});
+}
+
+void TaskTracer::record_duration(const EventType type, const Clock::time_point begin, const Clock::time_point end,
+                                 const NodeID node_id) {
+  if (!is_enabled()) return;
+  _record(Event{type, begin, end, {}, INVALID_TASK_ID, node_id});
+}
+
+void TaskTracer::record_instant(const EventType type, const NodeID node_id) {
+  if (!is_enabled()) return;
+  const auto now = Clock::now();
+  _record(Event{type, now, now, {}, INVALID_TASK_ID, node_id});
+}
+
+TaskTracer::ThreadBuffer& TaskTracer::_thread_buffer() {
+  thread_local ThreadBuffer* thread_buffer = nullptr;
+  if (thread_buffer) return *thread_buffer;
+
+  auto buffer = std::make_unique<ThreadBuffer>();
+  if (const auto worker = Worker::get_this_thread_worker()) {
+    buffer->worker_id = worker->id();
+    buffer->node_id = worker->queue()->node_id();
+  }
+
+  std::lock_guard<std::mutex> lock(_buffers_mutex);
+  thread_buffer = _buffers.emplace_back(std::move(buffer)).get();
+  return *thread_buffer;
+}
+
+void TaskTracer::_record(Event&& event) {
+  auto& buffer = _thread_buffer();
+  const auto capacity = _buffer_capacity.load();
+
+  std::lock_guard<std::mutex> lock(buffer.mutex);
+  if (buffer.events.size() < capacity) {
+    buffer.events.emplace_back(std::move(event));
+    return;
+  }
+
+  // The buffer is full, overwrite the oldest event
+  buffer.events[buffer.next_position] = std::move(event);
+  buffer.next_position = (buffer.next_position + 1) % buffer.events.size();
+}
+
+void TaskTracer::write_chrome_trace(std::ostream& stream, const Clock::time_point begin,
+                                    const Clock::time_point end) const {
+  auto trace_events = nlohmann::json::array();
+
+  std::lock_guard<std::mutex> buffers_lock(_buffers_mutex);
+  for (auto thread_index = size_t{0}; thread_index < _buffers.size(); ++thread_index) {
+    auto& buffer = *_buffers[thread_index];
+    const auto is_worker = buffer.worker_id != INVALID_WORKER_ID;
+
+    // Each node is a process of the trace, threads that are not workers are grouped in process 0
+    const auto pid = is_worker ? static_cast<uint64_t>(buffer.node_id) + 1u : uint64_t{0};
+    const auto tid = thread_index;
+
+    trace_events.push_back({{"ph", "M"},
+                            {"name", "process_name"},
+                            {"pid", pid},
+                            {"args", {{"name", is_worker ? "Node " + std::to_string(buffer.node_id) : "Other"}}}});
+    trace_events.push_back(
+        {{"ph", "M"},
+         {"name", "thread_name"},
+         {"pid", pid},
+         {"tid", tid},
+         {"args", {{"name", is_worker ? "Worker " + std::to_string(buffer.worker_id) : "Thread"}}}});
+
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    for (const auto& event : buffer.events) {
+      if (event.end < begin || event.begin > end) continue;
+
+      const auto category = event_type_name(event.type);
+      auto trace_event = nlohmann::json{{"name", event.type == EventType::Task ? event.name : category},
+                                        {"cat", category},
+                                        {"pid", pid},
+                                        {"tid", tid},
+                                        {"ts", to_trace_microseconds(event.begin)}};
+
+      if (event.begin == event.end && event.type != EventType::Task) {
+        trace_event["ph"] = "i";
+        trace_event["s"] = "t";
+      } else {
+        trace_event["ph"] = "X";
+        trace_event["dur"] = to_trace_microseconds(event.end) - to_trace_microseconds(event.begin);
+      }
+
+      auto args = nlohmann::json::object();
+      if (event.task_id != INVALID_TASK_ID) args["task_id"] = event.task_id;
+      if (event.node_id != INVALID_NODE_ID) args["node_id"] = static_cast<uint64_t>(event.node_id);
+      trace_event["args"] = std::move(args);
+
+      trace_events.push_back(std::move(trace_event));
+    }
+  }
+
+  stream << nlohmann::json{{"traceEvents", std::move(trace_events)}, {"displayTimeUnit", "ms"}};
+}
+
+}  // namespace opossum
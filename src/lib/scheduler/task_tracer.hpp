@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Records what the workers of the NodeQueueScheduler are doing, so that the timeline of a query can be inspected in
+ * chrome://tracing or Perfetto (see write_chrome_trace()). Recorded are
+ *
+ *   - the execution of each task, named by AbstractTask::name() (i.e., the operator name for OperatorTasks),
+ *   - tasks that a worker stole from the queue of another node,
+ *   - the time workers spent idle, hibernating or blocked in Worker::_wait_for_tasks() and
+ *   - the hand-off of the active worker token of a ProcessingUnit.
+ *
+ * Tracing is disabled by default, in which case recording costs a single relaxed atomic load. When enabled, each
+ * thread records into its own ring buffer, which only keeps the latest events once it is full. The buffers are locked
+ * per thread, so that recording never contends with other workers, only with dumping the trace.
+ */
+class TaskTracer : private Noncopyable {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  enum class EventType { Task, Idle, Hibernate, WaitForTasks, Steal, TokenAcquired, TokenYielded };
+
+  struct Event {
+    EventType type;
+    Clock::time_point begin;
+    // Equal to begin for instant events, i.e., Steal and token hand-offs
+    Clock::time_point end;
+    // The task name for Task events
+    std::string name;
+    TaskID task_id;
+    NodeID node_id;
+  };
+
+  static TaskTracer& get();
+
+  static constexpr size_t DEFAULT_BUFFER_CAPACITY = 1u << 16u;
+
+  // Clears all recorded events and starts recording with the given number of events per thread
+  void enable(const size_t buffer_capacity = DEFAULT_BUFFER_CAPACITY);
+  void disable();
+  bool is_enabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+  void clear();
+
+  /**
+   * The recording functions are no-ops if tracing is disabled. They are called by the scheduler and record the calling
+   * thread as the thread of the event.
+   * @{
+   */
+  void record_task(const AbstractTask& task, const Clock::time_point begin, const Clock::time_point end);
+  void record_duration(const EventType type, const Clock::time_point begin, const Clock::time_point end,
+                       const NodeID node_id = INVALID_NODE_ID);
+  void record_instant(const EventType type, const NodeID node_id = INVALID_NODE_ID);
+  /**@}*/
+
+  /**
+   * Writes the events that overlap the time window [begin, end] in the Chrome trace event format. Each node is a
+   * process and each thread a thread of the trace, so record the time around a query to get the trace of that query.
+   */
+  void write_chrome_trace(std::ostream& stream, const Clock::time_point begin = Clock::time_point::min(),
+                          const Clock::time_point end = Clock::time_point::max()) const;
+
+ protected:
+  struct ThreadBuffer {
+    std::mutex mutex;
+    // The worker running on the thread and the node of its queue, if the thread is a worker
+    WorkerID worker_id{INVALID_WORKER_ID};
+    NodeID node_id{INVALID_NODE_ID};
+    std::vector<Event> events;
+    // The position of the next event in events once the buffer is full
+    size_t next_position{0};
+  };
+
+  TaskTracer() = default;
+
+  ThreadBuffer& _thread_buffer();
+  void _record(Event&& event);
+
+  std::atomic_bool _enabled{false};
+  std::atomic<size_t> _buffer_capacity{DEFAULT_BUFFER_CAPACITY};
+
+  // Buffers are never removed, as threads keep a pointer to their buffer
+  mutable std::mutex _buffers_mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> _buffers;
+};
+
+}  // namespace opossum
@@ -14,6 +14,7 @@
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
 #include "task_queue.hpp"
+#include "task_tracer.hpp"
 
 namespace {
 
@@ -55,14 +56,24 @@ void Worker::operator()() {
 
   DebugAssert(static_cast<bool>(processing_unit), "No processing unit");
 
+  auto& tracer = TaskTracer::get();
+  auto was_active = false;
+
   while (!processing_unit->shutdown_flag()) {
     // Hibernate if this is not the active worker.
     {
       auto this_worker_is_active = processing_unit->try_acquire_active_worker_token(_id);
       if (!this_worker_is_active) {
+        was_active = false;
+        const auto hibernate_begin = TaskTracer::Clock::now();
         processing_unit->hibernate_calling_worker();
+        if (tracer.is_enabled()) {
+          tracer.record_duration(TaskTracer::EventType::Hibernate, hibernate_begin, TaskTracer::Clock::now());
+        }
         continue;  // Re-try to become the active worker
       }
+      if (!was_active && tracer.is_enabled()) tracer.record_instant(TaskTracer::EventType::TokenAcquired);
+      was_active = true;
     }
 
     auto task = _queue->pull();
@@ -81,13 +92,18 @@ void Worker::operator()() {
         if (task) {
           task->set_node_id(_queue->node_id());
           work_stealing_successful = true;
+          if (tracer.is_enabled()) tracer.record_instant(TaskTracer::EventType::Steal, queue->node_id());
           break;
         }
       }
 
       // Sleep iff there is no ready task in our queue and work stealing was not successful.
       if (!work_stealing_successful) {
+        const auto idle_begin = TaskTracer::Clock::now();
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        if (tracer.is_enabled()) {
+          tracer.record_duration(TaskTracer::EventType::Idle, idle_begin, TaskTracer::Clock::now());
+        }
         continue;
       }
     }
@@ -100,6 +116,7 @@ void Worker::operator()() {
   }
 
   processing_unit->yield_active_worker_token(_id);
+  if (tracer.is_enabled()) tracer.record_instant(TaskTracer::EventType::TokenYielded);
 }
 
 void Worker::_set_affinity() {
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "processing_unit.hpp"
+#include "task_tracer.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -48,12 +49,19 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
     auto processing_unit = _processing_unit.lock();
     DebugAssert(static_cast<bool>(processing_unit), "Bug: Locking the processing unit failed");
 
+    auto& tracer = TaskTracer::get();
+
     processing_unit->yield_active_worker_token(_id);
+    if (tracer.is_enabled()) tracer.record_instant(TaskTracer::EventType::TokenYielded);
     processing_unit->wake_or_create_worker();
 
+    const auto wait_begin = TaskTracer::Clock::now();
     for (auto& task : tasks) {
       task->_join_without_replacement_worker();
     }
+    if (tracer.is_enabled()) {
+      tracer.record_duration(TaskTracer::EventType::WaitForTasks, wait_begin, TaskTracer::Clock::now());
+    }
   }
 
  private:
@@ -1,5 +1,6 @@
 #include "query_response_builder.hpp"
 
+#include "logical_type.hpp"
 #include "server/postgres_wire_handler.hpp"
 #include "sql/sql_pipeline.hpp"
 
@@ -21,6 +22,17 @@ std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const
     uint32_t object_id;
     int32_t type_id;
 
+    // DATE and NUMERIC, their values are sent as formatted by LogicalType::format()
+    const auto& logical_type = table->column_logical_type(ColumnID{static_cast<ColumnID::base_type>(column_id)});
+    if (logical_type.kind == LogicalType::Kind::Date) {
+      result.emplace_back(ColumnDescription{column_names[column_id], 1082, 4});
+      continue;
+    }
+    if (logical_type.kind == LogicalType::Kind::Decimal) {
+      result.emplace_back(ColumnDescription{column_names[column_id], 1700, -1});
+      continue;
+    }
+
     switch (column_types[column_id]) {
       case DataType::Int:
         object_id = 23;
@@ -95,25 +107,36 @@ boost::future<void> QueryResponseBuilder::send_query_response_chunks(send_row_t
   if (current_chunk_id == table.chunk_count()) return boost::make_ready_future();
 
   const auto& chunk = table.get_chunk(current_chunk_id);
+  const auto rows = std::make_shared<const std::vector<std::vector<std::string>>>(format_chunk(table, *chunk));
 
-  return send_query_response_rows(send_row, *chunk, ChunkOffset{0}) >> then >>
+  return send_query_response_rows(send_row, rows, ChunkOffset{0}) >> then >>
          std::bind(QueryResponseBuilder::send_query_response_chunks, send_row, std::ref(table),
                    ChunkID{current_chunk_id + 1});
 }
 
-boost::future<void> QueryResponseBuilder::send_query_response_rows(send_row_t send_row, const Chunk& chunk,
-                                                                   ChunkOffset current_chunk_offset) {
-  if (current_chunk_offset == chunk.size()) return boost::make_ready_future();
+boost::future<void> QueryResponseBuilder::send_query_response_rows(
+    send_row_t send_row, const std::shared_ptr<const std::vector<std::vector<std::string>>>& rows,
+    ChunkOffset current_chunk_offset) {
+  if (current_chunk_offset == rows->size()) return boost::make_ready_future();
 
-  std::vector<std::string> row_strings(chunk.column_count());
+  return send_row((*rows)[current_chunk_offset]) >> then >>
+         std::bind(QueryResponseBuilder::send_query_response_rows, send_row, rows,
+                   ChunkOffset{current_chunk_offset + 1});
+}
+
+std::vector<std::vector<std::string>> QueryResponseBuilder::format_chunk(const Table& table, const Chunk& chunk) {
+  // The values are decoded column by column and then transposed into rows
+  auto rows = std::vector<std::vector<std::string>>(chunk.size(), std::vector<std::string>(chunk.column_count()));
 
   for (ColumnID column_id{0}; column_id < ColumnID{chunk.column_count()}; ++column_id) {
-    const auto& column = chunk.get_column(column_id);
-    row_strings[column_id] = type_cast<std::string>((*column)[current_chunk_offset]);
+    auto values = format_column_values(*chunk.get_column(column_id), table.column_data_type(column_id),
+                                       table.column_logical_type(column_id));
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      rows[chunk_offset][column_id] = std::move(values[chunk_offset]);
+    }
   }
 
-  return send_row(row_strings) >> then >> std::bind(QueryResponseBuilder::send_query_response_rows, send_row,
-                                                    std::ref(chunk), ChunkOffset{current_chunk_offset + 1});
+  return rows;
 }
 
 }  // namespace opossum
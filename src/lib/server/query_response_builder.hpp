@@ -22,8 +22,12 @@ class QueryResponseBuilder {
  protected:
   static boost::future<void> send_query_response_chunks(send_row_t send_row, const Table& table,
                                                         ChunkID current_chunk_id);
-  static boost::future<void> send_query_response_rows(send_row_t send_row, const Chunk& chunk,
-                                                      ChunkOffset current_chunk_offset);
+  // rows are the formatted values of a chunk, see format_chunk()
+  static boost::future<void> send_query_response_rows(
+      send_row_t send_row, const std::shared_ptr<const std::vector<std::vector<std::string>>>& rows,
+      ChunkOffset current_chunk_offset);
+
+  static std::vector<std::vector<std::string>> format_chunk(const Table& table, const Chunk& chunk);
 };
 
 }  // namespace opossum
@@ -159,6 +159,9 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
   };
 
   auto send_command_complete = [=](uint64_t row_count) {
+    // Like Postgres, EXPLAIN completes with its own tag regardless of the explained statement
+    if (sql_pipeline->explain_mode() != ExplainMode::None) return _connection->send_command_complete("EXPLAIN");
+
     auto statement_type = sql_pipeline->get_parsed_sql_statements().front()->getStatements().front()->type();
     auto complete_message = QueryResponseBuilder::build_command_complete_message(statement_type, row_count);
     return _connection->send_command_complete(complete_message);
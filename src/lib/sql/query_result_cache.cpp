@@ -0,0 +1,273 @@
+#include "query_result_cache.hpp"
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool contains_subselect(const std::shared_ptr<LQPExpression>& expression) {
+  if (!expression) return false;
+  if (expression->is_subselect()) return true;
+
+  for (const auto& argument : expression->aggregate_function_arguments()) {
+    if (contains_subselect(argument)) return true;
+  }
+
+  return contains_subselect(expression->left_child()) || contains_subselect(expression->right_child());
+}
+
+/**
+ * Collects the names of all StoredTables in the LQP.
+ * @return false if the LQP contains nodes whose result must not be cached
+ */
+bool collect_table_names(const std::shared_ptr<const AbstractLQPNode>& node,
+                         std::unordered_set<std::string>& table_names) {
+  if (!node) return true;
+
+  switch (node->type()) {
+    case LQPNodeType::StoredTable: {
+      const auto& table_name = std::static_pointer_cast<const StoredTableNode>(node)->table_name();
+      // Materialized views are refreshed when they are read, their last_commit_id() is not maintained
+      if (StorageManager::get().has_materialized_view(table_name)) return false;
+      table_names.emplace(table_name);
+    } break;
+
+    case LQPNodeType::Projection:
+      // The tables read by subselects are not part of the LQP itself
+      for (const auto& expression : std::static_pointer_cast<const ProjectionNode>(node)->column_expressions()) {
+        if (contains_subselect(expression)) return false;
+      }
+      break;
+
+    case LQPNodeType::Aggregate:
+    case LQPNodeType::DummyTable:
+    case LQPNodeType::Join:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Sort:
+    case LQPNodeType::Union:
+    case LQPNodeType::Validate:
+      break;
+
+    // Nodes that modify data, depend on the catalog or are only meaningful during a single execution
+    default:
+      return false;
+  }
+
+  return collect_table_names(node->left_input(), table_names) &&
+         collect_table_names(node->right_input(), table_names);
+}
+
+}  // namespace
+
+namespace opossum {
+
+QueryResultCache& QueryResultCache::get() {
+  static QueryResultCache instance;
+  return instance;
+}
+
+void QueryResultCache::set_memory_budget(const size_t memory_budget) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _memory_budget = memory_budget;
+  _evict_until_within_budget();
+}
+
+size_t QueryResultCache::memory_budget() const { return _memory_budget; }
+
+size_t QueryResultCache::memory_usage() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _memory_usage;
+}
+
+std::optional<std::vector<QueryResultCache::TableVersion>> QueryResultCache::capture_table_versions(
+    const std::shared_ptr<const AbstractLQPNode>& lqp) {
+  auto table_names = std::unordered_set<std::string>{};
+  if (!collect_table_names(lqp, table_names)) return std::nullopt;
+
+  auto table_versions = std::vector<TableVersion>{};
+  table_versions.reserve(table_names.size());
+
+  for (const auto& table_name : table_names) {
+    const auto table = StorageManager::get().get_table(table_name);
+
+    // Modifications of Tables without MVCC are not tracked
+    if (table->has_mvcc() == UseMvcc::No) return std::nullopt;
+
+    table_versions.emplace_back(TableVersion{table_name, table, table->last_commit_id()});
+  }
+
+  return table_versions;
+}
+
+std::shared_ptr<const Table> QueryResultCache::try_get(const std::shared_ptr<const AbstractLQPNode>& lqp,
+                                                       const CommitID snapshot_commit_id) {
+  if (_memory_budget == 0) return nullptr;
+
+  const auto fingerprint = _fingerprint(lqp);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto map_iter = _entries_by_fingerprint.find(fingerprint);
+  if (map_iter == _entries_by_fingerprint.end()) {
+    ++_miss_count;
+    return nullptr;
+  }
+
+  const auto entry_iter = map_iter->second;
+
+  if (!_is_up_to_date(*entry_iter)) {
+    _evict(entry_iter);
+    ++_miss_count;
+    return nullptr;
+  }
+
+  // The entry is up to date, but the transaction might not see all of the commits the result is based on
+  for (const auto& table_version : entry_iter->table_versions) {
+    if (table_version.last_commit_id > snapshot_commit_id) {
+      ++_miss_count;
+      return nullptr;
+    }
+  }
+
+  // Guard against different LQPs with the same string representation
+  if (entry_iter->lqp->find_first_subplan_mismatch(lqp)) {
+    ++_miss_count;
+    return nullptr;
+  }
+
+  ++entry_iter->hit_count;
+  ++_hit_count;
+  _saved_execution_time += entry_iter->execution_time;
+
+  _entries.splice(_entries.begin(), _entries, entry_iter);
+
+  return entry_iter->result;
+}
+
+void QueryResultCache::set(const std::shared_ptr<const AbstractLQPNode>& lqp, const std::string& sql,
+                           const std::vector<TableVersion>& table_versions, const CommitID snapshot_commit_id,
+                           const std::shared_ptr<const Table>& result, const std::chrono::microseconds execution_time) {
+  if (_memory_budget == 0 || !result) return;
+
+  // A commit that was in progress when the table versions were captured is not visible to the execution, so the
+  // result would not match the captured versions
+  for (const auto& table_version : table_versions) {
+    if (table_version.last_commit_id > snapshot_commit_id) return;
+  }
+
+  const auto memory_usage = result->estimate_memory_usage();
+  if (memory_usage > _memory_budget) return;
+
+  auto fingerprint = _fingerprint(lqp);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto map_iter = _entries_by_fingerprint.find(fingerprint);
+  if (map_iter != _entries_by_fingerprint.end()) {
+    _evict(map_iter->second);
+  }
+
+  // The LQP is copied since the caller may continue to modify it
+  _entries.emplace_front(Entry{fingerprint, lqp->deep_copy(), sql, table_versions, result, execution_time,
+                               memory_usage, 0});
+  _entries_by_fingerprint.emplace(std::move(fingerprint), _entries.begin());
+  _memory_usage += memory_usage;
+
+  _evict_until_within_budget();
+
+  // Entries that became outdated would be evicted upon their next lookup anyway, but the memory is better spent on
+  // entries that can still be used
+  for (auto entry_iter = _entries.begin(); entry_iter != _entries.end();) {
+    const auto next_iter = std::next(entry_iter);
+    if (!_is_up_to_date(*entry_iter)) _evict(entry_iter);
+    entry_iter = next_iter;
+  }
+}
+
+void QueryResultCache::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _entries.clear();
+  _entries_by_fingerprint.clear();
+  _memory_usage = 0;
+  _hit_count = 0;
+  _miss_count = 0;
+  _saved_execution_time = std::chrono::microseconds{0};
+}
+
+size_t QueryResultCache::hit_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _hit_count;
+}
+
+size_t QueryResultCache::miss_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _miss_count;
+}
+
+std::chrono::microseconds QueryResultCache::saved_execution_time() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _saved_execution_time;
+}
+
+std::vector<QueryResultCache::EntryStatistics> QueryResultCache::entry_statistics() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto entry_statistics = std::vector<EntryStatistics>{};
+  entry_statistics.reserve(_entries.size());
+
+  for (const auto& entry : _entries) {
+    entry_statistics.emplace_back(EntryStatistics{entry.sql, entry.hit_count, entry.execution_time,
+                                                  entry.execution_time * entry.hit_count, entry.memory_usage});
+  }
+
+  return entry_statistics;
+}
+
+std::string QueryResultCache::_fingerprint(const std::shared_ptr<const AbstractLQPNode>& lqp) {
+  if (!lqp) return "";
+
+  return lqp->description() + "(" + _fingerprint(lqp->left_input()) + "," + _fingerprint(lqp->right_input()) + ")";
+}
+
+bool QueryResultCache::_is_up_to_date(const Entry& entry) {
+  const auto& storage_manager = StorageManager::get();
+
+  for (const auto& table_version : entry.table_versions) {
+    // The Table might have been dropped or replaced by another Table with the same name
+    if (!storage_manager.has_table(table_version.table_name)) return false;
+
+    const auto table = storage_manager.get_table(table_version.table_name);
+    if (table != table_version.table.lock()) return false;
+
+    if (table->last_commit_id() != table_version.last_commit_id) return false;
+  }
+
+  return true;
+}
+
+void QueryResultCache::_evict(const std::list<Entry>::iterator& entry_iter) {
+  _memory_usage -= entry_iter->memory_usage;
+  _entries_by_fingerprint.erase(entry_iter->fingerprint);
+  _entries.erase(entry_iter);
+}
+
+void QueryResultCache::_evict_until_within_budget() {
+  while (_memory_usage > _memory_budget) {
+    DebugAssert(!_entries.empty(), "Memory usage without entries");
+    _evict(std::prev(_entries.end()));
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Table;
+
+/**
+ * Caches the result Tables of read-only queries, keyed by their optimized LQP.
+ *
+ * Each entry is tagged with the last_commit_id() of every Table the LQP reads. An entry is only handed out to a
+ * transaction whose snapshot includes all of these commits, and only as long as no newer commit modified any of
+ * these Tables. Thus, a cached result is always identical to what executing the LQP would return for that
+ * transaction. Entries that are outdated are evicted as soon as they are discovered, and entries are evicted in LRU
+ * order if the estimated memory usage of all cached results exceeds the memory budget.
+ *
+ * The cache is disabled (memory budget 0) by default. It is used by the SQLPipelineStatement for SELECT statements
+ * that run with MVCC.
+ */
+class QueryResultCache final : private Noncopyable {
+ public:
+  // The version of a Table that a result was computed from
+  struct TableVersion {
+    std::string table_name;
+    std::weak_ptr<const Table> table;
+    CommitID last_commit_id;
+  };
+
+  struct EntryStatistics {
+    std::string sql;
+    size_t hit_count;
+    std::chrono::microseconds execution_time;
+    // execution_time * hit_count
+    std::chrono::microseconds saved_execution_time;
+    size_t memory_usage;
+  };
+
+  static QueryResultCache& get();
+
+  // A memory budget of 0 disables the cache and evicts all entries
+  void set_memory_budget(const size_t memory_budget);
+  size_t memory_budget() const;
+  size_t memory_usage() const;
+
+  /**
+   * @return the versions of all Tables read by the LQP, or std::nullopt if the result of the LQP must not be cached
+   *         (e.g., because it modifies data or reads Tables without MVCC). Must be called before the LQP is executed.
+   */
+  static std::optional<std::vector<TableVersion>> capture_table_versions(
+      const std::shared_ptr<const AbstractLQPNode>& lqp);
+
+  /**
+   * @return the cached result of the LQP if it is valid for a transaction with snapshot_commit_id, nullptr otherwise
+   */
+  std::shared_ptr<const Table> try_get(const std::shared_ptr<const AbstractLQPNode>& lqp,
+                                       const CommitID snapshot_commit_id);
+
+  /**
+   * Caches the result of the LQP, which was executed by a transaction with snapshot_commit_id. table_versions need to
+   * be captured before the execution started, so that concurrent commits are not missed.
+   */
+  void set(const std::shared_ptr<const AbstractLQPNode>& lqp, const std::string& sql,
+           const std::vector<TableVersion>& table_versions, const CommitID snapshot_commit_id,
+           const std::shared_ptr<const Table>& result, const std::chrono::microseconds execution_time);
+
+  void clear();
+
+  /**
+   * @defgroup Statistics
+   * @{
+   */
+  size_t hit_count() const;
+  size_t miss_count() const;
+  std::chrono::microseconds saved_execution_time() const;
+  std::vector<EntryStatistics> entry_statistics() const;
+  /**@}*/
+
+ private:
+  struct Entry {
+    std::string fingerprint;
+    std::shared_ptr<const AbstractLQPNode> lqp;
+    std::string sql;
+    std::vector<TableVersion> table_versions;
+    std::shared_ptr<const Table> result;
+    std::chrono::microseconds execution_time;
+    size_t memory_usage;
+    size_t hit_count;
+  };
+
+  QueryResultCache() = default;
+
+  // A string representation of the LQP, used as hash key. Entries with the same fingerprint are compared with
+  // AbstractLQPNode::find_first_subplan_mismatch() before being served.
+  static std::string _fingerprint(const std::shared_ptr<const AbstractLQPNode>& lqp);
+
+  static bool _is_up_to_date(const Entry& entry);
+
+  void _evict(const std::list<Entry>::iterator& entry_iter);
+  void _evict_until_within_budget();
+
+  mutable std::mutex _mutex;
+
+  std::atomic<size_t> _memory_budget{0};
+  size_t _memory_usage{0};
+
+  // Most recently used entries first
+  std::list<Entry> _entries;
+  std::unordered_map<std::string, std::list<Entry>::iterator> _entries_by_fingerprint;
+
+  size_t _hit_count{0};
+  size_t _miss_count{0};
+  std::chrono::microseconds _saved_execution_time{0};
+};
+
+}  // namespace opossum
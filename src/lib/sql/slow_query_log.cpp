@@ -0,0 +1,155 @@
+#include "slow_query_log.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "json.hpp"
+
+#include "resolve_type.hpp"
+#include "sql/sql_query_plan_explainer.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using opossum::AllTypeVariant;
+
+nlohmann::json to_json(const AllTypeVariant& value) {
+  if (opossum::variant_is_null(value)) return nullptr;
+
+  auto json = nlohmann::json{};
+  opossum::resolve_data_type(opossum::data_type_from_all_type_variant(value), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    json = boost::get<ColumnDataType>(value);
+  });
+  return json;
+}
+
+std::string to_json_line(const opossum::SlowQueryLog::Entry& entry) {
+  const auto timestamp = std::chrono::system_clock::now().time_since_epoch();
+
+  auto json = nlohmann::json{
+      {"timestamp_us", std::chrono::duration_cast<std::chrono::microseconds>(timestamp).count()},
+      {"sql", entry.sql},
+      {"translate_us", entry.translate_time.count()},
+      {"optimize_us", entry.optimize_time.count()},
+      {"compile_us", entry.compile_time.count()},
+      {"execute_us", entry.execution_time.count()},
+      {"total_us",
+       (entry.translate_time + entry.optimize_time + entry.compile_time + entry.execution_time).count()},
+      {"query_plan_cache_hit", entry.query_plan_cache_hit},
+      {"result_cache_hit", entry.result_cache_hit},
+      {"operators", nlohmann::json::array()}};
+
+  const auto column_definitions = opossum::SQLQueryPlanExplainer::column_definitions();
+  for (const auto& row : entry.operators) {
+    auto op = nlohmann::json::object();
+    for (auto column_id = size_t{0}; column_id < row.size(); ++column_id) {
+      op[column_definitions[column_id].name] = to_json(row[column_id]);
+    }
+    json["operators"].push_back(op);
+  }
+
+  return json.dump();
+}
+
+}  // namespace
+
+namespace opossum {
+
+SlowQueryLog& SlowQueryLog::get() {
+  static SlowQueryLog instance;
+  return instance;
+}
+
+SlowQueryLog::~SlowQueryLog() { disable(); }
+
+void SlowQueryLog::enable(const std::string& path, const std::chrono::microseconds threshold,
+                          const size_t queue_capacity) {
+  Assert(!is_enabled(), "SlowQueryLog is already enabled");
+  Assert(queue_capacity > 0, "The queue needs to hold at least one entry");
+
+  _file.open(path, std::ios::app);
+  Assert(_file.is_open(), "Could not open slow query log at " + path);
+
+  _threshold_microseconds = threshold.count();
+  _queue_capacity = queue_capacity;
+  _dropped_entry_count = 0;
+  _shutdown = false;
+  _writer = std::thread(&SlowQueryLog::_write_entries, this);
+
+  _enabled = true;
+}
+
+void SlowQueryLog::disable() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_enabled) return;
+    _enabled = false;
+    _shutdown = true;
+  }
+  _entries_available.notify_one();
+
+  // The writer writes all remaining entries before it stops
+  _writer.join();
+  _file.close();
+}
+
+bool SlowQueryLog::exceeds_threshold(const std::chrono::microseconds duration) const {
+  return is_enabled() && duration.count() >= _threshold_microseconds.load(std::memory_order_relaxed);
+}
+
+void SlowQueryLog::log(Entry entry) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_enabled) return;
+
+    if (_queue.size() >= _queue_capacity) {
+      ++_dropped_entry_count;
+      return;
+    }
+
+    _queue.emplace_back(std::move(entry));
+    ++_pending_entry_count;
+  }
+  _entries_available.notify_one();
+}
+
+void SlowQueryLog::flush() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  _entries_written.wait(lock, [&]() { return _pending_entry_count == 0; });
+}
+
+size_t SlowQueryLog::dropped_entry_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _dropped_entry_count;
+}
+
+void SlowQueryLog::_write_entries() {
+  auto entries = std::deque<Entry>{};
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _entries_available.wait(lock, [&]() { return !_queue.empty() || _shutdown; });
+      if (_queue.empty()) return;
+
+      // Take all queued entries, so that statements can queue new entries while these are written
+      entries.swap(_queue);
+    }
+
+    for (const auto& entry : entries) {
+      _file << to_json_line(entry) << '\n';
+    }
+    _file.flush();
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _pending_entry_count -= entries.size();
+    }
+    _entries_written.notify_all();
+    entries.clear();
+  }
+}
+
+}  // namespace opossum
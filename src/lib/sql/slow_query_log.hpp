@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Logs SQL statements whose execution exceeds a latency threshold to a file, one JSON object per line. Each entry
+ * contains the SQL string, the translate/optimize/compile/execute times of the SQLPipelineStatement, whether the
+ * query plan or the result was served from a cache and the operators of the query plan as returned by
+ * SQLQueryPlanExplainer (i.e., the walltime and row count of each operator).
+ *
+ * Entries are written by a background thread, so that the statement never waits for the file. If the writer falls
+ * behind and the queue is full, new entries are dropped (see dropped_entry_count()) instead of blocking the statement.
+ *
+ * The log is disabled by default. The SQLPipelineStatement logs itself once its result table was created.
+ */
+class SlowQueryLog final : private Noncopyable {
+ public:
+  struct Entry {
+    std::string sql;
+    std::chrono::microseconds translate_time;
+    std::chrono::microseconds optimize_time;
+    std::chrono::microseconds compile_time;
+    std::chrono::microseconds execution_time;
+    bool query_plan_cache_hit;
+    bool result_cache_hit;
+    // The rows of SQLQueryPlanExplainer, empty if no query plan was executed (e.g., for cached results)
+    std::vector<std::vector<AllTypeVariant>> operators;
+  };
+
+  static SlowQueryLog& get();
+
+  static constexpr size_t DEFAULT_QUEUE_CAPACITY = 1024;
+
+  ~SlowQueryLog();
+
+  // Appends to the file at path. Statements that take at least threshold in total are logged.
+  void enable(const std::string& path, const std::chrono::microseconds threshold,
+              const size_t queue_capacity = DEFAULT_QUEUE_CAPACITY);
+
+  // Writes all queued entries and stops the writer thread
+  void disable();
+
+  bool is_enabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+  // False if the log is disabled
+  bool exceeds_threshold(const std::chrono::microseconds duration) const;
+
+  // Queues the entry for writing. Does not check the threshold.
+  void log(Entry entry);
+
+  // Blocks until all queued entries are written to the file
+  void flush();
+
+  // The number of entries that were dropped because the queue was full since the log was enabled
+  size_t dropped_entry_count() const;
+
+ private:
+  SlowQueryLog() = default;
+
+  void _write_entries();
+
+  std::atomic_bool _enabled{false};
+  std::atomic<int64_t> _threshold_microseconds{0};
+  size_t _queue_capacity{DEFAULT_QUEUE_CAPACITY};
+
+  std::ofstream _file;
+  std::thread _writer;
+
+  mutable std::mutex _mutex;
+  // Signals new entries and shutdown to the writer
+  std::condition_variable _entries_available;
+  // Signals the completion of writes to flush()
+  std::condition_variable _entries_written;
+  std::deque<Entry> _queue;
+  // Queued entries plus the entries the writer is currently writing
+  size_t _pending_entry_count{0};
+  size_t _dropped_entry_count{0};
+  bool _shutdown{false};
+};
+
+}  // namespace opossum
@@ -1,5 +1,7 @@
 #include "sql_pipeline.hpp"
 #include <boost/algorithm/string.hpp>
+#include <regex>
+#include <string>
 #include <utility>
 #include "SQLParser.h"
 
@@ -7,25 +9,35 @@ namespace opossum {
 
 SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context,
                          const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
-                         const std::shared_ptr<Optimizer>& optimizer, const PreparedStatementCache& prepared_statements)
+                         const std::shared_ptr<Optimizer>& optimizer, const PreparedStatementCache& prepared_statements,
+                         const std::optional<float>& reoptimization_factor)
     : _transaction_context(transaction_context), _optimizer(optimizer) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
   DebugAssert(!_transaction_context || use_mvcc == UseMvcc::Yes,
               "Transaction context without MVCC enabled makes no sense");
 
+  // The SQL parser does not know EXPLAIN, so the prefix is removed before the statement is parsed
+  static const auto explain_regex = std::regex{"^\\s*EXPLAIN(\\s+ANALYZE)?\\s+", std::regex::icase};
+  auto explain_match = std::smatch{};
+  if (std::regex_search(sql, explain_match, explain_regex)) {
+    _explain_mode = explain_match[1].matched ? ExplainMode::ExplainAnalyze : ExplainMode::Explain;
+  }
+  const auto statements_sql = _explain_mode == ExplainMode::None ? sql : explain_match.suffix().str();
+
   hsql::SQLParserResult parse_result;
   try {
-    hsql::SQLParser::parse(sql, &parse_result);
+    hsql::SQLParser::parse(statements_sql, &parse_result);
   } catch (const std::exception& exception) {
     throw std::runtime_error("Error while parsing SQL query:\n  " + std::string(exception.what()));
   }
 
   if (!parse_result.isValid()) {
-    throw std::runtime_error(SQLPipelineStatement::create_parse_error_message(sql, parse_result));
+    throw std::runtime_error(SQLPipelineStatement::create_parse_error_message(statements_sql, parse_result));
   }
 
   DebugAssert(parse_result.size() > 0, "Cannot create empty SQLPipeline.");
+  Assert(_explain_mode == ExplainMode::None || parse_result.size() == 1, "EXPLAIN only supports a single statement.");
   _sql_pipeline_statements.reserve(parse_result.size());
 
   std::vector<std::shared_ptr<hsql::SQLParserResult>> parsed_statements;
@@ -62,12 +74,14 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
 
     // Get the statement string from the original query string, so we can pass it to the SQLPipelineStatement
     const auto statement_string_length = statement->stringLength;
-    const auto statement_string = boost::trim_copy(sql.substr(sql_string_offset, statement_string_length));
+    const auto statement_string =
+        boost::trim_copy(statements_sql.substr(sql_string_offset, statement_string_length));
     sql_string_offset += statement_string_length;
 
     auto pipeline_statement =
         std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement), use_mvcc,
-                                               transaction_context, lqp_translator, optimizer, prepared_statements);
+                                               transaction_context, lqp_translator, optimizer, prepared_statements,
+                                               reoptimization_factor, _explain_mode);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -204,6 +218,8 @@ size_t SQLPipeline::statement_count() const { return _sql_pipeline_statements.si
 
 bool SQLPipeline::requires_execution() const { return _requires_execution; }
 
+ExplainMode SQLPipeline::explain_mode() const { return _explain_mode; }
+
 std::chrono::microseconds SQLPipeline::translate_time_microseconds() {
   if (_translate_time_microseconds.count() > 0) {
     return _translate_time_microseconds;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "SQLParserResult.h"
 #include "concurrency/transaction_context.hpp"
@@ -35,7 +36,7 @@ class SQLPipeline : public Noncopyable {
   // Prefer using the SQLPipelineBuilder interface for constructing SQLPipelines conveniently
   SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
               const std::shared_ptr<LQPTranslator>& lqp_translator, const std::shared_ptr<Optimizer>& optimizer,
-              const PreparedStatementCache& prepared_statements);
+              const PreparedStatementCache& prepared_statements, const std::optional<float>& reoptimization_factor);
 
   // Returns the SQL string for each statement.
   const std::vector<std::string>& get_sql_strings();
@@ -71,6 +72,9 @@ class SQLPipeline : public Noncopyable {
   // Returns whether the pipeline requires execution to handle all statements
   bool requires_execution() const;
 
+  // Returns whether the SQL string was prefixed with EXPLAIN or EXPLAIN ANALYZE
+  ExplainMode explain_mode() const;
+
   // Returns the entire time for X. Only possible to get this after all statements have been executed or if the
   // pipeline does not require previous execution to compile all statements.
   std::chrono::microseconds translate_time_microseconds();
@@ -103,6 +107,8 @@ class SQLPipeline : public Noncopyable {
   // --> requires execution of first statement before the second one can be translated
   bool _requires_execution{false};
 
+  ExplainMode _explain_mode{ExplainMode::None};
+
   std::shared_ptr<SQLPipelineStatement> _failed_pipeline_statement;
 
   // Execution times
@@ -33,13 +33,19 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_transaction_context(
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_adaptive_reoptimization(const float reoptimization_factor) {
+  _reoptimization_factor = reoptimization_factor;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _prepared_statements};
+  return {_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _prepared_statements,
+          _reoptimization_factor};
 }
 
 SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
@@ -47,7 +53,8 @@ SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql, parsed_sql, _use_mvcc, _transaction_context, lqp_translator, optimizer, _prepared_statements};
+  return {_sql, parsed_sql, _use_mvcc, _transaction_context, lqp_translator, optimizer,
+          _prepared_statements, _reoptimization_factor};
 }
 
 }  // namespace opossum
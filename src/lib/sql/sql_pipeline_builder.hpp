@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
@@ -43,6 +44,12 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_prepared_statement_cache(const PreparedStatementCache& prepared_statements);
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
 
+  /**
+   * Execute SELECT statements with the AdaptiveQueryExecutor, which re-optimizes the remaining joins once an
+   * intermediate result deviates from its estimate by more than @param reoptimization_factor.
+   */
+  SQLPipelineBuilder& with_adaptive_reoptimization(const float reoptimization_factor);
+
   /**
    * Short for with_mvcc(UseMvcc::No)
    */
@@ -64,6 +71,7 @@ class SQLPipelineBuilder final {
   std::shared_ptr<LQPTranslator> _lqp_translator;
   std::shared_ptr<Optimizer> _optimizer;
   PreparedStatementCache _prepared_statements;
+  std::optional<float> _reoptimization_factor;
 };
 
 }  // namespace opossum
@@ -7,11 +7,15 @@
 
 #include "SQLParser.h"
 #include "concurrency/transaction_manager.hpp"
+#include "optimizer/adaptive_query_executor.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/hsql_expr_translator.hpp"
+#include "sql/query_result_cache.hpp"
+#include "sql/slow_query_log.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_query_plan.hpp"
+#include "sql/sql_query_plan_explainer.hpp"
 #include "sql/sql_translator.hpp"
 #include "utils/assert.hpp"
 
@@ -22,13 +26,17 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<TransactionContext>& transaction_context,
                                            const std::shared_ptr<LQPTranslator>& lqp_translator,
                                            const std::shared_ptr<Optimizer>& optimizer,
-                                           const PreparedStatementCache& prepared_statements)
+                                           const PreparedStatementCache& prepared_statements,
+                                           const std::optional<float>& reoptimization_factor,
+                                           const ExplainMode explain_mode)
     : _sql_string(sql),
       _use_mvcc(use_mvcc),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
       _transaction_context(transaction_context),
       _lqp_translator(lqp_translator),
       _optimizer(optimizer),
+      _reoptimization_factor(reoptimization_factor),
+      _explain_mode(explain_mode),
       _parsed_sql_statement(std::move(parsed_sql)),
       _prepared_statements(prepared_statements) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
@@ -224,17 +232,53 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
     return _result_table;
   }
 
-  const auto& tasks = get_tasks();
+  _execute();
+  _log_if_slow();
 
-  const auto started = std::chrono::high_resolution_clock::now();
+  return _result_table;
+}
 
+void SQLPipelineStatement::_execute() {
   const auto* statement = get_parsed_sql_statement()->getStatement(0);
+
+  if (_explain_mode == ExplainMode::Explain) {
+    const auto started = std::chrono::high_resolution_clock::now();
+    get_query_plan();
+
+    if (_auto_commit) {
+      _transaction_context->commit();
+    }
+
+    _create_explain_table();
+
+    const auto done = std::chrono::high_resolution_clock::now();
+    _execution_time_micros = std::chrono::duration_cast<std::chrono::microseconds>(done - started);
+    return;
+  }
+
+  // A cached result has no operators to explain
+  if (statement->isType(hsql::kStmtSelect) && _use_mvcc == UseMvcc::Yes &&
+      QueryResultCache::get().memory_budget() > 0 && _explain_mode == ExplainMode::None) {
+    if (_try_get_cached_result()) return;
+  }
+
+  // Adaptive execution is only possible as long as the query plan has not been created yet
+  if (_reoptimization_factor && statement->isType(hsql::kStmtSelect) && !_query_plan) {
+    _execute_adaptively();
+    _cache_result();
+    if (_explain_mode == ExplainMode::ExplainAnalyze) _create_explain_table();
+    return;
+  }
+
+  const auto& tasks = get_tasks();
+
+  const auto started = std::chrono::high_resolution_clock::now();
   // If this is a PREPARE x FROM ... command, calling get_result_table should not fail but just return
   if (statement->isType(hsql::kStmtPrepare)) {
     _query_has_output = false;
     const auto done = std::chrono::high_resolution_clock::now();
     _execution_time_micros = std::chrono::duration_cast<std::chrono::microseconds>(done - started);
-    return _result_table;
+    return;
   }
 
   CurrentScheduler::schedule_and_wait_for_tasks(tasks);
@@ -250,7 +294,100 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
   _result_table = tasks.back()->get_operator()->get_output();
   if (_result_table == nullptr) _query_has_output = false;
 
-  return _result_table;
+  _cache_result();
+  if (_explain_mode == ExplainMode::ExplainAnalyze) _create_explain_table();
+}
+
+void SQLPipelineStatement::_log_if_slow() const {
+  auto& slow_query_log = SlowQueryLog::get();
+  const auto total_time = _translate_time_micros + _optimize_time_micros + _compile_time_micros + _execution_time_micros;
+  if (!slow_query_log.exceeds_threshold(total_time)) return;
+
+  auto entry = SlowQueryLog::Entry{};
+  entry.sql = _sql_string;
+  entry.translate_time = _translate_time_micros;
+  entry.optimize_time = _optimize_time_micros;
+  entry.compile_time = _compile_time_micros;
+  entry.execution_time = _execution_time_micros;
+  entry.query_plan_cache_hit = _query_plan_cache_hit;
+  entry.result_cache_hit = _result_cache_hit;
+  if (_query_plan) entry.operators = SQLQueryPlanExplainer::explain_rows(*_query_plan);
+
+  slow_query_log.log(std::move(entry));
+}
+
+void SQLPipelineStatement::_create_explain_table() {
+  _result_table = SQLQueryPlanExplainer::explain(*_query_plan);
+  _query_has_output = true;
+}
+
+bool SQLPipelineStatement::_try_get_cached_result() {
+  const auto& lqp = get_optimized_logical_plan();
+
+  if (!_transaction_context) {
+    _transaction_context = TransactionManager::get().new_transaction_context();
+  }
+
+  // Uncommitted modifications of this transaction are not reflected in the cached results
+  if (_transaction_context->has_read_write_operators()) return false;
+
+  const auto started = std::chrono::high_resolution_clock::now();
+
+  _result_cache_table_versions = QueryResultCache::capture_table_versions(lqp);
+  if (!_result_cache_table_versions) return false;
+
+  _result_table = QueryResultCache::get().try_get(lqp, _transaction_context->snapshot_commit_id());
+  if (!_result_table) {
+    // The AdaptiveQueryExecutor modifies the LQP while executing it
+    _result_cache_lqp = _reoptimization_factor ? lqp->deep_copy() : lqp;
+    return false;
+  }
+
+  _result_cache_hit = true;
+
+  if (_auto_commit) {
+    _transaction_context->commit();
+  }
+
+  const auto done = std::chrono::high_resolution_clock::now();
+  _execution_time_micros = std::chrono::duration_cast<std::chrono::microseconds>(done - started);
+
+  return true;
+}
+
+void SQLPipelineStatement::_cache_result() {
+  if (!_result_cache_lqp || !_result_table) return;
+
+  QueryResultCache::get().set(_result_cache_lqp, _sql_string, *_result_cache_table_versions,
+                              _transaction_context->snapshot_commit_id(), _result_table, _execution_time_micros);
+}
+
+void SQLPipelineStatement::_execute_adaptively() {
+  const auto& lqp = get_optimized_logical_plan();
+
+  if (!_transaction_context && _use_mvcc == UseMvcc::Yes) {
+    _transaction_context = TransactionManager::get().new_transaction_context();
+  }
+
+  const auto started = std::chrono::high_resolution_clock::now();
+
+  // Translation is interleaved with execution, so it is accounted for as execution time
+  auto executor = AdaptiveQueryExecutor{_lqp_translator, *_reoptimization_factor, _transaction_context};
+  const auto root = executor.execute(lqp);
+
+  _optimized_logical_plan = executor.executed_lqp();
+  _query_plan = std::make_shared<SQLQueryPlan>();
+  _query_plan->add_tree_by_root(root);
+
+  if (_auto_commit) {
+    _transaction_context->commit();
+  }
+
+  const auto done = std::chrono::high_resolution_clock::now();
+  _execution_time_micros = std::chrono::duration_cast<std::chrono::microseconds>(done - started);
+
+  _result_table = root->get_output();
+  if (_result_table == nullptr) _query_has_output = false;
 }
 
 const std::shared_ptr<TransactionContext>& SQLPipelineStatement::transaction_context() const {
@@ -270,7 +407,9 @@ std::chrono::microseconds SQLPipelineStatement::optimize_time_microseconds() con
 }
 
 std::chrono::microseconds SQLPipelineStatement::compile_time_microseconds() const {
-  Assert(_query_plan != nullptr, "Cannot return compile duration without having created the query plan.");
+  // Results served from the QueryResultCache don't need a query plan
+  Assert(_query_plan != nullptr || _result_cache_hit,
+         "Cannot return compile duration without having created the query plan.");
   return _compile_time_micros;
 }
 
@@ -328,4 +467,13 @@ bool SQLPipelineStatement::query_plan_cache_hit() const {
   DebugAssert(_query_plan != nullptr, "Asking for cache hit before compiling query plan will return undefined result");
   return _query_plan_cache_hit;
 }
+
+bool SQLPipelineStatement::result_cache_hit() const {
+  DebugAssert(_result_table != nullptr || !_query_has_output,
+              "Asking for cache hit before executing the query will return undefined result");
+  return _result_cache_hit;
+}
+
+ExplainMode SQLPipelineStatement::explain_mode() const { return _explain_mode; }
+
 }  // namespace opossum
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <optional>
 #include <string>
 
 #include "SQLParserResult.h"
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "optimizer/optimizer.hpp"
+#include "sql/query_result_cache.hpp"
 #include "sql/sql_query_cache.hpp"
 #include "sql/sql_query_plan.hpp"
 #include "storage/table.hpp"
@@ -14,6 +16,10 @@ namespace opossum {
 
 using PreparedStatementCache = std::shared_ptr<SQLQueryCache<SQLQueryPlan>>;
 
+// EXPLAIN returns the query plan without executing it, EXPLAIN ANALYZE executes the statement and returns the query
+// plan with the runtime statistics of each operator instead of the statement's result (see SQLQueryPlanExplainer)
+enum class ExplainMode { None, Explain, ExplainAnalyze };
+
 /**
  * This is the unified interface to handle SQL queries and related operations.
  * This should rarely be used directly - use SQLPipeline instead, as it creates the correct SQLPipelineStatement(s).
@@ -35,7 +41,9 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<TransactionContext>& transaction_context,
                        const std::shared_ptr<LQPTranslator>& lqp_translator,
-                       const std::shared_ptr<Optimizer>& optimizer, const PreparedStatementCache& prepared_statements);
+                       const std::shared_ptr<Optimizer>& optimizer, const PreparedStatementCache& prepared_statements,
+                       const std::optional<float>& reoptimization_factor = std::nullopt,
+                       const ExplainMode explain_mode = ExplainMode::None);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -55,7 +63,8 @@ class SQLPipelineStatement : public Noncopyable {
   // Returns all task sets that need to be executed for this query.
   const std::vector<std::shared_ptr<OperatorTask>>& get_tasks();
 
-  // Executes all tasks, waits for them to finish, and returns the resulting table.
+  // Executes all tasks, waits for them to finish, and returns the resulting table. Logs the statement to the
+  // SlowQueryLog if it exceeded the threshold.
   const std::shared_ptr<const Table>& get_result_table();
 
   // Returns the TransactionContext that was either passed to or created by the SQLPipelineStatement.
@@ -73,10 +82,31 @@ class SQLPipelineStatement : public Noncopyable {
 
   bool query_plan_cache_hit() const;
 
+  // Whether the result was served from the QueryResultCache. The execution time then only covers the lookup.
+  bool result_cache_hit() const;
+
+  ExplainMode explain_mode() const;
+
   // Helper function to create a pretty print error message after an invalid SQL parse
   static std::string create_parse_error_message(const std::string& sql, const hsql::SQLParserResult& result);
 
  private:
+  // Creates the result table, see get_result_table()
+  void _execute();
+
+  // Queues this statement in the SlowQueryLog if the sum of all pipeline steps exceeds its threshold
+  void _log_if_slow() const;
+
+  // Executes the optimized LQP with the AdaptiveQueryExecutor, bypassing the query plan cache
+  void _execute_adaptively();
+
+  // Looks up the result in the QueryResultCache and prepares caching it after execution if it is not found
+  bool _try_get_cached_result();
+  void _cache_result();
+
+  // Replaces the result table with the explained query plan
+  void _create_explain_table();
+
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
 
@@ -91,6 +121,11 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<Optimizer> _optimizer;
 
+  // If set, SELECT statements are executed by the AdaptiveQueryExecutor
+  const std::optional<float> _reoptimization_factor;
+
+  const ExplainMode _explain_mode;
+
   // Execution results
   std::shared_ptr<hsql::SQLParserResult> _parsed_sql_statement;
   std::shared_ptr<AbstractLQPNode> _unoptimized_logical_plan;
@@ -102,6 +137,11 @@ class SQLPipelineStatement : public Noncopyable {
   bool _query_has_output = true;
   bool _query_plan_cache_hit = false;
 
+  // Only set if the result can be cached, see _try_get_cached_result()
+  std::shared_ptr<AbstractLQPNode> _result_cache_lqp;
+  std::optional<std::vector<QueryResultCache::TableVersion>> _result_cache_table_versions;
+  bool _result_cache_hit = false;
+
   // Execution times
   std::chrono::microseconds _translate_time_micros{};
   std::chrono::microseconds _optimize_time_micros{};
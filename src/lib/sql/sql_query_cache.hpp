@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -45,8 +46,10 @@ class SQLQueryCache {
 
     std::lock_guard<std::mutex> lock(_mutex);
     if (!_cache->has(query)) {
+      ++_miss_count;
       return {};
     }
+    ++_hit_count;
     return _cache->get(query);
   }
 
@@ -60,13 +63,21 @@ class SQLQueryCache {
     return _cache->get(query);
   }
 
-  // Purges all entries from the cache.
-  void clear() { _cache->clear(); }
+  // Purges all entries from the cache and resets the hit and miss counts.
+  void clear() {
+    _cache->clear();
+    _hit_count = 0;
+    _miss_count = 0;
+  }
 
   void resize(size_t capacity) { _cache->resize(capacity); }
 
   size_t size() const { return _cache->size(); }
 
+  // The number of lookups by try_get() that found or did not find an entry
+  size_t hit_count() const { return _hit_count; }
+  size_t miss_count() const { return _miss_count; }
+
   // Returns a reference to the underlying cache.
   AbstractCache<Key, Value>& cache() { return *_cache; }
 
@@ -82,6 +93,9 @@ class SQLQueryCache {
   std::unique_ptr<AbstractCache<Key, Value>> _cache;
 
   std::mutex _mutex;
+
+  std::atomic<size_t> _hit_count{0};
+  std::atomic<size_t> _miss_count{0};
 };
 
 }  // namespace opossum
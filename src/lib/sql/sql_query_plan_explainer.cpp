@@ -0,0 +1,91 @@
+#include "sql_query_plan_explainer.hpp"
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "sql/sql_query_plan.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+void explain_operator(const std::shared_ptr<const AbstractOperator>& op, const size_t depth,
+                      std::unordered_set<std::shared_ptr<const AbstractOperator>>& visited_operators,
+                      std::vector<std::vector<AllTypeVariant>>& rows) {
+  if (!op || !visited_operators.emplace(op).second) return;
+
+  std::vector<AllTypeVariant> row;
+  row.emplace_back(static_cast<int32_t>(rows.size()));
+  row.emplace_back(std::string(depth * 2, ' ') + op->description(DescriptionMode::SingleLine));
+
+  auto estimated_row_count = NULL_VALUE;
+  if (const auto lqp_node = op->lqp_node()) {
+    // Statistics are computed lazily, which requires a mutable node
+    try {
+      const auto statistics = std::const_pointer_cast<AbstractLQPNode>(lqp_node)->get_statistics();
+      estimated_row_count = static_cast<int64_t>(statistics->row_count());
+    } catch (const std::exception&) {
+      // Not all nodes support estimating their output, leave the estimate empty
+    }
+  }
+  row.emplace_back(estimated_row_count);
+
+  if (const auto output = op->get_output()) {
+    const auto& performance_data = op->base_performance_data();
+    row.emplace_back(static_cast<int64_t>(output->row_count()));
+    row.emplace_back(static_cast<int64_t>(performance_data.walltime.count()));
+    row.emplace_back(static_cast<int64_t>(output->estimate_memory_usage()));
+    row.emplace_back(static_cast<int64_t>(performance_data.chunks_scanned));
+    row.emplace_back(static_cast<int64_t>(performance_data.chunks_pruned));
+    row.emplace_back(static_cast<int64_t>(performance_data.job_task_count));
+  } else {
+    row.insert(row.end(), 6u, NULL_VALUE);
+  }
+
+  rows.emplace_back(std::move(row));
+
+  explain_operator(op->input_left(), depth + 1, visited_operators, rows);
+  explain_operator(op->input_right(), depth + 1, visited_operators, rows);
+}
+
+}  // namespace
+
+std::shared_ptr<Table> SQLQueryPlanExplainer::explain(const SQLQueryPlan& query_plan) {
+  auto table = std::make_shared<Table>(column_definitions(), TableType::Data);
+  for (auto& row : explain_rows(query_plan)) {
+    table->append(std::move(row));
+  }
+  return table;
+}
+
+TableColumnDefinitions SQLQueryPlanExplainer::column_definitions() {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("id", DataType::Int);
+  column_definitions.emplace_back("operator", DataType::String);
+  column_definitions.emplace_back("estimated_rows", DataType::Long, true);
+  column_definitions.emplace_back("actual_rows", DataType::Long, true);
+  column_definitions.emplace_back("walltime_us", DataType::Long, true);
+  column_definitions.emplace_back("output_bytes", DataType::Long, true);
+  column_definitions.emplace_back("chunks_scanned", DataType::Long, true);
+  column_definitions.emplace_back("chunks_pruned", DataType::Long, true);
+  column_definitions.emplace_back("job_tasks", DataType::Long, true);
+  return column_definitions;
+}
+
+std::vector<std::vector<AllTypeVariant>> SQLQueryPlanExplainer::explain_rows(const SQLQueryPlan& query_plan) {
+  std::vector<std::vector<AllTypeVariant>> rows;
+  std::unordered_set<std::shared_ptr<const AbstractOperator>> visited_operators;
+  for (const auto& root : query_plan.tree_roots()) {
+    explain_operator(root, 0u, visited_operators, rows);
+  }
+  return rows;
+}
+
+}  // namespace opossum
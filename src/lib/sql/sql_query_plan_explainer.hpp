@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/table_column_definition.hpp"
+
+namespace opossum {
+
+class SQLQueryPlan;
+class Table;
+
+/**
+ * Creates the result table of EXPLAIN and EXPLAIN ANALYZE. Each row describes one operator of the plan, starting at
+ * the roots and indenting inputs below the operator that consumes them. Operators with multiple consumers are only
+ * listed once.
+ *
+ * The estimated row count is taken from the statistics of the LQP node the operator was translated from (NULL if the
+ * operator has none). The actual row count, the walltime, the output size, the scanned and pruned chunks and the
+ * number of JobTasks are only set for operators that were executed, i.e., they are NULL for EXPLAIN.
+ */
+class SQLQueryPlanExplainer {
+ public:
+  static std::shared_ptr<Table> explain(const SQLQueryPlan& query_plan);
+
+  // The columns and rows of the table created by explain(), e.g., for logging them without creating a table
+  static TableColumnDefinitions column_definitions();
+  static std::vector<std::vector<AllTypeVariant>> explain_rows(const SQLQueryPlan& query_plan);
+};
+
+}  // namespace opossum
@@ -10,6 +10,7 @@
 
 #include "abstract_expression.hpp"
 #include "constant_mappings.hpp"
+#include "logical_type.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/create_view_node.hpp"
@@ -20,6 +21,7 @@
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/limit_node.hpp"
 #include "logical_query_plan/lqp_expression.hpp"
+#include "logical_query_plan/meta_table_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/projection_node.hpp"
 #include "logical_query_plan/show_columns_node.hpp"
@@ -30,6 +32,7 @@
 #include "logical_query_plan/update_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
 #include "sql/hsql_expr_translator.hpp"
+#include "storage/meta_table_manager.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -87,6 +90,15 @@ PredicateCondition get_predicate_condition_for_reverse_order(const PredicateCond
   return predicate_condition;
 }
 
+LogicalType logical_type_of_column(const LQPColumnReference& column_reference) {
+  // Literals are only converted for columns of stored tables, not for computed columns
+  const auto stored_table_node = std::dynamic_pointer_cast<const StoredTableNode>(column_reference.original_node());
+  if (!stored_table_node) return {};
+
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name());
+  return table->column_logical_type(column_reference.original_column_id());
+}
+
 JoinMode translate_join_type_to_join_mode(const hsql::JoinType join_type) {
   static const std::unordered_map<const hsql::JoinType, const JoinMode> join_type_to_mode = {
       {hsql::kJoinInner, JoinMode::Inner}, {hsql::kJoinFull, JoinMode::Outer},      {hsql::kJoinLeft, JoinMode::Left},
@@ -148,9 +160,15 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_insert(const hsql::In
     current_result_node = DummyTableNode::make();
   }
 
-  // Lambda to compare a DataType to the type of an hqsl::Expr
-  auto literal_matches_data_type = [](const hsql::Expr& expr, const DataType& column_type) {
-    switch (column_type) {
+  // Lambda to compare the type of a column to the type of an hqsl::Expr
+  auto literal_matches_column_type = [&](const hsql::Expr& expr, const ColumnID column_id) {
+    // Literals for DATE and DECIMAL columns are converted by translate_value()
+    if (target_table->column_logical_type(column_id).kind != LogicalType::Kind::None) {
+      return expr.isType(hsql::kExprLiteralString) || expr.isType(hsql::kExprLiteralInt) ||
+             expr.isType(hsql::kExprLiteralFloat);
+    }
+
+    switch (target_table->column_data_type(column_id)) {
       case DataType::Int:
         return expr.isType(hsql::kExprLiteralInt);
       case DataType::Long:
@@ -168,25 +186,32 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_insert(const hsql::In
     }
   };
 
-  // Lambda to compare a vector of DataType to the types of a vector of hqsl::Expr
-  auto data_types_match_expr_types = [&](const std::vector<DataType>& data_types,
-                                         const std::vector<hsql::Expr*>& expressions) {
-    auto data_types_it = data_types.begin();
-    auto expressions_it = expressions.begin();
-
-    while (data_types_it != data_types.end() && expressions_it != expressions.end()) {
-      if (!literal_matches_data_type(*(*expressions_it), *data_types_it) &&
-          !(*expressions_it)->isType(hsql::kExprParameter)) {
-        // if this is a PreparedStatement, we don't have a mismatch
+  // Lambda to compare the types of all columns to the types of a vector of hqsl::Expr
+  auto column_types_match_expr_types = [&](const std::vector<hsql::Expr*>& expressions) {
+    for (auto column_id = ColumnID{0}; column_id < target_table->column_count() && column_id < expressions.size();
+         ++column_id) {
+      // if this is a PreparedStatement, we don't have a mismatch
+      if (!literal_matches_column_type(*expressions[column_id], column_id) &&
+          !expressions[column_id]->isType(hsql::kExprParameter)) {
         return false;
       }
-      data_types_it++;
-      expressions_it++;
     }
 
     return true;
   };
 
+  // Lambda to translate a value to insert into a column, converting literals to the integers DATE and DECIMAL columns
+  // store
+  auto translate_value = [&](const hsql::Expr& expr, const ColumnID column_id) {
+    auto expression = HSQLExprTranslator::to_lqp_expression(expr, nullptr);
+
+    const auto& logical_type = target_table->column_logical_type(column_id);
+    if (logical_type.kind != LogicalType::Kind::None && expression->type() == ExpressionType::Literal) {
+      expression = LQPExpression::create_literal(logical_type.encode(expression->value()));
+    }
+    return expression;
+  };
+
   if (!insert.columns) {
     // No column order given. Assuming all columns in regular order.
     // For SELECT ... INTO we are basically done because can use the above node as input.
@@ -194,11 +219,18 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_insert(const hsql::In
     if (insert.type == hsql::kInsertValues) {
       DebugAssert(insert.values != nullptr, "Insert: no values given");
 
-      Assert(data_types_match_expr_types(target_table->column_data_types(), *insert.values),
-             "Insert: Column type mismatch");
+      Assert(column_types_match_expr_types(*insert.values), "Insert: Column type mismatch");
+      Assert(insert.values->size() == target_table->column_count(), "Insert: Column count mismatch");
 
-      // In the case of INSERT ... VALUES (...), simply create a
-      current_result_node = _translate_projection(*insert.values, current_result_node);
+      // In the case of INSERT ... VALUES (...), simply create a projection of the values
+      auto projections = std::vector<std::shared_ptr<LQPExpression>>{};
+      for (auto column_id = ColumnID{0}; column_id < target_table->column_count(); ++column_id) {
+        projections.emplace_back(translate_value(*(*insert.values)[column_id], column_id));
+      }
+
+      auto projection_node = ProjectionNode::make(projections);
+      projection_node->set_left_input(current_result_node);
+      current_result_node = projection_node;
     }
 
     Assert(current_result_node->output_column_count() == target_table->column_count(), "Insert: Column count mismatch");
@@ -219,10 +251,9 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_insert(const hsql::In
         // when inserting values, simply translate the literal expression
         const auto& hsql_expr = *(*insert.values)[insert_column_index];
 
-        Assert(literal_matches_data_type(hsql_expr, target_table->column_data_types()[column_id]),
-               "Insert: Column type mismatch");
+        Assert(literal_matches_column_type(hsql_expr, column_id), "Insert: Column type mismatch");
 
-        projections[column_id] = HSQLExprTranslator::to_lqp_expression(hsql_expr, nullptr);
+        projections[column_id] = translate_value(hsql_expr, column_id);
       } else {
         DebugAssert(insert.type == hsql::kInsertSelect, "Unexpected Insert type");
         DebugAssert(insert_column_index < current_result_node->output_column_count(), "ColumnID out of range");
@@ -287,6 +318,13 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_update(const hsql::Up
     const auto column_id = current_values_node->get_output_column_id(column_reference);
 
     auto expr = HSQLExprTranslator::to_lqp_expression(*sql_expr->value, current_values_node);
+
+    // Literals for DATE and DECIMAL columns are converted to the integers these columns store
+    const auto logical_type = logical_type_of_column(column_reference);
+    if (logical_type.kind != LogicalType::Kind::None && expr->type() == ExpressionType::Literal) {
+      expr = LQPExpression::create_literal(logical_type.encode(expr->value()));
+    }
+
     update_expressions[column_id] = expr;
   }
 
@@ -302,7 +340,7 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_select(const hsql::Se
   // 2. WHERE clause
   // 3. GROUP BY clause
   // 4. HAVING clause
-  // 5. SELECT clause
+  // 5. SELECT clause (incl. DISTINCT)
   // 6. UNION clause
   // 7. ORDER BY clause
   // 8. LIMIT clause
@@ -316,8 +354,6 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_select(const hsql::Se
   DebugAssert(select.selectList != nullptr, "SELECT list needs to exist");
   DebugAssert(!select.selectList->empty(), "SELECT list needs to have entries");
 
-  Assert(!select.selectDistinct, "DISTINCT is not yet supported");
-
   // If the query has a GROUP BY clause or if it has aggregates, we do not need a top-level projection
   // because all elements must either be aggregate functions or columns of the GROUP BY clause,
   // so the Aggregate operator will handle them.
@@ -338,6 +374,10 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_select(const hsql::Se
     current_result_node = _translate_projection(*select.selectList, current_result_node);
   }
 
+  if (select.selectDistinct) {
+    current_result_node = _translate_distinct(current_result_node);
+  }
+
   Assert(select.unionSelect == nullptr, "Set operations (UNION/INTERSECT/...) are not supported yet");
 
   if (select.order != nullptr) {
@@ -626,7 +666,10 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_table_ref(const hsql:
   std::shared_ptr<AbstractLQPNode> node;
   switch (table.type) {
     case hsql::kTableName:
-      if (StorageManager::get().has_table(table.name)) {
+      if (MetaTableManager::is_meta_table_name(table.name)) {
+        // Meta tables are generated on demand and contain no MVCC data, so they are not validated
+        node = MetaTableNode::make(table.name);
+      } else if (StorageManager::get().has_table(table.name)) {
         /**
          * Make sure the ALIAS is applied to the StoredTableNode and not the ValidateNode
          */
@@ -1021,6 +1064,16 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_limit(const hsql::Lim
   return limit_node;
 }
 
+std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_distinct(
+    const std::shared_ptr<AbstractLQPNode>& input_node) {
+  // An aggregation that groups by all columns and has no aggregate functions. The LQPTranslator turns it into a
+  // Distinct operator.
+  auto aggregate_node =
+      AggregateNode::make(std::vector<std::shared_ptr<LQPExpression>>{}, input_node->output_column_references());
+  aggregate_node->set_left_input(input_node);
+  return aggregate_node;
+}
+
 std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_predicate(
     const hsql::Expr& hsql_expr, bool allow_function_columns,
     const std::function<LQPColumnReference(const hsql::Expr&)>& resolve_column,
@@ -1220,6 +1273,50 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_predicate(
     value = HSQLExprTranslator::to_all_parameter_variant(*value_ref_hsql_expr);
   }
 
+  // Literals compared to DATE and DECIMAL columns are converted to the integers the columns store, e.g., for
+  // `o_orderdate < '1995-03-15'`
+  const auto logical_type = logical_type_of_column(column_id);
+  if (logical_type.kind != LogicalType::Kind::None && value2) {
+    // The upper bound of a BETWEEN is rounded down, the lower bound up (see below)
+    value2 = logical_type.encode(*value2, LogicalType::Rounding::Floor);
+  }
+  if (logical_type.kind != LogicalType::Kind::None && is_variant(value)) {
+    const auto floor = logical_type.encode(boost::get<AllTypeVariant>(value), LogicalType::Rounding::Floor);
+    const auto ceil = logical_type.encode(boost::get<AllTypeVariant>(value), LogicalType::Rounding::Ceil);
+    value = floor;
+
+    // A DECIMAL literal with more decimal places than the column lies between two stored values. The comparison is
+    // adjusted to select the same rows, e.g., `price < 1.234` becomes `price <= 1.23`.
+    if (floor != ceil) {
+      switch (predicate_condition) {
+        case PredicateCondition::LessThan:
+        case PredicateCondition::LessThanEquals:
+          predicate_condition = PredicateCondition::LessThanEquals;
+          break;
+        case PredicateCondition::GreaterThan:
+        case PredicateCondition::GreaterThanEquals:
+          predicate_condition = PredicateCondition::GreaterThanEquals;
+          value = ceil;
+          break;
+        case PredicateCondition::Equals:
+          // No stored value is equal, so ceil <= x <= floor selects no row
+          predicate_condition = PredicateCondition::Between;
+          value = ceil;
+          value2 = floor;
+          break;
+        case PredicateCondition::NotEquals:
+          predicate_condition = PredicateCondition::IsNotNull;
+          value = NULL_VALUE;
+          break;
+        case PredicateCondition::Between:
+          value = ceil;
+          break;
+        default:
+          Fail("Unexpected predicate condition for a DECIMAL literal");
+      }
+    }
+  }
+
   auto predicate_node = PredicateNode::make(column_id, predicate_condition, value, value2);
   predicate_node->set_left_input(current_node);
 
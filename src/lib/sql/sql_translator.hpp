@@ -82,6 +82,8 @@ class SQLTranslator final : public Noncopyable {
   std::shared_ptr<AbstractLQPNode> _translate_projection(const std::vector<hsql::Expr*>& select_list,
                                                          const std::shared_ptr<AbstractLQPNode>& input_node);
 
+  std::shared_ptr<AbstractLQPNode> _translate_distinct(const std::shared_ptr<AbstractLQPNode>& input_node);
+
   std::shared_ptr<AbstractLQPNode> _translate_order_by(const std::vector<hsql::OrderDescription*>& order_list,
                                                        const std::shared_ptr<AbstractLQPNode>& input_node);
 
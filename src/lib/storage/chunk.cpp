@@ -14,6 +14,8 @@
 #include "resolve_type.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "utils/assert.hpp"
+#include "utils/numa_memory_resource.hpp"
+#include "value_deltas.hpp"
 
 namespace opossum {
 
@@ -33,6 +35,7 @@ Chunk::Chunk(const ChunkColumns& columns, std::shared_ptr<MvccColumns> mvcc_colu
 #endif
 
   if (alloc) _alloc = *alloc;
+  if (_mvcc_columns) _value_deltas = std::make_shared<ValueDeltas>();
 }
 
 bool Chunk::is_mutable() const {
@@ -95,6 +98,35 @@ SharedScopedLockingPtr<const MvccColumns> Chunk::mvcc_columns() const {
   return {*_mvcc_columns, _mvcc_columns->_mutex};
 }
 
+std::shared_ptr<ValueDeltas> Chunk::value_deltas() { return _value_deltas; }
+
+std::shared_ptr<const ValueDeltas> Chunk::value_deltas() const { return _value_deltas; }
+
+std::shared_ptr<Chunk> Chunk::copy_with_columns(const ChunkColumns& columns) const {
+  DebugAssert(columns.size() == _columns.size(), "Chunk copies need to have the same columns");
+
+  auto copy = std::make_shared<Chunk>(columns, _mvcc_columns, _alloc, _access_counter);
+  copy->_value_deltas = _value_deltas;
+  copy->_indices = _indices;
+  return copy;
+}
+
+std::shared_ptr<Chunk> Chunk::copy_using_memory_source(boost::container::pmr::memory_resource* memory_source) const {
+  const auto alloc = PolymorphicAllocator<size_t>(memory_source);
+
+  ChunkColumns columns(alloc);
+  for (ColumnID column_id{0}; column_id < _columns.size(); ++column_id) {
+    columns.push_back(get_column(column_id)->copy_using_allocator(alloc));
+  }
+
+  auto copy = copy_with_columns(columns);
+  copy->_alloc = alloc;
+
+  // The indices refer to the columns of this chunk and would not be found for the copied columns
+  copy->_indices.clear();
+  return copy;
+}
+
 std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(
     const std::vector<std::shared_ptr<const BaseColumn>>& columns) const {
   auto result = std::vector<std::shared_ptr<BaseIndex>>();
@@ -165,6 +197,15 @@ void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
 
 const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const { return _alloc; }
 
+NodeID Chunk::node_id() const {
+  const auto memory_resource = dynamic_cast<const NUMAMemoryResource*>(_alloc.resource());
+  if (!memory_resource || memory_resource->get_node_id() == NUMAMemoryResource::UNDEFINED_NODE_ID) {
+    return CURRENT_NODE_ID;
+  }
+
+  return NodeID{static_cast<NodeID::base_type>(memory_resource->get_node_id())};
+}
+
 size_t Chunk::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
 
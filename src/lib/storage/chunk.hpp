@@ -28,6 +28,7 @@ namespace opossum {
 class BaseIndex;
 class BaseColumn;
 class ChunkStatistics;
+class ValueDeltas;
 
 using ChunkColumns = pmr_vector<std::shared_ptr<BaseColumn>>;
 
@@ -92,6 +93,24 @@ class Chunk : private Noncopyable {
   SharedScopedLockingPtr<MvccColumns> mvcc_columns();
   SharedScopedLockingPtr<const MvccColumns> mvcc_columns() const;
 
+  // The versions of values written by in-place updates (see ValueDeltas). nullptr if the chunk has no MvccColumns.
+  std::shared_ptr<ValueDeltas> value_deltas();
+  std::shared_ptr<const ValueDeltas> value_deltas() const;
+
+  /**
+   * Returns a chunk with the given columns that shares everything else, i.e., the MvccColumns, ValueDeltas, indices,
+   * allocator and access counter, with this chunk. Used to provide transactions with the versions of the values they
+   * see (see create_table_with_visible_values()). The indices must not cover any of the replaced columns.
+   */
+  std::shared_ptr<Chunk> copy_with_columns(const ChunkColumns& columns) const;
+
+  /**
+   * Returns a copy of this chunk whose columns are copied using the given memory source. Everything else except the
+   * indices, which refer to the columns of this chunk, is shared as in copy_with_columns(). Used to replicate chunks on
+   * the NUMA nodes (see TablePlacement).
+   */
+  std::shared_ptr<Chunk> copy_using_memory_source(boost::container::pmr::memory_resource* memory_source) const;
+
   std::vector<std::shared_ptr<BaseIndex>> get_indices(
       const std::vector<std::shared_ptr<const BaseColumn>>& columns) const;
   std::vector<std::shared_ptr<BaseIndex>> get_indices(const std::vector<ColumnID> column_ids) const;
@@ -132,6 +151,13 @@ class Chunk : private Noncopyable {
 
   const PolymorphicAllocator<Chunk>& get_allocator() const;
 
+  /**
+   * Returns the NUMA node the chunk was placed on (see migrate()), or CURRENT_NODE_ID if its memory is not bound to a
+   * node. Operators use it to schedule the jobs that process the chunk on a worker of that node. Chunks of reference
+   * tables created by the TableScan share the allocator of the chunk they reference and return the same node.
+   */
+  NodeID node_id() const;
+
   std::shared_ptr<ChunkStatistics> statistics() const;
 
   void set_statistics(std::shared_ptr<ChunkStatistics> statistics);
@@ -148,6 +174,7 @@ class Chunk : private Noncopyable {
   PolymorphicAllocator<Chunk> _alloc;
   ChunkColumns _columns;
   std::shared_ptr<MvccColumns> _mvcc_columns;
+  std::shared_ptr<ValueDeltas> _value_deltas;
   std::shared_ptr<ChunkAccessCounter> _access_counter;
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
   std::shared_ptr<ChunkStatistics> _statistics;
@@ -11,4 +11,18 @@ uint64_t ChunkAccessCounter::history_sample(size_t lookback) const {
   return last - prelast;
 }
 
+uint64_t ChunkAccessCounter::counter() const {
+  auto sum = uint64_t{0};
+  for (const auto& shard : _shards) {
+    sum += shard.value.load(std::memory_order_relaxed);
+  }
+  return sum;
+}
+
+size_t ChunkAccessCounter::_shard_index() {
+  static std::atomic<size_t> next_shard_index{0};
+  thread_local const auto shard_index = next_shard_index++ % SHARD_COUNT;
+  return shard_index;
+}
+
 }  // namespace opossum
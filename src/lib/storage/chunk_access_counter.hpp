@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 
 #include "types.hpp"
@@ -11,33 +12,49 @@ namespace opossum {
  *
  * The chunk access times are tracked using ProxyChunk objects
  * that measure the cycles they were in scope using the RDTSC instructions.
+ * Only a sample of the accesses is timed (see ProxyChunk).
  * The access times are added to a counter. The ChunkMetricCollection tasks
  * is regularly scheduled by the NUMAPlacementManager. This tasks takes a snapshot
  * of the current counter values and places them in a history. The history is
  * stored in a ring buffer, so that only a limited number of history items are
  * preserved.
+ *
+ * Hot chunks are accessed by all workers at the same time. To avoid that they
+ * contend for a single cache line, the counter is split into shards that are
+ * assigned to the threads round robin. The shards are only summed up when the
+ * counter is read.
  */
 struct ChunkAccessCounter {
   friend class Chunk;
 
  public:
+  static constexpr size_t SHARD_COUNT = 16;
+
   explicit ChunkAccessCounter(const PolymorphicAllocator<uint64_t>& alloc) : _history(_capacity, alloc) {}
 
-  void increment() { _counter++; }
-  void increment(uint64_t value) { _counter.fetch_add(value); }
+  void increment() { increment(1); }
+  void increment(uint64_t value) { _shards[_shard_index()].value.fetch_add(value, std::memory_order_relaxed); }
 
   // Takes a snapshot of the current counter and adds it to the history
-  void process() { _history.push_back(_counter); }
+  void process() { _history.push_back(counter()); }
 
   // Returns the access time of the chunk during the specified number of
   // recent history sample iterations.
   uint64_t history_sample(size_t lookback) const;
 
-  uint64_t counter() const { return _counter; }
+  uint64_t counter() const;
 
  private:
+  // Each shard has its own cache line
+  struct alignas(64) Shard {
+    std::atomic<uint64_t> value{0};
+  };
+
+  // The shard of the calling thread
+  static size_t _shard_index();
+
   const size_t _capacity = 100;
-  std::atomic<std::uint64_t> _counter{0};
+  std::array<Shard, SHARD_COUNT> _shards;
   pmr_ring_buffer<uint64_t> _history;
 };
 
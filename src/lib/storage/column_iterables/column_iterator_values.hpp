@@ -3,6 +3,7 @@
 #include <boost/blank.hpp>
 
 #include <cstddef>
+#include <string>
 
 #include "types.hpp"
 
@@ -47,6 +48,8 @@ class ColumnIteratorValue : public AbstractColumnIteratorValue<T> {
   ColumnIteratorValue(const T& value, const bool null_value, const ChunkOffset& chunk_offset)
       : _value{value}, _null_value{null_value}, _chunk_offset{chunk_offset} {}
 
+  static ColumnIteratorValue null(const ChunkOffset& chunk_offset) { return {T{}, true, chunk_offset}; }
+
   const T& value() const final { return _value; }
   bool is_null() const final { return _null_value; }
   const ChunkOffset& chunk_offset() const final { return _chunk_offset; }
@@ -57,6 +60,37 @@ class ColumnIteratorValue : public AbstractColumnIteratorValue<T> {
   const ChunkOffset _chunk_offset;
 };
 
+/**
+ * @brief Column iterator value of string columns
+ *
+ * Instead of a copy, the value holds a reference to the string in the column
+ * (e.g., the dictionary entry), so that iterating over a string column does not
+ * allocate. Consumers can keep a std::string_view of value() as long as the
+ * column exists. Because of this, it cannot be constructed from a temporary.
+ */
+template <>
+class ColumnIteratorValue<std::string> : public AbstractColumnIteratorValue<std::string> {
+ public:
+  ColumnIteratorValue(const std::string& value, const bool null_value, const ChunkOffset& chunk_offset)
+      : _value{&value}, _null_value{null_value}, _chunk_offset{chunk_offset} {}
+
+  ColumnIteratorValue(std::string&& value, const bool null_value, const ChunkOffset& chunk_offset) = delete;
+
+  static ColumnIteratorValue null(const ChunkOffset& chunk_offset) {
+    static const auto empty_string = std::string{};
+    return {empty_string, true, chunk_offset};
+  }
+
+  const std::string& value() const final { return *_value; }
+  bool is_null() const final { return _null_value; }
+  const ChunkOffset& chunk_offset() const final { return _chunk_offset; }
+
+ private:
+  const std::string* const _value;
+  const bool _null_value;
+  const ChunkOffset _chunk_offset;
+};
+
 /**
  * @brief Column iterator value which is never null.
  *
@@ -77,6 +111,24 @@ class NonNullColumnIteratorValue : public AbstractColumnIteratorValue<T> {
   const ChunkOffset _chunk_offset;
 };
 
+// Refers to the string in the column, see ColumnIteratorValue<std::string>
+template <>
+class NonNullColumnIteratorValue<std::string> : public AbstractColumnIteratorValue<std::string> {
+ public:
+  NonNullColumnIteratorValue(const std::string& value, const ChunkOffset& chunk_offset)
+      : _value{&value}, _chunk_offset{chunk_offset} {}
+
+  NonNullColumnIteratorValue(std::string&& value, const ChunkOffset& chunk_offset) = delete;
+
+  const std::string& value() const final { return *_value; }
+  bool is_null() const final { return false; }
+  const ChunkOffset& chunk_offset() const final { return _chunk_offset; }
+
+ private:
+  const std::string* const _value;
+  const ChunkOffset _chunk_offset;
+};
+
 /**
  * @brief Column iterator value without value information
  *
@@ -0,0 +1,33 @@
+#include "delta_merge_manager.hpp"
+
+#include <memory>
+#include <string>
+
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/delta_merge_task.hpp"
+
+namespace opossum {
+
+DeltaMergeManager::DeltaMergeManager(const Options& options) : _options(options) {
+  _merge_thread =
+      std::make_unique<PausableLoopThread>(_options.merge_interval, [this](size_t) { merge_all_tables(); });
+}
+
+void DeltaMergeManager::resume() { _merge_thread->resume(); }
+
+void DeltaMergeManager::pause() { _merge_thread->pause(); }
+
+void DeltaMergeManager::merge_all_tables() {
+  auto& storage_manager = StorageManager::get();
+
+  for (const auto& table_name : storage_manager.table_names()) {
+    // Materialized views track the positions of their rows (see MaterializedView), which a rebuild would change
+    if (storage_manager.has_materialized_view(table_name) || !storage_manager.has_table(table_name)) continue;
+    if (storage_manager.get_table(table_name)->has_mvcc() == UseMvcc::No) continue;
+
+    DeltaMergeTask(table_name, _options.invalid_row_share).execute();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+// The DeltaMergeManager periodically merges the delta of all stored tables with MVCC columns into their main (see
+// DeltaMergeTask). Like the NUMAPlacementManager, it is created in a paused state and needs to be `resumed` to start
+// its operation.
+class DeltaMergeManager {
+ public:
+  struct Options {
+    Options() : merge_interval(std::chrono::seconds(1)), invalid_row_share(0.5f) {}
+
+    // The time interval at which the tables are merged
+    std::chrono::milliseconds merge_interval;
+
+    // The share of deleted rows and free space from which on a main chunk is rebuilt, see DeltaMergeTask
+    float invalid_row_share;
+  };
+
+  explicit DeltaMergeManager(const Options& options = {});
+
+  void resume();
+  void pause();
+
+  // Merges all tables once, on the current thread
+  void merge_all_tables();
+
+ private:
+  const Options _options;
+  std::unique_ptr<PausableLoopThread> _merge_thread;
+};
+
+}  // namespace opossum
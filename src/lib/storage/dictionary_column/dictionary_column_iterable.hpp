@@ -69,7 +69,7 @@ class DictionaryColumnIterable : public PointAccessibleColumnIterable<Dictionary
       const auto value_id = *_attribute_it;
       const auto is_null = (value_id == _null_value_id);
 
-      if (is_null) return ColumnIteratorValue<T>{T{}, true, _chunk_offset};
+      if (is_null) return ColumnIteratorValue<T>::null(_chunk_offset);
 
       return ColumnIteratorValue<T>{_dictionary[value_id], false, _chunk_offset};
     }
@@ -101,7 +101,7 @@ class DictionaryColumnIterable : public PointAccessibleColumnIterable<Dictionary
       const auto value_id = _attribute_decoder.get(chunk_offsets.into_referenced);
       const auto is_null = (value_id == _null_value_id);
 
-      if (is_null) return ColumnIteratorValue<T>{T{}, true, chunk_offsets.into_referencing};
+      if (is_null) return ColumnIteratorValue<T>::null(chunk_offsets.into_referencing);
 
       return ColumnIteratorValue<T>{_dictionary[value_id], false, chunk_offsets.into_referencing};
     }
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <optional>
+#include <type_traits>
+#include <vector>
 
 #include "resolve_type.hpp"
 #include "storage/base_column.hpp"
+#include "storage/column_iterables/chunk_offset_mapping.hpp"
 #include "storage/create_iterable_from_column.hpp"
 
 namespace opossum {
@@ -48,4 +51,99 @@ void materialize_nulls(const BaseColumn& column, Container& container) {
   });
 }
 
+/**
+ * @defgroup Typed bulk access to a part of a Column
+ *
+ * In contrast to BaseColumn::operator[], no AllTypeVariant is constructed and no virtual call is made per value. The
+ * values are decoded by the iterable of the Column's encoding. values[i] and nulls[i] hold the i-th requested value,
+ * the values of NULLs are default-constructed. Both vectors are resized, so they can be reused across chunks.
+ * T must be the DataType of the Column.
+ *
+ * Use like:
+ *
+ * ```c++
+ *   std::vector<T> values;
+ *   std::vector<bool> nulls;
+ *   materialize_values_and_nulls(*chunk->get_column(column_id), ChunkOffset{0}, chunk->size(), values, nulls);
+ * ```
+ *
+ * @{
+ */
+
+// Materialize the values/nulls of the Column column_id at the positions in pos_list. NULL_ROW_IDs result in NULLs.
+template <typename T>
+void materialize_values_and_nulls(const Table& table, const ColumnID column_id, const PosList& pos_list,
+                                  std::vector<T>& values, std::vector<bool>& nulls) {
+  values.resize(pos_list.size());
+  nulls.assign(pos_list.size(), true);
+
+  for (const auto& chunk_id_and_chunk_offsets : split_pos_list_by_chunk_id(pos_list)) {
+    const auto& column = *table.get_chunk(chunk_id_and_chunk_offsets.first)->get_column(column_id);
+    const auto& chunk_offsets = chunk_id_and_chunk_offsets.second;
+
+    resolve_column_type<T>(column, [&](const auto& typed_column) {
+      using ColumnType = std::decay_t<decltype(typed_column)>;
+
+      if constexpr (std::is_same_v<ColumnType, ReferenceColumn>) {
+        Fail("PosList must reference a data table");
+      } else {
+        create_iterable_from_column<T>(typed_column).for_each(&chunk_offsets, [&](const auto& value) {
+          // chunk_offset() is the index into pos_list
+          nulls[value.chunk_offset()] = value.is_null();
+          if (!value.is_null()) values[value.chunk_offset()] = value.value();
+        });
+      }
+    });
+  }
+}
+
+// Materialize the values/nulls at the chunk offsets [begin, end) of the Column
+template <typename T>
+void materialize_values_and_nulls(const BaseColumn& column, const ChunkOffset begin, const ChunkOffset end,
+                                  std::vector<T>& values, std::vector<bool>& nulls) {
+  DebugAssert(begin <= end && end <= column.size(), "Invalid range");
+
+  values.resize(end - begin);
+  nulls.resize(end - begin);
+
+  resolve_column_type<T>(column, [&](const auto& typed_column) {
+    using ColumnType = std::decay_t<decltype(typed_column)>;
+
+    if constexpr (std::is_same_v<ColumnType, ReferenceColumn>) {
+      const auto& referenced_table = *typed_column.referenced_table();
+      const auto& pos_list = *typed_column.pos_list();
+      if (begin == 0 && end == pos_list.size()) {
+        materialize_values_and_nulls(referenced_table, typed_column.referenced_column_id(), pos_list, values, nulls);
+      } else {
+        const auto positions = PosList(pos_list.cbegin() + begin, pos_list.cbegin() + end);
+        materialize_values_and_nulls(referenced_table, typed_column.referenced_column_id(), positions, values, nulls);
+      }
+    } else {
+      const auto iterable = create_iterable_from_column<T>(typed_column);
+      const auto materialize = [&](auto it, auto end_it) {
+        for (; it != end_it; ++it) {
+          const auto value = *it;
+          const auto index = value.chunk_offset() - begin;
+          nulls[index] = value.is_null();
+          if (!value.is_null()) values[index] = value.value();
+        }
+      };
+
+      // Sequential iteration is considerably cheaper than point access for some encodings (e.g., RunLength)
+      if (begin == 0 && end == typed_column.size()) {
+        iterable.with_iterators(materialize);
+      } else {
+        auto chunk_offsets = ChunkOffsetsList{};
+        chunk_offsets.reserve(end - begin);
+        for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+          chunk_offsets.push_back({chunk_offset, chunk_offset});
+        }
+        iterable.with_iterators(&chunk_offsets, materialize);
+      }
+    }
+  });
+}
+
+/**@}*/
+
 }  // namespace opossum
@@ -0,0 +1,824 @@
+#include "materialized_view.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_manager.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "operators/table_wrapper.hpp"
+#include "optimizer/optimizer.hpp"
+#include "optimizer/strategy/join_detection_rule.hpp"
+#include "optimizer/strategy/predicate_pushdown_rule.hpp"
+#include "optimizer/strategy/predicate_reordering_rule.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "statistics/generate_table_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_columns.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "storage/value_deltas.hpp"
+#include "tasks/delta_merge_task.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using TablesByNode = std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<const Table>>;
+
+/**
+ * Translates an LQP with some of its nodes replaced by TableWrappers around fixed Tables
+ */
+class SubstitutingLQPTranslator final : public LQPTranslator {
+ public:
+  explicit SubstitutingLQPTranslator(const TablesByNode& substitutions) : _substitutions(substitutions) {}
+
+  std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const override {
+    const auto substitution_iter = _substitutions.find(node);
+    if (substitution_iter == _substitutions.end()) return LQPTranslator::translate_node(node);
+
+    // Cache the TableWrappers, so that nodes with multiple outputs are only executed once
+    auto& table_wrapper = _table_wrappers[node];
+    if (!table_wrapper) table_wrapper = std::make_shared<TableWrapper>(substitution_iter->second);
+    return table_wrapper;
+  }
+
+ private:
+  const TablesByNode& _substitutions;
+  mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractOperator>>
+      _table_wrappers;
+};
+
+std::shared_ptr<const Table> execute(const std::shared_ptr<AbstractLQPNode>& lqp, const TablesByNode& substitutions) {
+  const auto pqp = SubstitutingLQPTranslator{substitutions}.translate_node(lqp);
+  CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(pqp));
+  return pqp->get_output();
+}
+
+bool is_visible(const CommitID commit_id, const CommitID begin_cid, const CommitID end_cid) {
+  return begin_cid <= commit_id && commit_id < end_cid;
+}
+
+/**
+ * @return a reference Table with all rows of the data Table whose begin and end CommitIDs satisfy the predicate. If
+ *         changed_since is given, only chunks that were modified by a commit after it are looked at.
+ */
+template <typename Predicate>
+std::shared_ptr<const Table> select_rows(const std::shared_ptr<const Table>& table, const Predicate& predicate,
+                                         const std::optional<CommitID> changed_since = std::nullopt) {
+  auto output = std::make_shared<Table>(table->column_definitions(), TableType::References);
+
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto mvcc_columns = chunk->mvcc_columns();
+    if (changed_since && mvcc_columns->last_commit_id() <= *changed_since) continue;
+
+    auto pos_list = std::make_shared<PosList>();
+    const auto chunk_size = chunk->size();
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (predicate(mvcc_columns->begin_cids[chunk_offset], mvcc_columns->end_cids[chunk_offset])) {
+        pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+      }
+    }
+
+    if (pos_list->empty()) continue;
+
+    ChunkColumns columns;
+    for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+      columns.push_back(std::make_shared<ReferenceColumn>(table, column_id, pos_list));
+    }
+    output->append_chunk(columns);
+  }
+
+  return output;
+}
+
+std::shared_ptr<const Table> select_visible_rows(const std::shared_ptr<const Table>& table, const CommitID commit_id) {
+  return select_rows(table, [&](const CommitID begin_cid, const CommitID end_cid) {
+    return is_visible(commit_id, begin_cid, end_cid);
+  });
+}
+
+std::vector<std::vector<AllTypeVariant>> materialize_rows(const Table& table) {
+  auto rows = std::vector<std::vector<AllTypeVariant>>{};
+  rows.reserve(table.row_count());
+
+  for (const auto& chunk : table.chunks()) {
+    const auto chunk_size = chunk->size();
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      auto& row = rows.emplace_back();
+      row.reserve(table.column_count());
+      for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+        row.emplace_back((*chunk->get_column(column_id))[chunk_offset]);
+      }
+    }
+  }
+
+  return rows;
+}
+
+ChunkColumns create_columns(const TableColumnDefinitions& column_definitions,
+                            const std::vector<const std::vector<AllTypeVariant>*>& rows) {
+  auto columns = ChunkColumns{};
+  for (const auto& column_definition : column_definitions) {
+    columns.push_back(make_shared_by_data_type<BaseColumn, ValueColumn>(column_definition.data_type,
+                                                                        column_definition.nullable));
+  }
+
+  for (const auto& row : rows) {
+    for (ColumnID column_id{0}; column_id < columns.size(); ++column_id) {
+      columns[column_id]->append((*row)[column_id]);
+    }
+  }
+
+  return columns;
+}
+
+std::shared_ptr<Table> create_table(const TableColumnDefinitions& column_definitions,
+                                    const std::vector<std::vector<AllTypeVariant>>& rows) {
+  auto row_pointers = std::vector<const std::vector<AllTypeVariant>*>{};
+  row_pointers.reserve(rows.size());
+  for (const auto& row : rows) {
+    row_pointers.emplace_back(&row);
+  }
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  table->append_chunk(create_columns(column_definitions, row_pointers));
+  return table;
+}
+
+AllTypeVariant add(const AllTypeVariant& accumulator, const AllTypeVariant& value, const int64_t sign) {
+  if (variant_is_null(value)) return accumulator;
+
+  if (accumulator.type() == typeid(int64_t)) {
+    return boost::get<int64_t>(accumulator) + sign * type_cast<int64_t>(value);
+  }
+  return boost::get<double>(accumulator) + static_cast<double>(sign) * type_cast<double>(value);
+}
+
+bool contains_subselect(const std::shared_ptr<LQPExpression>& expression) {
+  if (!expression) return false;
+  if (expression->is_subselect()) return true;
+
+  for (const auto& argument : expression->aggregate_function_arguments()) {
+    if (contains_subselect(argument)) return true;
+  }
+
+  return contains_subselect(expression->left_child()) || contains_subselect(expression->right_child());
+}
+
+/**
+ * @return whether the LQP only consists of selections, projections, inner joins and position unions, i.e., operations
+ *         whose result changes by exactly the rows that its input changes cause
+ */
+bool is_spj(const std::shared_ptr<const AbstractLQPNode>& node) {
+  switch (node->type()) {
+    case LQPNodeType::StoredTable:
+      return true;
+
+    case LQPNodeType::Predicate:
+      return is_spj(node->left_input());
+
+    case LQPNodeType::Projection:
+      for (const auto& expression : std::static_pointer_cast<const ProjectionNode>(node)->column_expressions()) {
+        if (contains_subselect(expression)) return false;
+      }
+      return is_spj(node->left_input());
+
+    case LQPNodeType::Join: {
+      const auto join_mode = std::static_pointer_cast<const JoinNode>(node)->join_mode();
+      if (join_mode != JoinMode::Inner && join_mode != JoinMode::Cross) return false;
+      return is_spj(node->left_input()) && is_spj(node->right_input());
+    }
+
+    case LQPNodeType::Union:
+      return is_spj(node->left_input()) && is_spj(node->right_input());
+
+    default:
+      return false;
+  }
+}
+
+void collect_stored_table_nodes(const std::shared_ptr<AbstractLQPNode>& node,
+                                std::unordered_set<std::shared_ptr<AbstractLQPNode>>& visited_nodes,
+                                std::vector<std::shared_ptr<StoredTableNode>>& stored_table_nodes) {
+  if (!node || !visited_nodes.emplace(node).second) return;
+
+  if (node->type() == LQPNodeType::StoredTable) {
+    stored_table_nodes.emplace_back(std::static_pointer_cast<StoredTableNode>(node));
+  }
+
+  collect_stored_table_nodes(node->left_input(), visited_nodes, stored_table_nodes);
+  collect_stored_table_nodes(node->right_input(), visited_nodes, stored_table_nodes);
+}
+
+void collect_validate_nodes(const std::shared_ptr<AbstractLQPNode>& node,
+                            std::unordered_set<std::shared_ptr<AbstractLQPNode>>& validate_nodes) {
+  if (!node) return;
+
+  if (node->type() == LQPNodeType::Validate) validate_nodes.emplace(node);
+
+  collect_validate_nodes(node->left_input(), validate_nodes);
+  collect_validate_nodes(node->right_input(), validate_nodes);
+}
+
+// Whether the node computes each of its output rows from a single input row, independently of all other rows
+bool is_row_wise(const std::shared_ptr<const AbstractLQPNode>& node) {
+  switch (node->type()) {
+    case LQPNodeType::Predicate:
+      return true;
+
+    case LQPNodeType::Projection:
+      for (const auto& expression : std::static_pointer_cast<const ProjectionNode>(node)->column_expressions()) {
+        if (contains_subselect(expression)) return false;
+      }
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+MaterializedView::MaterializedView(const std::shared_ptr<const AbstractLQPNode>& lqp, const uint32_t max_chunk_size)
+    : _lqp(lqp->deep_copy()) {
+  _analyze_lqp(max_chunk_size);
+
+  // Only fails if a base view was refreshed past the last commit that was read, concurrently
+  while (!refresh(TransactionManager::get().last_commit_id())) {
+  }
+
+  // Views whose first version is empty do not get column statistics from _write_changes()
+  if (!_table->table_statistics()) {
+    _table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*_table)));
+  }
+}
+
+const std::shared_ptr<const AbstractLQPNode>& MaterializedView::lqp() const { return _lqp; }
+
+bool MaterializedView::is_incrementally_maintained() const { return _is_incrementally_maintained; }
+
+bool MaterializedView::refresh(const CommitID commit_id) {
+  auto& storage_manager = StorageManager::get();
+
+  // Views on materialized views can only be as recent as the views they read
+  auto base_views_are_valid = true;
+  for (const auto& stored_table_node : _stored_table_nodes) {
+    const auto& table_name = stored_table_node->table_name();
+    if (storage_manager.has_materialized_view(table_name)) {
+      base_views_are_valid &= storage_manager.get_materialized_view(table_name)->refresh(commit_id);
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  if (_refreshed_commit_id && commit_id <= *_refreshed_commit_id) return commit_id >= *_valid_since_commit_id;
+
+  // Keep the stored result rather than computing it from versions of the base views that do not match commit_id
+  if (!base_views_are_valid) return false;
+
+  // Since the last_commit_id() of the TransactionManager only advances once all records of a commit were written, no
+  // commit up to commit_id can be missed.
+  if (_refreshed_commit_id && !_base_tables_changed_since(*_refreshed_commit_id)) {
+    _refreshed_commit_id = commit_id;
+    _oldest_required_commit_id = commit_id;
+    return true;
+  }
+
+  const auto row_changes = _is_incrementally_maintained && _refreshed_commit_id && !_base_tables_replaced() &&
+                                   !_base_tables_update_in_place()
+                               ? _apply_deltas(*_refreshed_commit_id, commit_id)
+                               : _recompute(commit_id);
+  _write_changes(row_changes, commit_id);
+
+  _valid_since_commit_id = commit_id;
+  _refreshed_commit_id = commit_id;
+  _oldest_required_commit_id = commit_id;
+  return true;
+}
+
+void MaterializedView::refresh() { refresh(TransactionManager::get().last_commit_id()); }
+
+CommitID MaterializedView::refreshed_commit_id() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  DebugAssert(_refreshed_commit_id, "MaterializedView was never refreshed");
+  return *_refreshed_commit_id;
+}
+
+std::optional<CommitID> MaterializedView::oldest_required_commit_id(const std::string& table_name) const {
+  if (!_is_incrementally_maintained) return std::nullopt;
+
+  for (const auto& stored_table_node : _stored_table_nodes) {
+    if (stored_table_node->table_name() == table_name) return _oldest_required_commit_id.load();
+  }
+  return std::nullopt;
+}
+
+std::shared_ptr<Table> MaterializedView::table() const { return _table; }
+
+std::shared_ptr<const Table> MaterializedView::rows_at(const CommitID commit_id) const {
+  // The ReferenceColumns of the result keep _table pinned, so that the chunks they reference are not reclaimed
+  return select_visible_rows(Table::pin(_table, _table), commit_id);
+}
+
+void MaterializedView::_analyze_lqp(const uint32_t max_chunk_size) {
+  _maintenance_lqp = _lqp->deep_copy();
+
+  auto validate_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+  collect_validate_nodes(_maintenance_lqp, validate_nodes);
+  for (const auto& validate_node : validate_nodes) {
+    if (validate_node == _maintenance_lqp) _maintenance_lqp = validate_node->left_input();
+    validate_node->remove_from_tree();
+  }
+
+  // Index scans and chunk pruning do not apply, since the deltas are evaluated on snapshots of the base tables
+  auto optimizer = Optimizer{10};
+  auto rule_batch = RuleBatch{RuleBatchExecutionPolicy::Iterative};
+  rule_batch.add_rule(std::make_shared<PredicatePushdownRule>());
+  rule_batch.add_rule(std::make_shared<PredicateReorderingRule>());
+  rule_batch.add_rule(std::make_shared<JoinDetectionRule>());
+  optimizer.add_rule_batch(rule_batch);
+  _maintenance_lqp = optimizer.optimize(_maintenance_lqp);
+
+  auto visited_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+  collect_stored_table_nodes(_maintenance_lqp, visited_nodes, _stored_table_nodes);
+
+  // Empty base tables, to determine names, types and nullability of result columns as the operators determine them
+  auto& storage_manager = StorageManager::get();
+  auto empty_tables = TablesByNode{};
+  for (const auto& stored_table_node : _stored_table_nodes) {
+    const auto table = storage_manager.get_table(stored_table_node->table_name());
+    Assert(table->has_mvcc() == UseMvcc::Yes, "Base tables of materialized views need MVCC columns");
+    empty_tables.emplace(stored_table_node, std::make_shared<Table>(table->column_definitions(), TableType::Data));
+  }
+
+  _table = std::make_shared<Table>(execute(_maintenance_lqp, empty_tables)->column_definitions(), TableType::Data,
+                                   max_chunk_size, UseMvcc::Yes);
+
+  // Look for an aggregation below a chain of operations that only process its result
+  auto node = _maintenance_lqp;
+  auto above_aggregate_is_row_wise = true;
+  while (node->type() != LQPNodeType::Aggregate && node->input_count() == 1) {
+    above_aggregate_is_row_wise &= is_row_wise(node);
+    node = node->left_input();
+  }
+
+  if (node->type() != LQPNodeType::Aggregate) {
+    _is_incrementally_maintained = is_spj(_maintenance_lqp);
+    _delta_lqp = _maintenance_lqp;
+    _delta_column_definitions = _table->column_definitions();
+    return;
+  }
+
+  // The changed rows of the aggregation are passed through the operations above it, so these cannot depend on other
+  // rows (as sorting or limits do)
+  const auto aggregate_node = std::static_pointer_cast<AggregateNode>(node);
+  if (!above_aggregate_is_row_wise || !is_spj(aggregate_node->left_input())) return;
+
+  auto partial_aggregates = std::vector<std::shared_ptr<LQPExpression>>{
+      LQPExpression::create_aggregate_function(AggregateFunction::Count, {LQPExpression::create_select_star()})};
+
+  for (const auto& aggregate : aggregate_node->aggregate_expressions()) {
+    const auto& argument = aggregate->aggregate_function_arguments().at(0);
+
+    switch (aggregate->aggregate_function()) {
+      case AggregateFunction::Count:
+        if (argument->type() != ExpressionType::Star) {
+          partial_aggregates.emplace_back(
+              LQPExpression::create_aggregate_function(AggregateFunction::Count, {argument->deep_copy()}));
+        }
+        break;
+
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        partial_aggregates.emplace_back(
+            LQPExpression::create_aggregate_function(AggregateFunction::Sum, {argument->deep_copy()}));
+        partial_aggregates.emplace_back(
+            LQPExpression::create_aggregate_function(AggregateFunction::Count, {argument->deep_copy()}));
+        break;
+
+      // MIN and MAX cannot be maintained when rows are deleted, COUNT DISTINCT would need to track all values
+      default:
+        return;
+    }
+  }
+
+  _is_incrementally_maintained = true;
+  _aggregate_node = aggregate_node;
+  _partial_aggregate_node = AggregateNode::make(partial_aggregates, aggregate_node->groupby_column_references(),
+                                                aggregate_node->left_input());
+  _delta_lqp = _partial_aggregate_node;
+
+  _aggregate_column_definitions = execute(_aggregate_node, empty_tables)->column_definitions();
+  _delta_column_definitions = execute(_delta_lqp, empty_tables)->column_definitions();
+}
+
+bool MaterializedView::_base_tables_changed_since(const CommitID commit_id) const {
+  if (_base_tables_replaced()) return true;
+
+  for (const auto& base_table : _base_tables) {
+    if (StorageManager::get().get_table(base_table.first)->last_commit_id() > commit_id) return true;
+  }
+
+  return false;
+}
+
+bool MaterializedView::_base_tables_replaced() const {
+  auto& storage_manager = StorageManager::get();
+
+  for (const auto& base_table : _base_tables) {
+    Assert(storage_manager.has_table(base_table.first),
+           "Base table '" + base_table.first + "' of materialized view was dropped");
+    if (storage_manager.get_table(base_table.first) != base_table.second.lock()) return true;
+  }
+
+  return false;
+}
+
+bool MaterializedView::_base_tables_update_in_place() const {
+  for (const auto& base_table : _base_tables) {
+    if (base_table.second.lock()->in_place_updates()) return true;
+  }
+
+  return false;
+}
+
+MaterializedView::RowChanges MaterializedView::_recompute(const CommitID commit_id) {
+  auto& storage_manager = StorageManager::get();
+
+  _base_tables.clear();
+  auto snapshots = std::unordered_map<std::string, std::shared_ptr<const Table>>{};
+  auto substitutions = TablesByNode{};
+
+  for (const auto& stored_table_node : _stored_table_nodes) {
+    const auto& table_name = stored_table_node->table_name();
+
+    auto& snapshot = snapshots[table_name];
+    if (!snapshot) {
+      const auto table = storage_manager.get_table(table_name);
+      _base_tables.emplace(table_name, table);
+      snapshot = select_visible_rows(create_table_with_visible_values(table, TransactionID{0}, commit_id), commit_id);
+    }
+
+    substitutions.emplace(stored_table_node, snapshot);
+  }
+
+  // The new result replaces all rows of the stored one
+  auto row_changes = RowChanges{};
+  for (const auto& [row, row_ids] : _row_ids) {
+    row_changes[row] -= static_cast<int64_t>(row_ids.size());
+  }
+
+  if (!_is_incrementally_maintained) {
+    for (auto& row : materialize_rows(*execute(_maintenance_lqp, substitutions))) {
+      ++row_changes[std::move(row)];
+    }
+    return row_changes;
+  }
+
+  _groups.clear();
+  auto changed_groups = ChangedGroups{};
+  _merge(*execute(_delta_lqp, substitutions), 1, row_changes, changed_groups);
+  if (!_aggregate_node) return row_changes;
+
+  auto aggregate_rows = std::vector<Row>{};
+  aggregate_rows.reserve(_groups.size() + 1);
+  for (const auto& [group_key, group] : _groups) {
+    aggregate_rows.emplace_back(_build_aggregate_row(group_key, group));
+  }
+
+  // Without GROUP BY, the aggregation has exactly one row, even if there are no input rows
+  if (_aggregate_node->groupby_column_references().empty() && _groups.empty()) {
+    aggregate_rows.emplace_back(_build_aggregate_row(Row{}, *_group_state(Row{})));
+  }
+
+  for (auto& row : _output_rows(aggregate_rows)) {
+    ++row_changes[std::move(row)];
+  }
+
+  return row_changes;
+}
+
+MaterializedView::RowChanges MaterializedView::_apply_deltas(const CommitID old_commit_id,
+                                                            const CommitID new_commit_id) {
+  // The snapshots of a base table are only determined if a delta term needs them
+  struct TableVersions {
+    std::shared_ptr<const Table> table;
+    std::shared_ptr<const Table> old_rows;
+    std::shared_ptr<const Table> new_rows;
+    std::shared_ptr<const Table> inserted_rows;
+    std::shared_ptr<const Table> deleted_rows;
+  };
+
+  auto versions_by_table_name = std::unordered_map<std::string, TableVersions>{};
+  for (const auto& base_table : _base_tables) {
+    const auto table = base_table.second.lock();
+    auto& versions = versions_by_table_name[base_table.first];
+    versions.table = table;
+
+    if (table->last_commit_id() <= old_commit_id) continue;
+
+    // Only chunks that were modified after old_commit_id can contain rows that were inserted or deleted since
+    versions.inserted_rows = select_rows(
+        table,
+        [&](const CommitID begin_cid, const CommitID end_cid) {
+          return is_visible(new_commit_id, begin_cid, end_cid) && !is_visible(old_commit_id, begin_cid, end_cid);
+        },
+        old_commit_id);
+    versions.deleted_rows = select_rows(
+        table,
+        [&](const CommitID begin_cid, const CommitID end_cid) {
+          return is_visible(old_commit_id, begin_cid, end_cid) && !is_visible(new_commit_id, begin_cid, end_cid);
+        },
+        old_commit_id);
+  }
+
+  // For unmodified tables, the old and the new snapshot are the same
+  const auto snapshot = [&](TableVersions& versions, const CommitID commit_id) {
+    auto& rows = commit_id == new_commit_id && versions.inserted_rows ? versions.new_rows : versions.old_rows;
+    if (!rows) rows = select_visible_rows(versions.table, commit_id);
+    return rows;
+  };
+
+  auto row_changes = RowChanges{};
+  auto changed_groups = ChangedGroups{};
+
+  /**
+   * With R_i denoting the i-th StoredTableNode, the change of an SPJ result is
+   *    sum over i of  R_1(new) x ... x R_{i-1}(new) x delta(R_i) x R_{i+1}(old) x ... x R_n(old)
+   * with delta(R_i) = inserted(R_i) - deleted(R_i). Aggregations of COUNT and SUM distribute over these terms.
+   */
+  for (auto delta_idx = size_t{0}; delta_idx < _stored_table_nodes.size(); ++delta_idx) {
+    const auto& delta_versions = versions_by_table_name.at(_stored_table_nodes[delta_idx]->table_name());
+
+    for (const auto& [delta, sign] : {std::make_pair(delta_versions.inserted_rows, int64_t{1}),
+                                      std::make_pair(delta_versions.deleted_rows, int64_t{-1})}) {
+      if (!delta || delta->empty()) continue;
+
+      auto substitutions = TablesByNode{};
+      for (auto node_idx = size_t{0}; node_idx < _stored_table_nodes.size(); ++node_idx) {
+        auto& versions = versions_by_table_name.at(_stored_table_nodes[node_idx]->table_name());
+
+        if (node_idx < delta_idx) {
+          substitutions.emplace(_stored_table_nodes[node_idx], snapshot(versions, new_commit_id));
+        } else if (node_idx == delta_idx) {
+          substitutions.emplace(_stored_table_nodes[node_idx], delta);
+        } else {
+          substitutions.emplace(_stored_table_nodes[node_idx], snapshot(versions, old_commit_id));
+        }
+      }
+
+      _merge(*execute(_delta_lqp, substitutions), sign, row_changes, changed_groups);
+    }
+  }
+
+  if (!_aggregate_node) return row_changes;
+
+  // Each changed group replaces its old row by its new one
+  auto old_rows = std::vector<Row>{};
+  auto new_rows = std::vector<Row>{};
+  for (const auto& [group_key, old_group] : changed_groups) {
+    if (old_group) old_rows.emplace_back(_build_aggregate_row(group_key, *old_group));
+    const auto new_group = _group_state(group_key);
+    if (new_group) new_rows.emplace_back(_build_aggregate_row(group_key, *new_group));
+  }
+
+  for (auto& row : _output_rows(old_rows)) {
+    --row_changes[std::move(row)];
+  }
+  for (auto& row : _output_rows(new_rows)) {
+    ++row_changes[std::move(row)];
+  }
+
+  return row_changes;
+}
+
+void MaterializedView::_merge(const Table& delta, const int64_t sign, RowChanges& row_changes,
+                              ChangedGroups& changed_groups) {
+  if (!_aggregate_node) {
+    for (auto& row : materialize_rows(delta)) {
+      row_changes[std::move(row)] += sign;
+    }
+    return;
+  }
+
+  const auto groupby_column_count = _aggregate_node->groupby_column_references().size();
+
+  for (const auto& row : materialize_rows(delta)) {
+    // Aggregations without GROUP BY produce a row even if their input is empty
+    const auto row_count = type_cast<int64_t>(row[groupby_column_count]);
+    if (row_count == 0) continue;
+
+    auto group_key = Row(row.begin(), row.begin() + groupby_column_count);
+    if (!changed_groups.count(group_key)) changed_groups.emplace(group_key, _group_state(group_key));
+
+    auto group_iter = _groups.find(group_key);
+    if (group_iter == _groups.end()) {
+      group_iter = _groups.emplace(std::move(group_key), GroupState{0, _initial_partial_aggregates()}).first;
+    }
+
+    auto& group = group_iter->second;
+    group.row_count += sign * row_count;
+    for (auto partial_idx = size_t{0}; partial_idx < group.partial_aggregates.size(); ++partial_idx) {
+      group.partial_aggregates[partial_idx] =
+          add(group.partial_aggregates[partial_idx], row[groupby_column_count + 1 + partial_idx], sign);
+    }
+
+    DebugAssert(group.row_count >= 0, "Deleted a row that was not part of the view");
+    if (group.row_count == 0) _groups.erase(group_iter);
+  }
+}
+
+std::optional<MaterializedView::GroupState> MaterializedView::_group_state(const Row& group_key) const {
+  const auto group_iter = _groups.find(group_key);
+  if (group_iter != _groups.end()) return group_iter->second;
+
+  // Without GROUP BY, the aggregation has exactly one row, even if there are no input rows
+  if (_aggregate_node->groupby_column_references().empty()) return GroupState{0, _initial_partial_aggregates()};
+
+  return std::nullopt;
+}
+
+std::vector<AllTypeVariant> MaterializedView::_initial_partial_aggregates() const {
+  const auto first_partial_column_id = _aggregate_node->groupby_column_references().size() + 1;
+
+  auto partial_aggregates = std::vector<AllTypeVariant>{};
+  for (auto column_id = first_partial_column_id; column_id < _delta_column_definitions.size(); ++column_id) {
+    // COUNTs and SUMs of integral types are Longs, SUMs of floating point types are Doubles
+    if (_delta_column_definitions[column_id].data_type == DataType::Long) {
+      partial_aggregates.emplace_back(int64_t{0});
+    } else {
+      Assert(_delta_column_definitions[column_id].data_type == DataType::Double,
+             "Unexpected type of partial aggregate");
+      partial_aggregates.emplace_back(0.0);
+    }
+  }
+
+  return partial_aggregates;
+}
+
+std::vector<MaterializedView::Row> MaterializedView::_output_rows(const std::vector<Row>& aggregate_rows) const {
+  if (_aggregate_node == _maintenance_lqp || aggregate_rows.empty()) return aggregate_rows;
+
+  // Apply the operations above the aggregation, e.g., HAVING or projections
+  const auto aggregate_table = create_table(_aggregate_column_definitions, aggregate_rows);
+  return materialize_rows(*execute(_maintenance_lqp, {{_aggregate_node, aggregate_table}}));
+}
+
+MaterializedView::Row MaterializedView::_build_aggregate_row(const Row& group_key, const GroupState& group) const {
+  auto row = group_key;
+  auto partial_idx = size_t{0};
+
+  for (const auto& aggregate : _aggregate_node->aggregate_expressions()) {
+    switch (aggregate->aggregate_function()) {
+      case AggregateFunction::Count:
+        if (aggregate->aggregate_function_arguments()[0]->type() == ExpressionType::Star) {
+          row.emplace_back(group.row_count);
+        } else {
+          row.emplace_back(group.partial_aggregates[partial_idx++]);
+        }
+        break;
+
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg: {
+        const auto& sum = group.partial_aggregates[partial_idx];
+        const auto non_null_count = type_cast<int64_t>(group.partial_aggregates[partial_idx + 1]);
+        partial_idx += 2;
+
+        if (non_null_count == 0) {
+          row.emplace_back(NullValue{});
+        } else if (aggregate->aggregate_function() == AggregateFunction::Sum) {
+          row.emplace_back(sum);
+        } else {
+          row.emplace_back(type_cast<double>(sum) / static_cast<double>(non_null_count));
+        }
+      } break;
+
+      default:
+        Fail("Aggregate function cannot be maintained incrementally");
+    }
+  }
+
+  return row;
+}
+
+void MaterializedView::_write_changes(const RowChanges& row_changes, const CommitID commit_id) {
+  auto inserted_rows = std::vector<const Row*>{};
+  auto deleted_row_count = size_t{0};
+
+  // Rows that left the view stay visible to snapshots before commit_id
+  const auto invalidate_row = [&](const RowID row_id) {
+    auto mvcc_columns = _table->get_chunk(row_id.chunk_id)->mvcc_columns();
+    mvcc_columns->end_cids[row_id.chunk_offset] = commit_id;
+    mvcc_columns->update_last_commit_id(commit_id);
+    --_row_counts_by_chunk[row_id.chunk_id];
+  };
+
+  for (const auto& [row, row_change] : row_changes) {
+    if (row_change > 0) {
+      inserted_rows.insert(inserted_rows.end(), static_cast<size_t>(row_change), &row);
+      continue;
+    }
+    if (row_change == 0) continue;
+
+    const auto row_ids_iter = _row_ids.find(row);
+    DebugAssert(row_ids_iter != _row_ids.end() && row_ids_iter->second.size() >= static_cast<size_t>(-row_change),
+                "Deleted a row that was not part of the view");
+
+    auto& row_ids = row_ids_iter->second;
+    for (auto deletion_idx = int64_t{0}; deletion_idx < -row_change; ++deletion_idx) {
+      invalidate_row(row_ids.back());
+      row_ids.pop_back();
+    }
+    if (row_ids.empty()) _row_ids.erase(row_ids_iter);
+
+    deleted_row_count += -row_change;
+  }
+
+  if (inserted_rows.empty() && deleted_row_count == 0) return;
+
+  _row_count += inserted_rows.size();
+  _row_count -= deleted_row_count;
+
+  // The remaining rows of completed chunks of which at least half of the rows left the view are moved to the end of
+  // _table as part of this version, so that the chunks can be reclaimed once no snapshot sees their rows anymore
+  auto compacted_chunk_ids = std::unordered_set<ChunkID>{};
+  for (ChunkID chunk_id{0}; chunk_id + 1u < _table->chunk_count(); ++chunk_id) {
+    const auto row_count = _row_counts_by_chunk[chunk_id];
+    if (row_count > 0 && row_count <= _table->max_chunk_size() / 2) compacted_chunk_ids.emplace(chunk_id);
+  }
+
+  if (!compacted_chunk_ids.empty()) {
+    for (auto& [row, row_ids] : _row_ids) {
+      const auto moved_row_ids_begin = std::partition(row_ids.begin(), row_ids.end(), [&](const auto& row_id) {
+        return compacted_chunk_ids.count(row_id.chunk_id) == 0;
+      });
+
+      for (auto row_id_iter = moved_row_ids_begin; row_id_iter != row_ids.end(); ++row_id_iter) {
+        invalidate_row(*row_id_iter);
+        inserted_rows.emplace_back(&row);
+      }
+      row_ids.erase(moved_row_ids_begin, row_ids.end());
+    }
+  }
+
+  // Rows that entered the view are appended to the last chunk. They become visible at commit_id.
+  for (const auto* row : inserted_rows) {
+    _table->append(*row);
+
+    const auto chunk_id = static_cast<ChunkID>(_table->chunk_count() - 1);
+    const auto chunk = _table->get_chunk(chunk_id);
+    const auto chunk_offset = static_cast<ChunkOffset>(chunk->size() - 1);
+    {
+      auto mvcc_columns = chunk->mvcc_columns();
+      mvcc_columns->begin_cids[chunk_offset] = commit_id;
+      mvcc_columns->update_last_commit_id(commit_id);
+    }
+
+    _row_ids[*row].emplace_back(RowID{chunk_id, chunk_offset});
+    _row_counts_by_chunk.resize(_table->chunk_count());
+    ++_row_counts_by_chunk[chunk_id];
+  }
+
+  _table->update_last_commit_id(commit_id);
+
+  // The column statistics are generated once, for the first version of the view. Later versions only update the row
+  // count, as Insert and Delete do for the base tables.
+  const auto table_statistics = _table->table_statistics();
+  if (!table_statistics) {
+    _table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*_table)));
+  } else {
+    _table->set_table_statistics(std::make_shared<TableStatistics>(
+        table_statistics->table_type(), static_cast<float>(_row_count), table_statistics->column_statistics()));
+  }
+
+  // Views that read this view need its rows for their next refresh as well, reclaim_chunks() finds them by the name of
+  // this view. The chunks of views that are not registered in the StorageManager are not reclaimed.
+  auto& storage_manager = StorageManager::get();
+  for (const auto& view_name : storage_manager.materialized_view_names()) {
+    if (storage_manager.get_materialized_view(view_name).get() != this) continue;
+    DeltaMergeTask::reclaim_chunks(view_name, *_table, static_cast<ChunkID>(_table->chunk_count() - 1));
+  }
+}
+
+}  // namespace opossum
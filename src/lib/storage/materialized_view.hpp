@@ -0,0 +1,183 @@
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/table_column_definition.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AggregateNode;
+class StoredTableNode;
+class Table;
+
+/**
+ * A view whose result is stored as a Table. It is registered in the StorageManager and can be read like any other
+ * Table. Before the Table is read, refresh() brings it up to date with the snapshot of the reader.
+ *
+ * The stored Table is versioned like the base tables: each refresh that changes the result appends the rows that
+ * entered the view to the last chunk, with the CommitID that the view was refreshed to as their begin CommitID, and
+ * sets the end CommitID of the rows that left it. Thus, a transaction that reads the view sees the result of the
+ * latest refresh up to its snapshot, even while the view is refreshed concurrently. This is the result of the view for
+ * that snapshot only if no base table changed between that refresh and the snapshot, see refresh(const CommitID).
+ *
+ * So that the stored Table does not grow with each refresh, the remaining rows of completed chunks of which at least
+ * half of the rows left the view are moved to the end of the Table, and chunks whose rows no snapshot sees anymore are
+ * reclaimed like those of the base tables (see DeltaMergeTask::reclaim_chunks()).
+ *
+ * Views consisting of selections, projections, inner joins and position unions ("SPJ"), optionally below a single
+ * aggregation with COUNT, SUM and AVG only (and selections and projections above it), are maintained incrementally:
+ * refresh() determines the rows each base table gained and lost since the last refresh from the MVCC begin and end
+ * CommitIDs of the chunks that were modified since, evaluates only the delta these rows cause in the view and merges
+ * it into the stored result. Aggregations are merged via the per-group row count and the partial SUMs and COUNTs of
+ * their arguments. The delta of a base table is joined with the complete other base tables, though. All other views
+ * (e.g., with MIN/MAX, sorting, limits or outer joins) are recomputed from scratch whenever one of their base tables
+ * changed; only the rows that differ from the stored result are written.
+ *
+ * The MaterializedViewRule replaces subplans of queries that are equal to the definition of a materialized view by a
+ * read of the view.
+ */
+class MaterializedView final : private Noncopyable {
+ public:
+  /**
+   * @param lqp             The definition of the view, as produced by the SQLTranslator with validation enabled. All
+   *                        base tables need to have MVCC columns.
+   * @param max_chunk_size  The size of the chunks of the stored Table, i.e., the granularity in which it is compacted
+   */
+  explicit MaterializedView(const std::shared_ptr<const AbstractLQPNode>& lqp, const uint32_t max_chunk_size = 100'000);
+
+  const std::shared_ptr<const AbstractLQPNode>& lqp() const;
+
+  bool is_incrementally_maintained() const;
+
+  /**
+   * Brings the stored result up to date with all transactions that committed up to commit_id, unless it is more
+   * recent already. Cheap if none of the base tables was modified since the last refresh.
+   *
+   * @return whether the rows of the stored result that are visible at commit_id are the result of the view for a
+   *         snapshot at commit_id. This is not the case if the view was refreshed past commit_id after a base table
+   *         changed, or if a base view (i.e., a materialized view this view reads) was.
+   */
+  bool refresh(const CommitID commit_id);
+
+  // Brings the stored result up to date with all transactions that committed so far
+  void refresh();
+
+  // The CommitID that the stored result reflects
+  CommitID refreshed_commit_id() const;
+
+  /**
+   * The CommitID from which the next refresh reads the changes of the base table with the given name, i.e., rows of the
+   * table that were invalidated after it are still needed. std::nullopt if the view does not read the table or is
+   * recomputed instead. Does not lock the view, so that it can be called while the view is being refreshed.
+   */
+  std::optional<CommitID> oldest_required_commit_id(const std::string& table_name) const;
+
+  // All versions of the stored result. Use rows_at() to get the rows of one version.
+  std::shared_ptr<Table> table() const;
+
+  // The rows of the stored result that are visible at commit_id, as a reference Table that pins table()
+  std::shared_ptr<const Table> rows_at(const CommitID commit_id) const;
+
+ private:
+  using Row = std::vector<AllTypeVariant>;
+
+  // The change of the multiplicity of each row in the view's result
+  using RowChanges = std::map<Row, int64_t>;
+
+  // The row count of an aggregation group and the partial aggregates of its rows, see _partial_aggregate_node
+  struct GroupState {
+    int64_t row_count{0};
+    std::vector<AllTypeVariant> partial_aggregates;
+  };
+
+  // The groups changed by a refresh, with their state before the refresh (std::nullopt for groups without a row)
+  using ChangedGroups = std::map<Row, std::optional<GroupState>>;
+
+  void _analyze_lqp(const uint32_t max_chunk_size);
+
+  bool _base_tables_changed_since(const CommitID commit_id) const;
+  bool _base_tables_replaced() const;
+
+  // In-place updates (see ValueDeltas) change rows without new row versions, so the deltas cannot be derived from the
+  // MvccColumns
+  bool _base_tables_update_in_place() const;
+
+  RowChanges _recompute(const CommitID commit_id);
+  RowChanges _apply_deltas(const CommitID old_commit_id, const CommitID new_commit_id);
+
+  // Merges a result of _delta_lqp into the state of an incrementally maintained view, with sign -1 for rows that left
+  // the view. Aggregation groups that were changed for the first time are added to changed_groups.
+  void _merge(const Table& delta, const int64_t sign, RowChanges& row_changes, ChangedGroups& changed_groups);
+
+  // The state of a group in the result of the aggregation, std::nullopt if it has no row
+  std::optional<GroupState> _group_state(const Row& group_key) const;
+
+  // The partial aggregates of a group without rows
+  std::vector<AllTypeVariant> _initial_partial_aggregates() const;
+
+  // The result rows of the view for rows of the aggregation, i.e., after applying the operations above it
+  std::vector<Row> _output_rows(const std::vector<Row>& aggregate_rows) const;
+  Row _build_aggregate_row(const Row& group_key, const GroupState& group) const;
+
+  // Writes the changes to _table as a new version that becomes visible at commit_id, and compacts _table
+  void _write_changes(const RowChanges& row_changes, const CommitID commit_id);
+
+  const std::shared_ptr<const AbstractLQPNode> _lqp;
+
+  // A copy of _lqp without ValidateNodes (the snapshots the deltas are computed from are already validated),
+  // optimized so that the delta evaluation profits from pushed down predicates and detected joins
+  std::shared_ptr<AbstractLQPNode> _maintenance_lqp;
+
+  // All StoredTableNodes in _maintenance_lqp, in the order in which the delta terms substitute them
+  std::vector<std::shared_ptr<StoredTableNode>> _stored_table_nodes;
+
+  // The base tables the view was last refreshed from, to detect tables that were dropped and re-added
+  std::map<std::string, std::weak_ptr<const Table>> _base_tables;
+
+  bool _is_incrementally_maintained{false};
+
+  // Only set if the view is maintained incrementally and has an aggregation. _partial_aggregate_node groups like
+  // _aggregate_node, and outputs COUNT(*) followed by the partial aggregates of each aggregate (SUM(x) and COUNT(x)
+  // for SUM(x) and AVG(x), COUNT(x) for COUNT(x), nothing for COUNT(*))
+  std::shared_ptr<AggregateNode> _aggregate_node;
+  std::shared_ptr<AggregateNode> _partial_aggregate_node;
+  TableColumnDefinitions _aggregate_column_definitions;
+
+  // The root of the plan the delta terms are evaluated for: _partial_aggregate_node or _maintenance_lqp
+  std::shared_ptr<AbstractLQPNode> _delta_lqp;
+
+  // The column definitions of the results of _delta_lqp
+  TableColumnDefinitions _delta_column_definitions;
+
+  // The state of each group of incrementally maintained views with an aggregation
+  std::map<Row, GroupState> _groups;
+
+  // The positions of the rows of the current version in _table, by row
+  std::map<Row, std::vector<RowID>> _row_ids;
+  size_t _row_count{0};
+
+  // The number of rows of the current version in each chunk of _table
+  std::vector<ChunkOffset> _row_counts_by_chunk;
+
+  // The stored result is the result of the view for all snapshots from _valid_since_commit_id to _refreshed_commit_id
+  std::optional<CommitID> _valid_since_commit_id;
+  std::optional<CommitID> _refreshed_commit_id;
+  std::shared_ptr<Table> _table;
+
+  // _refreshed_commit_id, for oldest_required_commit_id(). Only advanced once a refresh is complete.
+  std::atomic<CommitID> _oldest_required_commit_id{0};
+
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
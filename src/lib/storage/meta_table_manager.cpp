@@ -0,0 +1,233 @@
+#include "meta_table_manager.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "constant_mappings.hpp"
+#include "scheduler/abstract_scheduler.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/topology.hpp"
+#include "sql/sql_query_cache.hpp"
+#include "sql/sql_query_plan.hpp"
+#include "storage/base_encoded_column.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::string compressed_vector_type_name(const CompressedVectorType type) {
+  switch (type) {
+    case CompressedVectorType::FixedSize4ByteAligned:
+      return "FixedSize4ByteAligned";
+    case CompressedVectorType::FixedSize2ByteAligned:
+      return "FixedSize2ByteAligned";
+    case CompressedVectorType::FixedSize1ByteAligned:
+      return "FixedSize1ByteAligned";
+    case CompressedVectorType::SimdBp128:
+      return "SimdBp128";
+    case CompressedVectorType::Invalid:
+      break;
+  }
+  Fail("Invalid CompressedVectorType");
+}
+
+std::string transaction_phase_name(const TransactionPhase phase) {
+  switch (phase) {
+    case TransactionPhase::Active:
+      return "Active";
+    case TransactionPhase::Aborted:
+      return "Aborted";
+    case TransactionPhase::RolledBack:
+      return "RolledBack";
+    case TransactionPhase::Committing:
+      return "Committing";
+    case TransactionPhase::Committed:
+      return "Committed";
+  }
+  Fail("Invalid TransactionPhase");
+}
+
+}  // namespace
+
+const std::string MetaTableManager::META_PREFIX = "meta_";  // NOLINT
+
+bool MetaTableManager::is_meta_table_name(const std::string& table_name) {
+  return _generators().count(table_name) > 0;
+}
+
+std::vector<std::string> MetaTableManager::table_names() {
+  std::vector<std::string> table_names;
+  for (const auto& [table_name, generator] : _generators()) {
+    table_names.emplace_back(table_name);
+  }
+  std::sort(table_names.begin(), table_names.end());
+  return table_names;
+}
+
+std::shared_ptr<Table> MetaTableManager::generate_table(const std::string& table_name) {
+  const auto iter = _generators().find(table_name);
+  Assert(iter != _generators().end(), "No meta table named '" + table_name + "'");
+  return iter->second();
+}
+
+const std::unordered_map<std::string, std::function<std::shared_ptr<Table>()>>& MetaTableManager::_generators() {
+  static const auto generators = std::unordered_map<std::string, std::function<std::shared_ptr<Table>()>>{
+      {META_PREFIX + "tables", &MetaTableManager::_generate_tables_table},
+      {META_PREFIX + "chunks", &MetaTableManager::_generate_chunks_table},
+      {META_PREFIX + "columns", &MetaTableManager::_generate_columns_table},
+      {META_PREFIX + "plan_cache", &MetaTableManager::_generate_plan_cache_table},
+      {META_PREFIX + "scheduler", &MetaTableManager::_generate_scheduler_table},
+      {META_PREFIX + "transactions", &MetaTableManager::_generate_transactions_table}};
+  return generators;
+}
+
+std::shared_ptr<Table> MetaTableManager::_generate_tables_table() {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("table_name", DataType::String);
+  column_definitions.emplace_back("column_count", DataType::Int);
+  column_definitions.emplace_back("row_count", DataType::Long);
+  column_definitions.emplace_back("chunk_count", DataType::Int);
+  column_definitions.emplace_back("max_chunk_size", DataType::Long);
+  column_definitions.emplace_back("estimated_size_bytes", DataType::Long);
+  auto output_table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  for (const auto& table_name : StorageManager::get().table_names()) {
+    const auto table = StorageManager::get().get_table(table_name);
+    output_table->append({table_name, static_cast<int32_t>(table->column_count()),
+                          static_cast<int64_t>(table->row_count()), static_cast<int32_t>(table->chunk_count()),
+                          static_cast<int64_t>(table->max_chunk_size()),
+                          static_cast<int64_t>(table->estimate_memory_usage())});
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<Table> MetaTableManager::_generate_chunks_table() {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("table_name", DataType::String);
+  column_definitions.emplace_back("chunk_id", DataType::Int);
+  column_definitions.emplace_back("row_count", DataType::Long);
+  column_definitions.emplace_back("mutable", DataType::Int);
+  // NULL for chunks that are not bound to a NUMA node
+  column_definitions.emplace_back("node_id", DataType::Int, true);
+  column_definitions.emplace_back("estimated_size_bytes", DataType::Long);
+  auto output_table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  for (const auto& table_name : StorageManager::get().table_names()) {
+    const auto table = StorageManager::get().get_table(table_name);
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      const auto node_id = chunk->node_id() == CURRENT_NODE_ID ? NULL_VALUE
+                                                               : AllTypeVariant{static_cast<int32_t>(chunk->node_id())};
+      output_table->append({table_name, static_cast<int32_t>(chunk_id), static_cast<int64_t>(chunk->size()),
+                            static_cast<int32_t>(chunk->is_mutable()), node_id,
+                            static_cast<int64_t>(chunk->estimate_memory_usage())});
+    }
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<Table> MetaTableManager::_generate_columns_table() {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("table_name", DataType::String);
+  column_definitions.emplace_back("chunk_id", DataType::Int);
+  column_definitions.emplace_back("column_id", DataType::Int);
+  column_definitions.emplace_back("column_name", DataType::String);
+  column_definitions.emplace_back("data_type", DataType::String);
+  column_definitions.emplace_back("encoding", DataType::String);
+  column_definitions.emplace_back("vector_compression", DataType::String, true);
+  column_definitions.emplace_back("estimated_size_bytes", DataType::Long);
+  auto output_table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  for (const auto& table_name : StorageManager::get().table_names()) {
+    const auto table = StorageManager::get().get_table(table_name);
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+        const auto column = chunk->get_column(column_id);
+
+        auto encoding = EncodingType::Unencoded;
+        auto vector_compression = NULL_VALUE;
+        if (const auto encoded_column = std::dynamic_pointer_cast<const BaseEncodedColumn>(column)) {
+          encoding = encoded_column->encoding_type();
+          if (encoded_column->compressed_vector_type() != CompressedVectorType::Invalid) {
+            vector_compression = compressed_vector_type_name(encoded_column->compressed_vector_type());
+          }
+        }
+
+        output_table->append({table_name, static_cast<int32_t>(chunk_id), static_cast<int32_t>(column_id),
+                              table->column_name(column_id),
+                              data_type_to_string.left.at(table->column_data_type(column_id)),
+                              encoding_type_to_string.at(encoding), vector_compression,
+                              static_cast<int64_t>(column->estimate_memory_usage())});
+      }
+    }
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<Table> MetaTableManager::_generate_plan_cache_table() {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("capacity", DataType::Long);
+  column_definitions.emplace_back("size", DataType::Long);
+  column_definitions.emplace_back("hit_count", DataType::Long);
+  column_definitions.emplace_back("miss_count", DataType::Long);
+  auto output_table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  auto& cache = SQLQueryCache<SQLQueryPlan>::get();
+  output_table->append({static_cast<int64_t>(cache.cache().capacity()), static_cast<int64_t>(cache.size()),
+                        static_cast<int64_t>(cache.hit_count()), static_cast<int64_t>(cache.miss_count())});
+
+  return output_table;
+}
+
+std::shared_ptr<Table> MetaTableManager::_generate_scheduler_table() {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("node_id", DataType::Int);
+  column_definitions.emplace_back("worker_count", DataType::Int);
+  column_definitions.emplace_back("queued_task_count", DataType::Long);
+  auto output_table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  if (!CurrentScheduler::is_set()) return output_table;
+
+  const auto& scheduler = CurrentScheduler::get();
+  const auto& nodes = scheduler->topology()->nodes();
+  for (const auto& queue : scheduler->queues()) {
+    const auto node_id = queue->node_id();
+    output_table->append({static_cast<int32_t>(node_id), static_cast<int32_t>(nodes[node_id].cpus.size()),
+                          static_cast<int64_t>(queue->size())});
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<Table> MetaTableManager::_generate_transactions_table() {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("transaction_id", DataType::Long);
+  column_definitions.emplace_back("snapshot_commit_id", DataType::Long);
+  column_definitions.emplace_back("phase", DataType::String);
+  auto output_table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  for (const auto& context : TransactionManager::get().active_transaction_contexts()) {
+    output_table->append({static_cast<int64_t>(context->transaction_id()),
+                          static_cast<int64_t>(context->snapshot_commit_id()),
+                          transaction_phase_name(context->phase())});
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
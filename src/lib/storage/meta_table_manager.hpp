@@ -0,0 +1,54 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Meta tables expose the runtime state of the engine, e.g., the memory usage of the stored columns, the query plan
+ * cache or the task queues of the scheduler, as tables that can be queried via SQL ("SELECT * FROM meta_chunks").
+ * They are not stored, but generated on demand every time they are read (see MetaTableNode and GetMetaTable), so they
+ * always reflect the current state. They cannot be modified.
+ *
+ * Meta tables are identified by the prefix "meta_" and take precedence over stored tables with the same name.
+ */
+class MetaTableManager {
+ public:
+  static const std::string META_PREFIX;
+
+  static bool is_meta_table_name(const std::string& table_name);
+
+  // The names of all meta tables, including the prefix
+  static std::vector<std::string> table_names();
+
+  static std::shared_ptr<Table> generate_table(const std::string& table_name);
+
+ protected:
+  // One row per stored table
+  static std::shared_ptr<Table> _generate_tables_table();
+
+  // One row per chunk of a stored table
+  static std::shared_ptr<Table> _generate_chunks_table();
+
+  // One row per column of each chunk of a stored table, with its encoding and memory usage
+  static std::shared_ptr<Table> _generate_columns_table();
+
+  // One row with the statistics of the SQLQueryCache of query plans
+  static std::shared_ptr<Table> _generate_plan_cache_table();
+
+  // One row per TaskQueue of the current scheduler, no rows if there is none
+  static std::shared_ptr<Table> _generate_scheduler_table();
+
+  // One row per transaction that has neither committed nor rolled back yet
+  static std::shared_ptr<Table> _generate_transactions_table();
+
+  static const std::unordered_map<std::string, std::function<std::shared_ptr<Table>()>>& _generators();
+};
+
+}  // namespace opossum
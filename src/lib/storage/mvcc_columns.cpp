@@ -23,6 +23,14 @@ void MvccColumns::grow_by(size_t delta, CommitID begin_cid) {
   end_cids.grow_to_at_least(_size, MAX_COMMIT_ID);
 }
 
+CommitID MvccColumns::last_commit_id() const { return _last_commit_id; }
+
+void MvccColumns::update_last_commit_id(const CommitID commit_id) {
+  auto last_commit_id = _last_commit_id.load();
+  while (last_commit_id < commit_id && !_last_commit_id.compare_exchange_weak(last_commit_id, commit_id)) {
+  }
+}
+
 void MvccColumns::print(std::ostream& stream) const {
   stream << "TIDs: ";
   for (const auto& tid : tids) stream << tid << ", ";
@@ -41,6 +41,15 @@ struct MvccColumns {
    */
   void grow_by(size_t delta, CommitID begin_cid);
 
+  /**
+   * The CommitID of the last transaction that inserted or deleted rows in this chunk, or 0 if none did so far. Allows
+   * to skip unmodified chunks when looking for the rows that changed since a commit (see MaterializedView).
+   */
+  CommitID last_commit_id() const;
+
+  // Called by the ReadWriteOperators when committing, see Table::update_last_commit_id()
+  void update_last_commit_id(const CommitID commit_id);
+
   void print(std::ostream& stream = std::cout) const;
 
  private:
@@ -54,6 +63,8 @@ struct MvccColumns {
   std::shared_mutex _mutex;
 
   size_t _size{0};
+
+  std::atomic<CommitID> _last_commit_id{0};
 };
 
 }  // namespace opossum
@@ -1,5 +1,7 @@
 #include "proxy_chunk.hpp"
 
+#include <atomic>
+
 #include "chunk.hpp"
 
 // Hyrise only supports x86-64 CPUs, therefore relying on RDTSC is fine.
@@ -13,12 +15,24 @@ uint64_t rdtsc() {
 
 namespace opossum {
 
-ProxyChunk::ProxyChunk(const std::shared_ptr<Chunk>& chunk) : _chunk(chunk), _begin_rdtsc(rdtsc()) {}
+ProxyChunk::ProxyChunk(const std::shared_ptr<Chunk>& chunk)
+    : _chunk(chunk), _begin_rdtsc(_chunk->has_access_counter() && _sample_access() ? rdtsc() : 0) {}
 
 ProxyChunk::~ProxyChunk() {
-  if (const auto& access_counter = _chunk->access_counter()) {
-    access_counter->increment(rdtsc() - _begin_rdtsc);
-  }
+  if (_begin_rdtsc == 0) return;
+  _chunk->access_counter()->increment((rdtsc() - _begin_rdtsc) * ACCESS_SAMPLE_RATE);
+}
+
+bool ProxyChunk::_sample_access() {
+  // A fixed stride would always time the same chunks of a scan whose chunk count is a multiple of the stride. Instead,
+  // the accesses are sampled using a per-thread xorshift generator, which is cheaper than the <random> engines.
+  static std::atomic<uint64_t> next_seed{0x9E3779B97F4A7C15ull};
+  thread_local auto state = next_seed.fetch_add(0x9E3779B97F4A7C15ull) | 1u;
+
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state % ACCESS_SAMPLE_RATE == 0;
 }
 
 }  // namespace opossum
@@ -11,9 +11,12 @@ namespace opossum {
 // The ProxyChunk class wraps chunk objects and implements the RAII pattern
 // to track the time a particular chunk has been in scope. These times are
 // measured using the RDTSC instructions and are stored in the Chunk's
-// ChunkAccessCounter.
+// ChunkAccessCounter. Only about one in ACCESS_SAMPLE_RATE accesses is timed,
+// its time is multiplied by ACCESS_SAMPLE_RATE.
 class ProxyChunk {
  public:
+  static constexpr uint64_t ACCESS_SAMPLE_RATE = 16;
+
   explicit ProxyChunk(const std::shared_ptr<Chunk>& chunk);
   ~ProxyChunk();
 
@@ -26,7 +29,12 @@ class ProxyChunk {
   bool operator==(const ProxyChunk& rhs) const { return _chunk == rhs._chunk; }
 
  protected:
+  // Decides whether the current access is timed
+  static bool _sample_access();
+
   const std::shared_ptr<Chunk> _chunk;
+
+  // 0 if the access is not timed
   const uint64_t _begin_rdtsc;
 };
 
@@ -1,12 +1,20 @@
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "storage/column_iterables.hpp"
+#include "storage/dictionary_column.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/value_column.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
 
 namespace opossum {
 
@@ -23,14 +31,26 @@ class ReferenceColumnIterable : public ColumnIterable<ReferenceColumnIterable<T>
     const auto begin_it = _column.pos_list()->begin();
     const auto end_it = _column.pos_list()->end();
 
-    auto begin = Iterator{table, column_id, begin_it, begin_it};
-    auto end = Iterator{table, column_id, begin_it, end_it};
+    auto begin = Iterator{table, column_id, begin_it, begin_it, _referenced_columns};
+    auto end = Iterator{table, column_id, begin_it, end_it, _referenced_columns};
     functor(begin, end);
   }
 
+  /**
+   * The columns of the referenced table that the iterators have read from, by chunk. Strings are not copied but
+   * referenced (see ColumnIteratorValue<std::string>), and the chunks may replace their columns at any time (e.g.,
+   * when they are compressed). Callers that keep the values beyond the iteration also need to keep these columns.
+   */
+  const std::unordered_map<ChunkID, std::shared_ptr<const BaseColumn>>& referenced_columns() const {
+    return _referenced_columns;
+  }
+
  private:
   const ReferenceColumn& _column;
 
+  // Each referenced chunk's column is fetched only once, so all values of a chunk come from the same column
+  mutable std::unordered_map<ChunkID, std::shared_ptr<const BaseColumn>> _referenced_columns;
+
  private:
   class Iterator : public BaseColumnIterator<Iterator, ColumnIteratorValue<T>> {
    public:
@@ -38,9 +58,11 @@ class ReferenceColumnIterable : public ColumnIterable<ReferenceColumnIterable<T>
 
    public:
     explicit Iterator(const std::shared_ptr<const Table> table, const ColumnID column_id,
-                      const PosListIterator& begin_pos_list_it, const PosListIterator& pos_list_it)
+                      const PosListIterator& begin_pos_list_it, const PosListIterator& pos_list_it,
+                      std::unordered_map<ChunkID, std::shared_ptr<const BaseColumn>>& referenced_columns)
         : _table{table},
           _column_id{column_id},
+          _referenced_columns{&referenced_columns},
           _cached_chunk_id{INVALID_CHUNK_ID},
           _cached_column{nullptr},
           _begin_pos_list_it{begin_pos_list_it},
@@ -53,46 +75,84 @@ class ReferenceColumnIterable : public ColumnIterable<ReferenceColumnIterable<T>
 
     bool equal(const Iterator& other) const { return _pos_list_it == other._pos_list_it; }
 
-    // TODO(anyone): benchmark if using two maps instead doing the dynamic cast every time really is faster.
     ColumnIteratorValue<T> dereference() const {
-      if (_pos_list_it->is_null()) return ColumnIteratorValue<T>{T{}, true, 0u};
+      if (_pos_list_it->is_null()) return ColumnIteratorValue<T>::null(0u);
 
       const auto chunk_id = _pos_list_it->chunk_id;
       const auto& chunk_offset = _pos_list_it->chunk_offset;
 
       if (chunk_id != _cached_chunk_id) {
-        _cached_chunk_id = chunk_id;
-        const auto chunk = _table->get_chunk(chunk_id);
-        _cached_column = chunk->get_column(_column_id);
+        _cache_column(chunk_id);
       }
 
+      const auto chunk_offset_into_ref_column =
+          static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
+
       /**
-       * This is just a temporary solution to supporting encoded column type.
-       * It’s very slow and is going to be replaced very soon!
+       * The values are read from the typed columns directly, so that strings are not copied, but referenced by the
+       * returned ColumnIteratorValue. Only other encodings (i.e., FrameOfReference) go through the variant access.
        */
-      return _value_from_any_column(*_cached_column, chunk_offset);
-    }
+      if (_cached_value_column) {
+        const auto& values = _cached_value_column->values();
+        const auto is_null = _cached_value_column->is_nullable() && _cached_value_column->null_values()[chunk_offset];
+        return ColumnIteratorValue<T>{values[chunk_offset], is_null, chunk_offset_into_ref_column};
+      }
 
-   private:
-    auto _value_from_any_column(const BaseColumn& column, const ChunkOffset& chunk_offset) const {
-      const auto variant_value = column[chunk_offset];
+      if (_cached_dictionary_column) {
+        const auto value_id = _cached_attribute_decoder->get(chunk_offset);
+        if (value_id == _cached_dictionary_column->null_value_id()) {
+          return ColumnIteratorValue<T>::null(chunk_offset_into_ref_column);
+        }
+        return ColumnIteratorValue<T>{(*_cached_dictionary_column->dictionary())[value_id], false,
+                                      chunk_offset_into_ref_column};
+      }
 
-      const auto chunk_offset_into_ref_column =
-          static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
+      if (_cached_run_length_column) {
+        const auto& end_positions = *_cached_run_length_column->end_positions();
+        const auto index = std::distance(end_positions.cbegin(),
+                                         std::lower_bound(end_positions.cbegin(), end_positions.cend(), chunk_offset));
+        if ((*_cached_run_length_column->null_values())[index]) {
+          return ColumnIteratorValue<T>::null(chunk_offset_into_ref_column);
+        }
+        return ColumnIteratorValue<T>{(*_cached_run_length_column->values())[index], false,
+                                      chunk_offset_into_ref_column};
+      }
 
-      if (variant_is_null(variant_value)) {
-        return ColumnIteratorValue<T>{T{}, true, chunk_offset_into_ref_column};
+      if constexpr (std::is_same_v<T, std::string>) {
+        Fail("String columns are expected to be value, dictionary or run-length encoded columns");
+      } else {
+        const auto variant_value = (*_cached_column)[chunk_offset];
+        if (variant_is_null(variant_value)) return ColumnIteratorValue<T>::null(chunk_offset_into_ref_column);
+        return ColumnIteratorValue<T>{type_cast<T>(variant_value), false, chunk_offset_into_ref_column};
       }
+    }
 
-      return ColumnIteratorValue<T>{type_cast<T>(variant_value), false, chunk_offset_into_ref_column};
+   private:
+    void _cache_column(const ChunkID chunk_id) const {
+      _cached_chunk_id = chunk_id;
+
+      auto& referenced_column = (*_referenced_columns)[chunk_id];
+      if (!referenced_column) referenced_column = _table->get_chunk(chunk_id)->get_column(_column_id);
+      _cached_column = referenced_column;
+
+      _cached_value_column = dynamic_cast<const ValueColumn<T>*>(_cached_column.get());
+      _cached_dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(_cached_column.get());
+      _cached_run_length_column = dynamic_cast<const RunLengthColumn<T>*>(_cached_column.get());
+      _cached_attribute_decoder =
+          _cached_dictionary_column ? _cached_dictionary_column->attribute_vector()->create_base_decoder() : nullptr;
     }
 
    private:
     const std::shared_ptr<const Table> _table;
     const ColumnID _column_id;
+    std::unordered_map<ChunkID, std::shared_ptr<const BaseColumn>>* _referenced_columns;
 
     mutable ChunkID _cached_chunk_id;
     mutable std::shared_ptr<const BaseColumn> _cached_column;
+    mutable const ValueColumn<T>* _cached_value_column{nullptr};
+    mutable const DictionaryColumn<T>* _cached_dictionary_column{nullptr};
+    mutable const RunLengthColumn<T>* _cached_run_length_column{nullptr};
+    mutable std::shared_ptr<BaseVectorDecompressor> _cached_attribute_decoder;
 
     const PosListIterator _begin_pos_list_it;
     PosListIterator _pos_list_it;
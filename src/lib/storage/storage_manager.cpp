@@ -11,6 +11,8 @@
 #include "scheduler/job_task.hpp"
 #include "statistics/generate_table_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/table_placement.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -24,28 +26,39 @@ StorageManager& StorageManager::get() {
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
   Assert(_tables.find(name) == _tables.end(), "A table with the name " + name + " already exists");
   Assert(_views.find(name) == _views.end(), "Cannot add table " + name + " - a view with the same name already exists");
+  Assert(_materialized_views.find(name) == _materialized_views.end(),
+         "Cannot add table " + name + " - a materialized view with the same name already exists");
 
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id++) {
     Assert(table->get_chunk(chunk_id)->has_mvcc_columns(), "Table must have MVCC columns.");
   }
 
   table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*table)));
+  TablePlacement::place_chunks(table);
   _tables.emplace(name, std::move(table));
 }
 
 void StorageManager::drop_table(const std::string& name) {
+  const auto table_iter = _tables.find(name);
+  if (table_iter != _tables.end()) TablePlacement::drop_replicas(*table_iter->second);
+
   const auto num_deleted = _tables.erase(name);
   Assert(num_deleted == 1, "Error deleting table " + name + ": _erase() returned " + std::to_string(num_deleted) + ".");
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
   const auto iter = _tables.find(name);
-  Assert(iter != _tables.end(), "No such table named '" + name + "'");
+  if (iter != _tables.end()) return iter->second;
 
-  return iter->second;
+  const auto materialized_view_iter = _materialized_views.find(name);
+  Assert(materialized_view_iter != _materialized_views.end(), "No such table named '" + name + "'");
+
+  return materialized_view_iter->second->table();
 }
 
-bool StorageManager::has_table(const std::string& name) const { return _tables.count(name); }
+bool StorageManager::has_table(const std::string& name) const {
+  return _tables.count(name) || _materialized_views.count(name);
+}
 
 std::vector<std::string> StorageManager::table_names() const {
   std::vector<std::string> table_names;
@@ -62,6 +75,8 @@ void StorageManager::add_view(const std::string& name, std::shared_ptr<const Abs
   Assert(_tables.find(name) == _tables.end(),
          "Cannot add view " + name + " - a table with the same name already exists");
   Assert(_views.find(name) == _views.end(), "A view with the name " + name + " already exists");
+  Assert(_materialized_views.find(name) == _materialized_views.end(),
+         "Cannot add view " + name + " - a materialized view with the same name already exists");
 
   _views.emplace(name, std::move(view));
 }
@@ -91,6 +106,44 @@ std::vector<std::string> StorageManager::view_names() const {
   return view_names;
 }
 
+void StorageManager::add_materialized_view(const std::string& name,
+                                           std::shared_ptr<MaterializedView> materialized_view) {
+  Assert(_tables.find(name) == _tables.end(),
+         "Cannot add materialized view " + name + " - a table with the same name already exists");
+  Assert(_views.find(name) == _views.end(),
+         "Cannot add materialized view " + name + " - a view with the same name already exists");
+  Assert(_materialized_views.find(name) == _materialized_views.end(),
+         "A materialized view with the name " + name + " already exists");
+
+  _materialized_views.emplace(name, std::move(materialized_view));
+}
+
+void StorageManager::drop_materialized_view(const std::string& name) {
+  const auto num_deleted = _materialized_views.erase(name);
+  Assert(num_deleted == 1, "Error deleting materialized view " + name + ": _erase() returned " +
+                               std::to_string(num_deleted) + ".");
+}
+
+std::shared_ptr<MaterializedView> StorageManager::get_materialized_view(const std::string& name) const {
+  const auto iter = _materialized_views.find(name);
+  Assert(iter != _materialized_views.end(), "No such materialized view named '" + name + "'");
+
+  return iter->second;
+}
+
+bool StorageManager::has_materialized_view(const std::string& name) const { return _materialized_views.count(name); }
+
+std::vector<std::string> StorageManager::materialized_view_names() const {
+  std::vector<std::string> materialized_view_names;
+  materialized_view_names.reserve(_materialized_views.size());
+
+  for (const auto& materialized_view_item : _materialized_views) {
+    materialized_view_names.emplace_back(materialized_view_item.first);
+  }
+
+  return materialized_view_names;
+}
+
 void StorageManager::print(std::ostream& out) const {
   out << "==================" << std::endl;
   out << "===== Tables =====" << std::endl << std::endl;
@@ -109,9 +162,22 @@ void StorageManager::print(std::ostream& out) const {
     out << "==== view >> " << view.first << " <<";
     out << std::endl;
   }
+
+  out << "==================" << std::endl;
+  out << "= Materialized Views =" << std::endl << std::endl;
+
+  for (auto const& materialized_view : _materialized_views) {
+    const auto table = materialized_view.second->table();
+    out << "==== materialized view >> " << materialized_view.first << " <<";
+    out << " (" << table->column_count() << " columns, " << table->row_count() << " rows)";
+    out << std::endl;
+  }
 }
 
-void StorageManager::reset() { get() = StorageManager(); }
+void StorageManager::reset() {
+  for (const auto& table_item : get()._tables) TablePlacement::drop_replicas(*table_item.second);
+  get() = StorageManager();
+}
 
 void StorageManager::export_all_tables_as_csv(const std::string& path) {
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
@@ -12,6 +12,7 @@ namespace opossum {
 
 class Table;
 class AbstractLQPNode;
+class MaterializedView;
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
@@ -25,10 +26,10 @@ class StorageManager : private Noncopyable {
   // removes the table from the storage manger
   void drop_table(const std::string& name);
 
-  // returns the table instance with the given name
+  // returns the table instance with the given name, or the result table of the materialized view with that name
   std::shared_ptr<Table> get_table(const std::string& name) const;
 
-  // returns whether the storage manager holds a table with the given name
+  // returns whether the storage manager holds a table or materialized view with the given name
   bool has_table(const std::string& name) const;
 
   // returns a list of all table names
@@ -49,6 +50,21 @@ class StorageManager : private Noncopyable {
   // returns a list of all view names
   std::vector<std::string> view_names() const;
 
+  // adds a materialized view to the storage manager, its result can be read like a table with the given name
+  void add_materialized_view(const std::string& name, std::shared_ptr<MaterializedView> materialized_view);
+
+  // removes the materialized view from the storage manger
+  void drop_materialized_view(const std::string& name);
+
+  // returns the materialized view with the given name
+  std::shared_ptr<MaterializedView> get_materialized_view(const std::string& name) const;
+
+  // returns whether the storage manager holds a materialized view with the given name
+  bool has_materialized_view(const std::string& name) const;
+
+  // returns a list of all materialized view names
+  std::vector<std::string> materialized_view_names() const;
+
   // prints information about all tables in the storage manager (name, #columns, #rows, #chunks)
   void print(std::ostream& out = std::cout) const;
 
@@ -69,5 +85,6 @@ class StorageManager : private Noncopyable {
 
   std::map<std::string, std::shared_ptr<Table>> _tables;
   std::map<std::string, std::shared_ptr<const AbstractLQPNode>> _views;
+  std::map<std::string, std::shared_ptr<MaterializedView>> _materialized_views;
 };
 }  // namespace opossum
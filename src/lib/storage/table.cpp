@@ -9,6 +9,8 @@
 #include <vector>
 
 #include "resolve_type.hpp"
+#include "storage/materialize.hpp"
+#include "table_placement.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_column.hpp"
@@ -65,6 +67,11 @@ std::vector<DataType> Table::column_data_types() const {
   return data_types;
 }
 
+const LogicalType& Table::column_logical_type(const ColumnID column_id) const {
+  DebugAssert(column_id < _column_definitions.size(), "ColumnID out of range");
+  return _column_definitions[column_id].logical_type;
+}
+
 bool Table::column_is_nullable(const ColumnID column_id) const {
   DebugAssert(column_id < _column_definitions.size(), "ColumnID out of range");
   return _column_definitions[column_id].nullable;
@@ -93,6 +100,29 @@ void Table::append(std::vector<AllTypeVariant> values) {
   _chunks.back()->append(values);
 }
 
+template <typename T>
+T Table::get_value(const ColumnID column_id, const size_t row_number) const {
+  PerformanceWarning("get_value() used");
+
+  Assert(column_id < column_count(), "column_id invalid");
+
+  size_t row_counter = 0u;
+  for (auto& chunk : _chunks) {
+    size_t current_size = chunk->size();
+    row_counter += current_size;
+    if (row_counter > row_number) {
+      const auto chunk_offset = static_cast<ChunkOffset>(row_number + current_size - row_counter);
+
+      auto values = std::vector<T>{};
+      auto nulls = std::vector<bool>{};
+      materialize_values_and_nulls(*chunk->get_column(column_id), chunk_offset, chunk_offset + 1, values, nulls);
+      Assert(!nulls.front(), "get_value() cannot return NULL");
+      return values.front();
+    }
+  }
+  Fail("Row does not exist.");
+}
+
 void Table::append_mutable_chunk() {
   ChunkColumns columns;
   for (const auto& column_definition : _column_definitions) {
@@ -140,6 +170,16 @@ const ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) const {
   return ProxyChunk(_chunks[chunk_id]);
 }
 
+std::vector<uint64_t> Table::access_heatmap(size_t lookback) const {
+  auto heatmap = std::vector<uint64_t>(_chunks.size(), 0u);
+  for (auto chunk_id = size_t{0}; chunk_id < _chunks.size(); ++chunk_id) {
+    if (const auto& access_counter = _chunks[chunk_id]->access_counter()) {
+      heatmap[chunk_id] = access_counter->history_sample(lookback);
+    }
+  }
+  return heatmap;
+}
+
 void Table::append_chunk(const ChunkColumns& columns, const std::optional<PolymorphicAllocator<Chunk>>& alloc,
                          const std::shared_ptr<ChunkAccessCounter>& access_counter) {
   const auto chunk_size = columns.empty() ? 0u : columns[0]->size();
@@ -191,6 +231,39 @@ void Table::append_chunk(const std::shared_ptr<Chunk> chunk) {
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
+void Table::set_in_place_updates(const bool in_place_updates) { _in_place_updates = in_place_updates; }
+
+bool Table::in_place_updates() const { return _in_place_updates; }
+
+void Table::set_placement_policy(const PlacementPolicy placement_policy) {
+  _placement_policy = placement_policy;
+  _replicas = placement_policy == PlacementPolicy::Replicated ? std::make_shared<TableReplicas>() : nullptr;
+}
+
+PlacementPolicy Table::placement_policy() const { return _placement_policy; }
+
+const std::shared_ptr<TableReplicas>& Table::replicas() const { return _replicas; }
+
+std::shared_ptr<const Table> Table::origin_table() const { return _origin_table; }
+
+void Table::set_origin_table(const std::shared_ptr<const Table>& origin_table) { _origin_table = origin_table; }
+
+CommitID Table::last_commit_id() const { return _last_commit_id; }
+
+void Table::update_last_commit_id(const CommitID commit_id) {
+  auto last_commit_id = _last_commit_id.load();
+  while (last_commit_id < commit_id && !_last_commit_id.compare_exchange_weak(last_commit_id, commit_id)) {
+  }
+}
+
+std::shared_ptr<const Table> Table::pin(const std::shared_ptr<const Table>& stored_table,
+                                       const std::shared_ptr<const Table>& table) {
+  ++stored_table->_pin_count;
+  return std::shared_ptr<const Table>(table.get(), [stored_table, table](const Table*) { --stored_table->_pin_count; });
+}
+
+bool Table::is_pinned() const { return _pin_count > 0; }
+
 std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
 
 size_t Table::estimate_memory_usage() const {
@@ -210,4 +283,8 @@ size_t Table::estimate_memory_usage() const {
   return bytes;
 }
 
+#define EXPLICITLY_INSTANTIATE_GET_VALUE(r, data, type) \
+  template type Table::get_value<type>(const ColumnID column_id, const size_t row_number) const;
+BOOST_PP_SEQ_FOR_EACH(EXPLICITLY_INSTANTIATE_GET_VALUE, _, DATA_TYPES)
+
 }  // namespace opossum
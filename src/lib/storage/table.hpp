@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -18,6 +19,7 @@
 
 namespace opossum {
 
+class TableReplicas;
 class TableStatistics;
 
 /**
@@ -44,6 +46,9 @@ class Table : private Noncopyable {
   DataType column_data_type(const ColumnID column_id) const;
   std::vector<DataType> column_data_types() const;
 
+  // LogicalType::Kind::None for columns that are not DATE or DECIMAL
+  const LogicalType& column_logical_type(const ColumnID column_id) const;
+
   bool column_is_nullable(const ColumnID column_id) const;
   std::vector<bool> columns_are_nullable() const;
 
@@ -85,6 +90,13 @@ class Table : private Noncopyable {
   ProxyChunk get_chunk_with_access_counting(ChunkID chunk_id);
   const ProxyChunk get_chunk_with_access_counting(ChunkID chunk_id) const;
 
+  /**
+   * For each chunk, the time it was accessed during the specified number of recent samples of its ChunkAccessCounter
+   * (see ChunkAccessCounter::history_sample()), or 0 if it has no access counter. The samples are taken by the
+   * ChunkMetricsCollectionTask.
+   */
+  std::vector<uint64_t> access_heatmap(size_t lookback) const;
+
   /**
    * Creates a new Chunk and appends it to this table.
    * Makes sure the @param columns match with the TableType (only ReferenceColumns or only data containing columns)
@@ -119,22 +131,9 @@ class Table : private Noncopyable {
   // multiversion concurrency control values of chunks are ignored
   // - table needs to be validated before by Validate operator
   // If you want to write efficient operators, back off!
+  // T must be the DataType of the column, the value must not be NULL
   template <typename T>
-  T get_value(const ColumnID column_id, const size_t row_number) const {
-    PerformanceWarning("get_value() used");
-
-    Assert(column_id < column_count(), "column_id invalid");
-
-    size_t row_counter = 0u;
-    for (auto& chunk : _chunks) {
-      size_t current_size = chunk->size();
-      row_counter += current_size;
-      if (row_counter > row_number) {
-        return get<T>((*chunk->get_column(column_id))[row_number + current_size - row_counter]);
-      }
-    }
-    Fail("Row does not exist.");
-  }
+  T get_value(const ColumnID column_id, const size_t row_number) const;
 
   /** @} */
 
@@ -147,6 +146,50 @@ class Table : private Noncopyable {
 
   std::vector<IndexInfo> get_indexes() const;
 
+  /**
+   * Whether Update may write new values of fixed-width columns of this table as versions of the values instead of new
+   * row versions, see ValueDeltas. Only applies to tables with MVCC columns. Disabled by default.
+   */
+  void set_in_place_updates(const bool in_place_updates);
+  bool in_place_updates() const;
+
+  /**
+   * How the chunks of this table are placed on the NUMA nodes once it is added to the StorageManager, see
+   * TablePlacement. Needs to be set before the table is added. Local by default.
+   */
+  void set_placement_policy(const PlacementPolicy placement_policy);
+  PlacementPolicy placement_policy() const;
+
+  // The replicas of the chunks of tables with PlacementPolicy::Replicated, nullptr for all other tables
+  const std::shared_ptr<TableReplicas>& replicas() const;
+
+  /**
+   * For a copy of a table with the values that a transaction sees (see create_table_with_visible_values()), the table
+   * the copy was created from. Both have the same rows and MvccColumns. nullptr for all other tables.
+   */
+  std::shared_ptr<const Table> origin_table() const;
+  void set_origin_table(const std::shared_ptr<const Table>& origin_table);
+
+  /**
+   * The CommitID of the last transaction that inserted, deleted or updated rows in this Table, or 0 if none did so far.
+   * Used to decide whether results that were computed from this Table are still up to date (see QueryResultCache).
+   * Modifications that bypass the MVCC (e.g., append()) are not tracked.
+   */
+  CommitID last_commit_id() const;
+
+  // Called by the ReadWriteOperators when committing. Commits may arrive out of order, the highest CommitID wins.
+  void update_last_commit_id(const CommitID commit_id);
+
+  /**
+   * Returns a pointer to table (stored_table or a Table that shares its chunks, e.g., a copy with the values that a
+   * transaction sees) that pins stored_table until the pointer and all copies of it are destroyed. GetTable pins the
+   * tables it reads, so that query results, whose ReferenceColumns hold the returned pointer, keep the table pinned
+   * after their transaction ended. The DeltaMergeTask only reclaims chunks of tables that are not pinned.
+   */
+  static std::shared_ptr<const Table> pin(const std::shared_ptr<const Table>& stored_table,
+                                          const std::shared_ptr<const Table>& table);
+  bool is_pinned() const;
+
   template <typename Index>
   void create_index(const std::vector<ColumnID>& column_ids, const std::string& name = "") {
     ColumnIndexType index_type = get_index_type_of<Index>();
@@ -172,5 +215,11 @@ class Table : private Noncopyable {
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexInfo> _indexes;
+  std::atomic<CommitID> _last_commit_id{0};
+  bool _in_place_updates{false};
+  PlacementPolicy _placement_policy{PlacementPolicy::Local};
+  std::shared_ptr<TableReplicas> _replicas;
+  std::shared_ptr<const Table> _origin_table;
+  mutable std::atomic<size_t> _pin_count{0};
 };
 }  // namespace opossum
@@ -2,13 +2,21 @@
 
 namespace opossum {
 
-TableColumnDefinition::TableColumnDefinition(const std::string& name, const DataType data_type, const bool nullable)
-    : name(name), data_type(data_type), nullable(nullable) {
+TableColumnDefinition::TableColumnDefinition(const std::string& name, const DataType data_type, const bool nullable,
+                                             const LogicalType& logical_type)
+    : name(name), data_type(data_type), nullable(nullable), logical_type(logical_type) {
   Assert(name.size() <= std::numeric_limits<ColumnNameLength>::max(), "Column Name is too long");
+  Assert(logical_type.kind == LogicalType::Kind::None || logical_type.data_type() == data_type,
+         "DataType of column " + name + " does not match its logical type");
 }
 
+TableColumnDefinition::TableColumnDefinition(const std::string& name, const LogicalType& logical_type,
+                                             const bool nullable)
+    : TableColumnDefinition(name, logical_type.data_type(), nullable, logical_type) {}
+
 bool TableColumnDefinition::operator==(const TableColumnDefinition& rhs) const {
-  return name == rhs.name && data_type == rhs.data_type && nullable == rhs.nullable;
+  return name == rhs.name && data_type == rhs.data_type && nullable == rhs.nullable &&
+         logical_type == rhs.logical_type;
 }
 
 TableColumnDefinitions concatenated(const TableColumnDefinitions& lhs, const TableColumnDefinitions& rhs) {
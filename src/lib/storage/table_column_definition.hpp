@@ -1,19 +1,25 @@
 #pragma once
 
 #include "all_type_variant.hpp"
+#include "logical_type.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 struct TableColumnDefinition final {
   TableColumnDefinition() = default;
-  TableColumnDefinition(const std::string& name, const DataType data_type, const bool nullable = false);
+  TableColumnDefinition(const std::string& name, const DataType data_type, const bool nullable = false,
+                        const LogicalType& logical_type = {});
+
+  // Creates a column of a logical type (DATE or DECIMAL), which is stored as LogicalType::data_type()
+  TableColumnDefinition(const std::string& name, const LogicalType& logical_type, const bool nullable = false);
 
   bool operator==(const TableColumnDefinition& rhs) const;
 
   std::string name;
   DataType data_type{DataType::Int};
   bool nullable{false};
+  LogicalType logical_type;
 };
 
 using TableColumnDefinitions = std::vector<TableColumnDefinition>;
@@ -0,0 +1,145 @@
+#include "table_placement.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "scheduler/abstract_scheduler.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/topology.hpp"
+#include "scheduler/worker.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/numa_memory_resource.hpp"
+
+#if HYRISE_NUMA_SUPPORT
+#include "storage/numa_placement_manager.hpp"
+#endif
+
+namespace opossum {
+
+void TablePlacement::place_chunks(const std::shared_ptr<Table>& table) {
+  switch (table->placement_policy()) {
+    case PlacementPolicy::Local:
+      return;
+
+    case PlacementPolicy::Interleaved: {
+      Assert(table->get_indexes().empty(), "Tables with indices cannot be interleaved, see Chunk::migrate()");
+
+      const auto nodes = node_count();
+      if (nodes == 1) return;
+
+      for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        const auto node_id = NodeID{static_cast<NodeID::base_type>(chunk_id % nodes)};
+        table->get_chunk(chunk_id)->migrate(memory_resource(node_id));
+      }
+      return;
+    }
+
+    case PlacementPolicy::Replicated:
+      for (NodeID node_id{0}; static_cast<size_t>(node_id) < node_count(); ++node_id) {
+        replica_for_node(table, node_id);
+      }
+      return;
+  }
+}
+
+std::shared_ptr<const Table> TablePlacement::local_table(const std::shared_ptr<Table>& table) {
+  if (table->placement_policy() != PlacementPolicy::Replicated || !table->get_indexes().empty()) return table;
+
+  const auto worker = Worker::get_this_thread_worker();
+  if (!worker || static_cast<size_t>(worker->queue()->node_id()) >= node_count()) return table;
+
+  return replica_for_node(table, worker->queue()->node_id());
+}
+
+std::shared_ptr<const Table> TablePlacement::replica_for_node(const std::shared_ptr<Table>& table,
+                                                              const NodeID node_id) {
+  const auto& replicas = table->replicas();
+  DebugAssert(replicas, "Only replicated tables have replicas");
+  DebugAssert(static_cast<size_t>(node_id) < node_count(), "node_id is out of bounds");
+
+  std::lock_guard<std::mutex> lock(replicas->mutex);
+
+  if (replicas->nodes.size() <= static_cast<size_t>(node_id)) {
+    replicas->nodes.resize(static_cast<size_t>(node_id) + 1u);
+  }
+  auto& node_replicas = replicas->nodes[node_id];
+
+  const auto chunk_count = table->chunk_count();
+
+  const auto shared_chunk_is_encoded = [&]() {
+    return std::any_of(node_replicas.shared_chunk_ids.cbegin(), node_replicas.shared_chunk_ids.cend(),
+                       [&](const auto chunk_id) { return !table->get_chunk(chunk_id)->is_mutable(); });
+  };
+
+  if (node_replicas.table && node_replicas.table->chunk_count() == chunk_count && !shared_chunk_is_encoded()) {
+    return node_replicas.table;
+  }
+
+  auto replica_table = std::make_shared<Table>(table->column_definitions(), TableType::Data, table->max_chunk_size(),
+                                               table->has_mvcc());
+  replica_table->set_origin_table(table);
+
+  node_replicas.chunks.resize(chunk_count);
+  node_replicas.shared_chunk_ids.clear();
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+
+    // Values are appended to mutable chunks, so their replicas would be outdated right away
+    if (!node_replicas.chunks[chunk_id] && !chunk->is_mutable()) {
+      node_replicas.chunks[chunk_id] = chunk->copy_using_memory_source(memory_resource(node_id));
+    }
+
+    if (node_replicas.chunks[chunk_id]) {
+      replica_table->append_chunk(node_replicas.chunks[chunk_id]);
+    } else {
+      replica_table->append_chunk(chunk);
+      node_replicas.shared_chunk_ids.emplace_back(chunk_id);
+    }
+  }
+
+  node_replicas.table = replica_table;
+  return replica_table;
+}
+
+void TablePlacement::drop_replicas(const Table& table) {
+  const auto& replicas = table.replicas();
+  if (!replicas) return;
+
+  std::lock_guard<std::mutex> lock(replicas->mutex);
+  replicas->nodes.clear();
+}
+
+size_t TablePlacement::node_count() {
+#if HYRISE_NUMA_SUPPORT
+  return NUMAPlacementManager::get().topology()->nodes().size();
+#else
+  return CurrentScheduler::is_set() ? CurrentScheduler::get()->topology()->nodes().size() : 1u;
+#endif
+}
+
+boost::container::pmr::memory_resource* TablePlacement::memory_resource(const NodeID node_id) {
+#if HYRISE_NUMA_SUPPORT
+  return NUMAPlacementManager::get().get_memory_resource(static_cast<int>(node_id));
+#else
+  // The memory resources must outlive all tables, so they are never destroyed (see NUMAPlacementManager::get())
+  static auto mutex = std::mutex{};
+  static auto* memory_resources = new std::vector<std::unique_ptr<NUMAMemoryResource>>{};
+
+  std::lock_guard<std::mutex> lock(mutex);
+  while (memory_resources->size() <= static_cast<size_t>(node_id)) {
+    const auto resource_node_id = static_cast<int>(memory_resources->size());
+    memory_resources->emplace_back(
+        std::make_unique<NUMAMemoryResource>(resource_node_id, "numa_" + std::to_string(resource_node_id)));
+  }
+  return (*memory_resources)[node_id].get();
+#endif
+}
+
+}  // namespace opossum
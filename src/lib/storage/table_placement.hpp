@@ -0,0 +1,80 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// The replicas of the chunks of a table with PlacementPolicy::Replicated, see TablePlacement
+class TableReplicas : private Noncopyable {
+ public:
+  struct NodeReplicas {
+    // The replica of each chunk or nullptr if the chunk was not replicated (yet)
+    std::vector<std::shared_ptr<Chunk>> chunks;
+
+    // The table handed out for the node, and the chunks it shares with the stored table because they were mutable
+    std::shared_ptr<const Table> table;
+    std::vector<ChunkID> shared_chunk_ids;
+  };
+
+  std::mutex mutex;
+  std::vector<NodeReplicas> nodes;
+};
+
+/**
+ * Places the chunks of stored tables on the NUMA nodes according to their PlacementPolicy:
+ *
+ *   - Local: The chunks stay where they were allocated. The NUMAPlacementManager may migrate them later on.
+ *   - Interleaved: When the table is added to the StorageManager, its chunks are distributed round robin across the
+ *                  nodes, so that probes from all nodes are spread evenly.
+ *   - Replicated: Every immutable chunk is copied to every node. GetTable hands out the replica of the node of the
+ *                 calling worker, so that small, hot tables (e.g., dimension tables that are probed by joins from all
+ *                 nodes) are always read from local memory. The replicas share the MvccColumns and value versions
+ *                 with the original chunks, so transactions see the same rows. Mutable chunks are not replicated,
+ *                 they are replicated once they are encoded. Indices are not replicated, so tables with indexes are
+ *                 read from the original chunks until the indexes are dropped.
+ *
+ * Without NUMA support, the nodes are the nodes of the current scheduler and a chunk's node is only a label (see
+ * Chunk::node_id()).
+ */
+class TablePlacement {
+ public:
+  // Applies the placement policy of a table that is added to the StorageManager
+  static void place_chunks(const std::shared_ptr<Table>& table);
+
+  /**
+   * For replicated tables, returns a table with the replicas of the node of the calling worker (see
+   * replica_for_node()). Returns the table itself for all other tables, for tables with indexes (so that IndexScans
+   * find them), and if not called from a worker.
+   */
+  static std::shared_ptr<const Table> local_table(const std::shared_ptr<Table>& table);
+
+  /**
+   * Returns a table of the replicas of the immutable chunks of a replicated table on the given node, replicating
+   * chunks that were not replicated yet. The mutable chunks are shared with the table, which is the origin table of
+   * the returned table (see Table::origin_table()).
+   *
+   * The returned table is cached per node. It is only rebuilt once chunks were appended to the table or one of the
+   * shared chunks was encoded, so that it can be replicated.
+   */
+  static std::shared_ptr<const Table> replica_for_node(const std::shared_ptr<Table>& table, const NodeID node_id);
+
+  /**
+   * Releases the replicas of a table that is dropped. The cached tables of the replicas reference the table as their
+   * origin, so the table would be kept alive otherwise. Readers that hold a replica can continue to use it.
+   */
+  static void drop_replicas(const Table& table);
+
+  static size_t node_count();
+  static boost::container::pmr::memory_resource* memory_resource(const NodeID node_id);
+};
+
+}  // namespace opossum
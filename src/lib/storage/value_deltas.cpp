@@ -0,0 +1,234 @@
+#include "value_deltas.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::shared_ptr<BaseColumn> copy_value_column(const BaseColumn& column) {
+  auto copy = std::shared_ptr<BaseColumn>{};
+
+  resolve_data_type(column.data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto& value_column = static_cast<const ValueColumn<ColumnDataType>&>(column);
+    auto values = pmr_concurrent_vector<ColumnDataType>{value_column.values()};
+
+    if (value_column.is_nullable()) {
+      auto null_values = pmr_concurrent_vector<bool>{value_column.null_values()};
+      copy = std::make_shared<ValueColumn<ColumnDataType>>(std::move(values), std::move(null_values));
+    } else {
+      copy = std::make_shared<ValueColumn<ColumnDataType>>(std::move(values));
+    }
+  });
+
+  return copy;
+}
+
+void write_value(BaseColumn& column, const ChunkOffset chunk_offset, const AllTypeVariant& value) {
+  resolve_data_type(column.data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto& value_column = static_cast<ValueColumn<ColumnDataType>&>(column);
+
+    if (variant_is_null(value)) {
+      value_column.null_values()[chunk_offset] = true;
+      return;
+    }
+
+    value_column.values()[chunk_offset] = type_cast<ColumnDataType>(value);
+    if (value_column.is_nullable()) value_column.null_values()[chunk_offset] = false;
+  });
+}
+
+}  // namespace
+
+bool ValueDeltas::row_is_writable(const ChunkOffset chunk_offset, const TransactionID transaction_id,
+                                  const CommitID snapshot_commit_id) const {
+  if (empty()) return true;
+
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return std::none_of(_versions.cbegin(), _versions.cend(), [&](const auto& version) {
+    return version.chunk_offset == chunk_offset && !_is_visible(version, transaction_id, snapshot_commit_id);
+  });
+}
+
+bool ValueDeltas::try_start_writing() {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  if (_is_frozen) return false;
+
+  ++_writer_count;
+  return true;
+}
+
+void ValueDeltas::finish_writing() {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  DebugAssert(_writer_count > 0, "No writer registered");
+  --_writer_count;
+}
+
+bool ValueDeltas::try_freeze() {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  if (_writer_count > 0 || !_versions.empty()) return false;
+
+  _is_frozen = true;
+  return true;
+}
+
+void ValueDeltas::unfreeze() {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  _is_frozen = false;
+}
+
+void ValueDeltas::add(const ColumnID column_id, const ChunkOffset chunk_offset, const AllTypeVariant& value,
+                      const TransactionID transaction_id) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  DebugAssert(_writer_count > 0 && !_is_frozen, "Writers need to be registered via try_start_writing()");
+  _versions.emplace_back(Version{column_id, chunk_offset, value, transaction_id, MvccColumns::MAX_COMMIT_ID});
+  _size = _versions.size();
+}
+
+void ValueDeltas::commit(const TransactionID transaction_id, const CommitID commit_id) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  for (auto& version : _versions) {
+    if (version.transaction_id == transaction_id && version.commit_id == MvccColumns::MAX_COMMIT_ID) {
+      version.commit_id = commit_id;
+    }
+  }
+}
+
+void ValueDeltas::rollback(const TransactionID transaction_id) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  _versions.erase(std::remove_if(_versions.begin(), _versions.end(),
+                                 [&](const auto& version) {
+                                   return version.transaction_id == transaction_id &&
+                                          version.commit_id == MvccColumns::MAX_COMMIT_ID;
+                                 }),
+                  _versions.end());
+  _size = _versions.size();
+}
+
+bool ValueDeltas::empty() const { return _size == 0; }
+
+size_t ValueDeltas::size() const { return _size; }
+
+std::optional<ChunkColumns> ValueDeltas::visible_columns(const Chunk& chunk, const TransactionID transaction_id,
+                                                         const CommitID snapshot_commit_id) const {
+  if (empty()) return std::nullopt;
+
+  auto columns = std::optional<ChunkColumns>{};
+  auto column_is_copied = std::vector<bool>(chunk.column_count(), false);
+
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+
+  // Newer versions of a value come later and overwrite the older ones
+  for (const auto& version : _versions) {
+    if (!_is_visible(version, transaction_id, snapshot_commit_id)) continue;
+
+    if (!columns) {
+      columns.emplace();
+      for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+        columns->push_back(chunk.get_mutable_column(column_id));
+      }
+    }
+
+    auto& column = (*columns)[version.column_id];
+    if (!column_is_copied[version.column_id]) {
+      Assert(std::dynamic_pointer_cast<const BaseValueColumn>(column), "Chunks with value versions must stay mutable");
+      column = copy_value_column(*column);
+      column_is_copied[version.column_id] = true;
+    }
+
+    write_value(*column, version.chunk_offset, version.value);
+  }
+
+  return columns;
+}
+
+size_t ValueDeltas::merge(Chunk& chunk, const CommitID commit_id) {
+  if (empty()) return 0;
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+
+  const auto is_mergeable = [&](const auto& version) { return version.commit_id <= commit_id; };
+
+  // The copies of the columns with mergeable versions, which replace the columns once all versions are written
+  auto column_copies = std::vector<std::shared_ptr<BaseColumn>>(chunk.column_count());
+
+  // Versions of a value are applied in the order they were written, so that the newest one ends up in the main values
+  for (const auto& version : _versions) {
+    if (!is_mergeable(version)) continue;
+
+    auto& column_copy = column_copies[version.column_id];
+    if (!column_copy) {
+      const auto column = chunk.get_column(version.column_id);
+      Assert(std::dynamic_pointer_cast<const BaseValueColumn>(column), "Chunks with value versions must stay mutable");
+      column_copy = copy_value_column(*column);
+    }
+
+    write_value(*column_copy, version.chunk_offset, version.value);
+  }
+
+  for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+    if (column_copies[column_id]) chunk.replace_column(column_id, column_copies[column_id]);
+  }
+
+  const auto version_count = _versions.size();
+  _versions.erase(std::remove_if(_versions.begin(), _versions.end(), is_mergeable), _versions.end());
+  _size = _versions.size();
+
+  return version_count - _versions.size();
+}
+
+bool ValueDeltas::_is_visible(const Version& version, const TransactionID transaction_id,
+                              const CommitID snapshot_commit_id) {
+  if (version.commit_id == MvccColumns::MAX_COMMIT_ID) return version.transaction_id == transaction_id;
+  return version.commit_id <= snapshot_commit_id;
+}
+
+std::shared_ptr<const Table> create_table_with_visible_values(const std::shared_ptr<const Table>& table,
+                                                              const TransactionID transaction_id,
+                                                              const CommitID snapshot_commit_id) {
+  auto table_with_visible_values = std::shared_ptr<Table>{};
+
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+
+    auto columns = std::optional<ChunkColumns>{};
+    if (const auto value_deltas = chunk->value_deltas()) {
+      columns = value_deltas->visible_columns(*chunk, transaction_id, snapshot_commit_id);
+    }
+
+    // Copy the table on the first chunk with visible versions. All chunks without such versions are shared.
+    if (columns && !table_with_visible_values) {
+      table_with_visible_values = std::make_shared<Table>(table->column_definitions(), TableType::Data,
+                                                          table->max_chunk_size(), table->has_mvcc());
+      // Tables handed out by GetTable may be copies already (e.g., replicas, see TablePlacement)
+      table_with_visible_values->set_origin_table(table->origin_table() ? table->origin_table() : table);
+      for (ChunkID previous_chunk_id{0}; previous_chunk_id < chunk_id; ++previous_chunk_id) {
+        table_with_visible_values->append_chunk(table->chunks()[previous_chunk_id]);
+      }
+    }
+
+    if (!table_with_visible_values) continue;
+
+    table_with_visible_values->append_chunk(columns ? chunk->copy_with_columns(*columns) : table->chunks()[chunk_id]);
+  }
+
+  if (!table_with_visible_values) return table;
+
+  return table_with_visible_values;
+}
+
+}  // namespace opossum
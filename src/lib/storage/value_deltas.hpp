@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <shared_mutex>  // NOLINT lint thinks this is a C header or something
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "chunk.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Newer versions of single values of a chunk. For tables with in-place updates (see Table::set_in_place_updates()),
+ * Update stores the new values of fixed-width columns here instead of inserting new row versions, so that an update
+ * costs O(changed columns) and the table does not grow.
+ *
+ * A version is either uncommitted, and only visible to the transaction that wrote it, or committed and visible to all
+ * transactions whose snapshot includes its CommitID. The values in the chunk's columns (the "main" values) are visible
+ * where no newer version is. Writes to a row are serialized via its lock in the MvccColumns.
+ *
+ * GetTable replaces the values of the chunks by the versions visible to its transaction (see
+ * create_table_with_visible_values()). Versions that every transaction sees are written back into the main values by
+ * merge() (see MergeValueDeltasTask), so that the number of versions stays small.
+ *
+ * Only full chunks of ValueColumns are updated this way. They do not grow anymore, so that the copies of their columns
+ * with visible versions always have the size of the MvccColumns. Such chunks must not be compressed or otherwise have
+ * their columns replaced while they have versions. To rule out that a writer adds versions after such an operation
+ * checked for them, writers announce themselves with try_start_writing() and the operations freeze the chunk with
+ * try_freeze() first (see Update and ChunkCompressionTask). Both happen under the same lock, so only one of them
+ * succeeds.
+ */
+class ValueDeltas : private Noncopyable {
+ public:
+  /**
+   * Returns false if another transaction wrote a version of a value in the row that the given transaction cannot see,
+   * i.e., an uncommitted version or one committed after its snapshot. Writing the row would be a write-write conflict.
+   * The caller needs to hold the lock of the row.
+   */
+  bool row_is_writable(const ChunkOffset chunk_offset, const TransactionID transaction_id,
+                       const CommitID snapshot_commit_id) const;
+
+  /**
+   * Registers a writer that is about to add versions, unless the chunk is frozen. Each successful call needs to be
+   * followed by finish_writing(). While a writer is registered, the chunk cannot be frozen.
+   */
+  bool try_start_writing();
+  void finish_writing();
+
+  /**
+   * Freezes the chunk so that no versions can be added anymore, unless a writer is registered or versions are pending.
+   * Operations that replace the columns of the chunk (e.g., compression) call this first and must not touch the chunk
+   * if it fails. Returns true if the chunk is frozen already.
+   */
+  bool try_freeze();
+
+  // Allows writers again, e.g., if the operation that froze the chunk was rolled back
+  void unfreeze();
+
+  // Adds an uncommitted version of a value. The caller needs to be registered as a writer and hold the lock of the row.
+  void add(const ColumnID column_id, const ChunkOffset chunk_offset, const AllTypeVariant& value,
+           const TransactionID transaction_id);
+
+  void commit(const TransactionID transaction_id, const CommitID commit_id);
+  void rollback(const TransactionID transaction_id);
+
+  // Cheap, does not lock
+  bool empty() const;
+  size_t size() const;
+
+  /**
+   * Returns a copy of the columns of chunk in which the values are replaced by the newest versions visible to the
+   * transaction. Only the columns with such versions are copied, all others are shared. Returns std::nullopt if no
+   * version is visible to the transaction.
+   */
+  std::optional<ChunkColumns> visible_columns(const Chunk& chunk, const TransactionID transaction_id,
+                                              const CommitID snapshot_commit_id) const;
+
+  /**
+   * Writes the versions committed at or before commit_id into the ValueColumns of chunk and removes them. No active
+   * transaction may have a snapshot older than commit_id, as it would see values that are too new otherwise (see
+   * TransactionManager::lowest_active_snapshot_commit_id()).
+   *
+   * The main values are not overwritten in place, as readers without a transaction read the ValueColumns without
+   * looking at the versions. Instead, each column with mergeable versions is copied, the versions are written into the
+   * copy and the copy replaces the column atomically (see Chunk::replace_column()). Readers still holding the old
+   * column are not affected. This copies a column per merge, so merges should be batched.
+   *
+   * @return the number of merged versions
+   */
+  size_t merge(Chunk& chunk, const CommitID commit_id);
+
+ private:
+  struct Version {
+    ColumnID column_id;
+    ChunkOffset chunk_offset;
+    AllTypeVariant value;
+    TransactionID transaction_id;
+    CommitID commit_id;  // MvccColumns::MAX_COMMIT_ID while uncommitted
+  };
+
+  static bool _is_visible(const Version& version, const TransactionID transaction_id,
+                          const CommitID snapshot_commit_id);
+
+  // Locked exclusively by all writes, including merge() and the changes of the writer count and the frozen state
+  mutable std::shared_mutex _mutex;
+
+  size_t _writer_count{0};
+  bool _is_frozen{false};
+
+  // In the order in which they were written, so that newer versions of a value come after older ones
+  std::vector<Version> _versions;
+  std::atomic<size_t> _size{0};
+};
+
+/**
+ * Returns table if none of its chunks has versions visible to the transaction. Otherwise, returns a copy of table in
+ * which these chunks are replaced by chunks with the visible values (see ValueDeltas::visible_columns()). The copy
+ * shares the MvccColumns of table and has the same RowIDs, so that Validate and the DML operators can work on it (see
+ * Table::origin_table()).
+ */
+std::shared_ptr<const Table> create_table_with_visible_values(const std::shared_ptr<const Table>& table,
+                                                              const TransactionID transaction_id,
+                                                              const CommitID snapshot_commit_id);
+
+}  // namespace opossum
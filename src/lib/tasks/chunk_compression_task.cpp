@@ -7,6 +7,7 @@
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "storage/value_deltas.hpp"
 
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -29,6 +30,10 @@ void ChunkCompressionTask::_on_execute() {
 
     auto chunk = table->get_chunk(chunk_id);
 
+    // Once frozen, no in-place update can add versions anymore. Chunks that are being updated are skipped.
+    const auto value_deltas = chunk->value_deltas();
+    if (value_deltas && !value_deltas->try_freeze()) continue;
+
     DebugAssert(chunk_is_completed(chunk, table->max_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
@@ -39,6 +44,10 @@ void ChunkCompressionTask::_on_execute() {
 bool ChunkCompressionTask::chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size) {
   if (chunk->size() != max_chunk_size) return false;
 
+  // The versions of in-place updated values need to be merged into the ValueColumns first
+  const auto value_deltas = chunk->value_deltas();
+  if (value_deltas && !value_deltas->empty()) return false;
+
   auto mvcc_columns = chunk->mvcc_columns();
 
   for (const auto begin_cid : mvcc_columns->begin_cids) {
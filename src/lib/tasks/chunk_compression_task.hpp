@@ -24,8 +24,12 @@ class Chunk;
  * it does not touch the columns. However, inserting records while simultaneously
  * compressing the chunk leads to inconsistent state. Therefore only chunks where
  * all insertion has been completed may be compressed. In other words, they need to be
- * full and all of their end-cids must be smaller than infinity. This task calls
- * those chunks “completed”.
+ * full and all of their end-cids must be smaller than infinity. Also, chunks that still
+ * have versions of in-place updated values (see ValueDeltas) must not be compressed, as
+ * these versions need to be merged into the value columns first (see MergeValueDeltasTask).
+ * This task calls those chunks “completed”. As an in-place update could add versions
+ * right after that check, the task freezes the ValueDeltas of a chunk before compressing
+ * it and skips the chunk if an update is in progress (see ValueDeltas::try_freeze()).
  *
  * After the columns have been replaced, the task calls Chunk::shrink_mvcc_columns()
  * in order to reduce fragmentation of the MVCC columns. The MVCC columns are locked
@@ -39,16 +43,15 @@ class ChunkCompressionTask : public AbstractTask {
   explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
   explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
 
- protected:
-  void _on_execute() override;
-
- private:
   /**
    * @brief Checks if a chunks is completed
    *
    * See class comment for further explanation
    */
-  bool chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size);
+  static bool chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size);
+
+ protected:
+  void _on_execute() override;
 
  private:
   const std::string _table_name;
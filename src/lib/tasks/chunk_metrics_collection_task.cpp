@@ -1,7 +1,5 @@
 #include "chunk_metrics_collection_task.hpp"
 
-#if HYRISE_NUMA_SUPPORT
-
 #include <memory>
 #include <string>
 #include <vector>
@@ -26,7 +24,3 @@ void ChunkMetricsCollectionTask::_on_execute() {
 }
 
 }  // namespace opossum
-
-#else
-int chunk_metrics_collection_task_dummy;
-#endif
@@ -1,11 +1,14 @@
 #pragma once
 
-#if HYRISE_NUMA_SUPPORT
-
 #include "scheduler/abstract_task.hpp"
 
 namespace opossum {
 
+/**
+ * Adds the current counters of the ChunkAccessCounters of all stored chunks to their histories. Scheduled regularly by
+ * the NUMAPlacementManager, but also available without NUMA support, e.g., to collect the data for
+ * Table::access_heatmap().
+ */
 class ChunkMetricsCollectionTask : public AbstractTask {
  public:
   ChunkMetricsCollectionTask() = default;
@@ -15,5 +18,3 @@ class ChunkMetricsCollectionTask : public AbstractTask {
 };
 
 }  // namespace opossum
-
-#endif
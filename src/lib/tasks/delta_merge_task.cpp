@@ -0,0 +1,234 @@
+#include "delta_merge_task.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chunk_compression_task.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/rebuild_chunks.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "storage/chunk.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_deltas.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// A column of the given size that consists of a single run of NULLs, or of default values for columns that are not
+// nullable. Replaces the columns of reclaimed chunks.
+std::shared_ptr<BaseColumn> create_placeholder_column(const DataType data_type, const bool nullable,
+                                                      const ChunkOffset size) {
+  auto column = std::shared_ptr<BaseColumn>{};
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    column = std::make_shared<RunLengthColumn<ColumnDataType>>(
+        std::make_shared<pmr_vector<ColumnDataType>>(1u, ColumnDataType{}),
+        std::make_shared<pmr_vector<bool>>(1u, nullable), std::make_shared<pmr_vector<ChunkOffset>>(1u, size - 1));
+  });
+
+  return column;
+}
+
+bool is_placeholder_column(const BaseColumn& column) {
+  auto is_placeholder = false;
+
+  resolve_data_type(column.data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto run_length_column = dynamic_cast<const RunLengthColumn<ColumnDataType>*>(&column);
+    is_placeholder = run_length_column && run_length_column->values()->size() == 1u;
+  });
+
+  return is_placeholder;
+}
+
+}  // namespace
+
+DeltaMergeTask::DeltaMergeTask(const std::string& table_name, const float invalid_row_share)
+    : _table_name{table_name}, _invalid_row_share{invalid_row_share} {}
+
+const std::vector<ChunkID>& DeltaMergeTask::encoded_chunk_ids() const { return _encoded_chunk_ids; }
+
+const std::vector<ChunkID>& DeltaMergeTask::rebuilt_chunk_ids() const { return _rebuilt_chunk_ids; }
+
+const std::vector<ChunkID>& DeltaMergeTask::reclaimed_chunk_ids() const { return _reclaimed_chunk_ids; }
+
+void DeltaMergeTask::_on_execute() {
+  const auto table = StorageManager::get().get_table(_table_name);
+  Assert(table->has_mvcc() == UseMvcc::Yes, "Only tables with MVCC columns can be merged");
+
+  _encoded_chunk_ids.clear();
+  _rebuilt_chunk_ids.clear();
+  _reclaimed_chunk_ids.clear();
+
+  // Insert only appends to the last chunk. All chunks before it do not grow anymore.
+  auto last_chunk_id = ChunkID{0};
+  {
+    auto scoped_lock = table->acquire_append_mutex();
+    if (table->chunk_count() == 0) return;
+    last_chunk_id = static_cast<ChunkID>(table->chunk_count() - 1);
+  }
+
+  // 1. Encode the completed delta chunks
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id <= last_chunk_id; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk->is_mutable() || !ChunkCompressionTask::chunk_is_completed(chunk, table->max_chunk_size())) continue;
+
+    _encoded_chunk_ids.emplace_back(chunk_id);
+    jobs.emplace_back(std::make_shared<ChunkCompressionTask>(_table_name, chunk_id));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // Chunks that are being updated in place are skipped by the ChunkCompressionTask
+  const auto chunk_is_mutable = [&](const auto chunk_id) { return table->get_chunk(chunk_id)->is_mutable(); };
+  _encoded_chunk_ids.erase(std::remove_if(_encoded_chunk_ids.begin(), _encoded_chunk_ids.end(), chunk_is_mutable),
+                           _encoded_chunk_ids.end());
+
+  _rebuild_chunks(*table, last_chunk_id);
+
+  _reclaimed_chunk_ids = reclaim_chunks(_table_name, *table, last_chunk_id);
+}
+
+void DeltaMergeTask::_rebuild_chunks(Table& table, const ChunkID last_chunk_id) {
+  auto chunk_ids_to_rebuild = std::vector<ChunkID>{};
+  auto rebuild_removes_rows_or_chunks = false;
+
+  for (ChunkID chunk_id{0}; chunk_id <= last_chunk_id; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+
+    if (chunk->is_mutable() && (chunk_id == last_chunk_id || chunk->size() == table.max_chunk_size())) continue;
+
+    auto valid_row_count = size_t{0};
+    auto rows_are_committed = true;
+    {
+      const auto mvcc_columns = chunk->mvcc_columns();
+      for (ChunkOffset chunk_offset{0}; chunk_offset < mvcc_columns->size(); ++chunk_offset) {
+        if (mvcc_columns->begin_cids[chunk_offset] == MvccColumns::MAX_COMMIT_ID) rows_are_committed = false;
+        if (mvcc_columns->end_cids[chunk_offset] == MvccColumns::MAX_COMMIT_ID) ++valid_row_count;
+      }
+    }
+
+    // Chunks of which all rows were moved already, or that are still being inserted into, are skipped
+    if (valid_row_count == 0 || !rows_are_committed) continue;
+
+    // Main chunks that are only partially filled count as sparse as well, so that they are combined
+    const auto invalid_row_share = 1.0f - static_cast<float>(valid_row_count) / table.max_chunk_size();
+    if (!chunk->is_mutable() && invalid_row_share < _invalid_row_share) continue;
+
+    chunk_ids_to_rebuild.emplace_back(chunk_id);
+    if (chunk->is_mutable() || valid_row_count < chunk->size()) rebuild_removes_rows_or_chunks = true;
+  }
+
+  // A single main chunk without invalid rows would only be copied
+  if (chunk_ids_to_rebuild.size() > 1) rebuild_removes_rows_or_chunks = true;
+
+  if (chunk_ids_to_rebuild.empty() || !rebuild_removes_rows_or_chunks) return;
+
+  // Values updated in place are written to the new chunks as well, but pending versions would be lost. Main chunks
+  // cannot be updated in place (see Update), delta chunks are frozen so that no versions are added during the rebuild.
+  auto frozen_chunk_ids = std::vector<ChunkID>{};
+  const auto unfreeze_chunks = [&]() {
+    for (const auto chunk_id : frozen_chunk_ids) table.get_chunk(chunk_id)->value_deltas()->unfreeze();
+  };
+
+  for (const auto chunk_id : chunk_ids_to_rebuild) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk->is_mutable()) continue;
+
+    if (!chunk->value_deltas()->try_freeze()) {
+      unfreeze_chunks();
+      return;
+    }
+    frozen_chunk_ids.emplace_back(chunk_id);
+  }
+
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  auto rebuild_chunks = std::make_shared<RebuildChunks>(_table_name, chunk_ids_to_rebuild);
+  rebuild_chunks->set_transaction_context(transaction_context);
+  rebuild_chunks->execute();
+
+  if (rebuild_chunks->execute_failed()) {
+    transaction_context->rollback();
+    unfreeze_chunks();
+    return;
+  }
+
+  transaction_context->commit();
+  _rebuilt_chunk_ids = chunk_ids_to_rebuild;
+}
+
+std::vector<ChunkID> DeltaMergeTask::reclaim_chunks(const std::string& table_name, Table& table,
+                                                    const ChunkID last_chunk_id) {
+  auto reclaimed_chunk_ids = std::vector<ChunkID>{};
+
+  // The results of queries reference the rows of the table and may be read after their transaction ended. Thus, chunks
+  // are only reclaimed while no result pins the table (see Table::pin()). Transactions that pin the table afterwards
+  // cannot see the rows of the reclaimed chunks.
+  if (table.is_pinned()) return reclaimed_chunk_ids;
+
+  // Rows that were invalidated at or before the oldest snapshot of any active transaction are invisible to all current
+  // and future transactions. Materialized views that read the table still need the rows that were invalidated after
+  // their last refresh, to compute their deltas.
+  auto reclaim_commit_id = TransactionManager::get().lowest_active_snapshot_commit_id();
+
+  auto& storage_manager = StorageManager::get();
+  for (const auto& view_name : storage_manager.materialized_view_names()) {
+    const auto oldest_required_commit_id =
+        storage_manager.get_materialized_view(view_name)->oldest_required_commit_id(table_name);
+    if (oldest_required_commit_id) reclaim_commit_id = std::min(reclaim_commit_id, *oldest_required_commit_id);
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < last_chunk_id; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk->size() == 0) continue;
+
+    auto columns_are_placeholders = true;
+    for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      if (!is_placeholder_column(*chunk->get_column(column_id))) columns_are_placeholders = false;
+    }
+    if (columns_are_placeholders) continue;
+
+    auto rows_are_invisible = true;
+    {
+      const auto mvcc_columns = chunk->mvcc_columns();
+      for (ChunkOffset chunk_offset{0}; chunk_offset < mvcc_columns->size(); ++chunk_offset) {
+        if (mvcc_columns->end_cids[chunk_offset] > reclaim_commit_id) {
+          rows_are_invisible = false;
+          break;
+        }
+      }
+    }
+    if (!rows_are_invisible) continue;
+
+    // The versions of in-place updated values need to be merged first (see MergeValueDeltasTask)
+    const auto value_deltas = chunk->value_deltas();
+    if (value_deltas && !value_deltas->try_freeze()) continue;
+
+    // Readers that still hold the old columns keep them alive until they are done
+    const auto size = static_cast<ChunkOffset>(chunk->size());
+    for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      chunk->replace_column(column_id, create_placeholder_column(table.column_data_type(column_id),
+                                                                 table.column_is_nullable(column_id), size));
+    }
+
+    reclaimed_chunk_ids.emplace_back(chunk_id);
+  }
+
+  return reclaimed_chunk_ids;
+}
+
+}  // namespace opossum
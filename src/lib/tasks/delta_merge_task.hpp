@@ -0,0 +1,72 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "scheduler/abstract_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * @brief Merges the delta of a table into its main
+ *
+ * All inserts are appended to the mutable chunks of ValueColumns at the end of a table (the "delta"), which are cheap
+ * to write to, while the dictionary-encoded, immutable chunks with sorted dictionaries (the "main") are fast to scan.
+ * The task moves data from the delta to the main and keeps the main dense:
+ *
+ *   1. Completed delta chunks (see ChunkCompressionTask::chunk_is_completed()) are dictionary encoded, one job per
+ *      chunk. The columns are exchanged atomically, so readers are not blocked.
+ *   2. Main chunks of which at least invalid_row_share are deleted rows or free space, and delta chunks that will not
+ *      be filled anymore, because they are not the last chunk of the table, are rebuilt by RebuildChunks. Their
+ *      visible rows are moved into new, dense main chunks with new dictionaries in a single transaction, so that
+ *      readers see either the old or the new rows. If a row is locked by another transaction, the rebuild is rolled
+ *      back and retried by the next execution.
+ *   3. Chunks cannot be removed from tables, as that would change the RowIDs of the following chunks. Instead, once no
+ *      active transaction can see any row of a chunk anymore (e.g., after it was rebuilt), its columns are replaced by
+ *      run-length encoded columns that consist of a single run, which frees the memory of the values. The MvccColumns
+ *      and indexes of the chunk are kept, so that Validate still filters out its rows. As query results may still
+ *      reference the rows after their transaction ended, this is only done while the table is not pinned (see
+ *      Table::pin()). Rows that materialized views still need for their next refresh are kept as well.
+ *
+ * Chunks with versions of in-place updated values (see ValueDeltas) are frozen before they are encoded, rebuilt or
+ * reclaimed, and skipped if they are being updated or still have versions.
+ *
+ * The DeltaMergeManager executes this task periodically for all tables.
+ */
+class DeltaMergeTask : public AbstractTask {
+ public:
+  explicit DeltaMergeTask(const std::string& table_name, const float invalid_row_share = 0.5f);
+
+  // The chunks that were encoded, rebuilt and reclaimed by the last execution
+  const std::vector<ChunkID>& encoded_chunk_ids() const;
+  const std::vector<ChunkID>& rebuilt_chunk_ids() const;
+  const std::vector<ChunkID>& reclaimed_chunk_ids() const;
+
+  /**
+   * Reclaims the chunks before last_chunk_id that no transaction and no materialized view that reads the table needs
+   * anymore, see 3. above. Does nothing if the table is pinned. Also used by MaterializedView for its stored result.
+   *
+   * @param table_name  The name under which the table is stored in the StorageManager, to find the materialized views
+   *                    that read it
+   * @return the reclaimed chunks
+   */
+  static std::vector<ChunkID> reclaim_chunks(const std::string& table_name, Table& table, const ChunkID last_chunk_id);
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  void _rebuild_chunks(Table& table, const ChunkID last_chunk_id);
+
+  const std::string _table_name;
+  const float _invalid_row_share;
+
+  std::vector<ChunkID> _encoded_chunk_ids;
+  std::vector<ChunkID> _rebuilt_chunk_ids;
+  std::vector<ChunkID> _reclaimed_chunk_ids;
+};
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#include "merge_value_deltas_task.hpp"
+
+#include <string>
+
+#include "concurrency/transaction_manager.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_deltas.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+MergeValueDeltasTask::MergeValueDeltasTask(const std::string& table_name) : _table_name{table_name} {}
+
+size_t MergeValueDeltasTask::merged_version_count() const { return _merged_version_count; }
+
+void MergeValueDeltasTask::_on_execute() {
+  const auto table = StorageManager::get().get_table(_table_name);
+  const auto commit_id = TransactionManager::get().lowest_active_snapshot_commit_id();
+
+  _merged_version_count = 0;
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto value_deltas = chunk->value_deltas();
+    if (!value_deltas || value_deltas->empty()) continue;
+
+    _merged_version_count += value_deltas->merge(*chunk, commit_id);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+
+#include "scheduler/abstract_task.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Merges the versions of values written by in-place updates into the main values of a table
+ *
+ * Writes all versions that every transaction sees, i.e., that were committed at or before
+ * TransactionManager::lowest_active_snapshot_commit_id(), into the ValueColumns of their chunks (see
+ * ValueDeltas::merge()). Afterwards, GetTable does not need to copy these columns anymore.
+ *
+ * Like the ChunkCompressionTask, this task needs to be scheduled explicitly, e.g., periodically for tables with
+ * frequent in-place updates.
+ */
+class MergeValueDeltasTask : public AbstractTask {
+ public:
+  explicit MergeValueDeltasTask(const std::string& table_name);
+
+  // The number of versions merged by the last execution
+  size_t merged_version_count() const;
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  const std::string _table_name;
+  size_t _merged_version_count{0};
+};
+
+}  // namespace opossum
@@ -246,6 +246,11 @@ enum class JoinMode { Inner, Left, Right, Outer, Cross, Natural, Self, Semi, Ant
 
 enum class UnionMode { Positions };
 
+enum class SetOperationType { Intersect, Except };
+
+// Whether a set operation eliminates duplicates (e.g., INTERSECT) or respects the multiplicity of rows (INTERSECT ALL)
+enum class SetOperationMode { Distinct, All };
+
 enum class AggregateFunction { Min, Max, Sum, Avg, Count, CountDistinct };
 
 enum class OrderByMode { Ascending, Descending, AscendingNullsLast, DescendingNullsLast };
@@ -256,6 +261,9 @@ enum class DescriptionMode { SingleLine, MultiLine };
 
 enum class UseMvcc : bool { Yes = true, No = false };
 
+// How the chunks of a stored table are placed on the NUMA nodes, see TablePlacement
+enum class PlacementPolicy { Local, Interleaved, Replicated };
+
 class Noncopyable {
  protected:
   Noncopyable() = default;
@@ -8,6 +8,7 @@
 #include "storage/table.hpp"
 
 #include "constant_mappings.hpp"
+#include "logical_type.hpp"
 
 namespace opossum {
 
@@ -32,6 +33,11 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
 
   TableColumnDefinitions column_definitions;
   for (size_t i = 0; i < col_names.size(); i++) {
+    if (const auto logical_type = LogicalType::from_name(col_types[i])) {
+      column_definitions.emplace_back(col_names[i], *logical_type, col_nullable[i]);
+      continue;
+    }
+
     const auto data_type = data_type_to_string.right.find(col_types[i]);
     Assert(data_type != data_type_to_string.right.end(),
            std::string("Invalid data type ") + col_types[i] + " for column " + col_names[i]);
@@ -50,6 +56,8 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
       if (nullable && (value == AllTypeVariant{"null"})) {
         value = NULL_VALUE;
       }
+
+      value = column_definitions[column_id].logical_type.encode(value);
     }
 
     test_table->append(values);
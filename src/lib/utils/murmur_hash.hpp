@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 namespace opossum {
@@ -13,10 +14,12 @@ typename std::enable_if<std::is_arithmetic<T>::value, unsigned int>::type murmur
   return murmur_hash2(&key, sizeof(T), seed);
 }
 
-// murmur hash for std::string
+// murmur hash for std::string and std::string_view
 template <typename T>
-typename std::enable_if<std::is_same<T, std::string>::value, unsigned int>::type murmur2(T key, unsigned int seed) {
-  return murmur_hash2(key.c_str(), key.size(), seed);
+typename std::enable_if<std::is_same<T, std::string>::value || std::is_same<T, std::string_view>::value,
+                        unsigned int>::type
+murmur2(const T& key, unsigned int seed) {
+  return murmur_hash2(key.data(), key.size(), seed);
 }
 
 }  // namespace opossum
@@ -34,7 +34,7 @@ int NUMAMemoryResource::get_node_id() const { return _memory_source.getPhysicalN
 
 #else
 
-NUMAMemoryResource::NUMAMemoryResource(int node_id, const std::string& name) {}
+NUMAMemoryResource::NUMAMemoryResource(int node_id, const std::string& name) : _node_id(node_id) {}
 
 void* NUMAMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
   return boost::container::pmr::get_default_resource()->allocate(bytes, alignment);
@@ -46,7 +46,7 @@ void NUMAMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t a
 
 bool NUMAMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return true; }
 
-int NUMAMemoryResource::get_node_id() const { return UNDEFINED_NODE_ID; }
+int NUMAMemoryResource::get_node_id() const { return _node_id; }
 #endif
 
 }  // namespace opossum
@@ -28,6 +28,10 @@ class NUMAMemoryResource : public boost::container::pmr::memory_resource {
 #if HYRISE_NUMA_SUPPORT
   const numa::MemSource _memory_source;
   const size_t _alignment = 1;
+#else
+  // Without NUMA support, memory is allocated from the default resource. The node id is only kept as a label, so that
+  // chunks can be placed on the nodes of a fake topology (see Topology::create_fake_numa_topology()).
+  const int _node_id;
 #endif
 };
 
@@ -11,6 +11,7 @@
 #include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/load_table.hpp"
 
@@ -114,4 +115,20 @@ TYPED_TEST(CostFeatureProxyTest, AllFeatures) {
   EXPECT_EQ(proxies.join_proxy->extract_feature(CostFeature::LeftInputIsMajor).boolean(), true);
 }
 
+TEST(CostFeatureProxyEmptyInputTest, RowCountLogNOfEmptyInput) {
+  const auto nation = std::make_shared<TableWrapper>(load_table("src/test/tables/tpch/sf-0.001/nation.tbl"));
+  nation->execute();
+
+  const auto empty = std::make_shared<TableScan>(nation, ColumnID{0}, PredicateCondition::LessThan, 0);
+  empty->execute();
+
+  const auto join =
+      std::make_shared<JoinHash>(empty, nation, JoinMode::Inner, ColumnIDPair{0, 0}, PredicateCondition::Equals);
+  join->execute();
+
+  const auto proxy = CostFeatureOperatorProxy{join};
+  EXPECT_EQ(proxy.extract_feature(CostFeature::LeftInputRowCountLogN).scalar(), 0.0f);
+  EXPECT_FLOAT_EQ(proxy.extract_feature(CostFeature::RightInputRowCountLogN).scalar(), 25 * std::log(25));
+}
+
 }  // namespace opossum
@@ -0,0 +1,110 @@
+#include <limits>
+#include <map>
+
+#include "gtest/gtest.h"
+
+#include "cost_model/abstract_cost_feature_proxy.hpp"
+#include "cost_model/cost_model_calibration.hpp"
+#include "operators/abstract_operator.hpp"
+
+namespace opossum {
+
+/**
+ * Proxy that returns predefined values for the core CostFeatures
+ */
+class MockCostFeatureProxy : public AbstractCostFeatureProxy {
+ public:
+  explicit MockCostFeatureProxy(const std::map<CostFeature, float>& features) : _features(features) {}
+
+ protected:
+  CostFeatureVariant _extract_feature_impl(const CostFeature cost_feature) const override {
+    return _features.at(cost_feature);
+  }
+
+ private:
+  const std::map<CostFeature, float> _features;
+};
+
+class CostModelCalibrationTest : public ::testing::Test {
+ public:
+  void add_sample(CostModelCalibration& calibration, const float left_row_count, const float right_row_count,
+                  const float output_row_count, const Cost cost) {
+    const auto feature_proxy = MockCostFeatureProxy{{{CostFeature::LeftInputRowCount, left_row_count},
+                                                     {CostFeature::RightInputRowCount, right_row_count},
+                                                     {CostFeature::OutputRowCount, output_row_count}}};
+    calibration.add_sample(OperatorType::JoinHash, feature_proxy, cost);
+  }
+};
+
+TEST_F(CostModelCalibrationTest, RecoversLinearWeights) {
+  auto calibration = CostModelCalibration{{{OperatorType::JoinHash,
+                                            {CostFeature::LeftInputRowCount, CostFeature::RightInputRowCount,
+                                             CostFeature::OutputRowCount}}}};
+
+  for (auto left_row_count = 1'000.0f; left_row_count <= 100'000.0f; left_row_count *= 10.0f) {
+    for (auto right_row_count = 100.0f; right_row_count <= 10'000.0f; right_row_count *= 10.0f) {
+      const auto output_row_count = left_row_count / 2.0f;
+      add_sample(calibration, left_row_count, right_row_count, output_row_count,
+                 0.02f * left_row_count + 0.5f * right_row_count + 0.01f * output_row_count);
+    }
+  }
+
+  EXPECT_EQ(calibration.sample_count(OperatorType::JoinHash), 9u);
+  EXPECT_EQ(calibration.sample_count(OperatorType::TableScan), 0u);
+
+  const auto config = calibration.fit();
+  ASSERT_EQ(config.operator_feature_weights.size(), 1u);
+
+  const auto& weights = config.operator_feature_weights.at(OperatorType::JoinHash);
+  // LeftInputRowCount and OutputRowCount are collinear, only their combined weight is determined by the samples
+  EXPECT_NEAR(weights.at(CostFeature::LeftInputRowCount) + weights.at(CostFeature::OutputRowCount) / 2.0f, 0.025f,
+              0.0001f);
+  EXPECT_NEAR(weights.at(CostFeature::RightInputRowCount), 0.5f, 0.0001f);
+}
+
+TEST_F(CostModelCalibrationTest, NoNegativeWeights) {
+  auto calibration = CostModelCalibration{
+      {{OperatorType::JoinHash, {CostFeature::LeftInputRowCount, CostFeature::RightInputRowCount}}}};
+
+  // The cost decreases with the right input's row count, which must not result in a negative weight
+  add_sample(calibration, 100.0f, 10.0f, 0.0f, 95.0f);
+  add_sample(calibration, 200.0f, 20.0f, 0.0f, 190.0f);
+  add_sample(calibration, 300.0f, 10.0f, 0.0f, 295.0f);
+  add_sample(calibration, 400.0f, 30.0f, 0.0f, 385.0f);
+
+  const auto config = calibration.fit();
+  const auto& weights = config.operator_feature_weights.at(OperatorType::JoinHash);
+  EXPECT_EQ(weights.at(CostFeature::RightInputRowCount), 0.0f);
+  EXPECT_GT(weights.at(CostFeature::LeftInputRowCount), 0.0f);
+}
+
+TEST_F(CostModelCalibrationTest, UnmeasuredFeatureGetsZeroWeight) {
+  auto calibration = CostModelCalibration{
+      {{OperatorType::JoinHash, {CostFeature::LeftInputRowCount, CostFeature::OutputRowCount}}}};
+
+  add_sample(calibration, 100.0f, 0.0f, 0.0f, 300.0f);
+  add_sample(calibration, 200.0f, 0.0f, 0.0f, 600.0f);
+
+  const auto config = calibration.fit();
+  const auto& weights = config.operator_feature_weights.at(OperatorType::JoinHash);
+  EXPECT_NEAR(weights.at(CostFeature::LeftInputRowCount), 3.0f, 0.0001f);
+  EXPECT_EQ(weights.at(CostFeature::OutputRowCount), 0.0f);
+}
+
+TEST_F(CostModelCalibrationTest, SkipsNonFiniteFeatures) {
+  auto calibration = CostModelCalibration{{{OperatorType::JoinSortMerge, {CostFeature::LeftInputRowCountLogN}}}};
+
+  // LeftInputRowCountLogN is infinite for an infinite row count
+  const auto feature_proxy =
+      MockCostFeatureProxy{{{CostFeature::LeftInputRowCount, std::numeric_limits<float>::infinity()}}};
+  calibration.add_sample(OperatorType::JoinSortMerge, feature_proxy, 5.0f);
+
+  EXPECT_EQ(calibration.sample_count(OperatorType::JoinSortMerge), 0u);
+
+  // Empty inputs are clamped and do yield samples
+  calibration.add_sample(OperatorType::JoinSortMerge, MockCostFeatureProxy{{{CostFeature::LeftInputRowCount, 0.0f}}},
+                         5.0f);
+  EXPECT_EQ(calibration.sample_count(OperatorType::JoinSortMerge), 1u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "base_test.hpp"
+#include "cost_model/cost_model_runtime.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/load_table.hpp"
+
+using namespace std::string_literals;  // NOLINT
+
+namespace opossum {
+
+class CostModelRuntimeTest : public BaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("customer", load_table("src/test/tables/tpch/sf-0.001/customer.tbl"));
+    StorageManager::get().add_table("nation", load_table("src/test/tables/tpch/sf-0.001/nation.tbl"));
+
+    _config.operator_feature_weights[OperatorType::TableScan] = {{CostFeature::LeftInputRowCount, 2.0f},
+                                                                 {CostFeature::OutputRowCount, 0.5f}};
+    _config.operator_feature_weights[OperatorType::JoinHash] = {{CostFeature::LeftInputRowCount, 1.0f},
+                                                                {CostFeature::RightInputRowCount, 3.0f}};
+  }
+
+ protected:
+  CostModelRuntimeConfig _config;
+};
+
+TEST_F(CostModelRuntimeTest, EstimateLQPNodeCost) {
+  const auto cost_model = CostModelRuntime{_config};
+
+  const auto customer = StoredTableNode::make("customer");
+  const auto nation = StoredTableNode::make("nation");
+  const auto join = JoinNode::make(JoinMode::Inner,
+                                   LQPColumnReferencePair{customer->get_column("c_nationkey"s),
+                                                          nation->get_column("n_nationkey"s)},
+                                   PredicateCondition::Equals, customer, nation);
+  const auto sort_merge_join =
+      JoinNode::make(JoinMode::Inner,
+                     LQPColumnReferencePair{customer->get_column("c_nationkey"s), nation->get_column("n_nationkey"s)},
+                     PredicateCondition::LessThan, customer, nation);
+
+  EXPECT_FLOAT_EQ(cost_model.estimate_lqp_node_cost(join), 150.0f * 1.0f + 25.0f * 3.0f);
+  // No weights configured for JoinSortMerge
+  EXPECT_FLOAT_EQ(cost_model.estimate_lqp_node_cost(sort_merge_join), 0.0f);
+}
+
+TEST_F(CostModelRuntimeTest, EstimateOperatorCost) {
+  const auto cost_model = CostModelRuntime{_config};
+
+  const auto get_table = std::make_shared<GetTable>("nation");
+  get_table->execute();
+  const auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{2}, PredicateCondition::Equals, 1);
+  table_scan->execute();
+
+  EXPECT_FLOAT_EQ(cost_model.estimate_operator_cost(table_scan), 25.0f * 2.0f + 5.0f * 0.5f);
+  EXPECT_EQ(cost_model.get_reference_operator_cost(table_scan),
+            static_cast<Cost>(table_scan->base_performance_data().walltime.count()));
+}
+
+TEST_F(CostModelRuntimeTest, DefaultConfigCostsJoins) {
+  const auto cost_model = CostModelRuntime{};
+
+  const auto customer = StoredTableNode::make("customer");
+  const auto nation = StoredTableNode::make("nation");
+  const auto column_references =
+      LQPColumnReferencePair{customer->get_column("c_nationkey"s), nation->get_column("n_nationkey"s)};
+  const auto hash_join = JoinNode::make(JoinMode::Inner, column_references, PredicateCondition::Equals, customer, nation);
+  const auto sort_merge_join =
+      JoinNode::make(JoinMode::Inner, column_references, PredicateCondition::GreaterThan, customer, nation);
+
+  EXPECT_GT(cost_model.estimate_lqp_node_cost(hash_join), 0.0f);
+  EXPECT_GT(cost_model.estimate_lqp_node_cost(sort_merge_join), 0.0f);
+}
+
+TEST_F(CostModelRuntimeTest, ConfigImportExport) {
+  const auto json = export_cost_model_runtime_config(_config);
+  EXPECT_FLOAT_EQ(json["TableScan"]["LeftInputRowCount"].get<float>(), 2.0f);
+
+  const auto imported_config = import_cost_model_runtime_config(json);
+  EXPECT_EQ(imported_config.operator_feature_weights, _config.operator_feature_weights);
+}
+
+}  // namespace opossum
@@ -0,0 +1,243 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "logical_type.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/get_table.hpp"
+#include "operators/pqp_expression.hpp"
+#include "operators/print.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class LogicalTypeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/date_decimal.tbl", 2);
+    StorageManager::get().add_table("date_decimal", _table);
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(LogicalTypeTest, Dates) {
+  EXPECT_EQ(date_to_days("1970-01-01"), 0);
+  EXPECT_EQ(date_to_days("1969-12-31"), -1);
+  EXPECT_EQ(date_to_days("2000-02-29"), 11016);
+  EXPECT_EQ(date_to_days("2000-03-01"), 11017);
+  EXPECT_EQ(date_to_days("1995-03-15") - date_to_days("1994-03-15"), 365);
+
+  EXPECT_EQ(days_to_date(0), "1970-01-01");
+  EXPECT_EQ(days_to_date(-1), "1969-12-31");
+  EXPECT_EQ(days_to_date(11016), "2000-02-29");
+  EXPECT_EQ(days_to_date(date_to_days("1998-12-01")), "1998-12-01");
+
+  EXPECT_THROW(date_to_days("1995-3-15"), std::logic_error);
+  EXPECT_THROW(date_to_days("1995-02-29"), std::logic_error);
+  EXPECT_THROW(date_to_days("1995-13-01"), std::logic_error);
+}
+
+TEST_F(LogicalTypeTest, Names) {
+  EXPECT_EQ(LogicalType::date().name(), "date");
+  EXPECT_EQ(LogicalType::decimal(15, 2).name(), "decimal(15,2)");
+
+  EXPECT_EQ(LogicalType::from_name("date"), LogicalType::date());
+  EXPECT_EQ(LogicalType::from_name("decimal(15,2)"), LogicalType::decimal(15, 2));
+  EXPECT_EQ(LogicalType::from_name("int"), std::nullopt);
+
+  EXPECT_THROW(LogicalType::decimal(19, 2), std::logic_error);
+  EXPECT_THROW(LogicalType::decimal(2, 3), std::logic_error);
+}
+
+TEST_F(LogicalTypeTest, EncodeAndFormat) {
+  const auto date = LogicalType::date();
+  EXPECT_EQ(date.encode("1970-01-02"), AllTypeVariant{int32_t{1}});
+  EXPECT_EQ(date.encode(int32_t{5}), AllTypeVariant{int32_t{5}});
+  EXPECT_TRUE(variant_is_null(date.encode(NULL_VALUE)));
+  EXPECT_EQ(date.format(int32_t{1}), "1970-01-02");
+
+  const auto decimal = LogicalType::decimal(6, 2);
+  EXPECT_EQ(decimal.encode("12.5"), AllTypeVariant{int64_t{1250}});
+  EXPECT_EQ(decimal.encode("-0.05"), AllTypeVariant{int64_t{-5}});
+  EXPECT_EQ(decimal.encode("0012"), AllTypeVariant{int64_t{1200}});
+  EXPECT_EQ(decimal.encode(int32_t{3}), AllTypeVariant{int64_t{300}});
+  EXPECT_EQ(decimal.encode(0.07), AllTypeVariant{int64_t{7}});
+  EXPECT_EQ(decimal.encode(457.9f), AllTypeVariant{int64_t{45790}});
+
+  EXPECT_THROW(decimal.encode("1.234"), std::logic_error);
+  EXPECT_THROW(decimal.encode("10000"), std::logic_error);
+  EXPECT_THROW(decimal.encode(10000), std::logic_error);
+  EXPECT_THROW(decimal.encode(0.055), std::logic_error);
+  EXPECT_THROW(decimal.encode("1.2.3"), std::logic_error);
+
+  EXPECT_EQ(decimal.format(int64_t{1250}), "12.50");
+  EXPECT_EQ(decimal.format(int64_t{-5}), "-0.05");
+  EXPECT_EQ(LogicalType::decimal(4, 0).format(int64_t{42}), "42");
+  EXPECT_EQ(decimal.format(NULL_VALUE), "NULL");
+}
+
+TEST_F(LogicalTypeTest, EncodeRounded) {
+  const auto decimal = LogicalType::decimal(6, 2);
+  EXPECT_EQ(decimal.encode("1.234", LogicalType::Rounding::Floor), AllTypeVariant{int64_t{123}});
+  EXPECT_EQ(decimal.encode("1.234", LogicalType::Rounding::Ceil), AllTypeVariant{int64_t{124}});
+  EXPECT_EQ(decimal.encode("-1.234", LogicalType::Rounding::Floor), AllTypeVariant{int64_t{-124}});
+  EXPECT_EQ(decimal.encode("-1.234", LogicalType::Rounding::Ceil), AllTypeVariant{int64_t{-123}});
+  EXPECT_EQ(decimal.encode("1.2300", LogicalType::Rounding::Ceil), AllTypeVariant{int64_t{123}});
+  EXPECT_EQ(decimal.encode(0.055, LogicalType::Rounding::Floor), AllTypeVariant{int64_t{5}});
+  EXPECT_EQ(decimal.encode(0.055, LogicalType::Rounding::Ceil), AllTypeVariant{int64_t{6}});
+  EXPECT_EQ(decimal.encode("1.5", LogicalType::Rounding::Floor), AllTypeVariant{int64_t{150}});
+
+  EXPECT_EQ(LogicalType::date().encode("1970-01-02", LogicalType::Rounding::Ceil), AllTypeVariant{int32_t{1}});
+}
+
+TEST_F(LogicalTypeTest, LoadTable) {
+  EXPECT_EQ(_table->column_data_type(ColumnID{1}), DataType::Int);
+  EXPECT_EQ(_table->column_data_type(ColumnID{2}), DataType::Long);
+  EXPECT_EQ(_table->column_logical_type(ColumnID{0}).kind, LogicalType::Kind::None);
+  EXPECT_EQ(_table->column_logical_type(ColumnID{1}), LogicalType::date());
+  EXPECT_EQ(_table->column_logical_type(ColumnID{2}), LogicalType::decimal(10, 2));
+
+  EXPECT_EQ(_table->get_value<int32_t>(ColumnID{1}, 0u), date_to_days("1995-03-14"));
+  EXPECT_EQ(_table->get_value<int64_t>(ColumnID{2}, 1u), -99);
+  EXPECT_EQ(_table->get_value<int64_t>(ColumnID{2}, 2u), 10000);
+}
+
+TEST_F(LogicalTypeTest, TableComparisonChecksLogicalTypes) {
+  // How SQLite returns the table, which has neither DATEs nor DECIMALs
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("id", DataType::Int);
+  column_definitions.emplace_back("shipdate", DataType::String);
+  column_definitions.emplace_back("price", DataType::Double);
+  const auto untyped_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  untyped_table->append({1, "1995-03-14", 12.5});
+  untyped_table->append({2, "1995-03-15", -0.99});
+  untyped_table->append({3, "1996-01-01", 100.0});
+  untyped_table->append({4, "1994-12-31", 0.05});
+
+  EXPECT_TRUE(check_table_equal(_table, untyped_table, OrderSensitivity::Yes, TypeCmpMode::Lenient,
+                                FloatComparisonMode::AbsoluteDifference));
+  EXPECT_FALSE(check_table_equal(_table, untyped_table, OrderSensitivity::Yes, TypeCmpMode::Strict,
+                                 FloatComparisonMode::AbsoluteDifference));
+
+  EXPECT_TRUE(check_table_equal(_table, load_table("src/test/tables/date_decimal.tbl", 3), OrderSensitivity::Yes,
+                                TypeCmpMode::Strict, FloatComparisonMode::AbsoluteDifference));
+}
+
+TEST_F(LogicalTypeTest, ScansCompareIntegers) {
+  auto get_table = std::make_shared<GetTable>("date_decimal");
+  get_table->execute();
+
+  auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{1}, PredicateCondition::LessThan,
+                                                LogicalType::date().encode("1995-03-15"));
+  table_scan->execute();
+
+  const auto& output = table_scan->get_output();
+  EXPECT_EQ(output->row_count(), 2u);
+  EXPECT_EQ(output->column_logical_type(ColumnID{1}), LogicalType::date());
+}
+
+TEST_F(LogicalTypeTest, AggregatesKeepLogicalTypes) {
+  auto get_table = std::make_shared<GetTable>("date_decimal");
+  get_table->execute();
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Max},
+                                                                 {ColumnID{2}, AggregateFunction::Sum},
+                                                                 {ColumnID{2}, AggregateFunction::Count}};
+  auto aggregate = std::make_shared<Aggregate>(get_table, aggregates, std::vector<ColumnID>{});
+  aggregate->execute();
+
+  const auto& output = aggregate->get_output();
+  EXPECT_EQ(output->column_logical_type(ColumnID{0}), LogicalType::date());
+  EXPECT_EQ(output->column_logical_type(ColumnID{1}), LogicalType::decimal(10, 2));
+  EXPECT_EQ(output->column_logical_type(ColumnID{2}).kind, LogicalType::Kind::None);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{0}, 0u), date_to_days("1996-01-01"));
+  EXPECT_EQ(output->get_value<int64_t>(ColumnID{1}, 0u), 1250 - 99 + 10000 + 5);
+}
+
+TEST_F(LogicalTypeTest, AverageOfDecimals) {
+  auto get_table = std::make_shared<GetTable>("date_decimal");
+  get_table->execute();
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Avg}};
+  auto aggregate = std::make_shared<Aggregate>(get_table, aggregates, std::vector<ColumnID>{});
+  aggregate->execute();
+
+  const auto& output = aggregate->get_output();
+  EXPECT_EQ(output->column_data_type(ColumnID{0}), DataType::Double);
+  EXPECT_EQ(output->column_logical_type(ColumnID{0}).kind, LogicalType::Kind::None);
+  EXPECT_DOUBLE_EQ(output->get_value<double>(ColumnID{0}, 0u), (12.50 - 0.99 + 100 + 0.05) / 4);
+}
+
+TEST_F(LogicalTypeTest, ArithmeticOnDecimals) {
+  auto get_table = std::make_shared<GetTable>("date_decimal");
+  get_table->execute();
+
+  const auto price = PQPExpression::create_column(ColumnID{2});
+  const auto operation = [&](const ExpressionType type, const auto& left, const auto& right) {
+    return PQPExpression::create_binary_operator(type, left, right);
+  };
+
+  // price * (1 - 0.25), price + 1, price * price, price / 4, shipdate + 1
+  const auto expressions = Projection::ColumnExpressions{
+      operation(ExpressionType::Multiplication, price,
+                operation(ExpressionType::Subtraction, PQPExpression::create_literal(1),
+                          PQPExpression::create_literal(0.25))),
+      operation(ExpressionType::Addition, price, PQPExpression::create_literal(1)),
+      operation(ExpressionType::Multiplication, price, price),
+      operation(ExpressionType::Division, price, PQPExpression::create_literal(4)),
+      operation(ExpressionType::Addition, PQPExpression::create_column(ColumnID{1}), PQPExpression::create_literal(1))};
+  auto projection = std::make_shared<Projection>(get_table, expressions);
+  projection->execute();
+
+  const auto& output = projection->get_output();
+  EXPECT_EQ(output->column_logical_type(ColumnID{0}), LogicalType::decimal(18, 4));
+  EXPECT_EQ(output->column_logical_type(ColumnID{1}), LogicalType::decimal(18, 2));
+  EXPECT_EQ(output->column_logical_type(ColumnID{2}), LogicalType::decimal(18, 4));
+  EXPECT_EQ(output->column_logical_type(ColumnID{3}), LogicalType::decimal(18, 6));
+  EXPECT_EQ(output->column_logical_type(ColumnID{4}), LogicalType::date());
+
+  // 12.50 in the first row
+  EXPECT_EQ(output->get_value<int64_t>(ColumnID{0}, 0u), 93750);
+  EXPECT_EQ(output->get_value<int64_t>(ColumnID{1}, 0u), 1350);
+  EXPECT_EQ(output->get_value<int64_t>(ColumnID{2}, 0u), 1562500);
+  EXPECT_EQ(output->get_value<int64_t>(ColumnID{3}, 0u), 3125000);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{4}, 0u), date_to_days("1995-03-15"));
+
+  // -0.99 in the second row
+  EXPECT_EQ(output->get_value<int64_t>(ColumnID{3}, 1u), -247500);
+}
+
+TEST_F(LogicalTypeTest, FormatColumnValues) {
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  EXPECT_EQ(format_column_values(*chunk->get_column(ColumnID{0}), DataType::Int, LogicalType{}),
+            std::vector<std::string>({"1", "2"}));
+  EXPECT_EQ(format_column_values(*chunk->get_column(ColumnID{1}), DataType::Int, LogicalType::date()),
+            std::vector<std::string>({"1995-03-14", "1995-03-15"}));
+  EXPECT_EQ(format_column_values(*chunk->get_column(ColumnID{2}), DataType::Long, LogicalType::decimal(10, 2)),
+            std::vector<std::string>({"12.50", "-0.99"}));
+
+  const auto table_with_nulls = load_table("src/test/tables/int_float_with_null.tbl", 2);
+  EXPECT_EQ(format_column_values(*table_with_nulls->get_chunk(ChunkID{0})->get_column(ColumnID{1}), DataType::Float,
+                                 LogicalType{}),
+            std::vector<std::string>({"458.7", "NULL"}));
+}
+
+TEST_F(LogicalTypeTest, PrintFormatsValues) {
+  auto stream = std::ostringstream{};
+  Print::print(_table, 0, stream);
+
+  EXPECT_NE(stream.str().find("decimal(10,2)"), std::string::npos);
+  EXPECT_NE(stream.str().find("1995-03-14"), std::string::npos);
+  EXPECT_NE(stream.str().find("-0.99"), std::string::npos);
+}
+
+}  // namespace opossum
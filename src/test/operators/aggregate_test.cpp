@@ -160,6 +160,24 @@ TEST_F(OperatorsAggregateTest, CannotAvgStringColumns) {
   EXPECT_THROW(aggregate->execute(), std::logic_error);
 }
 
+TEST_F(OperatorsAggregateTest, SumThrowsOnOverflow) {
+  // Stored as 999'999'999'999.999999 * 10^6, so that ten of them exceed the range of int64_t
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", LogicalType::decimal(18, 6));
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 4);
+  for (auto row = 0; row < 10; ++row) {
+    table->append({int64_t{999'999'999'999'999'999}});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{});
+  EXPECT_THROW(aggregate->execute(), std::logic_error);
+}
+
 TEST_F(OperatorsAggregateTest, CanCountStringColumns) {
   this->test_output(_table_wrapper_1_1_string, {{ColumnID{0}, AggregateFunction::Count}}, {ColumnID{0}},
                     "src/test/tables/aggregateoperator/groupby_string_1gb_1agg/count_str.tbl", 1);
@@ -132,6 +132,47 @@ TEST_F(OperatorsDeleteTest, DetectDirtyWrite) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result->get_output());
 }
 
+TEST_F(OperatorsDeleteTest, RollbackOnlyUnlocksOwnRows) {
+  // One row per chunk, so that the rows are locked chunk by chunk
+  const auto table = load_table("src/test/tables/float_int.tbl", 1u);
+  StorageManager::get().add_table("table_b", table);
+
+  auto gt = std::make_shared<GetTable>("table_b");
+  gt->execute();
+
+  auto t1_context = TransactionManager::get().new_transaction_context();
+  auto t2_context = TransactionManager::get().new_transaction_context();
+
+  // Locks the row in the second chunk
+  auto table_scan1 = std::make_shared<TableScan>(gt, ColumnID{1}, PredicateCondition::Equals, "123");
+  table_scan1->execute();
+  ASSERT_EQ(table_scan1->get_output()->row_count(), 1u);
+
+  auto delete_op1 = std::make_shared<Delete>("table_b", table_scan1);
+  delete_op1->set_transaction_context(t1_context);
+  delete_op1->execute();
+  EXPECT_FALSE(delete_op1->execute_failed());
+
+  // Locks the row in the first chunk and then fails on the second one
+  auto table_scan2 = std::make_shared<TableScan>(gt, ColumnID{1}, PredicateCondition::GreaterThan, "0");
+  table_scan2->execute();
+
+  auto delete_op2 = std::make_shared<Delete>("table_b", table_scan2);
+  delete_op2->set_transaction_context(t2_context);
+  delete_op2->execute();
+  EXPECT_TRUE(delete_op2->execute_failed());
+
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->mvcc_columns()->tids.at(0u), t2_context->transaction_id());
+
+  t2_context->rollback();
+
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->mvcc_columns()->tids.at(0u), 0u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->mvcc_columns()->tids.at(0u), t1_context->transaction_id());
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->mvcc_columns()->tids.at(0u), 0u);
+
+  t1_context->commit();
+}
+
 TEST_F(OperatorsDeleteTest, UpdateAfterDeleteFails) {
   auto t1_context = TransactionManager::get().new_transaction_context();
   auto t2_context = TransactionManager::get().new_transaction_context();
@@ -0,0 +1,70 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/distinct.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsDistinctTest : public BaseTest {
+ protected:
+  static std::shared_ptr<const Table> _execute(const std::shared_ptr<AbstractOperator>& input) {
+    const auto distinct = std::make_shared<Distinct>(input);
+    distinct->execute();
+    return distinct->get_output();
+  }
+
+  static std::shared_ptr<TableWrapper> _wrap(const std::shared_ptr<Table>& table) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+};
+
+TEST_F(OperatorsDistinctTest, MultipleColumns) {
+  const auto output = _execute(_wrap(load_table("src/test/tables/set_operations/left.tbl", 2)));
+
+  EXPECT_EQ(output->type(), TableType::References);
+  EXPECT_TABLE_EQ_ORDERED(output, load_table("src/test/tables/distinct/int_string_distinct.tbl"));
+}
+
+TEST_F(OperatorsDistinctTest, ReferenceInput) {
+  const auto scan = std::make_shared<TableScan>(_wrap(load_table("src/test/tables/set_operations/left.tbl", 2)),
+                                                ColumnID{1}, PredicateCondition::NotEquals, "w");
+  scan->execute();
+
+  const auto output = _execute(scan);
+
+  EXPECT_TABLE_EQ_ORDERED(output, load_table("src/test/tables/distinct/int_string_distinct_filtered.tbl"));
+}
+
+TEST_F(OperatorsDistinctTest, SingleColumn) {
+  const auto output = _execute(_wrap(load_table("src/test/tables/distinct/int_null_repeated.tbl", 3)));
+
+  EXPECT_TABLE_EQ_ORDERED(output, load_table("src/test/tables/distinct/int_null_repeated_distinct.tbl"));
+}
+
+TEST_F(OperatorsDistinctTest, SingleDictionaryColumn) {
+  const auto table = load_table("src/test/tables/distinct/int_null_repeated.tbl", 3);
+  ChunkEncoder::encode_all_chunks(table);
+
+  const auto output = _execute(_wrap(table));
+
+  EXPECT_TABLE_EQ_ORDERED(output, load_table("src/test/tables/distinct/int_null_repeated_distinct.tbl"));
+}
+
+TEST_F(OperatorsDistinctTest, EmptyInput) {
+  const auto output = _execute(_wrap(load_table("src/test/tables/int_empty.tbl", 2)));
+
+  EXPECT_EQ(output->row_count(), 0u);
+  EXPECT_EQ(output->column_count(), 1u);
+}
+
+}  // namespace opossum
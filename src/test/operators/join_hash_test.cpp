@@ -52,8 +52,8 @@ TEST_F(JoinHashTest, FloatingTraits) {
 
 TEST_F(JoinHashTest, StringTraits) {
   // joining string and string
-  EXPECT_HASH_TYPE(std::string, std::string, std::string);
-  EXPECT_LEXICAL_CAST(std::string, std::string, true);
+  EXPECT_HASH_TYPE(std::string, std::string, std::string_view);
+  EXPECT_LEXICAL_CAST(std::string, std::string, false);
 }
 
 TEST_F(JoinHashTest, MixedNumberTraits) {
@@ -115,4 +115,52 @@ TEST_F(OperatorsLimitTest, Limit10ReferenceColumn) {
   test_limit_10();
 }
 
+TEST_F(OperatorsLimitTest, SharesCompleteChunksOfDataTable) {
+  // int_int3.tbl has chunks with three rows
+  auto limit = std::make_shared<Limit>(_table_wrapper, 6);
+  limit->execute();
+
+  const auto& input = _table_wrapper->get_output();
+  const auto& output = limit->get_output();
+
+  EXPECT_EQ(output->type(), TableType::Data);
+  ASSERT_EQ(output->chunk_count(), 2u);
+  EXPECT_EQ(output->get_chunk(ChunkID{0}), input->get_chunk(ChunkID{0}));
+  EXPECT_EQ(output->get_chunk(ChunkID{1}), input->get_chunk(ChunkID{1}));
+}
+
+TEST_F(OperatorsLimitTest, ReferencesIncompleteChunkOfDataTable) {
+  // The last chunk of int_int3.tbl has two rows, so that more rows can be appended to it
+  auto limit = std::make_shared<Limit>(_table_wrapper, 10);
+  limit->execute();
+
+  const auto output = limit->get_output();
+  EXPECT_EQ(output->type(), TableType::References);
+  ASSERT_EQ(output->chunk_count(), 3u);
+
+  // Rows appended to the input after the execution do not show up in the output
+  std::const_pointer_cast<Table>(_table_wrapper->get_output())->append({1, 2});
+  EXPECT_EQ(output->row_count(), 8u);
+  EXPECT_TABLE_EQ_ORDERED(output, load_table("src/test/tables/int_int3.tbl", 3));
+}
+
+TEST_F(OperatorsLimitTest, SharesCompleteChunksOfReferenceTable) {
+  // Filter accepts all rows in table.
+  const auto table_scan =
+      std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, -1);
+  table_scan->execute();
+
+  auto limit = std::make_shared<Limit>(table_scan, 4);
+  limit->execute();
+
+  const auto& input = table_scan->get_output();
+  const auto& output = limit->get_output();
+
+  EXPECT_EQ(output->type(), TableType::References);
+  ASSERT_EQ(output->chunk_count(), 2u);
+  EXPECT_EQ(output->get_chunk(ChunkID{0}), input->get_chunk(ChunkID{0}));
+  EXPECT_EQ(output->get_chunk(ChunkID{1})->size(), 1u);
+  EXPECT_TABLE_EQ_ORDERED(output, load_table("src/test/tables/int_int3_limit_4.tbl", 3));
+}
+
 }  // namespace opossum
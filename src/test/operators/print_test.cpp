@@ -47,7 +47,7 @@ class PrintWrapper : public Print {
     return _column_string_widths(min, max, tab);
   }
 
-  std::string test_truncate_cell(const AllTypeVariant& cell, uint16_t max_width) {
+  std::string test_truncate_cell(const std::string& cell, uint16_t max_width) {
     return _truncate_cell(cell, max_width);
   }
 };
@@ -130,7 +130,7 @@ TEST_F(OperatorsPrintTest, OperatorName) {
 TEST_F(OperatorsPrintTest, TruncateLongValue) {
   auto print_wrap = std::make_shared<PrintWrapper>(gt);
 
-  auto cell = AllTypeVariant{"abcdefghijklmnopqrstuvwxyz"};
+  auto cell = std::string{"abcdefghijklmnopqrstuvwxyz"};
 
   auto truncated_cell_20 = print_wrap->test_truncate_cell(cell, 20);
   EXPECT_EQ(truncated_cell_20, "abcdefghijklmnopq...");
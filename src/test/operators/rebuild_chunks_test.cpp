@@ -0,0 +1,116 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/rebuild_chunks.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "storage/base_dictionary_column.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsRebuildChunksTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/compression_input.tbl", 4u);
+    StorageManager::get().add_table(_table_name, _table);
+  }
+
+  std::shared_ptr<const Table> get_visible_rows(const std::shared_ptr<TransactionContext>& context) {
+    auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->set_transaction_context(context);
+    get_table->execute();
+
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  // Deletes the rows with b == 3, i.e., rows 0, 1, 6, 7 and 9
+  std::shared_ptr<AbstractReadWriteOperator> delete_rows(const std::shared_ptr<TransactionContext>& context) {
+    auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->execute();
+
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+
+    auto table_scan = std::make_shared<TableScan>(validate, ColumnID{1}, PredicateCondition::Equals, 3);
+    table_scan->execute();
+
+    auto delete_op = std::make_shared<Delete>(_table_name, table_scan);
+    delete_op->set_transaction_context(context);
+    delete_op->execute();
+    return delete_op;
+  }
+
+  const std::string _table_name{"rebuild_chunks_table"};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsRebuildChunksTest, MovesVisibleRows) {
+  auto delete_context = TransactionManager::get().new_transaction_context();
+  delete_rows(delete_context);
+  delete_context->commit();
+
+  auto old_context = TransactionManager::get().new_transaction_context();
+  const auto rows_before = get_visible_rows(old_context);
+  ASSERT_EQ(rows_before->row_count(), 7u);
+
+  auto context = TransactionManager::get().new_transaction_context();
+  auto rebuild_chunks =
+      std::make_shared<RebuildChunks>(_table_name, std::vector<ChunkID>{ChunkID{0}, ChunkID{1}, ChunkID{2}});
+  rebuild_chunks->set_transaction_context(context);
+  rebuild_chunks->execute();
+  ASSERT_FALSE(rebuild_chunks->execute_failed());
+  context->commit();
+
+  // The seven remaining rows are moved into two new, dictionary-encoded chunks
+  EXPECT_EQ(rebuild_chunks->new_chunk_ids(), (std::vector<ChunkID>{ChunkID{3}, ChunkID{4}}));
+  ASSERT_EQ(_table->chunk_count(), 5u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{3})->size(), 4u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{4})->size(), 3u);
+  for (ColumnID column_id{0}; column_id < _table->column_count(); ++column_id) {
+    EXPECT_NE(std::dynamic_pointer_cast<const BaseDictionaryColumn>(
+                  _table->get_chunk(ChunkID{3})->get_column(column_id)),
+              nullptr);
+  }
+
+  // Transactions see each row exactly once, no matter whether they started before or after the rebuild
+  EXPECT_TABLE_EQ_UNORDERED(get_visible_rows(TransactionManager::get().new_transaction_context()), rows_before);
+  EXPECT_TABLE_EQ_UNORDERED(get_visible_rows(old_context), rows_before);
+
+  // New transactions only see the new chunks
+  EXPECT_EQ(get_visible_rows(TransactionManager::get().new_transaction_context())->chunk_count(), 2u);
+}
+
+TEST_F(OperatorsRebuildChunksTest, FailsOnLockedRows) {
+  auto delete_context = TransactionManager::get().new_transaction_context();
+  delete_rows(delete_context);
+
+  auto context = TransactionManager::get().new_transaction_context();
+  auto rebuild_chunks = std::make_shared<RebuildChunks>(_table_name, std::vector<ChunkID>{ChunkID{0}});
+  rebuild_chunks->set_transaction_context(context);
+  rebuild_chunks->execute();
+  EXPECT_TRUE(rebuild_chunks->execute_failed());
+  context->rollback();
+
+  delete_context->rollback();
+
+  // No chunks were appended and all rows are unlocked again
+  EXPECT_EQ(_table->chunk_count(), 3u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->mvcc_columns()->tids.at(2u), 0u);
+  EXPECT_EQ(get_visible_rows(TransactionManager::get().new_transaction_context())->row_count(), 12u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/set_operation_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsSetOperationHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper_left = std::make_shared<TableWrapper>(load_table("src/test/tables/set_operations/left.tbl", 2));
+    _table_wrapper_left->execute();
+
+    // The right input is dictionary encoded, so that rows of different column types are compared
+    const auto right_table = load_table("src/test/tables/set_operations/right.tbl", 2);
+    ChunkEncoder::encode_all_chunks(right_table);
+    _table_wrapper_right = std::make_shared<TableWrapper>(right_table);
+    _table_wrapper_right->execute();
+  }
+
+  std::shared_ptr<const Table> _execute(const SetOperationType type, const SetOperationMode mode) {
+    const auto set_operation = std::make_shared<SetOperationHash>(_table_wrapper_left, _table_wrapper_right, type, mode);
+    set_operation->execute();
+    return set_operation->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left;
+  std::shared_ptr<TableWrapper> _table_wrapper_right;
+};
+
+TEST_F(OperatorsSetOperationHashTest, Accessors) {
+  const auto set_operation = std::make_shared<SetOperationHash>(_table_wrapper_left, _table_wrapper_right,
+                                                                SetOperationType::Except, SetOperationMode::All);
+
+  EXPECT_EQ(set_operation->type(), OperatorType::SetOperationHash);
+  EXPECT_EQ(set_operation->set_operation_type(), SetOperationType::Except);
+  EXPECT_EQ(set_operation->mode(), SetOperationMode::All);
+}
+
+TEST_F(OperatorsSetOperationHashTest, IntersectDistinct) {
+  EXPECT_TABLE_EQ_UNORDERED(_execute(SetOperationType::Intersect, SetOperationMode::Distinct),
+                            load_table("src/test/tables/set_operations/intersect_distinct.tbl"));
+}
+
+TEST_F(OperatorsSetOperationHashTest, IntersectAll) {
+  EXPECT_TABLE_EQ_UNORDERED(_execute(SetOperationType::Intersect, SetOperationMode::All),
+                            load_table("src/test/tables/set_operations/intersect_all.tbl"));
+}
+
+TEST_F(OperatorsSetOperationHashTest, ExceptDistinct) {
+  EXPECT_TABLE_EQ_UNORDERED(_execute(SetOperationType::Except, SetOperationMode::Distinct),
+                            load_table("src/test/tables/set_operations/except_distinct.tbl"));
+}
+
+TEST_F(OperatorsSetOperationHashTest, ExceptAll) {
+  EXPECT_TABLE_EQ_UNORDERED(_execute(SetOperationType::Except, SetOperationMode::All),
+                            load_table("src/test/tables/set_operations/except_all.tbl"));
+}
+
+TEST_F(OperatorsSetOperationHashTest, ReferenceInputs) {
+  const auto scan_left =
+      std::make_shared<TableScan>(_table_wrapper_left, ColumnID{1}, PredicateCondition::NotEquals, "w");
+  scan_left->execute();
+  const auto scan_right =
+      std::make_shared<TableScan>(_table_wrapper_right, ColumnID{1}, PredicateCondition::NotEquals, "v");
+  scan_right->execute();
+
+  const auto set_operation =
+      std::make_shared<SetOperationHash>(scan_left, scan_right, SetOperationType::Except, SetOperationMode::Distinct);
+  set_operation->execute();
+
+  const auto output = set_operation->get_output();
+  EXPECT_EQ(output->type(), TableType::References);
+  EXPECT_TABLE_EQ_UNORDERED(output, load_table("src/test/tables/set_operations/except_distinct_filtered.tbl"));
+}
+
+TEST_F(OperatorsSetOperationHashTest, ThrowsOnDifferentColumnTypes) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  table_wrapper->execute();
+
+  const auto set_operation = std::make_shared<SetOperationHash>(_table_wrapper_left, table_wrapper,
+                                                                SetOperationType::Intersect, SetOperationMode::All);
+  EXPECT_THROW(set_operation->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -52,6 +52,61 @@ TEST_F(OperatorsUnionAllTest, UnionOfValueReferenceTables) {
   EXPECT_TABLE_EQ_UNORDERED(union_all->get_output(), expected_result);
 }
 
+TEST_F(OperatorsUnionAllTest, SharesInputChunks) {
+  auto union_all = std::make_shared<UnionAll>(_table_wrapper_a, _table_wrapper_b);
+  union_all->execute();
+
+  const auto& left_table = _table_wrapper_a->get_output();
+  const auto& right_table = _table_wrapper_b->get_output();
+  const auto& output = union_all->get_output();
+
+  ASSERT_EQ(output->chunk_count(), left_table->chunk_count() + right_table->chunk_count());
+  EXPECT_EQ(output->get_chunk(ChunkID{0}), left_table->get_chunk(ChunkID{0}));
+  EXPECT_EQ(output->get_chunk(left_table->chunk_count()), right_table->get_chunk(ChunkID{0}));
+}
+
+TEST_F(OperatorsUnionAllTest, CopiesIncompleteChunksOfDataTables) {
+  // The last chunk of int_float.tbl has one row, so that more rows can be appended to it
+  auto union_all = std::make_shared<UnionAll>(_table_wrapper_a, _table_wrapper_b);
+  union_all->execute();
+
+  const auto left_table = std::const_pointer_cast<Table>(_table_wrapper_a->get_output());
+  const auto& output = union_all->get_output();
+  EXPECT_NE(output->get_chunk(ChunkID{1}), left_table->get_chunk(ChunkID{1}));
+  EXPECT_EQ(output->get_chunk(ChunkID{1})->has_mvcc_columns(), true);
+
+  // Rows appended to the input after the execution do not show up in the output
+  left_table->append({1, 1.0f});
+  EXPECT_EQ(output->row_count(), 7u);
+  EXPECT_TABLE_EQ_UNORDERED(output, load_table("src/test/tables/int_float_union.tbl", 2));
+}
+
+TEST_F(OperatorsUnionAllTest, KeepsMvccColumnsOnlyIfBothInputsHaveThem) {
+  auto union_all = std::make_shared<UnionAll>(_table_wrapper_a, _table_wrapper_b);
+  union_all->execute();
+  EXPECT_EQ(union_all->get_output()->has_mvcc(), UseMvcc::Yes);
+
+  // Copy the chunks of table b into a table without MVCC columns
+  const auto& table_b = _table_wrapper_b->get_output();
+  const auto table_without_mvcc = std::make_shared<Table>(table_b->column_definitions(), TableType::Data);
+  for (ChunkID chunk_id{0}; chunk_id < table_b->chunk_count(); ++chunk_id) {
+    table_without_mvcc->append_chunk(table_b->get_chunk(chunk_id)->columns());
+  }
+  const auto table_wrapper_without_mvcc = std::make_shared<TableWrapper>(table_without_mvcc);
+  table_wrapper_without_mvcc->execute();
+
+  union_all = std::make_shared<UnionAll>(_table_wrapper_a, table_wrapper_without_mvcc);
+  union_all->execute();
+
+  const auto& output = union_all->get_output();
+  EXPECT_EQ(output->has_mvcc(), UseMvcc::No);
+  EXPECT_TABLE_EQ_UNORDERED(output, load_table("src/test/tables/int_float_union.tbl", 2));
+
+  // The columns are still shared
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->get_column(ColumnID{0}),
+            _table_wrapper_a->get_output()->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+}
+
 TEST_F(OperatorsUnionAllTest, ThrowWrongColumnNumberException) {
   if (!IS_DEBUG) return;
   std::shared_ptr<Table> test_table_c = load_table("src/test/tables/int.tbl", 2);
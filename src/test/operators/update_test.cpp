@@ -13,8 +13,11 @@
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "storage/value_deltas.hpp"
+#include "tasks/merge_value_deltas_task.hpp"
 
 namespace opossum {
 
@@ -145,6 +148,205 @@ TEST_F(OperatorsUpdateTest, MultipleChunks) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_int_same.tbl", 1);
   helper(gt, gt2, expected_result);
 }
+TEST_F(OperatorsUpdateTest, KeepsUnchangedColumns) {
+  // The unchanged columns are copied from the old row versions, which are stored in encoded chunks and contain NULLs
+  auto table = load_table("src/test/tables/int_int_int_null.tbl", 2u);
+  ChunkEncoder::encode_all_chunks(table);
+  StorageManager::get().add_table("updateTestTable3", table);
+
+  auto t_context = TransactionManager::get().new_transaction_context();
+
+  auto gt = std::make_shared<GetTable>("updateTestTable3");
+  gt->execute();
+
+  auto validate = std::make_shared<Validate>(gt);
+  validate->set_transaction_context(t_context);
+  validate->execute();
+
+  auto rows_to_update =
+      std::make_shared<Projection>(validate, Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{1})});
+  rows_to_update->set_transaction_context(t_context);
+  rows_to_update->execute();
+
+  auto updated_values =
+      std::make_shared<Projection>(validate, Projection::ColumnExpressions{PQPExpression::create_literal(7, {"b"})});
+  updated_values->set_transaction_context(t_context);
+  updated_values->execute();
+
+  auto update = std::make_shared<Update>("updateTestTable3", rows_to_update, updated_values);
+  update->set_transaction_context(t_context);
+  update->execute();
+  EXPECT_FALSE(update->execute_failed());
+
+  t_context->commit();
+
+  t_context = TransactionManager::get().new_transaction_context();
+  auto validate_after_update = std::make_shared<Validate>(gt);
+  validate_after_update->set_transaction_context(t_context);
+  validate_after_update->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(validate_after_update->get_output(),
+                            load_table("src/test/tables/int_int_int_null_b_updated.tbl", 1));
+}
+
+TEST_F(OperatorsUpdateTest, InPlaceUpdate) {
+  auto table = load_table("src/test/tables/int_int.tbl", 3u);
+  table->set_in_place_updates(true);
+  StorageManager::get().add_table("updateTestTable4", table);
+
+  const auto get_visible_rows = [](const std::shared_ptr<TransactionContext>& context) {
+    auto gt = std::make_shared<GetTable>("updateTestTable4");
+    gt->set_transaction_context(context);
+    gt->execute();
+
+    auto validate = std::make_shared<Validate>(gt);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  };
+
+  // Started before the update, must not see it
+  auto old_context = TransactionManager::get().new_transaction_context();
+
+  auto t_context = TransactionManager::get().new_transaction_context();
+
+  auto gt = std::make_shared<GetTable>("updateTestTable4");
+  gt->set_transaction_context(t_context);
+  gt->execute();
+
+  auto validate = std::make_shared<Validate>(gt);
+  validate->set_transaction_context(t_context);
+  validate->execute();
+
+  auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, PredicateCondition::GreaterThan, 1000);
+  table_scan->set_transaction_context(t_context);
+  table_scan->execute();
+
+  auto rows_to_update = std::make_shared<Projection>(
+      table_scan, Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{1})});
+  rows_to_update->set_transaction_context(t_context);
+  rows_to_update->execute();
+
+  auto updated_values =
+      std::make_shared<Projection>(table_scan, Projection::ColumnExpressions{PQPExpression::create_literal(7, {"b"})});
+  updated_values->set_transaction_context(t_context);
+  updated_values->execute();
+
+  auto update = std::make_shared<Update>("updateTestTable4", rows_to_update, updated_values);
+  update->set_transaction_context(t_context);
+  update->execute();
+  EXPECT_FALSE(update->execute_failed());
+
+  t_context->commit();
+
+  // No new row versions were written
+  EXPECT_EQ(table->row_count(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->value_deltas()->size(), 2u);
+
+  const auto expected_result = load_table("src/test/tables/int_int_b_updated.tbl", 1);
+  EXPECT_TABLE_EQ_UNORDERED(get_visible_rows(TransactionManager::get().new_transaction_context()), expected_result);
+  EXPECT_TABLE_EQ_UNORDERED(get_visible_rows(old_context), load_table("src/test/tables/int_int.tbl", 1));
+
+  // The versions cannot be merged while the old transaction is active
+  auto merge_task = std::make_shared<MergeValueDeltasTask>("updateTestTable4");
+  merge_task->execute();
+  EXPECT_EQ(merge_task->merged_version_count(), 0u);
+
+  old_context->commit();
+  old_context = nullptr;
+
+  merge_task = std::make_shared<MergeValueDeltasTask>("updateTestTable4");
+  merge_task->execute();
+  EXPECT_EQ(merge_task->merged_version_count(), 2u);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->value_deltas()->empty());
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{1}, 0u), 7);
+  EXPECT_TABLE_EQ_UNORDERED(get_visible_rows(TransactionManager::get().new_transaction_context()), expected_result);
+}
+
+TEST_F(OperatorsUpdateTest, InPlaceUpdateConflict) {
+  auto table = load_table("src/test/tables/int_int.tbl", 3u);
+  table->set_in_place_updates(true);
+  StorageManager::get().add_table("updateTestTable4", table);
+
+  const auto update_all_rows = [](const std::shared_ptr<TransactionContext>& context) {
+    auto gt = std::make_shared<GetTable>("updateTestTable4");
+    gt->set_transaction_context(context);
+    gt->execute();
+
+    auto validate = std::make_shared<Validate>(gt);
+    validate->set_transaction_context(context);
+    validate->execute();
+
+    auto rows_to_update = std::make_shared<Projection>(
+        validate, Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{1})});
+    rows_to_update->execute();
+
+    auto updated_values =
+        std::make_shared<Projection>(validate, Projection::ColumnExpressions{PQPExpression::create_literal(7, {"b"})});
+    updated_values->execute();
+
+    auto update = std::make_shared<Update>("updateTestTable4", rows_to_update, updated_values);
+    update->set_transaction_context(context);
+    update->execute();
+    return update->execute_failed();
+  };
+
+  auto t1_context = TransactionManager::get().new_transaction_context();
+  auto t2_context = TransactionManager::get().new_transaction_context();
+
+  EXPECT_FALSE(update_all_rows(t1_context));
+
+  // The rows are unlocked again, but their uncommitted versions conflict
+  EXPECT_TRUE(update_all_rows(t2_context));
+  t2_context->rollback();
+
+  t1_context->commit();
+
+  // Transactions started after the commit see the versions and can update the rows again
+  auto t3_context = TransactionManager::get().new_transaction_context();
+  EXPECT_FALSE(update_all_rows(t3_context));
+  t3_context->commit();
+
+  EXPECT_EQ(table->row_count(), 3u);
+}
+
+TEST_F(OperatorsUpdateTest, InPlaceUpdateOfFrozenChunk) {
+  auto table = load_table("src/test/tables/int_int.tbl", 3u);
+  table->set_in_place_updates(true);
+  StorageManager::get().add_table("updateTestTable4", table);
+
+  // As if the chunk was being compressed
+  ASSERT_TRUE(table->get_chunk(ChunkID{0})->value_deltas()->try_freeze());
+
+  auto context = TransactionManager::get().new_transaction_context();
+
+  auto gt = std::make_shared<GetTable>("updateTestTable4");
+  gt->set_transaction_context(context);
+  gt->execute();
+
+  auto validate = std::make_shared<Validate>(gt);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  auto rows_to_update = std::make_shared<Projection>(
+      validate, Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{1})});
+  rows_to_update->execute();
+
+  auto updated_values =
+      std::make_shared<Projection>(validate, Projection::ColumnExpressions{PQPExpression::create_literal(7, {"b"})});
+  updated_values->execute();
+
+  auto update = std::make_shared<Update>("updateTestTable4", rows_to_update, updated_values);
+  update->set_transaction_context(context);
+  update->execute();
+  EXPECT_FALSE(update->execute_failed());
+  context->commit();
+
+  // Update fell back to Delete and Insert
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->value_deltas()->empty());
+  EXPECT_EQ(table->row_count(), 6u);
+}
+
 TEST_F(OperatorsUpdateTest, MissingChunks) {
   auto t_context = TransactionManager::get().new_transaction_context();
 
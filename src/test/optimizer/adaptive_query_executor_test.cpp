@@ -0,0 +1,95 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/materialized_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "optimizer/adaptive_query_executor.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class AdaptiveQueryExecutorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("customer", load_table("src/test/tables/tpch/sf-0.001/customer.tbl", 20));
+    StorageManager::get().add_table("nation", load_table("src/test/tables/tpch/sf-0.001/nation.tbl", 5));
+    StorageManager::get().add_table("region", load_table("src/test/tables/tpch/sf-0.001/region.tbl", 5));
+
+    _customer_node = StoredTableNode::make("customer");
+    _nation_node = StoredTableNode::make("nation");
+    _region_node = StoredTableNode::make("region");
+
+    const auto c_nationkey = LQPColumnReference{_customer_node, ColumnID{3}};
+    const auto n_nationkey = LQPColumnReference{_nation_node, ColumnID{0}};
+    const auto n_regionkey = LQPColumnReference{_nation_node, ColumnID{2}};
+    const auto r_regionkey = LQPColumnReference{_region_node, ColumnID{0}};
+
+    // clang-format off
+    _lqp =
+    JoinNode::make(JoinMode::Inner, LQPColumnReferencePair{n_nationkey, c_nationkey}, PredicateCondition::Equals,
+      JoinNode::make(JoinMode::Inner, LQPColumnReferencePair{n_regionkey, r_regionkey}, PredicateCondition::Equals,
+        _nation_node,
+        _region_node),
+      _customer_node);
+    // clang-format on
+
+    const auto reference_operator = LQPTranslator{}.translate_node(_lqp->deep_copy());
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(reference_operator));
+    _expected_table = reference_operator->get_output();
+  }
+
+  // Pretend that nation is way larger than it actually is
+  void mislead_nation_statistics() {
+    const auto& nation_statistics = StorageManager::get().get_table("nation")->table_statistics();
+    _nation_node->set_statistics(std::make_shared<TableStatistics>(TableType::Data, 100'000.0f,
+                                                                   nation_statistics->column_statistics()));
+  }
+
+  std::shared_ptr<StoredTableNode> _customer_node, _nation_node, _region_node;
+  std::shared_ptr<AbstractLQPNode> _lqp;
+  std::shared_ptr<const Table> _expected_table;
+};
+
+TEST_F(AdaptiveQueryExecutorTest, AccurateEstimatesKeepPlan) {
+  auto executor = AdaptiveQueryExecutor{std::make_shared<LQPTranslator>(), 1'000.0f};
+  const auto root_operator = executor.execute(_lqp);
+
+  EXPECT_EQ(executor.reoptimization_count(), 0u);
+  EXPECT_TABLE_EQ_UNORDERED(root_operator->get_output(), _expected_table);
+
+  // The topmost join has been executed as the last step and stands in for the entire LQP now
+  ASSERT_EQ(executor.executed_lqp()->type(), LQPNodeType::Materialized);
+  EXPECT_EQ(std::static_pointer_cast<MaterializedNode>(executor.executed_lqp())->subplan(), _lqp);
+}
+
+TEST_F(AdaptiveQueryExecutorTest, ReoptimizesOnMisestimate) {
+  mislead_nation_statistics();
+
+  auto executor = AdaptiveQueryExecutor{std::make_shared<LQPTranslator>(), 2.0f};
+  const auto root_operator = executor.execute(_lqp);
+
+  EXPECT_EQ(executor.reoptimization_count(), 1u);
+  EXPECT_TABLE_EQ_UNORDERED(root_operator->get_output(), _expected_table);
+
+  // The operator that revealed the misestimate knows about the decision
+  const auto nation_operator = root_operator->input_left()->input_left();
+  ASSERT_NE(nation_operator, nullptr);
+  ASSERT_NE(nation_operator->lqp_node(), nullptr);
+  ASSERT_EQ(nation_operator->lqp_node()->type(), LQPNodeType::Materialized);
+
+  const auto materialized_node = std::static_pointer_cast<const MaterializedNode>(nation_operator->lqp_node());
+  EXPECT_EQ(materialized_node->subplan(), _nation_node);
+  EXPECT_TRUE(materialized_node->triggered_reoptimization());
+  EXPECT_FLOAT_EQ(materialized_node->estimated_row_count(), 100'000.0f);
+  EXPECT_FLOAT_EQ(materialized_node->actual_row_count(), 25.0f);
+}
+
+}  // namespace opossum
@@ -0,0 +1,119 @@
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/greedy_operator_ordering.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/join_graph_builder.hpp"
+#include "optimizer/join_ordering/join_plan_predicate.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+
+namespace opossum {
+
+class GreedyOperatorOrderingTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    _mock_node_a = MockNode::make(make_statistics(1000));
+    _mock_node_b = MockNode::make(make_statistics(10));
+    _mock_node_c = MockNode::make(make_statistics(100));
+
+    _a_0 = LQPColumnReference{_mock_node_a, ColumnID{0}};
+    _b_0 = LQPColumnReference{_mock_node_b, ColumnID{0}};
+    _c_0 = LQPColumnReference{_mock_node_c, ColumnID{0}};
+  }
+
+  // A single int column with unique values from 0 to row_count - 1
+  static std::shared_ptr<TableStatistics> make_statistics(const float row_count) {
+    std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
+    column_statistics.emplace_back(
+        std::make_shared<ColumnStatistics<int32_t>>(0.0f, row_count, 0, static_cast<int32_t>(row_count) - 1));
+    return std::make_shared<TableStatistics>(TableType::Data, row_count, column_statistics);
+  }
+
+  std::shared_ptr<JoinGraph> make_join_graph(
+      const std::vector<std::shared_ptr<const AbstractJoinPlanPredicate>>& predicates) {
+    const auto vertices = std::vector<std::shared_ptr<AbstractLQPNode>>{_mock_node_a, _mock_node_b, _mock_node_c};
+    auto edges = JoinGraphBuilder::join_edges_from_predicates(vertices, predicates);
+    const auto cross_edges = JoinGraphBuilder::cross_edges_between_components(vertices, edges);
+    edges.insert(edges.end(), cross_edges.begin(), cross_edges.end());
+
+    return std::make_shared<JoinGraph>(vertices, std::vector<LQPOutputRelation>{}, edges);
+  }
+
+  std::shared_ptr<MockNode> _mock_node_a, _mock_node_b, _mock_node_c;
+  LQPColumnReference _a_0, _b_0, _c_0;
+};
+
+TEST_F(GreedyOperatorOrderingTest, JoinsSmallestIntermediateResultFirst) {
+  // a joins with both b and c, but joining b yields the smaller intermediate result
+  const auto join_graph = make_join_graph({
+      std::make_shared<JoinPlanAtomicPredicate>(_a_0, PredicateCondition::Equals, _c_0),
+      std::make_shared<JoinPlanAtomicPredicate>(_a_0, PredicateCondition::Equals, _b_0),
+  });
+
+  const auto lqp = GreedyOperatorOrdering{}(join_graph);  // NOLINT
+
+  ASSERT_EQ(lqp->type(), LQPNodeType::Join);
+  EXPECT_EQ(lqp->right_input(), _mock_node_c);
+
+  const auto lower_join_node = std::dynamic_pointer_cast<JoinNode>(lqp->left_input());
+  ASSERT_NE(lower_join_node, nullptr);
+  EXPECT_EQ(lower_join_node->join_mode(), JoinMode::Inner);
+  EXPECT_EQ(lower_join_node->left_input(), _mock_node_a);
+  EXPECT_EQ(lower_join_node->right_input(), _mock_node_b);
+
+  // The discarded candidates have been untied from the vertices
+  EXPECT_EQ(_mock_node_a->output_count(), 1u);
+  EXPECT_EQ(_mock_node_b->output_count(), 1u);
+  EXPECT_EQ(_mock_node_c->output_count(), 1u);
+}
+
+TEST_F(GreedyOperatorOrderingTest, PlacesPredicatesAsLowAsPossible) {
+  const auto join_graph = make_join_graph({
+      std::make_shared<JoinPlanAtomicPredicate>(_c_0, PredicateCondition::Equals, _a_0),
+      std::make_shared<JoinPlanAtomicPredicate>(_b_0, PredicateCondition::Equals, _a_0),
+      std::make_shared<JoinPlanAtomicPredicate>(_b_0, PredicateCondition::LessThan, _c_0),
+      std::make_shared<JoinPlanAtomicPredicate>(_c_0, PredicateCondition::GreaterThan, 5),
+  });
+
+  const auto lqp = GreedyOperatorOrdering{}(join_graph);  // NOLINT
+
+  // The predicate on c alone is placed directly on top of c, the one on b and c above the join bringing them together
+  ASSERT_EQ(lqp->type(), LQPNodeType::Predicate);
+  EXPECT_EQ(std::static_pointer_cast<PredicateNode>(lqp)->predicate_condition(), PredicateCondition::LessThan);
+
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(lqp->left_input());
+  ASSERT_NE(join_node, nullptr);
+  EXPECT_EQ(join_node->join_mode(), JoinMode::Inner);
+
+  const auto c_predicate_node = std::dynamic_pointer_cast<PredicateNode>(_mock_node_c->outputs().at(0));
+  ASSERT_NE(c_predicate_node, nullptr);
+  EXPECT_EQ(c_predicate_node->predicate_condition(), PredicateCondition::GreaterThan);
+
+  // Join predicates with the left operand from the right subplan swap the inputs instead of the PredicateCondition
+  EXPECT_EQ(join_node->join_column_references()->first, _c_0);
+  EXPECT_EQ(join_node->left_input(), c_predicate_node);
+}
+
+TEST_F(GreedyOperatorOrderingTest, CrossJoinsUnconnectedVertices) {
+  const auto join_graph = make_join_graph({
+      std::make_shared<JoinPlanAtomicPredicate>(_a_0, PredicateCondition::Equals, _b_0),
+  });
+
+  const auto lqp = GreedyOperatorOrdering{}(join_graph);  // NOLINT
+
+  ASSERT_EQ(lqp->type(), LQPNodeType::Join);
+  EXPECT_EQ(std::static_pointer_cast<JoinNode>(lqp)->join_mode(), JoinMode::Cross);
+
+  const auto lower_join_node = std::dynamic_pointer_cast<JoinNode>(lqp->left_input());
+  ASSERT_NE(lower_join_node, nullptr);
+  EXPECT_EQ(lower_join_node->join_mode(), JoinMode::Inner);
+  EXPECT_EQ(lqp->right_input(), _mock_node_c);
+}
+
+}  // namespace opossum
@@ -19,6 +19,7 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "operators/aggregate.hpp"
+#include "operators/distinct.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/join_hash.hpp"
@@ -404,6 +405,37 @@ TEST_F(LQPTranslatorTest, AggregateNodeWithArithmetics) {
   EXPECT_EQ(column_expression1->alias(), std::nullopt);
 }
 
+TEST_F(LQPTranslatorTest, AggregateNodeWithoutAggregatesOnAllColumns) {
+  const auto stored_table_node = StoredTableNode::make("table_int_float");
+  const auto aggregate_node =
+      AggregateNode::make(std::vector<std::shared_ptr<LQPExpression>>{}, stored_table_node->output_column_references());
+  aggregate_node->set_left_input(stored_table_node);
+
+  const auto op = LQPTranslator{}.translate_node(aggregate_node);
+
+  const auto distinct_op = std::dynamic_pointer_cast<Distinct>(op);
+  ASSERT_TRUE(distinct_op);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(distinct_op->input_left()));
+}
+
+TEST_F(LQPTranslatorTest, AggregateNodeWithoutAggregatesOnSomeColumns) {
+  const auto stored_table_node = StoredTableNode::make("table_int_float");
+  const auto aggregate_node = AggregateNode::make(std::vector<std::shared_ptr<LQPExpression>>{},
+                                                  std::vector<LQPColumnReference>{{stored_table_node, ColumnID{1}}});
+  aggregate_node->set_left_input(stored_table_node);
+
+  const auto op = LQPTranslator{}.translate_node(aggregate_node);
+
+  const auto distinct_op = std::dynamic_pointer_cast<Distinct>(op);
+  ASSERT_TRUE(distinct_op);
+
+  // Only the GROUP BY column is passed to the Distinct operator
+  const auto projection_op = std::dynamic_pointer_cast<const Projection>(distinct_op->input_left());
+  ASSERT_TRUE(projection_op);
+  ASSERT_EQ(projection_op->column_expressions().size(), 1u);
+  EXPECT_EQ(projection_op->column_expressions()[0]->column_id(), ColumnID{1});
+}
+
 TEST_F(LQPTranslatorTest, MultipleNodesHierarchy) {
   /**
    * Build LQP and translate to PQP
@@ -14,11 +14,13 @@ struct MockRule : public AbstractRule {
   std::string name() const override { return "MockNode"; }
 
   bool apply_to(const std::shared_ptr<AbstractLQPNode>& root) override {
+    ++num_applications;
     num_iterations = num_iterations > 0 ? num_iterations - 1 : 0;
     return num_iterations != 0;
   }
 
   uint32_t num_iterations;
+  uint32_t num_applications{0};
 };
 
 TEST_F(OptimizerTest, RuleBatches) {
@@ -50,4 +52,28 @@ TEST_F(OptimizerTest, RuleBatches) {
   EXPECT_EQ(iterative_rule_d->num_iterations, 6u);
 }
 
+TEST_F(OptimizerTest, IterativeBatchStopsOnceAllRulesReachedFixpoint) {
+  // rule_a changes the LQP in its first two applications. After its second change, rule_b and rule_c are applied
+  // without changing anything, so the third application of rule_a is the last one - no full extra pass is needed.
+  auto rule_a = std::make_shared<MockRule>(3u);
+  auto rule_b = std::make_shared<MockRule>(1u);
+  auto rule_c = std::make_shared<MockRule>(1u);
+
+  RuleBatch iterative_batch(RuleBatchExecutionPolicy::Iterative);
+  iterative_batch.add_rule(rule_a);
+  iterative_batch.add_rule(rule_b);
+  iterative_batch.add_rule(rule_c);
+
+  Optimizer optimizer{10};
+  optimizer.add_rule_batch(iterative_batch);
+
+  auto lqp = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}});
+
+  optimizer.optimize(lqp);
+
+  EXPECT_EQ(rule_a->num_applications, 3u);
+  EXPECT_EQ(rule_b->num_applications, 2u);
+  EXPECT_EQ(rule_c->num_applications, 2u);
+}
+
 }  // namespace opossum
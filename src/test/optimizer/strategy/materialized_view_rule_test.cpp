@@ -0,0 +1,140 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/materialized_view_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "optimizer/strategy/materialized_view_rule.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class MaterializedViewRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("t", load_table("src/test/tables/int_int_int.tbl", 2));
+    StorageManager::get().add_materialized_view("v", std::make_shared<MaterializedView>(_make_view_lqp()));
+
+    _rule = std::make_shared<MaterializedViewRule>();
+  }
+
+  // SELECT a, SUM(b) FROM t WHERE c > 9 GROUP BY a, built anew for each call
+  static std::shared_ptr<AbstractLQPNode> _make_view_lqp() {
+    const auto stored_table_node = StoredTableNode::make("t");
+    const auto a = LQPColumnReference{stored_table_node, ColumnID{0}};
+    const auto b = LQPColumnReference{stored_table_node, ColumnID{1}};
+    const auto c = LQPColumnReference{stored_table_node, ColumnID{2}};
+
+    const auto aggregates = std::vector<std::shared_ptr<LQPExpression>>{
+        LQPExpression::create_aggregate_function(AggregateFunction::Sum, {LQPExpression::create_column(b)})};
+
+    return AggregateNode::make(
+        aggregates, std::vector<LQPColumnReference>{a},
+        PredicateNode::make(c, PredicateCondition::GreaterThan, 9, ValidateNode::make(stored_table_node)));
+  }
+
+  static std::shared_ptr<const Table> _execute(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                               const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto pqp = LQPTranslator{}.translate_node(lqp);
+    pqp->set_transaction_context_recursively(transaction_context);
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(pqp));
+    return pqp->get_output();
+  }
+
+  static void _insert(const std::vector<AllTypeVariant>& values,
+                      const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto rows = std::make_shared<Table>(StorageManager::get().get_table("t")->column_definitions(),
+                                              TableType::Data);
+    rows->append(values);
+    const auto table_wrapper = std::make_shared<TableWrapper>(rows);
+    table_wrapper->execute();
+
+    const auto insert = std::make_shared<Insert>("t", table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+  }
+
+  std::shared_ptr<MaterializedViewRule> _rule;
+};
+
+TEST_F(MaterializedViewRuleTest, ReplacesSubplanEqualToView) {
+  const auto view_lqp = _make_view_lqp();
+  const auto sum_b = view_lqp->output_column_references()[1];
+  const auto lqp = PredicateNode::make(sum_b, PredicateCondition::GreaterThan, int64_t{10}, view_lqp);
+
+  const auto result_lqp = apply_rule(_rule, lqp);
+
+  ASSERT_EQ(result_lqp, lqp);
+  ASSERT_EQ(lqp->left_input()->type(), LQPNodeType::MaterializedView);
+
+  // The column references of the nodes above remain valid
+  const auto materialized_view_node = std::static_pointer_cast<MaterializedViewNode>(lqp->left_input());
+  EXPECT_EQ(materialized_view_node->view_name(), "v");
+  EXPECT_EQ(lqp->find_output_column_id(sum_b), ColumnID{1});
+
+  const auto get_table = std::dynamic_pointer_cast<GetTable>(LQPTranslator{}.translate_node(materialized_view_node));
+  ASSERT_NE(get_table, nullptr);
+  EXPECT_EQ(get_table->table_name(), "v");
+}
+
+TEST_F(MaterializedViewRuleTest, KeepsDifferentSubplan) {
+  const auto stored_table_node = StoredTableNode::make("t");
+  const auto c = LQPColumnReference{stored_table_node, ColumnID{2}};
+  const auto lqp =
+      PredicateNode::make(c, PredicateCondition::GreaterThan, 10, ValidateNode::make(stored_table_node));
+
+  EXPECT_FALSE(_rule->apply_to(lqp));
+  EXPECT_EQ(lqp->left_input()->type(), LQPNodeType::Validate);
+}
+
+TEST_F(MaterializedViewRuleTest, ExecutesSubplanForOutdatedSnapshot) {
+  const auto lqp = apply_rule(_rule, _make_view_lqp());
+  ASSERT_EQ(lqp->type(), LQPNodeType::MaterializedView);
+
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+  _insert({9, 1, 10}, transaction_context);
+  transaction_context->commit();
+
+  const auto outdated_transaction_context = TransactionManager::get().new_transaction_context();
+
+  transaction_context = TransactionManager::get().new_transaction_context();
+  _insert({9, 2, 10}, transaction_context);
+  transaction_context->commit();
+
+  // Refreshes the view past the snapshot of outdated_transaction_context, which sees the first insert only
+  _execute(lqp, TransactionManager::get().new_transaction_context());
+
+  EXPECT_TABLE_EQ_UNORDERED(_execute(lqp, outdated_transaction_context),
+                            _execute(_make_view_lqp(), outdated_transaction_context));
+}
+
+TEST_F(MaterializedViewRuleTest, ExecutesSubplanForOwnWrites) {
+  const auto lqp = apply_rule(_rule, _make_view_lqp());
+  ASSERT_EQ(lqp->type(), LQPNodeType::MaterializedView);
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  _insert({9, 1, 10}, transaction_context);
+
+  // Without the fallback, the read would miss the uncommitted row
+  EXPECT_TABLE_EQ_UNORDERED(_execute(lqp, transaction_context), _execute(_make_view_lqp(), transaction_context));
+
+  transaction_context->rollback();
+}
+
+}  // namespace opossum
@@ -11,7 +11,9 @@
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
 #include "scheduler/topology.hpp"
+#include "storage/chunk.hpp"
 #include "storage/storage_manager.hpp"
+#include "utils/numa_memory_resource.hpp"
 
 namespace opossum {
 
@@ -203,4 +205,88 @@ TEST_F(SchedulerTest, MultipleOperators) {
   EXPECT_TABLE_EQ_UNORDERED(ts->get_output(), expected_result);
 }
 
+TEST_F(SchedulerTest, PreferredNode) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  // Jobs preferring a node the scheduler has no queue for are scheduled like jobs without a preference
+  std::atomic_uint counter{0};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{std::make_shared<JobTask>([&]() { ++counter; }, NodeID{1}),
+                                                         std::make_shared<JobTask>([&]() { ++counter; }, NodeID{42})};
+  EXPECT_EQ(jobs[0]->preferred_node_id(), NodeID{1});
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  EXPECT_EQ(counter, 2u);
+
+  CurrentScheduler::set(nullptr);
+}
+
+TEST_F(SchedulerTest, JobTaskCounter) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  // Created before the counter, not counted
+  std::make_shared<JobTask>([]() {})->execute();
+
+  auto outer_count = size_t{0};
+  auto inner_count = size_t{0};
+  {
+    const JobTaskCounter outer_counter;
+
+    // The jobs created by the jobs are counted as well, even though they are created by other threads
+    auto jobs = std::vector<std::shared_ptr<JobTask>>{};
+    for (auto job_index = 0; job_index < 3; ++job_index) {
+      jobs.emplace_back(std::make_shared<JobTask>([]() {
+        auto nested_jobs = std::vector<std::shared_ptr<JobTask>>{std::make_shared<JobTask>([]() {}),
+                                                                 std::make_shared<JobTask>([]() {})};
+        CurrentScheduler::schedule_and_wait_for_tasks(nested_jobs);
+      }));
+    }
+
+    {
+      // Jobs created while a nested counter is active are attributed to that counter only
+      const JobTaskCounter inner_counter;
+      std::make_shared<JobTask>([]() {})->execute();
+      inner_count = inner_counter.count();
+    }
+
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+    outer_count = outer_counter.count();
+  }
+
+  EXPECT_EQ(inner_count, 1u);
+  EXPECT_EQ(outer_count, 9u);
+
+  CurrentScheduler::set(nullptr);
+}
+
+#if !HYRISE_NUMA_SUPPORT
+TEST_F(SchedulerTest, OperatorsOnChunksOfDifferentNodes) {
+  // Without NUMA support, the node of a NUMAMemoryResource is only a label. The resources outlive all tables.
+  static auto memory_resources = std::vector<NUMAMemoryResource>{{0, "node_0"}, {1, "node_1"}};
+
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  auto test_table = load_table("src/test/tables/int_float.tbl", 1);
+  for (ChunkID chunk_id{0}; chunk_id < test_table->chunk_count(); ++chunk_id) {
+    test_table->get_chunk(chunk_id)->migrate(&memory_resources[chunk_id % 2]);
+    EXPECT_EQ(test_table->get_chunk(chunk_id)->node_id(), NodeID{static_cast<NodeID::base_type>(chunk_id % 2)});
+  }
+  StorageManager::get().add_table("table", test_table);
+
+  auto gt = std::make_shared<GetTable>("table");
+  gt->execute();
+  auto ts = std::make_shared<TableScan>(gt, ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
+  ts->execute();
+
+  auto expected_result = load_table("src/test/tables/int_float_filtered2.tbl", 1);
+  EXPECT_TABLE_EQ_UNORDERED(ts->get_output(), expected_result);
+
+  // The output chunks are placed on the nodes of the chunks they reference
+  for (ChunkID chunk_id{0}; chunk_id < ts->get_output()->chunk_count(); ++chunk_id) {
+    EXPECT_NE(ts->get_output()->get_chunk(chunk_id)->node_id(), CURRENT_NODE_ID);
+  }
+
+  CurrentScheduler::set(nullptr);
+}
+#endif
+
 }  // namespace opossum
@@ -0,0 +1,123 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+#include "json.hpp"
+
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/task_tracer.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class TaskTracerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("src/test/tables/int_float.tbl", 2));
+    TaskTracer::get().enable();
+  }
+
+  void TearDown() override { TaskTracer::get().disable(); }
+
+  void _run_query() {
+    auto get_table = std::make_shared<GetTable>("table_a");
+    auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, PredicateCondition::GreaterThan, 200);
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(table_scan));
+  }
+
+  nlohmann::json _trace(const TaskTracer::Clock::time_point begin = TaskTracer::Clock::time_point::min(),
+                        const TaskTracer::Clock::time_point end = TaskTracer::Clock::time_point::max()) {
+    auto stream = std::stringstream{};
+    TaskTracer::get().write_chrome_trace(stream, begin, end);
+    return nlohmann::json::parse(stream.str());
+  }
+
+  std::vector<nlohmann::json> _events(const nlohmann::json& trace, const std::string& category) {
+    auto events = std::vector<nlohmann::json>{};
+    for (const auto& event : trace["traceEvents"]) {
+      if (event.count("cat") && event["cat"] == category) events.emplace_back(event);
+    }
+    return events;
+  }
+};
+
+TEST_F(TaskTracerTest, TasksAreNamedByTheirOperator) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(2, 1)));
+  _run_query();
+  CurrentScheduler::get()->finish();
+
+  const auto tasks = _events(_trace(), "Task");
+
+  auto task_names = std::vector<std::string>{};
+  for (const auto& task : tasks) {
+    EXPECT_EQ(task["ph"], "X");
+    EXPECT_GE(task["dur"].get<double>(), 0.0);
+    task_names.emplace_back(task["name"]);
+  }
+
+  // The TableScan also spawned one JobTask per chunk
+  EXPECT_EQ(std::count(task_names.begin(), task_names.end(), "GetTable"), 1);
+  EXPECT_EQ(std::count(task_names.begin(), task_names.end(), "TableScan"), 1);
+  EXPECT_EQ(std::count(task_names.begin(), task_names.end(), "JobTask"), 2);
+}
+
+TEST_F(TaskTracerTest, WorkerEvents) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(2, 1)));
+  _run_query();
+  CurrentScheduler::get()->finish();
+
+  const auto trace = _trace();
+
+  // The OperatorTask of the TableScan waited for its JobTasks and handed off the token meanwhile
+  EXPECT_FALSE(_events(trace, "WaitForTasks").empty());
+  EXPECT_FALSE(_events(trace, "TokenYielded").empty());
+  EXPECT_FALSE(_events(trace, "TokenAcquired").empty());
+
+  auto worker_threads = 0;
+  for (const auto& event : trace["traceEvents"]) {
+    if (event["ph"] == "M" && event["name"] == "thread_name" && event["args"]["name"] != "Thread") ++worker_threads;
+  }
+  EXPECT_GE(worker_threads, 1);
+}
+
+TEST_F(TaskTracerTest, TimeWindow) {
+  const auto before_query = TaskTracer::Clock::now();
+  _run_query();
+  const auto after_query = TaskTracer::Clock::now();
+
+  EXPECT_EQ(_events(_trace(before_query, after_query), "Task").size(), 4u);
+  EXPECT_TRUE(_events(_trace(after_query), "Task").empty());
+}
+
+TEST_F(TaskTracerTest, RingBuffer) {
+  TaskTracer::get().enable(3);
+  _run_query();
+
+  // Without a scheduler, all tasks run on this thread
+  const auto tasks = _events(_trace(), "Task");
+  ASSERT_EQ(tasks.size(), 3u);
+
+  // The GetTable was overwritten
+  for (const auto& task : tasks) {
+    EXPECT_NE(task["name"], "GetTable");
+  }
+}
+
+TEST_F(TaskTracerTest, Disabled) {
+  TaskTracer::get().disable();
+  TaskTracer::get().clear();
+  _run_query();
+
+  EXPECT_TRUE(_events(_trace(), "Task").empty());
+}
+
+}  // namespace opossum
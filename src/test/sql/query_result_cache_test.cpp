@@ -0,0 +1,119 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "sql/query_result_cache.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class QueryResultCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("src/test/tables/int_float.tbl", 2));
+
+    QueryResultCache::get().clear();
+    QueryResultCache::get().set_memory_budget(1'000'000);
+  }
+
+  void TearDown() override {
+    QueryResultCache::get().set_memory_budget(0);
+    QueryResultCache::get().clear();
+  }
+
+  static std::shared_ptr<SQLPipelineStatement> execute(
+      const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql};
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+
+    auto statement = std::make_shared<SQLPipelineStatement>(builder.create_pipeline_statement());
+    statement->get_result_table();
+    return statement;
+  }
+
+  const std::string _select_query = "SELECT * FROM table_a WHERE a > 1000";
+};
+
+TEST_F(QueryResultCacheTest, ServesRepeatedQuery) {
+  const auto first_statement = execute(_select_query);
+  EXPECT_FALSE(first_statement->result_cache_hit());
+
+  const auto second_statement = execute(_select_query);
+  EXPECT_TRUE(second_statement->result_cache_hit());
+  EXPECT_EQ(second_statement->get_result_table(), first_statement->get_result_table());
+
+  EXPECT_EQ(QueryResultCache::get().hit_count(), 1u);
+  EXPECT_EQ(QueryResultCache::get().miss_count(), 1u);
+  EXPECT_GT(QueryResultCache::get().memory_usage(), 0u);
+
+  const auto entry_statistics = QueryResultCache::get().entry_statistics();
+  ASSERT_EQ(entry_statistics.size(), 1u);
+  EXPECT_EQ(entry_statistics[0].sql, _select_query);
+  EXPECT_EQ(entry_statistics[0].hit_count, 1u);
+  EXPECT_EQ(entry_statistics[0].saved_execution_time, first_statement->execution_time_microseconds());
+}
+
+TEST_F(QueryResultCacheTest, DifferentQueriesAreCachedSeparately) {
+  execute(_select_query);
+  const auto statement = execute("SELECT * FROM table_a WHERE a > 100");
+
+  EXPECT_FALSE(statement->result_cache_hit());
+  EXPECT_EQ(statement->get_result_table()->row_count(), 3u);
+  EXPECT_EQ(QueryResultCache::get().entry_statistics().size(), 2u);
+}
+
+TEST_F(QueryResultCacheTest, CommitInvalidatesResult) {
+  execute(_select_query);
+  execute("INSERT INTO table_a VALUES (5000, 1.5)");
+
+  const auto statement = execute(_select_query);
+  EXPECT_FALSE(statement->result_cache_hit());
+  EXPECT_EQ(statement->get_result_table()->row_count(), 3u);
+
+  // The outdated entry was replaced
+  EXPECT_EQ(QueryResultCache::get().entry_statistics().size(), 1u);
+  EXPECT_TRUE(execute(_select_query)->result_cache_hit());
+}
+
+TEST_F(QueryResultCacheTest, NewerResultIsNotServedToOlderSnapshot) {
+  const auto old_transaction_context = TransactionManager::get().new_transaction_context();
+
+  execute("INSERT INTO table_a VALUES (5000, 1.5)");
+  EXPECT_EQ(execute(_select_query)->get_result_table()->row_count(), 3u);
+
+  const auto statement = execute(_select_query, old_transaction_context);
+  EXPECT_FALSE(statement->result_cache_hit());
+  EXPECT_EQ(statement->get_result_table()->row_count(), 2u);
+}
+
+TEST_F(QueryResultCacheTest, UncommittedModificationsBypassCache) {
+  execute(_select_query);
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  execute("INSERT INTO table_a VALUES (5000, 1.5)", transaction_context);
+
+  const auto statement = execute(_select_query, transaction_context);
+  EXPECT_FALSE(statement->result_cache_hit());
+  EXPECT_EQ(statement->get_result_table()->row_count(), 3u);
+}
+
+TEST_F(QueryResultCacheTest, RespectsMemoryBudget) {
+  QueryResultCache::get().set_memory_budget(1);
+
+  execute(_select_query);
+  EXPECT_FALSE(execute(_select_query)->result_cache_hit());
+  EXPECT_EQ(QueryResultCache::get().memory_usage(), 0u);
+}
+
+TEST_F(QueryResultCacheTest, DisabledWithoutMvcc) {
+  SQLPipelineBuilder{_select_query}.disable_mvcc().create_pipeline_statement().get_result_table();
+
+  EXPECT_EQ(QueryResultCache::get().entry_statistics().size(), 0u);
+}
+
+}  // namespace opossum
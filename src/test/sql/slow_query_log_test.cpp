@@ -0,0 +1,145 @@
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+#include "json.hpp"
+
+#include "sql/slow_query_log.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class SlowQueryLogTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("src/test/tables/int_float.tbl", 2));
+    std::remove(_filename.c_str());
+  }
+
+  void TearDown() override {
+    SlowQueryLog::get().disable();
+    std::remove(_filename.c_str());
+  }
+
+  std::vector<nlohmann::json> _read_log() {
+    SlowQueryLog::get().flush();
+
+    auto entries = std::vector<nlohmann::json>{};
+    auto file = std::ifstream{_filename};
+    auto line = std::string{};
+    while (std::getline(file, line)) {
+      entries.emplace_back(nlohmann::json::parse(line));
+    }
+    return entries;
+  }
+
+  SlowQueryLog::Entry _entry(const std::string& sql) {
+    auto entry = SlowQueryLog::Entry{};
+    entry.sql = sql;
+    entry.translate_time = std::chrono::microseconds{1};
+    entry.optimize_time = std::chrono::microseconds{2};
+    entry.compile_time = std::chrono::microseconds{3};
+    entry.execution_time = std::chrono::microseconds{4};
+    entry.query_plan_cache_hit = true;
+    entry.result_cache_hit = false;
+    entry.operators = {{int32_t{0}, std::string{"GetTable"}, NULL_VALUE, int64_t{3}}};
+    return entry;
+  }
+
+  const std::string _filename = test_data_path + "slow_query_log_test.log";
+};
+
+TEST_F(SlowQueryLogTest, Disabled) {
+  EXPECT_FALSE(SlowQueryLog::get().is_enabled());
+  EXPECT_FALSE(SlowQueryLog::get().exceeds_threshold(std::chrono::hours{1}));
+
+  SlowQueryLog::get().log(_entry("SELECT 1"));
+  EXPECT_TRUE(_read_log().empty());
+}
+
+TEST_F(SlowQueryLogTest, Threshold) {
+  SlowQueryLog::get().enable(_filename, std::chrono::milliseconds{10});
+
+  EXPECT_TRUE(SlowQueryLog::get().is_enabled());
+  EXPECT_FALSE(SlowQueryLog::get().exceeds_threshold(std::chrono::microseconds{9999}));
+  EXPECT_TRUE(SlowQueryLog::get().exceeds_threshold(std::chrono::microseconds{10000}));
+}
+
+TEST_F(SlowQueryLogTest, WritesJSONLines) {
+  SlowQueryLog::get().enable(_filename, std::chrono::microseconds{0});
+  SlowQueryLog::get().log(_entry("SELECT 1"));
+  SlowQueryLog::get().log(_entry("SELECT 2"));
+
+  const auto entries = _read_log();
+  ASSERT_EQ(entries.size(), 2u);
+  EXPECT_EQ(entries[0]["sql"], "SELECT 1");
+  EXPECT_EQ(entries[1]["sql"], "SELECT 2");
+  EXPECT_EQ(entries[0]["translate_us"], 1);
+  EXPECT_EQ(entries[0]["optimize_us"], 2);
+  EXPECT_EQ(entries[0]["compile_us"], 3);
+  EXPECT_EQ(entries[0]["execute_us"], 4);
+  EXPECT_EQ(entries[0]["total_us"], 10);
+  EXPECT_EQ(entries[0]["query_plan_cache_hit"], true);
+  EXPECT_EQ(entries[0]["result_cache_hit"], false);
+
+  ASSERT_EQ(entries[0]["operators"].size(), 1u);
+  const auto& get_table = entries[0]["operators"][0];
+  EXPECT_EQ(get_table["id"], 0);
+  EXPECT_EQ(get_table["operator"], "GetTable");
+  EXPECT_TRUE(get_table["estimated_rows"].is_null());
+  EXPECT_EQ(get_table["actual_rows"], 3);
+  EXPECT_EQ(SlowQueryLog::get().dropped_entry_count(), 0u);
+}
+
+TEST_F(SlowQueryLogTest, DisableWritesQueuedEntries) {
+  SlowQueryLog::get().enable(_filename, std::chrono::microseconds{0});
+  for (auto i = 0; i < 10; ++i) {
+    SlowQueryLog::get().log(_entry("SELECT " + std::to_string(i)));
+  }
+  SlowQueryLog::get().disable();
+
+  EXPECT_EQ(_read_log().size(), 10u);
+}
+
+TEST_F(SlowQueryLogTest, AppendsToExistingLog) {
+  SlowQueryLog::get().enable(_filename, std::chrono::microseconds{0});
+  SlowQueryLog::get().log(_entry("SELECT 1"));
+  SlowQueryLog::get().disable();
+
+  SlowQueryLog::get().enable(_filename, std::chrono::microseconds{0});
+  SlowQueryLog::get().log(_entry("SELECT 2"));
+
+  EXPECT_EQ(_read_log().size(), 2u);
+}
+
+TEST_F(SlowQueryLogTest, LogsSQLPipelineStatements) {
+  SlowQueryLog::get().enable(_filename, std::chrono::microseconds{0});
+
+  const auto sql = std::string{"SELECT * FROM table_a WHERE a > 200"};
+  auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+  sql_pipeline.get_result_table();
+
+  const auto entries = _read_log();
+  ASSERT_EQ(entries.size(), 1u);
+  EXPECT_EQ(entries[0]["sql"], sql);
+  EXPECT_EQ(entries[0]["result_cache_hit"], false);
+  EXPECT_GE(entries[0]["operators"].size(), 2u);
+  EXPECT_TRUE(entries[0]["operators"][0]["walltime_us"].is_number());
+  EXPECT_TRUE(entries[0]["operators"][0]["actual_rows"].is_number());
+}
+
+TEST_F(SlowQueryLogTest, FastStatementsAreNotLogged) {
+  SlowQueryLog::get().enable(_filename, std::chrono::hours{1});
+
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_a"}.create_pipeline();
+  sql_pipeline.get_result_table();
+
+  EXPECT_TRUE(_read_log().empty());
+}
+
+}  // namespace opossum
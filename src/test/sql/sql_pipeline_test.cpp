@@ -413,6 +413,46 @@ TEST_F(SQLPipelineTest, GetTimes) {
   EXPECT_GT(sql_pipeline.execution_time_microseconds().count(), 0);
 }
 
+TEST_F(SQLPipelineTest, Explain) {
+  auto sql_pipeline = SQLPipelineBuilder{"EXPLAIN " + _join_query}.create_pipeline();
+  EXPECT_EQ(sql_pipeline.explain_mode(), ExplainMode::Explain);
+  EXPECT_EQ(sql_pipeline.get_sql_strings().front(), _join_query);
+
+  const auto table = sql_pipeline.get_result_table();
+  ASSERT_GT(table->row_count(), 1u);
+  EXPECT_EQ(table->column_name(ColumnID{3}), "actual_rows");
+
+  // The statement was not executed
+  const auto& root = sql_pipeline.get_query_plans().front()->tree_roots().front();
+  EXPECT_EQ(root->get_output(), nullptr);
+  EXPECT_TRUE(variant_is_null((*table->get_chunk(ChunkID{0})->get_column(ColumnID{3}))[0]));
+}
+
+TEST_F(SQLPipelineTest, ExplainAnalyze) {
+  auto sql_pipeline = SQLPipelineBuilder{"explain  analyze\n" + _join_query}.create_pipeline();
+  EXPECT_EQ(sql_pipeline.explain_mode(), ExplainMode::ExplainAnalyze);
+
+  const auto table = sql_pipeline.get_result_table();
+  ASSERT_GT(table->row_count(), 1u);
+
+  // The first row is the root operator, which returned the result of the statement
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{3}, 0u), static_cast<int64_t>(_join_result->row_count()));
+  EXPECT_GE(table->get_value<int64_t>(ColumnID{4}, 0u), 0);
+}
+
+TEST_F(SQLPipelineTest, ExplainMultipleStatements) {
+  EXPECT_THROW(SQLPipelineBuilder{"EXPLAIN " + _multi_statement_query}.create_pipeline(), std::exception);
+}
+
+TEST_F(SQLPipelineTest, MetaTable) {
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT table_name FROM meta_tables WHERE table_name = 'table_b'"}
+                          .create_pipeline();
+
+  const auto table = sql_pipeline.get_result_table();
+  ASSERT_EQ(table->row_count(), 1u);
+  EXPECT_EQ(table->get_value<std::string>(ColumnID{0}, 0u), "table_b");
+}
+
 TEST_F(SQLPipelineTest, RequiresExecutionVariations) {
   EXPECT_FALSE(SQLPipelineBuilder{_select_query_a}.create_pipeline().requires_execution());
   EXPECT_FALSE(SQLPipelineBuilder{_join_query}.create_pipeline().requires_execution());
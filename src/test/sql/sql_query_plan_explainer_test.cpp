@@ -0,0 +1,86 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/union_all.hpp"
+#include "sql/sql_query_plan.hpp"
+#include "sql/sql_query_plan_explainer.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class SQLQueryPlanExplainerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Two chunks
+    StorageManager::get().add_table("table_a", load_table("src/test/tables/int_float.tbl", 2));
+
+    _get_table = std::make_shared<GetTable>("table_a");
+    _get_table->set_excluded_chunk_ids({ChunkID{1}});
+    _table_scan = std::make_shared<TableScan>(_get_table, ColumnID{0}, PredicateCondition::GreaterThan, 200);
+
+    _query_plan.add_tree_by_root(_table_scan);
+  }
+
+  std::shared_ptr<GetTable> _get_table;
+  std::shared_ptr<TableScan> _table_scan;
+  SQLQueryPlan _query_plan;
+};
+
+TEST_F(SQLQueryPlanExplainerTest, NotExecuted) {
+  const auto explained = SQLQueryPlanExplainer::explain(_query_plan);
+
+  ASSERT_EQ(explained->row_count(), 2u);
+  EXPECT_EQ(explained->column_name(ColumnID{1}), "operator");
+  const auto table_scan_description = _table_scan->description(DescriptionMode::SingleLine);
+  const auto get_table_description = _get_table->description(DescriptionMode::SingleLine);
+  EXPECT_EQ(explained->get_value<std::string>(ColumnID{1}, 0u), table_scan_description);
+  EXPECT_EQ(explained->get_value<std::string>(ColumnID{1}, 1u), "  " + get_table_description);
+
+  // Without statistics and without execution, only the description is known
+  for (auto column_id = ColumnID{2}; column_id < explained->column_count(); ++column_id) {
+    EXPECT_TRUE(variant_is_null((*explained->get_chunk(ChunkID{0})->get_column(column_id))[0]));
+  }
+}
+
+TEST_F(SQLQueryPlanExplainerTest, Executed) {
+  _get_table->execute();
+  _table_scan->execute();
+
+  const auto explained = SQLQueryPlanExplainer::explain(_query_plan);
+  ASSERT_EQ(explained->row_count(), 2u);
+
+  // The TableScan only sees the first chunk, which contains one matching row
+  EXPECT_EQ(explained->get_value<int64_t>(ColumnID{3}, 0u), 1);
+  EXPECT_EQ(explained->get_value<int64_t>(ColumnID{3}, 1u), 2);
+  EXPECT_GT(explained->get_value<int64_t>(ColumnID{5}, 0u), 0);
+
+  // GetTable pruned the second chunk
+  EXPECT_EQ(explained->get_value<int64_t>(ColumnID{6}, 1u), 1);
+  EXPECT_EQ(explained->get_value<int64_t>(ColumnID{7}, 1u), 1);
+
+  // The TableScan scanned its only input chunk in one JobTask
+  EXPECT_EQ(explained->get_value<int64_t>(ColumnID{6}, 0u), 1);
+  EXPECT_EQ(explained->get_value<int64_t>(ColumnID{7}, 0u), 0);
+  EXPECT_EQ(explained->get_value<int64_t>(ColumnID{8}, 0u), 1);
+  EXPECT_EQ(explained->get_value<int64_t>(ColumnID{8}, 1u), 0);
+}
+
+TEST_F(SQLQueryPlanExplainerTest, SharedInputsAreListedOnce) {
+  auto query_plan = SQLQueryPlan{};
+  query_plan.add_tree_by_root(std::make_shared<UnionAll>(_table_scan, _table_scan));
+
+  const auto explained = SQLQueryPlanExplainer::explain(query_plan);
+
+  ASSERT_EQ(explained->row_count(), 3u);
+  EXPECT_EQ(explained->get_value<int32_t>(ColumnID{0}, 2u), 2);
+  const auto get_table_description = _get_table->description(DescriptionMode::SingleLine);
+  EXPECT_EQ(explained->get_value<std::string>(ColumnID{1}, 2u), "    " + get_table_description);
+}
+
+}  // namespace opossum
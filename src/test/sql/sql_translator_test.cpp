@@ -9,6 +9,7 @@
 #include "gtest/gtest.h"
 
 #include "constant_mappings.hpp"
+#include "logical_type.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/create_view_node.hpp"
@@ -141,6 +142,64 @@ TEST_F(SQLTranslatorTest, ExpressionStringTest) {
   EXPECT_LQP_EQ(projection_node, result_node);
 }
 
+TEST_F(SQLTranslatorTest, LogicalTypeLiterals) {
+  StorageManager::get().add_table("date_decimal", load_table("src/test/tables/date_decimal.tbl", 2));
+
+  const auto query = "SELECT * FROM date_decimal WHERE shipdate BETWEEN '1995-01-01' AND '1995-12-31' AND price > 0.5";
+  const auto result_node = compile_query(query);
+
+  const auto stored_table_node = StoredTableNode::make("date_decimal");
+  const auto shipdate = stored_table_node->get_column("shipdate"s);
+  const auto price = stored_table_node->get_column("price"s);
+
+  auto projection_node = ProjectionNode::make_pass_through(PredicateNode::make(
+      price, PredicateCondition::GreaterThan, int64_t{50},
+      PredicateNode::make(shipdate, PredicateCondition::Between, date_to_days("1995-01-01"),
+                          date_to_days("1995-12-31"), stored_table_node)));
+
+  EXPECT_LQP_EQ(projection_node, result_node);
+}
+
+TEST_F(SQLTranslatorTest, LogicalTypeLiteralsWithMoreDecimalPlaces) {
+  StorageManager::get().add_table("date_decimal", load_table("src/test/tables/date_decimal.tbl", 2));
+
+  const auto stored_table_node = StoredTableNode::make("date_decimal");
+  const auto price = stored_table_node->get_column("price"s);
+
+  // The predicates are adjusted so that they select the same rows as the comparison with the exact literal
+  const auto expect_predicate = [&](const std::string& query, const PredicateCondition predicate_condition,
+                                    const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2) {
+    const auto expected_lqp = ProjectionNode::make_pass_through(
+        PredicateNode::make(price, predicate_condition, value, value2, stored_table_node));
+    EXPECT_LQP_EQ(expected_lqp, compile_query(query));
+  };
+
+  expect_predicate("SELECT * FROM date_decimal WHERE price < 0.555", PredicateCondition::LessThanEquals, int64_t{55},
+                   std::nullopt);
+  expect_predicate("SELECT * FROM date_decimal WHERE price > 0.555", PredicateCondition::GreaterThanEquals,
+                   int64_t{56}, std::nullopt);
+  expect_predicate("SELECT * FROM date_decimal WHERE price = 0.555", PredicateCondition::Between, int64_t{56},
+                   int64_t{55});
+  expect_predicate("SELECT * FROM date_decimal WHERE price != 0.555", PredicateCondition::IsNotNull, NULL_VALUE,
+                   std::nullopt);
+  expect_predicate("SELECT * FROM date_decimal WHERE price BETWEEN 0.555 AND 1.005", PredicateCondition::Between,
+                   int64_t{56}, int64_t{100});
+}
+
+TEST_F(SQLTranslatorTest, InsertLogicalTypeValues) {
+  StorageManager::get().add_table("date_decimal", load_table("src/test/tables/date_decimal.tbl", 2));
+
+  const auto expected_projection = std::vector<std::shared_ptr<LQPExpression>>{
+      LQPExpression::create_literal(5), LQPExpression::create_literal(date_to_days("1998-12-01")),
+      LQPExpression::create_literal(int64_t{1050})};
+  const auto expected_lqp =
+      InsertNode::make("date_decimal", ProjectionNode::make(expected_projection, DummyTableNode::make()));
+
+  EXPECT_LQP_EQ(expected_lqp, compile_query("INSERT INTO date_decimal VALUES (5, '1998-12-01', 10.5);"));
+  EXPECT_LQP_EQ(expected_lqp,
+                compile_query("INSERT INTO date_decimal (price, id, shipdate) VALUES (10.5, 5, '1998-12-01');"));
+}
+
 TEST_F(SQLTranslatorTest, SelectWithAndCondition) {
   const auto query = "SELECT * FROM table_a WHERE a >= 1234 AND b < 457.9";
   const auto result_node = compile_query(query);
@@ -213,6 +272,20 @@ TEST_F(SQLTranslatorTest, AggregateWithExpression) {
   EXPECT_FALSE(stored_table_node->right_input());
 }
 
+TEST_F(SQLTranslatorTest, SelectDistinct) {
+  const auto query = "SELECT DISTINCT b FROM table_a;";
+  const auto result_node = compile_query(query);
+
+  // DISTINCT is an aggregation that groups by all selected columns
+  ASSERT_EQ(result_node->type(), LQPNodeType::Aggregate);
+  const auto aggregate_node = std::static_pointer_cast<AggregateNode>(result_node);
+  EXPECT_EQ(aggregate_node->aggregate_expressions().size(), 0u);
+  EXPECT_EQ(aggregate_node->groupby_column_references(), result_node->left_input()->output_column_references());
+  EXPECT_EQ(aggregate_node->output_column_names(), std::vector<std::string>({"b"}));
+
+  EXPECT_EQ(result_node->left_input()->type(), LQPNodeType::Projection);
+}
+
 TEST_F(SQLTranslatorTest, AggregateWithCountDistinct) {
   const auto query = "SELECT a, COUNT(DISTINCT b) AS s FROM table_a GROUP BY a;";
   const auto result_node = compile_query(query);
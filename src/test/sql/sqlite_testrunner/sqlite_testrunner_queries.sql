@@ -89,6 +89,12 @@ SELECT COUNT(*), SUM(a + b) FROM id_int_int_int_100;
 -- COUNT(DISTINCT)
 SELECT a, COUNT(DISTINCT b) FROM mixed GROUP BY a;
 
+-- DISTINCT and GROUP BY without aggregates
+SELECT DISTINCT a FROM mixed;
+SELECT DISTINCT a, b FROM mixed_null;
+SELECT DISTINCT b + 1 AS b_plus_one FROM mixed;
+SELECT a FROM mixed GROUP BY a;
+
 -- Case insensitivity
 sELEcT Sum(b + b) AS sum_b_b from mixed;
 
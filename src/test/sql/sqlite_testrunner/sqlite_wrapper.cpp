@@ -39,9 +39,10 @@ void SQLiteWrapper::create_table_from_tbl(const std::string& file, const std::st
     std::string actual_type = _split<std::string>(type, '_')[0];
     if (actual_type == "int" || actual_type == "long") {
       col_types.push_back("INT");
-    } else if (actual_type == "float" || actual_type == "double") {
+    } else if (actual_type == "float" || actual_type == "double" || actual_type.compare(0, 8, "decimal(") == 0) {
       col_types.push_back("REAL");
-    } else if (actual_type == "string") {
+    } else if (actual_type == "string" || actual_type == "date") {
+      // SQLite has no DATE type. Dates in the format YYYY-MM-DD compare like strings, though.
       col_types.push_back("TEXT");
     } else {
       DebugAssert(false, "SQLiteWrapper: column type " + type + " not supported.");
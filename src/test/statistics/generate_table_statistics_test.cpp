@@ -21,7 +21,8 @@ TEST_F(GenerateTableStatisticsTest, GenerateTableStatisticsUnsampled) {
   EXPECT_STRING_COLUMN_STATISTICS(table_statistics.column_statistics().at(1), 0.0f, 150, "Customer#000000001",
                                   "Customer#000000150");
   EXPECT_INT32_COLUMN_STATISTICS(table_statistics.column_statistics().at(3), 0.0f, 25, 0, 24);
-  EXPECT_FLOAT_COLUMN_STATISTICS(table_statistics.column_statistics().at(5), 0.0f, 150, -986.96f, 9983.38f);
+  // c_acctbal is a DECIMAL(15,2), i.e., stored in cents
+  EXPECT_INT64_COLUMN_STATISTICS(table_statistics.column_statistics().at(5), 0.0f, 150, -98696, 998338);
 }
 
 }  // namespace opossum
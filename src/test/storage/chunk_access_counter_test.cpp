@@ -0,0 +1,93 @@
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk.hpp"
+#include "storage/chunk_access_counter.hpp"
+#include "storage/proxy_chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "tasks/chunk_metrics_collection_task.hpp"
+
+namespace opossum {
+
+class ChunkAccessCounterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data,
+                                     Chunk::MAX_SIZE, UseMvcc::Yes);
+
+    const auto alloc = PolymorphicAllocator<Chunk>{};
+    for (auto chunk_index = 0; chunk_index < 3; ++chunk_index) {
+      const auto columns = ChunkColumns{std::make_shared<ValueColumn<int32_t>>(pmr_concurrent_vector<int32_t>{1, 2})};
+      // The last chunk has no access counter
+      _table->append_chunk(columns, alloc, chunk_index < 2 ? std::make_shared<ChunkAccessCounter>(alloc) : nullptr);
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkAccessCounterTest, IncrementFromMultipleThreads) {
+  auto access_counter = ChunkAccessCounter{PolymorphicAllocator<uint64_t>{}};
+
+  // More threads than shards, so that some threads share a shard
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = size_t{0}; thread_index < ChunkAccessCounter::SHARD_COUNT + 4; ++thread_index) {
+    threads.emplace_back([&]() {
+      for (auto increment_index = 0; increment_index < 1000; ++increment_index) {
+        access_counter.increment();
+        access_counter.increment(2);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(access_counter.counter(), (ChunkAccessCounter::SHARD_COUNT + 4) * 3000u);
+}
+
+TEST_F(ChunkAccessCounterTest, History) {
+  auto access_counter = ChunkAccessCounter{PolymorphicAllocator<uint64_t>{}};
+
+  access_counter.process();
+  access_counter.increment(10);
+  access_counter.process();
+  access_counter.increment(5);
+  access_counter.process();
+
+  // The lookback includes the latest sample
+  EXPECT_EQ(access_counter.history_sample(1), 0u);
+  EXPECT_EQ(access_counter.history_sample(2), 5u);
+  EXPECT_EQ(access_counter.history_sample(3), 15u);
+  EXPECT_EQ(access_counter.history_sample(100), 15u);
+}
+
+TEST_F(ChunkAccessCounterTest, AccessesAreSampled) {
+  // About one in ACCESS_SAMPLE_RATE accesses is timed, the chance that none of them is, is negligible
+  for (auto access_index = 0; access_index < 1000; ++access_index) {
+    const auto chunk = _table->get_chunk_with_access_counting(ChunkID{0});
+  }
+
+  EXPECT_GT(_table->get_chunk(ChunkID{0})->access_counter()->counter(), 0u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->access_counter()->counter(), 0u);
+}
+
+TEST_F(ChunkAccessCounterTest, AccessHeatmap) {
+  StorageManager::get().add_table("table", _table);
+
+  ChunkMetricsCollectionTask().execute();
+  _table->get_chunk(ChunkID{0})->access_counter()->increment(10);
+  _table->get_chunk(ChunkID{1})->access_counter()->increment(20);
+  ChunkMetricsCollectionTask().execute();
+  _table->get_chunk(ChunkID{1})->access_counter()->increment(5);
+  ChunkMetricsCollectionTask().execute();
+
+  EXPECT_EQ(_table->access_heatmap(2), (std::vector<uint64_t>{0u, 5u, 0u}));
+  EXPECT_EQ(_table->access_heatmap(3), (std::vector<uint64_t>{10u, 25u, 0u}));
+}
+
+}  // namespace opossum
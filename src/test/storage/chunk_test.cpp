@@ -10,6 +10,7 @@
 #include "../lib/storage/index/group_key/composite_group_key_index.hpp"
 #include "../lib/storage/index/group_key/group_key_index.hpp"
 #include "../lib/types.hpp"
+#include "../lib/utils/numa_memory_resource.hpp"
 
 namespace opossum {
 
@@ -188,4 +189,17 @@ TEST_F(StorageChunkTest, RemoveIndex) {
   EXPECT_EQ(std::find(ind_col_0.cbegin(), ind_col_0.cend(), index_str), ind_col_0.cend());
 }
 
+TEST_F(StorageChunkTest, NodeId) {
+  EXPECT_EQ(c->node_id(), CURRENT_NODE_ID);
+
+  auto memory_resource = NUMAMemoryResource(0, "chunk_test");
+
+  auto columns = ChunkColumns{};
+  columns.push_back(vc_int);
+  auto chunk = std::make_shared<Chunk>(columns);
+  chunk->migrate(&memory_resource);
+
+  EXPECT_EQ(chunk->node_id(), NodeID{0});
+}
+
 }  // namespace opossum
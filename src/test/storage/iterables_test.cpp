@@ -165,6 +165,25 @@ TEST_F(IterablesTest, ReferenceColumnIteratorWithIterators) {
   EXPECT_EQ(sum, 24'825u);
 }
 
+TEST_F(IterablesTest, ReferenceColumnIteratorKeepsReferencedColumns) {
+  auto pos_list = PosList{RowID{ChunkID{0u}, 3u}, RowID{ChunkID{0u}, 1u}};
+
+  auto reference_column =
+      std::make_unique<ReferenceColumn>(table, ColumnID{0u}, std::make_shared<PosList>(std::move(pos_list)));
+
+  auto iterable = ReferenceColumnIterable<int>{*reference_column};
+
+  auto sum = uint32_t{0};
+  iterable.with_iterators(SumUpWithIt{sum});
+
+  const auto column = std::weak_ptr<const BaseColumn>{table->get_chunk(ChunkID{0u})->get_column(ColumnID{0u})};
+  table->get_chunk(ChunkID{0u})->replace_column(ColumnID{0u}, std::make_shared<ValueColumn<int>>());
+
+  ASSERT_EQ(iterable.referenced_columns().size(), 1u);
+  EXPECT_FALSE(column.expired());
+  EXPECT_EQ(iterable.referenced_columns().at(ChunkID{0u}), column.lock());
+}
+
 TEST_F(IterablesTest, ConstantValueIteratorWithIterators) {
   auto iterable = ConstantValueIterable<int>{2u};
 
@@ -107,6 +107,54 @@ TEST_P(MaterializeTest, MaterializeNulls) {
   EXPECT_EQ(expected, nulls);
 }
 
+TEST_P(MaterializeTest, MaterializeRange) {
+  const auto& column = *_data_table_with_nulls->get_chunk(ChunkID(0))->get_column(ColumnID(1));
+  auto values = std::vector<float>{};
+  auto nulls = std::vector<bool>{};
+
+  materialize_values_and_nulls(column, ChunkOffset{0}, ChunkOffset{2}, values, nulls);
+  ASSERT_EQ(values.size(), 2u);
+  EXPECT_FLOAT_EQ(values[0], 458.7f);
+  EXPECT_EQ(nulls, std::vector<bool>({false, true}));
+
+  materialize_values_and_nulls(column, ChunkOffset{1}, ChunkOffset{2}, values, nulls);
+  EXPECT_EQ(values.size(), 1u);
+  EXPECT_EQ(nulls, std::vector<bool>({true}));
+
+  materialize_values_and_nulls(column, ChunkOffset{0}, ChunkOffset{1}, values, nulls);
+  ASSERT_EQ(values.size(), 1u);
+  EXPECT_FLOAT_EQ(values[0], 458.7f);
+  EXPECT_EQ(nulls, std::vector<bool>({false}));
+}
+
+TEST_P(MaterializeTest, MaterializeRangeOfReferences) {
+  const auto& column = *_references_table->get_chunk(ChunkID(0))->get_column(ColumnID(0));
+  auto values = std::vector<int32_t>{};
+  auto nulls = std::vector<bool>{};
+
+  materialize_values_and_nulls(column, ChunkOffset{1}, ChunkOffset{2}, values, nulls);
+  EXPECT_EQ(values, std::vector<int32_t>({123}));
+  EXPECT_EQ(nulls, std::vector<bool>({false}));
+
+  materialize_values_and_nulls(column, ChunkOffset{0}, ChunkOffset{2}, values, nulls);
+  EXPECT_EQ(values, std::vector<int32_t>({12345, 123}));
+  EXPECT_EQ(nulls, std::vector<bool>({false, false}));
+}
+
+TEST_P(MaterializeTest, MaterializePosList) {
+  const auto pos_list = PosList{RowID{ChunkID{1}, 1}, NULL_ROW_ID, RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0},
+                                RowID{ChunkID{0}, 0}};
+  auto values = std::vector<int32_t>{};
+  auto nulls = std::vector<bool>{};
+
+  materialize_values_and_nulls(*_data_table_with_nulls, ColumnID{0}, pos_list, values, nulls);
+  ASSERT_EQ(values.size(), 5u);
+  EXPECT_EQ(nulls, std::vector<bool>({false, true, false, true, false}));
+  EXPECT_EQ(values[0], 1234);
+  EXPECT_EQ(values[2], 12345);
+  EXPECT_EQ(values[4], 12345);
+}
+
 INSTANTIATE_TEST_CASE_P(MaterializeTestInstances, MaterializeTest,
                         ::testing::ValuesIn(std::begin(all_column_encoding_specs),
                                             std::end(all_column_encoding_specs)), );  // NOLINT
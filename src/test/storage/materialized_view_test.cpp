@@ -0,0 +1,268 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class MaterializedViewTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("t", load_table("src/test/tables/int_int_int.tbl", 2));
+    StorageManager::get().add_table("u", load_table("src/test/tables/int_int_int.tbl", 2));
+
+    _t = StoredTableNode::make("t");
+    _t_a = LQPColumnReference{_t, ColumnID{0}};
+    _t_b = LQPColumnReference{_t, ColumnID{1}};
+    _t_c = LQPColumnReference{_t, ColumnID{2}};
+
+    _u = StoredTableNode::make("u");
+    _u_a = LQPColumnReference{_u, ColumnID{0}};
+    _u_b = LQPColumnReference{_u, ColumnID{1}};
+  }
+
+  // SELECT a, SUM(b), COUNT(*), AVG(c) FROM t WHERE c > 9 GROUP BY a
+  std::shared_ptr<AggregateNode> _make_aggregate_lqp() {
+    const auto aggregates = std::vector<std::shared_ptr<LQPExpression>>{
+        LQPExpression::create_aggregate_function(AggregateFunction::Sum, {LQPExpression::create_column(_t_b)}),
+        LQPExpression::create_aggregate_function(AggregateFunction::Count, {LQPExpression::create_select_star()}),
+        LQPExpression::create_aggregate_function(AggregateFunction::Avg, {LQPExpression::create_column(_t_c)})};
+
+    return AggregateNode::make(aggregates, std::vector<LQPColumnReference>{_t_a},
+                               PredicateNode::make(_t_c, PredicateCondition::GreaterThan, 9, ValidateNode::make(_t)));
+  }
+
+  static std::shared_ptr<const Table> _execute(
+      const std::shared_ptr<AbstractLQPNode>& lqp,
+      std::shared_ptr<TransactionContext> transaction_context = TransactionManager::get().new_transaction_context()) {
+    const auto pqp = LQPTranslator{}.translate_node(lqp->deep_copy());
+    pqp->set_transaction_context_recursively(transaction_context);
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(pqp));
+    return pqp->get_output();
+  }
+
+  static std::shared_ptr<const Table> _current_rows(const std::shared_ptr<MaterializedView>& view) {
+    return view->rows_at(view->refreshed_commit_id());
+  }
+
+  static void _insert(const std::string& table_name, const std::vector<AllTypeVariant>& values) {
+    const auto rows = std::make_shared<Table>(StorageManager::get().get_table(table_name)->column_definitions(),
+                                              TableType::Data);
+    rows->append(values);
+    const auto table_wrapper = std::make_shared<TableWrapper>(rows);
+    table_wrapper->execute();
+
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+    const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    transaction_context->commit();
+  }
+
+  static void _delete(const std::string& table_name, const ColumnID column_id, const AllTypeVariant& value) {
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+
+    const auto get_table = std::make_shared<GetTable>(table_name);
+    const auto validate = std::make_shared<Validate>(get_table);
+    const auto table_scan = std::make_shared<TableScan>(validate, column_id, PredicateCondition::Equals, value);
+    const auto delete_op = std::make_shared<Delete>(table_name, table_scan);
+    delete_op->set_transaction_context_recursively(transaction_context);
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(delete_op));
+    transaction_context->commit();
+  }
+
+  std::shared_ptr<StoredTableNode> _t, _u;
+  LQPColumnReference _t_a, _t_b, _t_c, _u_a, _u_b;
+};
+
+TEST_F(MaterializedViewTest, MaintainsAggregationIncrementally) {
+  const auto lqp = _make_aggregate_lqp();
+  const auto view = std::make_shared<MaterializedView>(lqp);
+
+  EXPECT_TRUE(view->is_incrementally_maintained());
+  EXPECT_TABLE_EQ_UNORDERED(_current_rows(view), _execute(lqp));
+
+  _insert("t", {9, 5, 12});
+  _insert("t", {12, 7, 10});
+  view->refresh();
+  EXPECT_TABLE_EQ_UNORDERED(_current_rows(view), _execute(lqp));
+
+  // Deleting all rows of a group removes the group
+  _delete("t", ColumnID{0}, 11);
+  _delete("t", ColumnID{2}, 12);
+  view->refresh();
+  EXPECT_TABLE_EQ_UNORDERED(_current_rows(view), _execute(lqp));
+  EXPECT_EQ(_current_rows(view)->row_count(), 3u);
+}
+
+TEST_F(MaterializedViewTest, MaintainsOperationsAboveAggregation) {
+  const auto aggregate_node = _make_aggregate_lqp();
+
+  // ... HAVING COUNT(*) > 1
+  const auto count_star = aggregate_node->output_column_references()[2];
+  const auto lqp = PredicateNode::make(count_star, PredicateCondition::GreaterThan, int64_t{1}, aggregate_node);
+  const auto view = std::make_shared<MaterializedView>(lqp);
+
+  EXPECT_TRUE(view->is_incrementally_maintained());
+  EXPECT_EQ(_current_rows(view)->row_count(), 0u);
+
+  _insert("t", {10, 1, 10});
+  view->refresh();
+  EXPECT_TABLE_EQ_UNORDERED(_current_rows(view), _execute(lqp));
+  EXPECT_EQ(_current_rows(view)->row_count(), 1u);
+}
+
+TEST_F(MaterializedViewTest, MaintainsJoinIncrementally) {
+  // SELECT * FROM t, u WHERE t.a = u.b AND u.a > 9
+  const auto lqp = PredicateNode::make(
+      _u_a, PredicateCondition::GreaterThan, 9,
+      JoinNode::make(JoinMode::Inner, LQPColumnReferencePair{_t_a, _u_b}, PredicateCondition::Equals,
+                     ValidateNode::make(_t), ValidateNode::make(_u)));
+  const auto view = std::make_shared<MaterializedView>(lqp);
+
+  EXPECT_TRUE(view->is_incrementally_maintained());
+  EXPECT_TABLE_EQ_UNORDERED(_current_rows(view), _execute(lqp));
+
+  // Changes in both inputs of the join, some of them matching each other
+  _insert("t", {10, 1, 2});
+  _insert("u", {20, 10, 0});
+  _insert("u", {21, 9, 0});
+  _delete("u", ColumnID{0}, 10);
+  view->refresh();
+  EXPECT_TABLE_EQ_UNORDERED(_current_rows(view), _execute(lqp));
+
+  _delete("t", ColumnID{0}, 10);
+  view->refresh();
+  EXPECT_TABLE_EQ_UNORDERED(_current_rows(view), _execute(lqp));
+}
+
+TEST_F(MaterializedViewTest, RecomputesUnsupportedAggregates) {
+  const auto aggregates = std::vector<std::shared_ptr<LQPExpression>>{
+      LQPExpression::create_aggregate_function(AggregateFunction::Max, {LQPExpression::create_column(_t_c)})};
+  const auto lqp = AggregateNode::make(aggregates, std::vector<LQPColumnReference>{_t_a}, ValidateNode::make(_t));
+  const auto view = std::make_shared<MaterializedView>(lqp);
+
+  EXPECT_FALSE(view->is_incrementally_maintained());
+  EXPECT_TABLE_EQ_UNORDERED(_current_rows(view), _execute(lqp));
+
+  _delete("t", ColumnID{2}, 11);
+  view->refresh();
+  EXPECT_TABLE_EQ_UNORDERED(_current_rows(view), _execute(lqp));
+}
+
+TEST_F(MaterializedViewTest, RefreshWithoutChangesKeepsTable) {
+  const auto view = std::make_shared<MaterializedView>(_make_aggregate_lqp());
+  const auto chunk_count = view->table()->chunk_count();
+
+  // Modifications of other tables are ignored
+  _insert("u", {1, 2, 3});
+  view->refresh();
+
+  EXPECT_EQ(view->table()->chunk_count(), chunk_count);
+  EXPECT_EQ(view->refreshed_commit_id(), TransactionManager::get().last_commit_id());
+}
+
+TEST_F(MaterializedViewTest, WritesOnlyChangedRows) {
+  const auto lqp = _make_aggregate_lqp();
+  const auto view = std::make_shared<MaterializedView>(lqp);
+  const auto row_count = view->table()->row_count();
+  const auto chunk_count = view->table()->chunk_count();
+
+  // Only the group of a = 12 changes: its old row is invalidated and its new row appended to the last chunk
+  _insert("t", {12, 7, 10});
+  view->refresh();
+
+  EXPECT_EQ(view->table()->row_count(), row_count + 1);
+  EXPECT_EQ(view->table()->chunk_count(), chunk_count);
+  EXPECT_TABLE_EQ_UNORDERED(_current_rows(view), _execute(lqp));
+}
+
+TEST_F(MaterializedViewTest, KeepsVersionsForOlderSnapshots) {
+  const auto lqp = _make_aggregate_lqp();
+  const auto view = std::make_shared<MaterializedView>(lqp);
+  const auto old_transaction_context = TransactionManager::get().new_transaction_context();
+  const auto old_commit_id = old_transaction_context->snapshot_commit_id();
+
+  _insert("t", {9, 5, 12});
+  view->refresh();
+
+  // The old version of the view is still visible at the old snapshot, but the view cannot be refreshed to it anymore
+  EXPECT_TABLE_EQ_UNORDERED(view->rows_at(old_commit_id), _execute(lqp, old_transaction_context));
+  EXPECT_FALSE(view->refresh(old_commit_id));
+  EXPECT_TRUE(view->refresh(view->refreshed_commit_id()));
+
+  // Refreshing to a snapshot between the last refresh and the last commit
+  const auto intermediate_transaction_context = TransactionManager::get().new_transaction_context();
+  _insert("t", {9, 3, 10});
+  EXPECT_TRUE(view->refresh(intermediate_transaction_context->snapshot_commit_id()));
+  EXPECT_TABLE_EQ_UNORDERED(view->rows_at(intermediate_transaction_context->snapshot_commit_id()),
+                            _execute(lqp, intermediate_transaction_context));
+}
+
+TEST_F(MaterializedViewTest, CompactsAndReclaimsChunks) {
+  const auto lqp = ValidateNode::make(_t);
+  const auto view = std::make_shared<MaterializedView>(lqp, 2u);
+  StorageManager::get().add_materialized_view("v", view);
+  const auto table = view->table();
+  ASSERT_EQ(table->chunk_count(), 2u);
+
+  auto old_transaction_context = TransactionManager::get().new_transaction_context();
+  const auto old_rows = _execute(lqp, old_transaction_context);
+
+  // The row (9, 10, 9) is the first row of the first chunk. The other row of the chunk is moved to a new chunk.
+  _delete("t", ColumnID{2}, 9);
+  view->refresh();
+  ASSERT_EQ(table->chunk_count(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 1u);
+  EXPECT_TABLE_EQ_UNORDERED(_current_rows(view), _execute(lqp));
+
+  // The first chunk is still visible to the old transaction
+  EXPECT_TABLE_EQ_UNORDERED(view->rows_at(old_transaction_context->snapshot_commit_id()), old_rows);
+  old_transaction_context->commit();
+  old_transaction_context = nullptr;
+
+  // Once no one sees the rows of the first chunk anymore, the next refresh reclaims it. New rows fill the last chunk.
+  _insert("t", {12, 12, 12});
+  view->refresh();
+  EXPECT_EQ(table->chunk_count(), 3u);
+  const auto column = table->get_chunk(ChunkID{0})->get_column(ColumnID{0});
+  EXPECT_EQ(std::dynamic_pointer_cast<const ValueColumn<int32_t>>(column), nullptr);
+  EXPECT_TABLE_EQ_UNORDERED(_current_rows(view), _execute(lqp));
+}
+
+TEST_F(MaterializedViewTest, IsRefreshedWhenRead) {
+  StorageManager::get().add_materialized_view("v", std::make_shared<MaterializedView>(_make_aggregate_lqp()));
+  EXPECT_TRUE(StorageManager::get().has_table("v"));
+
+  _insert("t", {42, 1, 10});
+
+  const auto get_table = std::make_shared<GetTable>("v");
+  get_table->execute();
+  EXPECT_EQ(get_table->get_output()->row_count(), 4u);
+  EXPECT_TABLE_EQ_UNORDERED(get_table->get_output(), _current_rows(StorageManager::get().get_materialized_view("v")));
+}
+
+}  // namespace opossum
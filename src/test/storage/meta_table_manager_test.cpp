@@ -0,0 +1,154 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/meta_table_node.hpp"
+#include "operators/get_meta_table.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "sql/sql_query_cache.hpp"
+#include "sql/sql_query_plan.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/meta_table_manager.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class MetaTableManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The first chunk is dictionary-encoded and immutable, the second one is mutable
+    _table = load_table("src/test/tables/int_float.tbl", 2);
+    ChunkEncoder::encode_chunks(_table, {ChunkID{0}});
+    StorageManager::get().add_table("table_a", _table);
+
+    SQLQueryCache<SQLQueryPlan>::get().clear();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(MetaTableManagerTest, TableNames) {
+  const auto expected_names = std::vector<std::string>{"meta_chunks",    "meta_columns",   "meta_plan_cache",
+                                                       "meta_scheduler", "meta_tables",    "meta_transactions"};
+  EXPECT_EQ(MetaTableManager::table_names(), expected_names);
+
+  EXPECT_TRUE(MetaTableManager::is_meta_table_name("meta_tables"));
+  EXPECT_FALSE(MetaTableManager::is_meta_table_name("meta_table_a"));
+  EXPECT_FALSE(MetaTableManager::is_meta_table_name("table_a"));
+  EXPECT_THROW(MetaTableManager::generate_table("table_a"), std::exception);
+}
+
+TEST_F(MetaTableManagerTest, Tables) {
+  const auto table = MetaTableManager::generate_table("meta_tables");
+
+  ASSERT_EQ(table->row_count(), 1u);
+  EXPECT_EQ(table->get_value<std::string>(ColumnID{0}, 0u), "table_a");
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{1}, 0u), 2);
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{2}, 0u), 3);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{3}, 0u), 2);
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{4}, 0u), 2);
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{5}, 0u), static_cast<int64_t>(_table->estimate_memory_usage()));
+}
+
+TEST_F(MetaTableManagerTest, Chunks) {
+  const auto table = MetaTableManager::generate_table("meta_chunks");
+
+  ASSERT_EQ(table->row_count(), 2u);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{1}, 1u), 1);
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{2}, 0u), 2);
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{2}, 1u), 1);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{3}, 0u), 0);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{3}, 1u), 1);
+  // The chunks were not migrated to a NUMA node
+  EXPECT_TRUE(variant_is_null((*table->get_chunk(ChunkID{0})->get_column(ColumnID{4}))[0]));
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{5}, 1u),
+            static_cast<int64_t>(_table->get_chunk(ChunkID{1})->estimate_memory_usage()));
+}
+
+TEST_F(MetaTableManagerTest, Columns) {
+  const auto table = MetaTableManager::generate_table("meta_columns");
+
+  // Two chunks with two columns each
+  ASSERT_EQ(table->row_count(), 4u);
+
+  EXPECT_EQ(table->get_value<std::string>(ColumnID{3}, 1u), "b");
+  EXPECT_EQ(table->get_value<std::string>(ColumnID{4}, 1u), "float");
+  EXPECT_EQ(table->get_value<std::string>(ColumnID{5}, 0u), "Dictionary");
+  EXPECT_EQ(table->get_value<std::string>(ColumnID{6}, 0u), "FixedSize1ByteAligned");
+  EXPECT_EQ(table->get_value<std::string>(ColumnID{5}, 2u), "Unencoded");
+  EXPECT_TRUE(variant_is_null((*table->get_chunk(ChunkID{0})->get_column(ColumnID{6}))[2]));
+
+  const auto column = _table->get_chunk(ChunkID{1})->get_column(ColumnID{1});
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{7}, 3u), static_cast<int64_t>(column->estimate_memory_usage()));
+}
+
+TEST_F(MetaTableManagerTest, PlanCache) {
+  auto& cache = SQLQueryCache<SQLQueryPlan>::get();
+  cache.try_get("SELECT * FROM table_a");
+  cache.set("SELECT * FROM table_a", SQLQueryPlan{});
+  cache.try_get("SELECT * FROM table_a");
+  cache.try_get("SELECT * FROM table_a");
+
+  const auto table = MetaTableManager::generate_table("meta_plan_cache");
+
+  ASSERT_EQ(table->row_count(), 1u);
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{0}, 0u), static_cast<int64_t>(cache.cache().capacity()));
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{1}, 0u), 1);
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{2}, 0u), 2);
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{3}, 0u), 1);
+}
+
+TEST_F(MetaTableManagerTest, Scheduler) {
+  EXPECT_EQ(MetaTableManager::generate_table("meta_scheduler")->row_count(), 0u);
+
+  // The second node has two workers that share a CPU, as the machine might only have one
+  auto nodes = std::vector<TopologyNode>{};
+  nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{0}}});
+  nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{0}}, TopologyCpu{CpuID{0}}});
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(std::make_shared<Topology>(std::move(nodes), 1)));
+  const auto table = MetaTableManager::generate_table("meta_scheduler");
+
+  ASSERT_EQ(table->row_count(), 2u);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 1u), 1);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{1}, 1u), 2);
+}
+
+TEST_F(MetaTableManagerTest, Transactions) {
+  auto context_a = TransactionManager::get().new_transaction_context();
+  auto context_b = TransactionManager::get().new_transaction_context();
+  context_a->commit();
+
+  const auto table = MetaTableManager::generate_table("meta_transactions");
+
+  ASSERT_EQ(table->row_count(), 1u);
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{0}, 0u), static_cast<int64_t>(context_b->transaction_id()));
+  EXPECT_EQ(table->get_value<std::string>(ColumnID{2}, 0u), "Active");
+
+  context_b = nullptr;
+  EXPECT_EQ(MetaTableManager::generate_table("meta_transactions")->row_count(), 0u);
+}
+
+TEST_F(MetaTableManagerTest, GeneratedOnEveryExecution) {
+  const auto meta_table_node = MetaTableNode::make("meta_tables");
+  EXPECT_EQ(meta_table_node->output_column_names().front(), "table_name");
+
+  const auto get_meta_table = std::dynamic_pointer_cast<GetMetaTable>(LQPTranslator{}.translate_node(meta_table_node));
+  ASSERT_NE(get_meta_table, nullptr);
+
+  // The operator of a cached query plan sees tables that were added after the plan was created
+  StorageManager::get().add_table("table_b", load_table("src/test/tables/int_float.tbl", 2));
+  get_meta_table->execute();
+  EXPECT_EQ(get_meta_table->get_output()->row_count(), 2u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,158 @@
+// With NUMA support, the nodes are those of the NUMAPlacementManager, which depend on the machine
+#if !HYRISE_NUMA_SUPPORT
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/table_placement.hpp"
+
+namespace opossum {
+
+class TablePlacementTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Two nodes that share a CPU, as the machine might only have one
+    auto nodes = std::vector<TopologyNode>{};
+    nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{0}}});
+    nodes.emplace_back(std::vector<TopologyCpu>{TopologyCpu{CpuID{0}}});
+    CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(std::make_shared<Topology>(std::move(nodes), 1)));
+
+    // The first chunk is immutable, the second one is mutable
+    _table = load_table("src/test/tables/int_int_int.tbl", 2);
+    ChunkEncoder::encode_chunks(_table, {ChunkID{0}});
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TablePlacementTest, Local) {
+  StorageManager::get().add_table("table", _table);
+
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->node_id(), CURRENT_NODE_ID);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->node_id(), CURRENT_NODE_ID);
+  EXPECT_EQ(TablePlacement::local_table(_table), _table);
+}
+
+TEST_F(TablePlacementTest, Interleaved) {
+  _table->set_placement_policy(PlacementPolicy::Interleaved);
+  StorageManager::get().add_table("table", _table);
+
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->node_id(), NodeID{0});
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->node_id(), NodeID{1});
+  EXPECT_EQ(TablePlacement::local_table(_table), _table);
+}
+
+TEST_F(TablePlacementTest, Replicated) {
+  _table->set_placement_policy(PlacementPolicy::Replicated);
+  StorageManager::get().add_table("table", _table);
+
+  const auto replica_0 = TablePlacement::replica_for_node(_table, NodeID{0});
+  const auto replica_1 = TablePlacement::replica_for_node(_table, NodeID{1});
+
+  EXPECT_EQ(replica_0->origin_table(), _table);
+  EXPECT_TABLE_EQ_ORDERED(replica_0, _table);
+  EXPECT_TABLE_EQ_ORDERED(replica_1, _table);
+
+  // Only the immutable chunk is replicated
+  EXPECT_EQ(replica_0->get_chunk(ChunkID{0})->node_id(), NodeID{0});
+  EXPECT_EQ(replica_1->get_chunk(ChunkID{0})->node_id(), NodeID{1});
+  EXPECT_EQ(replica_1->get_chunk(ChunkID{1}), _table->get_chunk(ChunkID{1}));
+  EXPECT_EQ(replica_1->get_chunk(ChunkID{0})->get_allocator().resource(), TablePlacement::memory_resource(NodeID{1}));
+
+  // Replicas are created once, the table of the replicas is cached. Mutable chunks are replicated once they are
+  // encoded.
+  EXPECT_EQ(TablePlacement::replica_for_node(_table, NodeID{1}), replica_1);
+
+  ChunkEncoder::encode_chunks(_table, {ChunkID{1}});
+  const auto replica_1_encoded = TablePlacement::replica_for_node(_table, NodeID{1});
+  EXPECT_NE(replica_1_encoded, replica_1);
+  EXPECT_EQ(replica_1_encoded->get_chunk(ChunkID{0}), replica_1->get_chunk(ChunkID{0}));
+  EXPECT_EQ(replica_1_encoded->get_chunk(ChunkID{1})->node_id(), NodeID{1});
+
+  // Appended chunks show up in the replicas
+  _table->append({4, 5, 6});
+  _table->append({7, 8, 9});
+  const auto replica_1_appended = TablePlacement::replica_for_node(_table, NodeID{1});
+  EXPECT_EQ(replica_1_appended->chunk_count(), 3u);
+  EXPECT_EQ(replica_1_appended->get_chunk(ChunkID{2}), _table->get_chunk(ChunkID{2}));
+  EXPECT_EQ(TablePlacement::replica_for_node(_table, NodeID{1}), replica_1_appended);
+}
+
+TEST_F(TablePlacementTest, ReplicatedWithIndex) {
+  _table->set_placement_policy(PlacementPolicy::Replicated);
+  ChunkEncoder::encode_chunks(_table, {ChunkID{1}});
+  _table->create_index<GroupKeyIndex>({ColumnID{0}});
+  StorageManager::get().add_table("table", _table);
+
+  // The indices of the chunks are not replicated, the table is read from the original chunks
+  const auto replica = TablePlacement::replica_for_node(_table, NodeID{1});
+  EXPECT_TRUE(replica->get_chunk(ChunkID{0})->get_indices(std::vector<ColumnID>{ColumnID{0}}).empty());
+
+  auto local_table = std::shared_ptr<const Table>{};
+  auto get_local_table = std::make_shared<JobTask>([&]() { local_table = TablePlacement::local_table(_table); });
+  CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{get_local_table});
+  EXPECT_EQ(local_table, _table);
+}
+
+TEST_F(TablePlacementTest, DroppingReleasesReplicatedTable) {
+  _table->set_placement_policy(PlacementPolicy::Replicated);
+  StorageManager::get().add_table("table", _table);
+
+  const auto table = std::weak_ptr<Table>{_table};
+  _table = nullptr;
+
+  StorageManager::get().drop_table("table");
+  EXPECT_TRUE(table.expired());
+}
+
+TEST_F(TablePlacementTest, ReplicasAreReadAndWrittenThroughGetTable) {
+  _table->set_placement_policy(PlacementPolicy::Replicated);
+  StorageManager::get().add_table("table", _table);
+
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  auto get_table = std::make_shared<GetTable>("table");
+  auto validate = std::make_shared<Validate>(get_table);
+  auto delete_op = std::make_shared<Delete>("table", validate);
+
+  delete_op->set_transaction_context_recursively(transaction_context);
+  CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(delete_op));
+
+  // GetTable was executed by a worker, so it read a replica
+  EXPECT_EQ(get_table->get_output()->origin_table(), _table);
+  EXPECT_NE(get_table->get_output()->get_chunk(ChunkID{0})->node_id(), CURRENT_NODE_ID);
+
+  // The rows of the replica are the rows of the table
+  EXPECT_FALSE(delete_op->execute_failed());
+  transaction_context->commit();
+
+  auto validate_context = TransactionManager::get().new_transaction_context();
+  auto get_table_after_delete = std::make_shared<GetTable>("table");
+  get_table_after_delete->execute();
+  auto validate_after_delete = std::make_shared<Validate>(get_table_after_delete);
+  validate_after_delete->set_transaction_context(validate_context);
+  validate_after_delete->execute();
+  EXPECT_EQ(validate_after_delete->get_output()->row_count(), 0u);
+}
+
+}  // namespace opossum
+
+#endif
@@ -0,0 +1,149 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "storage/value_deltas.hpp"
+
+namespace opossum {
+
+class StorageValueDeltasTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/int_int.tbl", 3u);
+    _chunk = _table->get_chunk(ChunkID{0});
+    _value_deltas = _chunk->value_deltas();
+  }
+
+  void add_version(const ColumnID column_id, const ChunkOffset chunk_offset, const AllTypeVariant& value,
+                   const TransactionID transaction_id) {
+    ASSERT_TRUE(_value_deltas->try_start_writing());
+    _value_deltas->add(column_id, chunk_offset, value, transaction_id);
+    _value_deltas->finish_writing();
+  }
+
+  AllTypeVariant visible_value(const TransactionID transaction_id, const CommitID snapshot_commit_id,
+                               const ChunkOffset chunk_offset) {
+    const auto columns = _value_deltas->visible_columns(*_chunk, transaction_id, snapshot_commit_id);
+    if (!columns) return (*_chunk->get_column(ColumnID{1}))[chunk_offset];
+    return (*(*columns)[1])[chunk_offset];
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Chunk> _chunk;
+  std::shared_ptr<ValueDeltas> _value_deltas;
+};
+
+TEST_F(StorageValueDeltasTest, VersionsAreVisibleAfterCommit) {
+  ASSERT_NE(_value_deltas, nullptr);
+  EXPECT_TRUE(_value_deltas->empty());
+
+  add_version(ColumnID{1}, ChunkOffset{0}, 7, TransactionID{1});
+  EXPECT_EQ(_value_deltas->size(), 1u);
+
+  // Uncommitted versions are only visible to their own transaction
+  EXPECT_EQ(visible_value(TransactionID{1}, CommitID{0}, ChunkOffset{0}), AllTypeVariant{7});
+  EXPECT_EQ(visible_value(TransactionID{2}, CommitID{10}, ChunkOffset{0}), AllTypeVariant{1});
+
+  _value_deltas->commit(TransactionID{1}, CommitID{5});
+  EXPECT_EQ(visible_value(TransactionID{2}, CommitID{4}, ChunkOffset{0}), AllTypeVariant{1});
+  EXPECT_EQ(visible_value(TransactionID{2}, CommitID{5}, ChunkOffset{0}), AllTypeVariant{7});
+  EXPECT_EQ(visible_value(TransactionID{2}, CommitID{5}, ChunkOffset{1}), AllTypeVariant{2});
+
+  // Only the columns with visible versions are copied
+  const auto columns = _value_deltas->visible_columns(*_chunk, TransactionID{2}, CommitID{5});
+  ASSERT_TRUE(columns);
+  EXPECT_EQ((*columns)[0], _chunk->get_column(ColumnID{0}));
+  EXPECT_NE((*columns)[1], _chunk->get_column(ColumnID{1}));
+  EXPECT_EQ((*_chunk->get_column(ColumnID{1}))[0], AllTypeVariant{1});
+}
+
+TEST_F(StorageValueDeltasTest, Rollback) {
+  add_version(ColumnID{1}, ChunkOffset{0}, 7, TransactionID{1});
+  _value_deltas->commit(TransactionID{1}, CommitID{1});
+  add_version(ColumnID{1}, ChunkOffset{0}, 8, TransactionID{2});
+
+  _value_deltas->rollback(TransactionID{2});
+  EXPECT_EQ(_value_deltas->size(), 1u);
+  EXPECT_EQ(visible_value(TransactionID{2}, CommitID{1}, ChunkOffset{0}), AllTypeVariant{7});
+}
+
+TEST_F(StorageValueDeltasTest, RowIsWritable) {
+  add_version(ColumnID{1}, ChunkOffset{0}, 7, TransactionID{1});
+
+  EXPECT_TRUE(_value_deltas->row_is_writable(ChunkOffset{0}, TransactionID{1}, CommitID{0}));
+  EXPECT_FALSE(_value_deltas->row_is_writable(ChunkOffset{0}, TransactionID{2}, CommitID{10}));
+  EXPECT_TRUE(_value_deltas->row_is_writable(ChunkOffset{1}, TransactionID{2}, CommitID{10}));
+
+  _value_deltas->commit(TransactionID{1}, CommitID{5});
+
+  EXPECT_FALSE(_value_deltas->row_is_writable(ChunkOffset{0}, TransactionID{2}, CommitID{4}));
+  EXPECT_TRUE(_value_deltas->row_is_writable(ChunkOffset{0}, TransactionID{2}, CommitID{5}));
+}
+
+TEST_F(StorageValueDeltasTest, Merge) {
+  add_version(ColumnID{1}, ChunkOffset{0}, 7, TransactionID{1});
+  add_version(ColumnID{1}, ChunkOffset{0}, 8, TransactionID{1});
+  _value_deltas->commit(TransactionID{1}, CommitID{5});
+  add_version(ColumnID{1}, ChunkOffset{2}, 9, TransactionID{2});
+  _value_deltas->commit(TransactionID{2}, CommitID{6});
+
+  const auto unchanged_column = _chunk->get_column(ColumnID{0});
+  const auto old_column = _chunk->get_column(ColumnID{1});
+
+  EXPECT_EQ(_value_deltas->merge(*_chunk, CommitID{5}), 2u);
+  EXPECT_EQ(_value_deltas->size(), 1u);
+
+  // The newest merged version ends up in the main values
+  EXPECT_EQ((*_chunk->get_column(ColumnID{1}))[0], AllTypeVariant{8});
+  EXPECT_EQ((*_chunk->get_column(ColumnID{1}))[2], AllTypeVariant{3});
+  EXPECT_EQ(visible_value(TransactionID{3}, CommitID{6}, ChunkOffset{2}), AllTypeVariant{9});
+
+  // The merged column is a copy, readers of the old column are not affected. Columns without versions are kept.
+  EXPECT_NE(_chunk->get_column(ColumnID{1}), old_column);
+  EXPECT_EQ((*old_column)[0], AllTypeVariant{1});
+  EXPECT_EQ(_chunk->get_column(ColumnID{0}), unchanged_column);
+}
+
+TEST_F(StorageValueDeltasTest, FreezeExcludesWriters) {
+  // A registered writer prevents freezing
+  ASSERT_TRUE(_value_deltas->try_start_writing());
+  EXPECT_FALSE(_value_deltas->try_freeze());
+  _value_deltas->add(ColumnID{1}, ChunkOffset{0}, 7, TransactionID{1});
+  _value_deltas->finish_writing();
+
+  // So do pending versions
+  EXPECT_FALSE(_value_deltas->try_freeze());
+  _value_deltas->commit(TransactionID{1}, CommitID{1});
+  _value_deltas->merge(*_chunk, CommitID{1});
+
+  EXPECT_TRUE(_value_deltas->try_freeze());
+  EXPECT_TRUE(_value_deltas->try_freeze());
+  EXPECT_FALSE(_value_deltas->try_start_writing());
+
+  _value_deltas->unfreeze();
+  EXPECT_TRUE(_value_deltas->try_start_writing());
+  _value_deltas->finish_writing();
+}
+
+TEST_F(StorageValueDeltasTest, CreateTableWithVisibleValues) {
+  EXPECT_EQ(create_table_with_visible_values(_table, TransactionID{2}, CommitID{5}), _table);
+
+  add_version(ColumnID{1}, ChunkOffset{1}, 7, TransactionID{1});
+  _value_deltas->commit(TransactionID{1}, CommitID{5});
+
+  EXPECT_EQ(create_table_with_visible_values(_table, TransactionID{2}, CommitID{4}), _table);
+
+  const auto table_with_visible_values = create_table_with_visible_values(_table, TransactionID{2}, CommitID{5});
+  EXPECT_NE(table_with_visible_values, _table);
+  EXPECT_EQ(table_with_visible_values->origin_table(), _table);
+  EXPECT_EQ(table_with_visible_values->row_count(), 3u);
+  EXPECT_EQ(table_with_visible_values->get_value<int32_t>(ColumnID{1}, 1u), 7);
+
+  // The MvccColumns are shared, so that Validate and the DML operators work on the copy
+  EXPECT_EQ(table_with_visible_values->get_chunk(ChunkID{0})->value_deltas(), _value_deltas);
+}
+
+}  // namespace opossum
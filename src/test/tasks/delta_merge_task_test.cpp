@@ -0,0 +1,231 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/base_dictionary_column.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/delta_merge_task.hpp"
+
+namespace opossum {
+
+class DeltaMergeTaskTest : public BaseTest {
+ protected:
+  // Deletes the rows with b == 3 from compression_input.tbl, so that chunks 0 and 1 are rebuilt by the next merge
+  void delete_rows() {
+    auto context = TransactionManager::get().new_transaction_context();
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    auto table_scan = std::make_shared<TableScan>(validate, ColumnID{1}, PredicateCondition::Equals, 3);
+    table_scan->execute();
+    auto delete_op = std::make_shared<Delete>("table", table_scan);
+    delete_op->set_transaction_context(context);
+    delete_op->execute();
+    context->commit();
+  }
+
+  std::shared_ptr<const Table> get_visible_rows() {
+    auto context = TransactionManager::get().new_transaction_context();
+
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->set_transaction_context(context);
+    get_table->execute();
+
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+};
+
+TEST_F(DeltaMergeTaskTest, EncodesAndRebuildsChunks) {
+  auto table = load_table("src/test/tables/compression_input.tbl", 4u);
+  StorageManager::get().add_table("table", table);
+
+  // All chunks are full and committed, so they are encoded
+  auto merge_task = std::make_shared<DeltaMergeTask>("table");
+  merge_task->execute();
+  EXPECT_EQ(merge_task->encoded_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}, ChunkID{2}}));
+  EXPECT_TRUE(merge_task->rebuilt_chunk_ids().empty());
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    EXPECT_FALSE(table->get_chunk(chunk_id)->is_mutable());
+  }
+
+  // Deletes the rows with b == 3, i.e., two rows of chunk 0, two rows of chunk 1, and one row of chunk 2
+  auto context = TransactionManager::get().new_transaction_context();
+  auto get_table = std::make_shared<GetTable>("table");
+  get_table->execute();
+  auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(context);
+  validate->execute();
+  auto table_scan = std::make_shared<TableScan>(validate, ColumnID{1}, PredicateCondition::Equals, 3);
+  table_scan->execute();
+  auto delete_op = std::make_shared<Delete>("table", table_scan);
+  delete_op->set_transaction_context(context);
+  delete_op->execute();
+  context->commit();
+
+  const auto rows_before = get_visible_rows();
+
+  // Half of the rows of chunks 0 and 1 are invalid, they are rebuilt into a single new chunk
+  merge_task = std::make_shared<DeltaMergeTask>("table");
+  merge_task->execute();
+  EXPECT_TRUE(merge_task->encoded_chunk_ids().empty());
+  EXPECT_EQ(merge_task->rebuilt_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+  ASSERT_EQ(table->chunk_count(), 4u);
+  EXPECT_EQ(table->get_chunk(ChunkID{3})->size(), 4u);
+  EXPECT_NE(std::dynamic_pointer_cast<const BaseDictionaryColumn>(table->get_chunk(ChunkID{3})->get_column(ColumnID{0})),
+            nullptr);
+
+  EXPECT_TABLE_EQ_UNORDERED(get_visible_rows(), rows_before);
+
+  // Nothing left to do
+  merge_task = std::make_shared<DeltaMergeTask>("table");
+  merge_task->execute();
+  EXPECT_TRUE(merge_task->encoded_chunk_ids().empty());
+  EXPECT_TRUE(merge_task->rebuilt_chunk_ids().empty());
+  EXPECT_EQ(table->chunk_count(), 4u);
+}
+
+TEST_F(DeltaMergeTaskTest, ReclaimsChunksNoTransactionSees) {
+  // Chunks are only reclaimed while no result of a GetTable pins the table
+  StorageManager::get().add_table("table", load_table("src/test/tables/compression_input.tbl", 4u));
+  DeltaMergeTask("table").execute();
+
+  delete_rows();
+
+  // The rows of a copy of the table that are not deleted
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/compression_input.tbl", 4u));
+  table_wrapper->execute();
+  auto expected_rows = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, PredicateCondition::NotEquals, 3);
+  expected_rows->execute();
+
+  auto visible_rows = get_visible_rows();
+
+  // Still sees the rows of chunks 0 and 1 after they were rebuilt
+  auto old_context = TransactionManager::get().new_transaction_context();
+
+  auto merge_task = std::make_shared<DeltaMergeTask>("table");
+  merge_task->execute();
+  EXPECT_EQ(merge_task->rebuilt_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+  EXPECT_TRUE(merge_task->reclaimed_chunk_ids().empty());
+
+  old_context->commit();
+  old_context = nullptr;
+
+  // The result of a finished transaction still references the rows of chunks 0 and 1
+  merge_task = std::make_shared<DeltaMergeTask>("table");
+  merge_task->execute();
+  EXPECT_TRUE(merge_task->reclaimed_chunk_ids().empty());
+  EXPECT_TABLE_EQ_UNORDERED(visible_rows, expected_rows->get_output());
+
+  visible_rows = nullptr;
+
+  merge_task = std::make_shared<DeltaMergeTask>("table");
+  merge_task->execute();
+  EXPECT_EQ(merge_task->reclaimed_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+  {
+    const auto table = StorageManager::get().get_table("table");
+    EXPECT_EQ(table->chunk_count(), 4u);
+    EXPECT_EQ(table->row_count(), 16u);
+    const auto column = table->get_chunk(ChunkID{0})->get_column(ColumnID{0});
+    EXPECT_EQ(std::dynamic_pointer_cast<const BaseDictionaryColumn>(column), nullptr);
+  }
+
+  EXPECT_TABLE_EQ_UNORDERED(get_visible_rows(), expected_rows->get_output());
+
+  // Reclaimed chunks are not reclaimed again
+  merge_task = std::make_shared<DeltaMergeTask>("table");
+  merge_task->execute();
+  EXPECT_TRUE(merge_task->reclaimed_chunk_ids().empty());
+}
+
+TEST_F(DeltaMergeTaskTest, DoesNotReclaimChunksOfPinnedTables) {
+  const auto table = load_table("src/test/tables/compression_input.tbl", 4u);
+  StorageManager::get().add_table("table", table);
+  DeltaMergeTask("table").execute();
+
+  // Holding the table itself does not prevent reclaiming, pinning it does
+  auto pinned_table = Table::pin(table, table);
+
+  delete_rows();
+  auto merge_task = std::make_shared<DeltaMergeTask>("table");
+  merge_task->execute();
+  EXPECT_EQ(merge_task->rebuilt_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+  EXPECT_TRUE(merge_task->reclaimed_chunk_ids().empty());
+
+  pinned_table = nullptr;
+  EXPECT_FALSE(table->is_pinned());
+
+  merge_task = std::make_shared<DeltaMergeTask>("table");
+  merge_task->execute();
+  EXPECT_EQ(merge_task->reclaimed_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+}
+
+TEST_F(DeltaMergeTaskTest, KeepsRowsMaterializedViewsNeed) {
+  StorageManager::get().add_table("table", load_table("src/test/tables/compression_input.tbl", 4u));
+  DeltaMergeTask("table").execute();
+
+  const auto view = std::make_shared<MaterializedView>(ValidateNode::make(StoredTableNode::make("table")));
+  ASSERT_TRUE(view->is_incrementally_maintained());
+  StorageManager::get().add_materialized_view("view", view);
+
+  // The view still needs the rows that were deleted and moved since its last refresh
+  delete_rows();
+  auto merge_task = std::make_shared<DeltaMergeTask>("table");
+  merge_task->execute();
+  EXPECT_EQ(merge_task->rebuilt_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+  EXPECT_TRUE(merge_task->reclaimed_chunk_ids().empty());
+
+  view->refresh();
+  EXPECT_TABLE_EQ_UNORDERED(view->rows_at(view->refreshed_commit_id()), get_visible_rows());
+
+  merge_task = std::make_shared<DeltaMergeTask>("table");
+  merge_task->execute();
+  EXPECT_EQ(merge_task->reclaimed_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+}
+
+TEST_F(DeltaMergeTaskTest, RebuildsDeltaChunksThatAreNotFilledAnymore) {
+  // The first chunk is only partially filled, but the table continues with a new chunk
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String}, {"b", DataType::Int}},
+                                       TableType::Data, 4u, UseMvcc::Yes);
+  table->append({"foo", 7});
+  table->append({"bar", 8});
+  table->append_mutable_chunk();
+  table->append({"baz", 9});
+
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    auto mvcc_columns = table->get_chunk(chunk_id)->mvcc_columns();
+    for (auto& begin_cid : mvcc_columns->begin_cids) begin_cid = 0u;
+  }
+
+  StorageManager::get().add_table("table", table);
+  const auto rows_before = get_visible_rows();
+
+  auto merge_task = std::make_shared<DeltaMergeTask>("table");
+  merge_task->execute();
+  EXPECT_TRUE(merge_task->encoded_chunk_ids().empty());
+  EXPECT_EQ(merge_task->rebuilt_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}}));
+  ASSERT_EQ(table->chunk_count(), 3u);
+  EXPECT_FALSE(table->get_chunk(ChunkID{2})->is_mutable());
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 2u);
+
+  EXPECT_TABLE_EQ_UNORDERED(get_visible_rows(), rows_before);
+}
+
+}  // namespace opossum
@@ -8,10 +8,12 @@
 
 #include "all_type_variant.hpp"
 #include "constant_mappings.hpp"
+#include "logical_type.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "storage/table.hpp"
 #include "storage/value_column.hpp"
+#include "type_cast.hpp"
 
 #define ANSI_COLOR_RED "\x1B[31m"
 #define ANSI_COLOR_GREEN "\x1B[32m"
@@ -25,14 +27,61 @@ namespace {
 
 using Matrix = std::vector<std::vector<opossum::AllTypeVariant>>;
 
-Matrix _table_to_matrix(const std::shared_ptr<const opossum::Table>& table) {
+/**
+ * In TypeCmpMode::Lenient, DATEs are compared as formatted strings and DECIMALs as Doubles, so that they can be
+ * compared to the results of SQLite, which has neither of these types. Otherwise, the logical types have to match and
+ * DATEs and DECIMALs are compared as formatted strings, which is exact for equal logical types.
+ */
+opossum::DataType _comparison_data_type(const opossum::Table& table, const opossum::ColumnID column_id,
+                                        const opossum::TypeCmpMode type_cmp_mode) {
+  if (type_cmp_mode == opossum::TypeCmpMode::Lenient) {
+    switch (table.column_logical_type(column_id).kind) {
+      case opossum::LogicalType::Kind::Date:
+        return opossum::DataType::String;
+      case opossum::LogicalType::Kind::Decimal:
+        return opossum::DataType::Double;
+      case opossum::LogicalType::Kind::None:
+        break;
+    }
+  }
+  return table.column_data_type(column_id);
+}
+
+std::string _column_type_name(const opossum::Table& table, const opossum::ColumnID column_id,
+                              const opossum::TypeCmpMode type_cmp_mode) {
+  const auto& logical_type = table.column_logical_type(column_id);
+  if (type_cmp_mode == opossum::TypeCmpMode::Strict && logical_type.kind != opossum::LogicalType::Kind::None) {
+    return logical_type.name();
+  }
+  return opossum::data_type_to_string.left.at(_comparison_data_type(table, column_id, type_cmp_mode));
+}
+
+opossum::AllTypeVariant _comparison_value(const opossum::LogicalType& logical_type,
+                                          const opossum::AllTypeVariant& value,
+                                          const opossum::TypeCmpMode type_cmp_mode) {
+  if (opossum::variant_is_null(value)) return value;
+
+  switch (logical_type.kind) {
+    case opossum::LogicalType::Kind::Date:
+      return logical_type.format(value);
+    case opossum::LogicalType::Kind::Decimal:
+      if (type_cmp_mode == opossum::TypeCmpMode::Strict) return logical_type.format(value);
+      return static_cast<double>(opossum::type_cast<int64_t>(value)) /
+             static_cast<double>(opossum::decimal_factor(logical_type.scale));
+    case opossum::LogicalType::Kind::None:
+      break;
+  }
+  return value;
+}
+
+Matrix _table_to_matrix(const std::shared_ptr<const opossum::Table>& table, const opossum::TypeCmpMode type_cmp_mode) {
   // initialize matrix with table sizes, including column names/types
   Matrix matrix(table->row_count() + 2, std::vector<opossum::AllTypeVariant>(table->column_count()));
 
   // set column names/types
   for (auto column_id = opossum::ColumnID{0}; column_id < table->column_count(); ++column_id) {
     matrix[0][column_id] = table->column_name(column_id);
-    matrix[1][column_id] = opossum::data_type_to_string.left.at(table->column_data_type(column_id));
+    matrix[1][column_id] = _column_type_name(*table, column_id, type_cmp_mode);
   }
 
   // set values
@@ -45,9 +94,11 @@ Matrix _table_to_matrix(const std::shared_ptr<const opossum::Table>& table) {
 
     for (auto column_id = opossum::ColumnID{0}; column_id < table->column_count(); ++column_id) {
       const auto column = chunk->get_column(column_id);
+      const auto& logical_type = table->column_logical_type(column_id);
 
       for (auto chunk_offset = opossum::ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
-        matrix[row_offset + chunk_offset + 2][column_id] = (*column)[chunk_offset];
+        matrix[row_offset + chunk_offset + 2][column_id] =
+            _comparison_value(logical_type, (*column)[chunk_offset], type_cmp_mode);
       }
     }
     row_offset += chunk->size();
@@ -117,8 +168,8 @@ namespace opossum {
 bool check_table_equal(const std::shared_ptr<const Table>& opossum_table,
                        const std::shared_ptr<const Table>& expected_table, OrderSensitivity order_sensitivity,
                        TypeCmpMode type_cmp_mode, FloatComparisonMode float_comparison_mode) {
-  auto opossum_matrix = _table_to_matrix(opossum_table);
-  auto expected_matrix = _table_to_matrix(expected_table);
+  auto opossum_matrix = _table_to_matrix(opossum_table, type_cmp_mode);
+  auto expected_matrix = _table_to_matrix(expected_table, type_cmp_mode);
 
   const auto print_table_comparison = [&](const std::string& error_type, const std::string& error_msg,
                                           const std::vector<std::pair<uint64_t, uint16_t>>& highlighted_cells = {}) {
@@ -148,8 +199,8 @@ bool check_table_equal(const std::shared_ptr<const Table>& opossum_table,
   //  - column names and types
   DataType left_col_type, right_col_type;
   for (auto column_id = ColumnID{0}; column_id < expected_table->column_count(); ++column_id) {
-    left_col_type = opossum_table->column_data_type(column_id);
-    right_col_type = expected_table->column_data_type(column_id);
+    left_col_type = _comparison_data_type(*opossum_table, column_id, type_cmp_mode);
+    right_col_type = _comparison_data_type(*expected_table, column_id, type_cmp_mode);
     // This is needed for the SQLiteTestrunner, since SQLite does not differentiate between float/double, and int/long.
     if (type_cmp_mode == TypeCmpMode::Lenient) {
       if (left_col_type == DataType::Double) {
@@ -174,11 +225,15 @@ bool check_table_equal(const std::shared_ptr<const Table>& opossum_table,
       return false;
     }
 
-    if (left_col_type != right_col_type) {
+    const auto logical_types_differ =
+        type_cmp_mode == TypeCmpMode::Strict &&
+        opossum_table->column_logical_type(column_id) != expected_table->column_logical_type(column_id);
+
+    if (left_col_type != right_col_type || logical_types_differ) {
       const std::string error_type = "Column type mismatch (column " + std::to_string(column_id) + ")";
       const std::string error_msg =
-          "Actual column type: " + data_type_to_string.left.at(opossum_table->column_data_type(column_id)) + "\n" +
-          "Expected column type: " + data_type_to_string.left.at(expected_table->column_data_type(column_id));
+          "Actual column type: " + _column_type_name(*opossum_table, column_id, type_cmp_mode) + "\n" +
+          "Expected column type: " + _column_type_name(*expected_table, column_id, type_cmp_mode);
 
       print_table_comparison(error_type, error_msg, {{1, column_id}});
       return false;
@@ -216,23 +271,23 @@ bool check_table_equal(const std::shared_ptr<const Table>& opossum_table,
   // Compare each cell, skipping header
   for (auto row_id = size_t{2}; row_id < opossum_matrix.size(); row_id++)
     for (auto column_id = ColumnID{0}; column_id < opossum_matrix[row_id].size(); column_id++) {
+      const auto data_type = _comparison_data_type(*opossum_table, column_id, type_cmp_mode);
       if (variant_is_null(opossum_matrix[row_id][column_id]) || variant_is_null(expected_matrix[row_id][column_id])) {
         highlight_if(!(variant_is_null(opossum_matrix[row_id][column_id]) &&
                        variant_is_null(expected_matrix[row_id][column_id])),
                      row_id, column_id);
-      } else if (opossum_table->column_data_type(column_id) == DataType::Float) {
+      } else if (data_type == DataType::Float) {
         auto left_val = type_cast<float>(opossum_matrix[row_id][column_id]);
         auto right_val = type_cast<float>(expected_matrix[row_id][column_id]);
 
         highlight_if(!almost_equals(left_val, right_val, float_comparison_mode), row_id, column_id);
-      } else if (opossum_table->column_data_type(column_id) == DataType::Double) {
+      } else if (data_type == DataType::Double) {
         auto left_val = type_cast<double>(opossum_matrix[row_id][column_id]);
         auto right_val = type_cast<double>(expected_matrix[row_id][column_id]);
 
         highlight_if(!almost_equals(left_val, right_val, float_comparison_mode), row_id, column_id);
       } else {
-        if (type_cmp_mode == TypeCmpMode::Lenient && (opossum_table->column_data_type(column_id) == DataType::Int ||
-                                                      opossum_table->column_data_type(column_id) == DataType::Long)) {
+        if (type_cmp_mode == TypeCmpMode::Lenient && (data_type == DataType::Int || data_type == DataType::Long)) {
           auto left_val = type_cast<int64_t>(opossum_matrix[row_id][column_id]);
           auto right_val = type_cast<int64_t>(expected_matrix[row_id][column_id]);
           highlight_if(left_val != right_val, row_id, column_id);
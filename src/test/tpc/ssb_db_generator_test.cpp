@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "ssb/ssb_db_generator.hpp"
+#include "storage/table.hpp"
+#include "testing_assert.hpp"
+
+namespace opossum {
+
+TEST(SsbDbGeneratorTest, RowCounts) {
+  const auto scale_factor = 0.001f;
+  const auto tables = SsbDbGenerator(scale_factor, 100).generate();
+
+  EXPECT_EQ(tables.at(SsbTable::Customer)->row_count(), std::floor(30'000 * scale_factor));
+  EXPECT_EQ(tables.at(SsbTable::Supplier)->row_count(), std::floor(2'000 * scale_factor));
+  EXPECT_EQ(tables.at(SsbTable::Part)->row_count(), std::floor(200'000 * scale_factor));
+
+  // Seven years, two of them leap years
+  EXPECT_EQ(tables.at(SsbTable::Date)->row_count(), 7u * 365u + 2u);
+
+  // 1-7 lines per order
+  const auto order_count = std::floor(1'500'000 * scale_factor);
+  EXPECT_GE(tables.at(SsbTable::LineOrder)->row_count(), order_count);
+  EXPECT_LE(tables.at(SsbTable::LineOrder)->row_count(), 7 * order_count);
+  EXPECT_EQ(tables.at(SsbTable::LineOrder)->get_value<int32_t>(ColumnID{0}, 0u), 1);
+}
+
+TEST(SsbDbGeneratorTest, Deterministic) {
+  const auto tables_a = SsbDbGenerator(0.001f, 1000).generate();
+  const auto tables_b = SsbDbGenerator(0.001f, 1000).generate();
+
+  for (const auto& [ssb_table, table] : tables_a) {
+    EXPECT_TABLE_EQ_ORDERED(table, tables_b.at(ssb_table));
+  }
+}
+
+TEST(SsbDbGeneratorTest, TableContents) {
+  const auto tables = SsbDbGenerator(0.001f).generate();
+
+  const auto& date = tables.at(SsbTable::Date);
+  EXPECT_EQ(date->get_value<int32_t>(ColumnID{0}, 0u), 19920101);
+  EXPECT_EQ(date->get_value<std::string>(ColumnID{1}, 0u), "January 1, 1992");
+  EXPECT_EQ(date->get_value<std::string>(ColumnID{2}, 0u), "Wednesday");
+  EXPECT_EQ(date->get_value<std::string>(ColumnID{6}, 0u), "Jan1992");
+  EXPECT_EQ(date->get_value<int32_t>(ColumnID{0}, date->row_count() - 1), 19981231);
+  EXPECT_EQ(date->get_value<std::string>(ColumnID{2}, date->row_count() - 1), "Thursday");
+
+  // The brand determines the category, which determines the manufacturer
+  const auto& part = tables.at(SsbTable::Part);
+  for (auto row = size_t{0}; row < part->row_count(); ++row) {
+    const auto manufacturer = part->get_value<std::string>(ColumnID{2}, row);
+    const auto category = part->get_value<std::string>(ColumnID{3}, row);
+    const auto brand = part->get_value<std::string>(ColumnID{4}, row);
+    EXPECT_EQ(category.substr(0, manufacturer.size()), manufacturer);
+    EXPECT_EQ(brand.substr(0, category.size()), category);
+  }
+
+  // The city is derived from the nation, e.g., UNITED KI1
+  const auto& customer = tables.at(SsbTable::Customer);
+  for (auto row = size_t{0}; row < customer->row_count(); ++row) {
+    const auto city = customer->get_value<std::string>(ColumnID{3}, row);
+    const auto nation = customer->get_value<std::string>(ColumnID{4}, row);
+    ASSERT_EQ(city.size(), 10u);
+    EXPECT_EQ(city.substr(0, std::min(nation.size(), size_t{9})), nation.substr(0, 9));
+  }
+
+  // All order dates are date keys
+  auto date_keys = std::set<int32_t>{};
+  for (auto row = size_t{0}; row < date->row_count(); ++row) {
+    date_keys.insert(date->get_value<int32_t>(ColumnID{0}, row));
+  }
+  const auto& lineorder = tables.at(SsbTable::LineOrder);
+  for (auto row = size_t{0}; row < lineorder->row_count(); ++row) {
+    EXPECT_TRUE(date_keys.count(lineorder->get_value<int32_t>(ColumnID{5}, row)));
+    EXPECT_TRUE(date_keys.count(lineorder->get_value<int32_t>(ColumnID{15}, row)));
+  }
+}
+
+}  // namespace opossum
@@ -1,5 +1,9 @@
 #include "gtest/gtest.h"
 
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/base_encoded_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "testing_assert.hpp"
 #include "tpch/tpch_db_generator.hpp"
@@ -47,6 +51,34 @@ TEST(TpchDbGeneratorTest, TableContents) {
                           load_table("src/test/tables/tpch/sf-0.001/region.tbl", chunk_size));
 }
 
+TEST(TpchDbGeneratorTest, GenerateParallel) {
+  /**
+   * The tables generated in parallel need to be the exact same as the ones generated sequentially. The small chunk
+   * size splits the tables into many ranges.
+   */
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+
+  const auto scale_factor = 0.001f;
+  const auto chunk_size = 100;
+  const auto tables = TpchDbGenerator(scale_factor, chunk_size).generate();
+  const auto parallel_tables =
+      TpchDbGenerator(scale_factor, chunk_size).generate_parallel(ColumnEncodingSpec{EncodingType::Dictionary});
+
+  ASSERT_EQ(parallel_tables.size(), tables.size());
+  for (const auto& [tpch_table, table] : tables) {
+    EXPECT_TABLE_EQ_ORDERED(parallel_tables.at(tpch_table), table);
+  }
+
+  // 150 customers, 4 * 200 partsupps
+  EXPECT_EQ(parallel_tables.at(TpchTable::Customer)->chunk_count(), 2u);
+  EXPECT_EQ(parallel_tables.at(TpchTable::PartSupp)->chunk_count(), 8u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BaseEncodedColumn>(
+      parallel_tables.at(TpchTable::LineItem)->get_chunk(ChunkID{0})->get_column(ColumnID{0})));
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
 TEST(TpchDbGeneratorTest, GenerateAndStore) {
   EXPECT_FALSE(StorageManager::get().has_table("part"));
   EXPECT_FALSE(StorageManager::get().has_table("supplier"));
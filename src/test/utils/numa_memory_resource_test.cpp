@@ -32,6 +32,7 @@ TEST_F(NUMAMemoryResourceTest, BasicAllocate) {
 #endif
 
   auto memory_resource = NUMAMemoryResource(numa_node, "test");
+  EXPECT_EQ(memory_resource.get_node_id(), numa_node);
   const auto alloc = PolymorphicAllocator<size_t>(&memory_resource);
 
   const auto vec = pmr_vector<size_t>(1024, alloc);
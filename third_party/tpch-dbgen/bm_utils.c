@@ -119,7 +119,7 @@ char     *getenv PROTO((const char *name));
 #endif
 void usage();
 long *permute_dist(distribution *d, long stream);
-extern seed_t Seed[];
+extern __thread seed_t Seed[];
 
 /*
  * env_config: look for a environmental variable setting and return its
@@ -444,10 +444,17 @@ tbl_open(int tbl, char *mode)
 void
 agg_str(distribution *set, long count, long col, char *dest)
 {
-	distribution *d;
+	distribution d_copy, *d;
 	int i;
 
-	d = set;
+	/**
+	 * HYRISE: permute a copy of the distribution instead of the distribution itself, so that agg_str() can be
+	 * called concurrently. permute_dist() starts from the identity permutation anyway.
+	 */
+	long permutation[DIST_SIZE(set)];
+	d_copy = *set;
+	d_copy.permute = permutation;
+	d = &d_copy;
 	*dest = '\0';
 
 	permute_dist(d, col);